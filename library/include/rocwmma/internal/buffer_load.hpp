@@ -0,0 +1,287 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BUFFER_LOAD_HPP
+#define ROCWMMA_BUFFER_LOAD_HPP
+
+#include "buffer_resource.hpp"
+#include "cache_policy.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "tuple.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
+        struct amdgcn_buffer_load
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+            static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
+                          "Cannot vectorize input");
+
+            using LoadT    = VecT<DataT, VectorWidth>;
+            using VectorIO
+                = amdgcn_raw_buffer_io<sizeof(LoadT), CachePolicyTraits<CachePolicy>::Bits>;
+            using ScalarIO
+                = amdgcn_raw_buffer_io<sizeof(DataT), CachePolicyTraits<CachePolicy>::Bits>;
+
+            // Byte offsets: voffset is per lane, soffset is wave-uniform
+            ROCWMMA_DEVICE static inline void
+                exec(LoadT& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                auto raw = VectorIO::load(rsrc, voffset, soffset);
+                data     = *reinterpret_cast<LoadT const*>(&raw);
+            }
+
+            // Bounds-checked load of a vector that may straddle the matrix edge.
+            // Elements at or beyond validCount are zero-filled by the hardware
+            // range check, using an out-of-range offset.
+            ROCWMMA_DEVICE static inline void exec(LoadT&      data,
+                                                   BufferRsrcT rsrc,
+                                                   uint32_t    voffset,
+                                                   uint32_t    soffset,
+                                                   uint32_t    validCount)
+            {
+                constexpr uint32_t OobOffset = amdgcn_make_buffer_rsrc::OobOffset;
+
+                if(validCount == 0u || validCount >= VectorWidth)
+                {
+                    exec(data, rsrc, validCount ? voffset : OobOffset, soffset);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        auto offset = (i < validCount) ? voffset + i * sizeof(DataT) : OobOffset;
+                        auto raw    = ScalarIO::load(rsrc, offset, soffset);
+                        data[i]     = *reinterpret_cast<DataT const*>(&raw);
+                    }
+                }
+            }
+        };
+
+    } // namespace detail
+
+    // Buffer IO backend counterpart of OpaqueLoad.
+    // Addresses are a wave-uniform buffer resource, a per-lane 32-bit voffset
+    // computed once, and a wave-uniform soffset that carries the unrolled
+    // strides. This keeps 64-bit address math out of VGPRs and gives hardware
+    // range checking at the end of the buffer.
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
+    struct BufferLoad
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+
+        struct Traits
+        {
+            // Raw IO on unpacked register data.
+            using Loader       = detail::amdgcn_buffer_load<DataT, VectorWidth, CachePolicy>;
+            using LoadT        = typename Loader::LoadT;
+            using OutputT      = VecT<DataT, IOTraits::UnpackedSize>;
+            using MatrixCoordT = Coord2d;
+            using BufferRsrcT  = detail::BufferRsrcT;
+        };
+
+        using LoadVecTraits = VecTraits<typename Traits::LoadT>;
+
+        // Number of in-bounds elements of the vector at coord.
+        // Vectors are contiguous in the minor dimension of the data layout.
+        ROCWMMA_DEVICE static inline uint32_t
+            validCount(typename Traits::MatrixCoordT const& coord,
+                       typename Traits::MatrixCoordT const& extent)
+        {
+            auto major       = get<DataLayout::MajorIndex>(coord);
+            auto minor       = get<DataLayout::MinorIndex>(coord);
+            auto majorExtent = get<DataLayout::MajorIndex>(extent);
+            auto minorExtent = get<DataLayout::MinorIndex>(extent);
+            return (major < majorExtent && minor < minorExtent) ? minorExtent - minor : 0u;
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&                    out,
+                                                       typename Traits::BufferRsrcT rsrc,
+                                                       uint32_t                     voffset,
+                                                       uint32_t                     soffset,
+                                                       uint32_t                     ldm,
+                                                       StrideCounts&&               strideCounts,
+                                                       Strides2d&&                  strides2d)
+        {
+            auto strideOffset
+                = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm) * sizeof(DataT);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Loader::exec(*out, rsrc, voffset, soffset);
+                    soffset += strideOffset;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, rsrc, voffset, soffset, ldm, strideCounts, strides2d);
+                    soffset += strideOffset;
+                }
+            }
+        }
+
+        // Bounds-checked unroll: tracks the matrix coordinate of each vector
+        // alongside its offset.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto
+            unroll_right(Iterator&                            out,
+                         typename Traits::BufferRsrcT         rsrc,
+                         uint32_t                             voffset,
+                         uint32_t                             soffset,
+                         uint32_t                             ldm,
+                         typename Traits::MatrixCoordT        coord,
+                         typename Traits::MatrixCoordT const& extent,
+                         StrideCounts&&                       strideCounts,
+                         Strides2d&&                          strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm) * sizeof(DataT);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Loader::exec(*out, rsrc, voffset, soffset, validCount(coord, extent));
+                    soffset += strideOffset;
+                    coord += stride2d;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, rsrc, voffset, soffset, ldm, coord, extent, strideCounts, strides2d);
+                    soffset += strideOffset;
+                    coord += stride2d;
+                }
+            }
+        }
+
+        // Offset is the wave-uniform element offset of the block in the buffer.
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT&    data,
+                                        typename Traits::BufferRsrcT rsrc,
+                                        uint32_t                     offset,
+                                        uint32_t                     ldm)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<LoadVecTraits::size()>(data).begin();
+
+            // Wave-uniform block offset goes to SGPR
+            auto blockOffset = static_cast<int32_t>(offset * sizeof(DataT));
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Make sure that the IOCount is consistent with the number of total strides
+            static_assert(IOTraits::IOCount
+                              == apply([](auto... items) { return (items * ...); },
+                                       MatrixLayout::strideCounts()),
+                          "IOCount inconsistent with total strides");
+
+            // Unroll loading in each strided dimension
+            unroll_right(it,
+                         rsrc,
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm) * sizeof(DataT),
+                         __builtin_amdgcn_readfirstlane(blockOffset),
+                         ldm,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+
+        // Bounds-checked load. Extent is the (rows, cols) count of valid matrix
+        // elements starting at offset. Out-of-bounds elements are zero-filled.
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT&            data,
+                                        typename Traits::BufferRsrcT         rsrc,
+                                        uint32_t                             offset,
+                                        uint32_t                             ldm,
+                                        typename Traits::MatrixCoordT const& extent)
+        {
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<LoadVecTraits::size()>(data).begin();
+
+            // Wave-uniform block offset goes to SGPR
+            auto blockOffset = static_cast<int32_t>(offset * sizeof(DataT));
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            unroll_right(it,
+                         rsrc,
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm) * sizeof(DataT),
+                         __builtin_amdgcn_readfirstlane(blockOffset),
+                         ldm,
+                         baseOffset2d,
+                         extent,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BUFFER_LOAD_HPP
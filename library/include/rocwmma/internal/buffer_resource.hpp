@@ -0,0 +1,286 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BUFFER_RESOURCE_HPP
+#define ROCWMMA_BUFFER_RESOURCE_HPP
+
+#include "config.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // 128-bit buffer resource descriptor (V#). Wave-uniform, held in SGPRs.
+        using BufferRsrcT = int32_t __attribute__((ext_vector_type(4)));
+
+        using BufferI32x2T = int32_t __attribute__((ext_vector_type(2)));
+        using BufferI32x4T = int32_t __attribute__((ext_vector_type(4)));
+
+        // Raw buffer intrinsics.
+        // Address = base + voffset (per lane) + soffset (wave-uniform) + immediate offset.
+        // Out-of-range loads return zero and out-of-range stores are dropped.
+        ROCWMMA_DEVICE int8_t llvm_amdgcn_raw_buffer_load_i8(BufferRsrcT rsrc,
+                                                             index_t     voffset,
+                                                             index_t     soffset,
+                                                             index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i8");
+
+        ROCWMMA_DEVICE int16_t llvm_amdgcn_raw_buffer_load_i16(BufferRsrcT rsrc,
+                                                               index_t     voffset,
+                                                               index_t     soffset,
+                                                               index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i16");
+
+        ROCWMMA_DEVICE int32_t llvm_amdgcn_raw_buffer_load_i32(BufferRsrcT rsrc,
+                                                               index_t     voffset,
+                                                               index_t     soffset,
+                                                               index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.load.i32");
+
+        ROCWMMA_DEVICE BufferI32x2T llvm_amdgcn_raw_buffer_load_i32x2(BufferRsrcT rsrc,
+                                                                      index_t     voffset,
+                                                                      index_t     soffset,
+                                                                      index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.load.v2i32");
+
+        ROCWMMA_DEVICE BufferI32x4T llvm_amdgcn_raw_buffer_load_i32x4(BufferRsrcT rsrc,
+                                                                      index_t     voffset,
+                                                                      index_t     soffset,
+                                                                      index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.load.v4i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_i8(int8_t      data,
+                                                            BufferRsrcT rsrc,
+                                                            index_t     voffset,
+                                                            index_t     soffset,
+                                                            index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i8");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_i16(int16_t     data,
+                                                             BufferRsrcT rsrc,
+                                                             index_t     voffset,
+                                                             index_t     soffset,
+                                                             index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i16");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_i32(int32_t     data,
+                                                             BufferRsrcT rsrc,
+                                                             index_t     voffset,
+                                                             index_t     soffset,
+                                                             index_t     aux)
+            __asm("llvm.amdgcn.raw.buffer.store.i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_i32x2(BufferI32x2T data,
+                                                               BufferRsrcT  rsrc,
+                                                               index_t      voffset,
+                                                               index_t      soffset,
+                                                               index_t      aux)
+            __asm("llvm.amdgcn.raw.buffer.store.v2i32");
+
+        ROCWMMA_DEVICE void llvm_amdgcn_raw_buffer_store_i32x4(BufferI32x4T data,
+                                                               BufferRsrcT  rsrc,
+                                                               index_t      voffset,
+                                                               index_t      soffset,
+                                                               index_t      aux)
+            __asm("llvm.amdgcn.raw.buffer.store.v4i32");
+
+        // LDS-direct load (buffer_load ... lds). Each active lane loads size bytes
+        // from its buffer address and writes them to ldsBase + lane * size. The LDS
+        // base must be wave-uniform. Completion is tracked by vmcnt.
+        ROCWMMA_DEVICE void
+            llvm_amdgcn_raw_buffer_load_lds(BufferRsrcT                             rsrc,
+                                            __attribute__((address_space(3))) void* ldsBase,
+                                            index_t                                 size,
+                                            index_t                                 voffset,
+                                            index_t                                 soffset,
+                                            index_t                                 offset,
+                                            index_t                                 aux)
+            __asm("llvm.amdgcn.raw.buffer.load.lds");
+
+        // Builds a raw (stride 0) buffer resource over numBytes starting at base.
+        struct amdgcn_make_buffer_rsrc
+        {
+            enum : uint32_t
+            {
+                // Word 3: dst_sel, format and out-of-bounds select
+                Config = ROCWMMA_ARCH_GFX11 ? 0x31004000u : 0x00020000u,
+
+                // Any voffset at or above this is out of range, as
+                // buffers are limited to less than 2GB.
+                OobOffset = 0x80000000u
+            };
+
+            ROCWMMA_DEVICE static inline BufferRsrcT exec(void const* base, uint32_t numBytes)
+            {
+                auto address = reinterpret_cast<uint64_t>(base);
+
+                // Promote to SGPRs
+                BufferRsrcT rsrc;
+                rsrc.x = __builtin_amdgcn_readfirstlane(static_cast<int32_t>(address));
+                rsrc.y = __builtin_amdgcn_readfirstlane(static_cast<int32_t>(address >> 32u));
+                rsrc.z = __builtin_amdgcn_readfirstlane(static_cast<int32_t>(numBytes));
+                rsrc.w = static_cast<int32_t>(Config);
+                return rsrc;
+            }
+        };
+
+        // Raw buffer access of Bytes, with the cache policy bits of the instruction.
+        // Accesses wider than 16B are split into 16B chunks.
+        template <uint32_t Bytes, uint32_t CacheBits = 0u>
+        struct amdgcn_raw_buffer_io;
+
+        template <uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io<1u, CacheBits>
+        {
+            using RawT = int8_t;
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                return llvm_amdgcn_raw_buffer_load_i8(rsrc, voffset, soffset, CacheBits);
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_store_i8(data, rsrc, voffset, soffset, CacheBits);
+            }
+        };
+
+        template <uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io<2u, CacheBits>
+        {
+            using RawT = int16_t;
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                return llvm_amdgcn_raw_buffer_load_i16(rsrc, voffset, soffset, CacheBits);
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_store_i16(data, rsrc, voffset, soffset, CacheBits);
+            }
+        };
+
+        template <uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io<4u, CacheBits>
+        {
+            using RawT = int32_t;
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                return llvm_amdgcn_raw_buffer_load_i32(rsrc, voffset, soffset, CacheBits);
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_store_i32(data, rsrc, voffset, soffset, CacheBits);
+            }
+        };
+
+        template <uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io<8u, CacheBits>
+        {
+            using RawT = BufferI32x2T;
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                return llvm_amdgcn_raw_buffer_load_i32x2(rsrc, voffset, soffset, CacheBits);
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_store_i32x2(data, rsrc, voffset, soffset, CacheBits);
+            }
+        };
+
+        template <uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io<16u, CacheBits>
+        {
+            using RawT = BufferI32x4T;
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                return llvm_amdgcn_raw_buffer_load_i32x4(rsrc, voffset, soffset, CacheBits);
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_store_i32x4(data, rsrc, voffset, soffset, CacheBits);
+            }
+        };
+
+        template <uint32_t Bytes, uint32_t CacheBits>
+        struct amdgcn_raw_buffer_io
+        {
+            static_assert(Bytes % 16u == 0u, "Unsupported buffer access size");
+
+            using ChunkIO = amdgcn_raw_buffer_io<16u, CacheBits>;
+
+            struct RawT
+            {
+                typename ChunkIO::RawT chunks[Bytes / 16u];
+            };
+
+            ROCWMMA_DEVICE static inline RawT
+                load(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                RawT result;
+#pragma unroll
+                for(uint32_t i = 0; i < Bytes / 16u; i++)
+                {
+                    // Constant chunk offsets fold into the instruction offset
+                    result.chunks[i] = ChunkIO::load(rsrc, voffset + i * 16u, soffset);
+                }
+                return result;
+            }
+
+            ROCWMMA_DEVICE static inline void
+                store(RawT const& data, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+#pragma unroll
+                for(uint32_t i = 0; i < Bytes / 16u; i++)
+                {
+                    ChunkIO::store(data.chunks[i], rsrc, voffset + i * 16u, soffset);
+                }
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BUFFER_RESOURCE_HPP
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_BUFFER_STORE_HPP
+#define ROCWMMA_BUFFER_STORE_HPP
+
+#include "buffer_resource.hpp"
+#include "cache_policy.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "tuple.hpp"
+#include "types.hpp"
+#include "vector_iterator.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
+        struct amdgcn_buffer_store
+        {
+            static_assert(VectorWidth > 0, "Vector width must be greater than 0");
+            static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
+                          "Cannot vectorize output");
+
+            using StoreT   = VecT<DataT, VectorWidth>;
+            using VectorIO
+                = amdgcn_raw_buffer_io<sizeof(StoreT), CachePolicyTraits<CachePolicy>::Bits>;
+            using ScalarIO
+                = amdgcn_raw_buffer_io<sizeof(DataT), CachePolicyTraits<CachePolicy>::Bits>;
+
+            // Byte offsets: voffset is per lane, soffset is wave-uniform
+            ROCWMMA_DEVICE static inline void
+                exec(BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset, StoreT const& data)
+            {
+                VectorIO::store(*reinterpret_cast<typename VectorIO::RawT const*>(&data),
+                                rsrc,
+                                voffset,
+                                soffset);
+            }
+
+            // Bounds-checked store of a vector that may straddle the matrix edge.
+            // Elements at or beyond validCount are dropped by the hardware
+            // range check, using an out-of-range offset.
+            ROCWMMA_DEVICE static inline void exec(BufferRsrcT   rsrc,
+                                                   uint32_t      voffset,
+                                                   uint32_t      soffset,
+                                                   StoreT const& data,
+                                                   uint32_t      validCount)
+            {
+                constexpr uint32_t OobOffset = amdgcn_make_buffer_rsrc::OobOffset;
+
+                if(validCount == 0u || validCount >= VectorWidth)
+                {
+                    exec(rsrc, validCount ? voffset : OobOffset, soffset, data);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        auto  offset  = (i < validCount) ? voffset + i * sizeof(DataT) : OobOffset;
+                        DataT element = data[i];
+                        ScalarIO::store(*reinterpret_cast<typename ScalarIO::RawT const*>(&element),
+                                        rsrc,
+                                        offset,
+                                        soffset);
+                    }
+                }
+            }
+        };
+
+    } // namespace detail
+
+    // Buffer IO backend counterpart of OpaqueStore. See BufferLoad.
+    template <uint32_t BlockDim,
+              uint32_t BlockK,
+              typename DataT,
+              class DataLayout,
+              class MatrixLayout,
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
+    struct BufferStore
+    {
+        using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
+
+        struct Traits
+        {
+            // Raw IO on unpacked register data.
+            using Storer       = detail::amdgcn_buffer_store<DataT, VectorWidth, CachePolicy>;
+            using StoreT       = typename Storer::StoreT;
+            using InputT       = VecT<DataT, IOTraits::UnpackedSize>;
+            using MatrixCoordT = Coord2d;
+            using BufferRsrcT  = detail::BufferRsrcT;
+        };
+
+        using StoreVecTraits = VecTraits<typename Traits::StoreT>;
+
+        // Number of in-bounds elements of the vector at coord.
+        // Vectors are contiguous in the minor dimension of the data layout.
+        ROCWMMA_DEVICE static inline uint32_t
+            validCount(typename Traits::MatrixCoordT const& coord,
+                       typename Traits::MatrixCoordT const& extent)
+        {
+            auto major       = get<DataLayout::MajorIndex>(coord);
+            auto minor       = get<DataLayout::MinorIndex>(coord);
+            auto majorExtent = get<DataLayout::MajorIndex>(extent);
+            auto minorExtent = get<DataLayout::MinorIndex>(extent);
+            return (major < majorExtent && minor < minorExtent) ? minorExtent - minor : 0u;
+        }
+
+        // Outer loop = index 0,
+        // Inner loop = index N-1
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto unroll_right(Iterator&                    in,
+                                                       typename Traits::BufferRsrcT rsrc,
+                                                       uint32_t                     voffset,
+                                                       uint32_t                     soffset,
+                                                       uint32_t                     ldm,
+                                                       StrideCounts&&               strideCounts,
+                                                       Strides2d&&                  strides2d)
+        {
+            auto strideOffset
+                = DataLayout::fromMatrixCoord(get<Depth>(strides2d), ldm) * sizeof(DataT);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::exec(rsrc, voffset, soffset, *in);
+                    soffset += strideOffset;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        in, rsrc, voffset, soffset, ldm, strideCounts, strides2d);
+                    soffset += strideOffset;
+                }
+            }
+        }
+
+        // Bounds-checked unroll: tracks the matrix coordinate of each vector
+        // alongside its offset.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto
+            unroll_right(Iterator&                            in,
+                         typename Traits::BufferRsrcT         rsrc,
+                         uint32_t                             voffset,
+                         uint32_t                             soffset,
+                         uint32_t                             ldm,
+                         typename Traits::MatrixCoordT        coord,
+                         typename Traits::MatrixCoordT const& extent,
+                         StrideCounts&&                       strideCounts,
+                         Strides2d&&                          strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm) * sizeof(DataT);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::Storer::exec(rsrc, voffset, soffset, *in, validCount(coord, extent));
+                    soffset += strideOffset;
+                    coord += stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        in, rsrc, voffset, soffset, ldm, coord, extent, strideCounts, strides2d);
+                    soffset += strideOffset;
+                    coord += stride2d;
+                }
+            }
+        }
+
+        // Offset is the wave-uniform element offset of the block in the buffer.
+        ROCWMMA_DEVICE static void exec(typename Traits::InputT const& data,
+                                        typename Traits::BufferRsrcT   rsrc,
+                                        uint32_t                       offset,
+                                        uint32_t                       ldm)
+        {
+            // Arrange wave threads to starting matrix layout offsets.
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            // Wave-uniform block offset goes to SGPR
+            auto blockOffset = static_cast<int32_t>(offset * sizeof(DataT));
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            // Make sure that the IOCount is consistent with the number of total strides
+            static_assert(IOTraits::IOCount
+                              == apply([](auto... items) { return (items * ...); },
+                                       MatrixLayout::strideCounts()),
+                          "IOCount inconsistent with total strides");
+
+            unroll_right(it,
+                         rsrc,
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm) * sizeof(DataT),
+                         __builtin_amdgcn_readfirstlane(blockOffset),
+                         ldm,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+
+        // Bounds-checked store. Extent is the (rows, cols) count of valid matrix
+        // elements starting at offset. Out-of-bounds elements are not written.
+        ROCWMMA_DEVICE static void exec(typename Traits::InputT const&       data,
+                                        typename Traits::BufferRsrcT         rsrc,
+                                        uint32_t                             offset,
+                                        uint32_t                             ldm,
+                                        typename Traits::MatrixCoordT const& extent)
+        {
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            // Wave-uniform block offset goes to SGPR
+            auto blockOffset = static_cast<int32_t>(offset * sizeof(DataT));
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            unroll_right(it,
+                         rsrc,
+                         DataLayout::fromMatrixCoord(baseOffset2d, ldm) * sizeof(DataT),
+                         __builtin_amdgcn_readfirstlane(blockOffset),
+                         ldm,
+                         baseOffset2d,
+                         extent,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_BUFFER_STORE_HPP
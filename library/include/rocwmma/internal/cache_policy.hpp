@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_CACHE_POLICY_HPP
+#define ROCWMMA_CACHE_POLICY_HPP
+
+#include "config.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+    // clang-format off
+
+    // Cache policy meta-tags
+    /*! \struct cache_default
+ *  \brief Default caching of global memory accesses
+ */
+    struct cache_default{};
+    /*! \struct cache_nontemporal
+ *  \brief Data is not expected to be reused soon: accesses are marked non-temporal
+ *  so that they are first in line for eviction
+ */
+    struct cache_nontemporal{};
+    /*! \struct cache_streaming
+ *  \brief Data is touched exactly once: accesses bypass the near caches and are
+ *  marked non-temporal in the last level cache. Buffer loads / stores only
+ */
+    struct cache_streaming{};
+    /*! \struct cache_l2_only
+ *  \brief Accesses bypass the near caches and are served by L2. Buffer loads /
+ *  stores only
+ */
+    struct cache_l2_only{};
+    /*! \struct cache_bits
+ *  \brief Raw cache policy bits of the target architecture (glc / slc / dlc on gfx9
+ *  and gfx11, sc0 / nt / sc1 on gfx940+)
+ *  @tparam CacheBits cache policy operand bits passed through to the instruction.
+ *  Buffer loads / stores only, except for the non-temporal bit alone
+ */
+    template <uint32_t CacheBits>
+    struct cache_bits{};
+
+    // clang-format on
+
+    namespace detail
+    {
+        // Cache policy operand bits of memory instructions, per architecture
+        struct amdgcn_cache_bits
+        {
+            enum : uint32_t
+            {
+#if ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+                Sc0 = 1u << 0,
+                Nt  = 1u << 1,
+                Sc1 = 1u << 4,
+
+                // Bypass L1 / L2-coherent, and first-to-evict
+                Coherent    = Sc0,
+                NonTemporal = Nt,
+#elif ROCWMMA_ARCH_GFX11
+                Glc = 1u << 0,
+                Slc = 1u << 1,
+                Dlc = 1u << 2,
+
+                // Bypass GL0 and GL1, and first-to-evict
+                Coherent    = Glc | Dlc,
+                NonTemporal = Slc,
+#else
+                Glc = 1u << 0,
+                Slc = 1u << 1,
+
+                // Bypass L1, and first-to-evict
+                Coherent    = Glc,
+                NonTemporal = Slc,
+#endif // ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+            };
+        };
+
+        template <typename CachePolicy>
+        struct CachePolicyTraits;
+
+        template <>
+        struct CachePolicyTraits<cache_default>
+        {
+            constexpr static uint32_t Bits = 0u;
+        };
+
+        template <>
+        struct CachePolicyTraits<cache_nontemporal>
+        {
+            constexpr static uint32_t Bits = amdgcn_cache_bits::NonTemporal;
+        };
+
+        template <>
+        struct CachePolicyTraits<cache_streaming>
+        {
+            constexpr static uint32_t Bits
+                = amdgcn_cache_bits::Coherent | amdgcn_cache_bits::NonTemporal;
+        };
+
+        template <>
+        struct CachePolicyTraits<cache_l2_only>
+        {
+            constexpr static uint32_t Bits = amdgcn_cache_bits::Coherent;
+        };
+
+        template <uint32_t CacheBits>
+        struct CachePolicyTraits<cache_bits<CacheBits>>
+        {
+            constexpr static uint32_t Bits = CacheBits;
+        };
+
+        // Raw integer type of Bytes, usable with the non-temporal builtins
+        template <uint32_t Bytes>
+        struct amdgcn_raw_type
+        {
+            static_assert(Bytes % 4u == 0u, "Unsupported access size");
+            using Type = int32_t __attribute__((ext_vector_type(Bytes / 4u)));
+        };
+
+        template <>
+        struct amdgcn_raw_type<1u>
+        {
+            using Type = int8_t;
+        };
+
+        template <>
+        struct amdgcn_raw_type<2u>
+        {
+            using Type = int16_t;
+        };
+
+        template <>
+        struct amdgcn_raw_type<4u>
+        {
+            using Type = int32_t;
+        };
+
+        // Pointer-based accesses cannot carry the policy bits directly: the
+        // pointer may address LDS as well as global memory. Only the non-temporal
+        // hint can be forwarded through the compiler, which sets the matching bits
+        // on the global load / store instructions. Coherent and raw policy bits
+        // need the buffer_resource overloads, which pass them to the instruction.
+        template <typename CachePolicy>
+        struct amdgcn_global_access
+        {
+            static_assert((CachePolicyTraits<CachePolicy>::Bits & ~amdgcn_cache_bits::NonTemporal)
+                              == 0u,
+                          "Pointer loads / stores only apply cache_default and cache_nontemporal. "
+                          "Use the buffer_resource overloads for coherent or raw cache bits");
+
+            constexpr static bool NonTemporal
+                = (CachePolicyTraits<CachePolicy>::Bits & amdgcn_cache_bits::NonTemporal) != 0u;
+
+            template <typename T>
+            ROCWMMA_DEVICE static inline T load(T const* ptr)
+            {
+                if constexpr(NonTemporal)
+                {
+                    using RawT = typename amdgcn_raw_type<sizeof(T)>::Type;
+                    auto raw   = __builtin_nontemporal_load(reinterpret_cast<RawT const*>(ptr));
+                    return *reinterpret_cast<T const*>(&raw);
+                }
+                else
+                {
+                    return *ptr;
+                }
+            }
+
+            template <typename T>
+            ROCWMMA_DEVICE static inline void store(T* ptr, T const& data)
+            {
+                if constexpr(NonTemporal)
+                {
+                    using RawT = typename amdgcn_raw_type<sizeof(T)>::Type;
+                    __builtin_nontemporal_store(*reinterpret_cast<RawT const*>(&data),
+                                                reinterpret_cast<RawT*>(ptr));
+                }
+                else
+                {
+                    *ptr = data;
+                }
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_CACHE_POLICY_HPP
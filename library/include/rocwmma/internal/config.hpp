@@ -97,6 +97,7 @@ namespace rocwmma
 /// ROCWMMA_WAVE32_MODE
 /// ROCWMMA_BLOCK_DIM_16_SUPPORTED
 /// ROCWMMA_BLOCK_DIM_32_SUPPORTED
+/// ROCWMMA_LDS_DIRECT_LOAD_SUPPORTED
 ///
 #if ROCWMMA_ARCH_GFX908 || ROCWMMA_ARCH_GFX90A || ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 \
     || ROCWMMA_ARCH_GFX942
@@ -104,6 +105,7 @@ namespace rocwmma
 #define ROCWMMA_WAVE64_MODE 1
 #define ROCWMMA_BLOCK_DIM_16_SUPPORTED 1
 #define ROCWMMA_BLOCK_DIM_32_SUPPORTED 1
+#define ROCWMMA_LDS_DIRECT_LOAD_SUPPORTED 1
 #endif
 
 #if ROCWMMA_ARCH_GFX1100 || ROCWMMA_ARCH_GFX1101 || ROCWMMA_ARCH_GFX1102
@@ -130,6 +132,9 @@ namespace rocwmma
 #if !defined(ROCWMMA_BLOCK_DIM_32_SUPPORTED)
 #define ROCWMMA_BLOCK_DIM_32_SUPPORTED 0
 #endif
+#if !defined(ROCWMMA_LDS_DIRECT_LOAD_SUPPORTED)
+#define ROCWMMA_LDS_DIRECT_LOAD_SUPPORTED 0
+#endif
 
 #if defined(NDEBUG)
 #define ROCWMMA_UNSUPPORTED_IMPL(MSG)
@@ -149,6 +154,16 @@ namespace rocwmma
 #define ROCWMMA_TESTS_NO_HALF 0
 #endif // !ROCWMMA_NO_HALF && defined(__HIP_NO_HALF_CONVERSIONS__)
 
+///
+/// Host backend configuration
+/// Guaranteed symbols:
+/// ROCWMMA_HOST_WAVE_SIZE
+///
+/// Wave size simulated by the host backend. Host compiles otherwise use a wave size of 64.
+#if !defined(ROCWMMA_HOST_WAVE_SIZE)
+#define ROCWMMA_HOST_WAVE_SIZE 64
+#endif
+
 ///
 /// Sanity checks
 ///
@@ -159,6 +174,11 @@ namespace rocwmma
                   "rocWMMA supports only block size of 16 for gfx11 arch");
 #endif
 
+#if ROCWMMA_ARCH_HOST
+    static_assert(ROCWMMA_HOST_WAVE_SIZE == 64 || ROCWMMA_HOST_WAVE_SIZE == 32,
+                  "rocWMMA host backend supports only wave64 or wave32");
+#endif
+
 #if ROCWMMA_ARCH_GFX9
     static_assert(!(bool)(ROCWMMA_WAVE32_MODE) && (bool)(ROCWMMA_WAVE64_MODE),
                   "rocWMMA supports only wave64 for gfx9 arch");
@@ -84,7 +84,7 @@ namespace rocwmma
 #elif ROCWMMA_WAVE32_MODE
         static constexpr uint32_t AMDGCN_WAVE_SIZE       = AMDGCN_WAVE_SIZE_32;
 #else // Host default to 64 to avoid host compile time asserts.
-        static constexpr uint32_t AMDGCN_WAVE_SIZE       = AMDGCN_WAVE_SIZE_64;
+        static constexpr uint32_t AMDGCN_WAVE_SIZE       = ROCWMMA_HOST_WAVE_SIZE;
 #endif
 
         static constexpr uint32_t AMDGCN_REGISTER_ELEMENT_SIZE_BYTES = 4u;
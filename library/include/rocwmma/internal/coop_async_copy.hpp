@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_COOP_ASYNC_COPY_HPP
+#define ROCWMMA_COOP_ASYNC_COPY_HPP
+
+#include "buffer_resource.hpp"
+#include "cache_policy.hpp"
+#include "flow_control.hpp"
+#include "mapping_util.hpp"
+#include "types.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Copies one dword per lane from global memory straight into LDS.
+        // Lanes write consecutive dwords starting at the wave-uniform LDS address.
+        template <typename CachePolicy = cache_default>
+        struct amdgcn_buffer_load_lds_dword
+        {
+            using LdsPtrT = __attribute__((address_space(3))) void*;
+
+            ROCWMMA_DEVICE static inline void
+                exec(void* ldsAddr, BufferRsrcT rsrc, uint32_t voffset, uint32_t soffset)
+            {
+                llvm_amdgcn_raw_buffer_load_lds(rsrc,
+                                                (LdsPtrT)(ldsAddr),
+                                                sizeof(uint32_t),
+                                                voffset,
+                                                soffset,
+                                                0,
+                                                CachePolicyTraits<CachePolicy>::Bits);
+            }
+        };
+
+    } // namespace detail
+
+    // Cooperative copy of a BlockHeight x BlockWidth block from global memory to LDS,
+    // that does not stage data in registers.
+    // Each line of the block in the minor dimension of the data layout is split into
+    // segments of one dword per lane. Segments are assigned in round robin fashion to
+    // the waves in [0, WaveCount) and each segment is a single LDS-direct buffer load.
+    // Copies complete asynchronously: wait<>() must precede reading the LDS data.
+    template <uint32_t BlockHeight,
+              uint32_t BlockWidth,
+              typename DataT,
+              class DataLayout,
+              typename CachePolicy = cache_default>
+    struct CooperativeAsyncCopy
+    {
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                WaveSize = Constants::AMDGCN_WAVE_SIZE,
+
+                MinorSize = (DataLayout::MinorIndex == 1u ? BlockWidth : BlockHeight),
+                MajorSize = (DataLayout::MinorIndex == 1u ? BlockHeight : BlockWidth),
+
+                LineBytes  = MinorSize * sizeof(DataT),
+                LineDwords = LineBytes / sizeof(uint32_t),
+
+                SegmentsPerLine = (LineDwords + WaveSize - 1u) / WaveSize,
+                TotalSegments   = MajorSize * SegmentsPerLine,
+            };
+        };
+
+        // The direct path needs hardware support, lines that are whole dwords
+        // and an even split of segments over the waves.
+        template <uint32_t WaveCount>
+        constexpr static inline bool isDirect()
+        {
+            return (bool)ROCWMMA_LDS_DIRECT_LOAD_SUPPORTED
+                   && (Traits::LineBytes % sizeof(uint32_t) == 0u)
+                   && (Traits::TotalSegments % WaveCount == 0u);
+        }
+
+        // Outstanding vector memory ops that each wave issues per copy.
+        template <uint32_t WaveCount>
+        constexpr static inline uint32_t segmentsPerWave()
+        {
+            return Traits::TotalSegments / WaveCount;
+        }
+
+        // Issues this wave's share of the copy.
+        // Assumes row starting addresses of data and lds are dword aligned.
+        template <uint32_t WaveCount>
+        ROCWMMA_DEVICE static inline void exec(DataT*       lds,
+                                               uint32_t     ldlds,
+                                               DataT const* data,
+                                               uint32_t     ldm,
+                                               uint32_t     waveIndex)
+        {
+            static_assert(isDirect<WaveCount>(), "Async copy is unsupported for this block");
+
+            using Loader = detail::amdgcn_buffer_load_lds_dword<CachePolicy>;
+
+            // Range of the block footprint in global memory
+            auto rsrc = detail::amdgcn_make_buffer_rsrc::exec(
+                data, ((Traits::MajorSize - 1u) * ldm + Traits::MinorSize) * sizeof(DataT));
+
+            auto lane    = detail::WaveSpace<>::localLaneId();
+            auto voffset = lane * sizeof(uint32_t);
+
+            // Segment origins must be wave-uniform
+            waveIndex = __builtin_amdgcn_readfirstlane(waveIndex);
+
+#pragma unroll
+            for(uint32_t i = 0; i < segmentsPerWave<WaveCount>(); i++)
+            {
+                auto segment = i * WaveCount + waveIndex;
+                auto line    = segment / Traits::SegmentsPerLine;
+                auto segOff  = (segment % Traits::SegmentsPerLine) * Traits::WaveSize;
+
+                auto soffset = line * ldm * sizeof(DataT) + segOff * sizeof(uint32_t);
+                auto ldsAddr = reinterpret_cast<char*>(lds) + line * ldlds * sizeof(DataT)
+                               + segOff * sizeof(uint32_t);
+
+                // Partial segments at the end of a line must not spill into the next
+                if(Traits::LineDwords % Traits::WaveSize == 0u
+                   || segOff + lane < Traits::LineDwords)
+                {
+                    Loader::exec(ldsAddr, rsrc, voffset, soffset);
+                }
+            }
+        }
+
+        // Waits until at most PendingCopies later copies from this wave are in flight.
+        // Other waves' copies are only visible after a subsequent workgroup barrier.
+        template <uint32_t WaveCount, uint32_t PendingCopies = 0u>
+        ROCWMMA_DEVICE static inline void wait()
+        {
+            constexpr uint32_t VmCount = PendingCopies * segmentsPerWave<WaveCount>();
+            static_assert(VmCount < 64u, "Too many pending copies for the vmcnt counter");
+
+            detail::amdgcn_s_vmcnt<VmCount>::exec();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_COOP_ASYNC_COPY_HPP
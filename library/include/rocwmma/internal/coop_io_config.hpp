@@ -26,6 +26,8 @@
 #ifndef ROCWMMA_COOP_IO_CONFIG_HPP
 #define ROCWMMA_COOP_IO_CONFIG_HPP
 
+#include "cache_policy.hpp"
+#include "coop_async_copy.hpp"
 #include "coop_load.hpp"
 #include "coop_store.hpp"
 #include "io_layout.hpp"
@@ -58,6 +60,9 @@ namespace rocwmma
  * @param MappingUtil global mapping utility for current fragment
  * @param Loader Issues cooperative load instructions for raw fragment data
  * @param Storer Issues cooperative store instructions for raw fragment data
+ * @param PolicyLoader / PolicyStorer Loader and Storer with explicit cache policy
+ * @param AsyncCopier Issues cooperative global to LDS copies without register staging
+ * @param PolicyAsyncCopier AsyncCopier with explicit cache policy
  */
 
     template <typename MatrixT,
@@ -78,19 +83,34 @@ namespace rocwmma
         using MappingUtil
             = MappingUtil<IOShape::BlockHeight, IOShape::BlockWidth, DataT, DataLayoutT>;
 
-        using Loader = CooperativeLoad<IOShape::BlockDim,
-                                       IOShape::KDim,
-                                       DataT,
-                                       typename IOLayout::DataLayout,
-                                       typename IOLayout::MatrixLayout,
-                                       IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyLoader = CooperativeLoad<IOShape::BlockDim,
+                                             IOShape::KDim,
+                                             DataT,
+                                             typename IOLayout::DataLayout,
+                                             typename IOLayout::MatrixLayout,
+                                             IOLayout::VW,
+                                             CachePolicy>;
 
-        using Storer = CooperativeStore<IOShape::BlockDim,
-                                        IOShape::KDim,
-                                        DataT,
-                                        typename IOLayout::DataLayout,
-                                        typename IOLayout::MatrixLayout,
-                                        IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyStorer = CooperativeStore<IOShape::BlockDim,
+                                              IOShape::KDim,
+                                              DataT,
+                                              typename IOLayout::DataLayout,
+                                              typename IOLayout::MatrixLayout,
+                                              IOLayout::VW,
+                                              CachePolicy>;
+
+        template <typename CachePolicy>
+        using PolicyAsyncCopier = CooperativeAsyncCopy<IOShape::BlockHeight,
+                                                       IOShape::BlockWidth,
+                                                       DataT,
+                                                       typename IOLayout::DataLayout,
+                                                       CachePolicy>;
+
+        using Loader      = PolicyLoader<cache_default>;
+        using Storer      = PolicyStorer<cache_default>;
+        using AsyncCopier = PolicyAsyncCopier<cache_default>;
     };
 
     /************************************************
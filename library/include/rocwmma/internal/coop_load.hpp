@@ -40,7 +40,8 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
     struct CooperativeLoad
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
@@ -52,7 +53,7 @@ namespace rocwmma
             };
 
             // Load implementation
-            using Loader = detail::amdgcn_opaque_load<DataT, VectorWidth>;
+            using Loader = detail::amdgcn_opaque_load<DataT, VectorWidth, CachePolicy>;
             using LoadT  = typename Loader::LoadT;
 
             // Block output vector
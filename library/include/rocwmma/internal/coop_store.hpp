@@ -40,7 +40,8 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
     struct CooperativeStore
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
@@ -53,7 +54,7 @@ namespace rocwmma
 
             // Store implementation
             // Iteratively stores the entire block
-            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth>;
+            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth, CachePolicy>;
             using StoreT = typename Storer::StoreT;
 
             // Block input vector
@@ -0,0 +1,283 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_HPP
+#define ROCWMMA_EPILOGUE_HPP
+
+#include "layout.hpp"
+#include "type_traits.hpp"
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace rocwmma
+{
+    namespace epilogue
+    {
+        /*
+        * Epilogue ops transform accumulator elements before they are stored.
+        * Each op is a trivially copyable functor:
+        *
+        *   template <typename DataT>
+        *   ROCWMMA_DEVICE DataT operator()(DataT value, uint32_t row, uint32_t col) const;
+        *
+        * where (row, col) is the matrix coordinate of the element. Ops may be
+        * constructed on the host and passed as kernel arguments.
+        */
+
+        namespace detail
+        {
+            // Transcendentals are evaluated in fp32, or fp64 for fp64 accumulators
+            template <typename DataT>
+            using MathT = conditional_t<is_same<DataT, float64_t>::value, float64_t, float32_t>;
+
+        } // namespace detail
+
+        // No-op
+        struct identity
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value;
+            }
+        };
+
+        // max(x, 0)
+        struct relu
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value > static_cast<DataT>(0) ? value : static_cast<DataT>(0);
+            }
+        };
+
+        // Tanh approximation: 0.5x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715x^3)))
+        struct gelu
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                using MathT = detail::MathT<DataT>;
+
+                auto x     = static_cast<MathT>(value);
+                auto inner = static_cast<MathT>(0.7978845608028654)
+                             * (x + static_cast<MathT>(0.044715) * x * x * x);
+                return static_cast<DataT>(static_cast<MathT>(0.5) * x
+                                          * (static_cast<MathT>(1) + tanh(inner)));
+            }
+        };
+
+        // x * sigmoid(x)
+        struct silu
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                using MathT = detail::MathT<DataT>;
+
+                auto x = static_cast<MathT>(value);
+                return static_cast<DataT>(x / (static_cast<MathT>(1) + exp(-x)));
+            }
+        };
+
+        // Per-tensor scale
+        template <typename ScaleT>
+        struct scale
+        {
+            ROCWMMA_HOST_DEVICE constexpr scale(ScaleT scale)
+                : mScale(scale)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value * static_cast<DataT>(mScale);
+            }
+
+            ScaleT mScale;
+        };
+
+        // Per-channel scale, indexed by row
+        template <typename ScaleT>
+        struct scale_row
+        {
+            ROCWMMA_HOST_DEVICE constexpr scale_row(ScaleT const* scale)
+                : mScale(scale)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value * static_cast<DataT>(mScale[row]);
+            }
+
+            ScaleT const* mScale;
+        };
+
+        // Per-channel scale, indexed by column
+        template <typename ScaleT>
+        struct scale_col
+        {
+            ROCWMMA_HOST_DEVICE constexpr scale_col(ScaleT const* scale)
+                : mScale(scale)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value * static_cast<DataT>(mScale[col]);
+            }
+
+            ScaleT const* mScale;
+        };
+
+        // Bias vector of length M, indexed by row
+        template <typename BiasT>
+        struct bias_row
+        {
+            ROCWMMA_HOST_DEVICE constexpr bias_row(BiasT const* bias)
+                : mBias(bias)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value + static_cast<DataT>(mBias[row]);
+            }
+
+            BiasT const* mBias;
+        };
+
+        // Bias vector of length N, indexed by column
+        template <typename BiasT>
+        struct bias_col
+        {
+            ROCWMMA_HOST_DEVICE constexpr bias_col(BiasT const* bias)
+                : mBias(bias)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value + static_cast<DataT>(mBias[col]);
+            }
+
+            BiasT const* mBias;
+        };
+
+        // x + beta * R, where R is a matrix of the same coordinate space as the output.
+        // beta is held in ComputeT, the type of the accumulator values the op is applied to.
+        // Each element is fetched individually: for a full C matrix, prefer loading
+        // a fragment with load_matrix_sync.
+        template <typename ResidualT, typename DataLayoutT, typename ComputeT = float32_t>
+        struct residual_add
+        {
+            ROCWMMA_HOST_DEVICE constexpr residual_add(ResidualT const* residual,
+                                                       uint32_t         ldr,
+                                                       ComputeT         beta = ComputeT(1))
+                : mResidual(residual)
+                , mLdr(ldr)
+                , mBeta(beta)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                using DataLayout = DataLayout::template Array1d<DataLayoutT>;
+
+                auto offset = DataLayout::fromMatrixCoord(make_coord2d(row, col), mLdr);
+                return value + static_cast<DataT>(mBeta) * static_cast<DataT>(mResidual[offset]);
+            }
+
+            ResidualT const* mResidual;
+            uint32_t         mLdr;
+            ComputeT         mBeta;
+        };
+
+        // Clamps to the finite range of OutputT ahead of a narrowing conversion.
+        // NaN is propagated.
+        template <typename OutputT>
+        struct saturate
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                auto const upper = static_cast<DataT>(numeric_limits<OutputT>::max());
+                auto const lower = static_cast<DataT>(numeric_limits<OutputT>::lowest());
+                return value > upper ? upper : (value < lower ? lower : value);
+            }
+        };
+
+        // Applies ops left to right
+        template <typename... Ops>
+        struct chain;
+
+        template <>
+        struct chain<>
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return value;
+            }
+        };
+
+        template <typename Op, typename... Ops>
+        struct chain<Op, Ops...>
+        {
+            ROCWMMA_HOST_DEVICE constexpr chain(Op const& op, Ops const&... ops)
+                : mOp(op)
+                , mNext(ops...)
+            {
+            }
+
+            template <typename DataT>
+            ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+            {
+                return mNext(mOp(value, row, col), row, col);
+            }
+
+            Op            mOp;
+            chain<Ops...> mNext;
+        };
+
+        template <typename... Ops>
+        ROCWMMA_HOST_DEVICE constexpr inline auto make_chain(Ops const&... ops)
+        {
+            return chain<Ops...>(ops...);
+        }
+
+    } // namespace epilogue
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_EPILOGUE_HPP
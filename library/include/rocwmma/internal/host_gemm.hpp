@@ -0,0 +1,597 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_HOST_GEMM_HPP
+#define ROCWMMA_HOST_GEMM_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if(defined(__x86_64__) || defined(__i386__)) && !defined(__HIP_DEVICE_COMPILE__)
+#define ROCWMMA_HOST_GEMM_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define ROCWMMA_HOST_GEMM_X86_SIMD 0
+#endif
+
+#include "types.hpp"
+
+// Cache-blocked host gemm, used as the reference by the tests and samples.
+// Host only: it does not depend on HIP.
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        namespace GemmCPU
+        {
+            // Cache blocking of the host reference gemm.
+            // Each thread owns an (MC x NC) tile of D, and streams through K
+            // in KC-deep slices. The packed KC x NC panel of B is sized for L2
+            // and the MR x KC slivers of A for L1.
+            constexpr int64_t BlockMC = 120;
+            constexpr int64_t BlockNC = 256;
+            constexpr int64_t BlockKC = 256;
+
+            // Portable register-blocked micro-kernel.
+            // Computes an MR x NR tile of C += A * B over kc, where A and B are
+            // packed panels in ComputeT. Used for every ComputeT, and as the
+            // fallback when no vector ISA is available.
+            template <typename ComputeT>
+            struct ScalarKernel
+            {
+                constexpr static int64_t MR = 4;
+                constexpr static int64_t NR = 8;
+
+                static inline void
+                    exec(int64_t kc, ComputeT const* a, ComputeT const* b, ComputeT* c, int64_t ldc)
+                {
+                    ComputeT acc[MR][NR];
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        for(int64_t j = 0; j < NR; ++j)
+                        {
+                            acc[i][j] = static_cast<ComputeT>(0);
+                        }
+                    }
+
+                    for(int64_t p = 0; p < kc; ++p, a += MR, b += NR)
+                    {
+                        for(int64_t i = 0; i < MR; ++i)
+                        {
+                            auto ai = a[i];
+#pragma omp simd
+                            for(int64_t j = 0; j < NR; ++j)
+                            {
+                                acc[i][j] += ai * b[j];
+                            }
+                        }
+                    }
+
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        for(int64_t j = 0; j < NR; ++j)
+                        {
+                            c[i * ldc + j] += acc[i][j];
+                        }
+                    }
+                }
+            };
+
+#if ROCWMMA_HOST_GEMM_X86_SIMD
+
+#define ROCWMMA_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define ROCWMMA_TARGET_AVX512 __attribute__((target("avx512f")))
+
+            // Vector ops for the AVX2 / AVX-512 micro-kernels.
+            // Functions carry their own target attributes so that the host
+            // build doesn't need -mavx2 / -mavx512f. The ISA is selected at runtime.
+            template <typename DataT>
+            struct Avx2Ops;
+
+            template <>
+            struct Avx2Ops<float32_t>
+            {
+                using VecT                       = __m256;
+                constexpr static int64_t VecSize = 8;
+
+                ROCWMMA_TARGET_AVX2 static inline VecT zero()
+                {
+                    return _mm256_setzero_ps();
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT load(float32_t const* p)
+                {
+                    return _mm256_loadu_ps(p);
+                }
+                ROCWMMA_TARGET_AVX2 static inline void store(float32_t* p, VecT v)
+                {
+                    _mm256_storeu_ps(p, v);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT bcast(float32_t const* p)
+                {
+                    return _mm256_broadcast_ss(p);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT add(VecT a, VecT b)
+                {
+                    return _mm256_add_ps(a, b);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT fma(VecT a, VecT b, VecT c)
+                {
+                    return _mm256_fmadd_ps(a, b, c);
+                }
+            };
+
+            template <>
+            struct Avx2Ops<float64_t>
+            {
+                using VecT                       = __m256d;
+                constexpr static int64_t VecSize = 4;
+
+                ROCWMMA_TARGET_AVX2 static inline VecT zero()
+                {
+                    return _mm256_setzero_pd();
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT load(float64_t const* p)
+                {
+                    return _mm256_loadu_pd(p);
+                }
+                ROCWMMA_TARGET_AVX2 static inline void store(float64_t* p, VecT v)
+                {
+                    _mm256_storeu_pd(p, v);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT bcast(float64_t const* p)
+                {
+                    return _mm256_broadcast_sd(p);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT add(VecT a, VecT b)
+                {
+                    return _mm256_add_pd(a, b);
+                }
+                ROCWMMA_TARGET_AVX2 static inline VecT fma(VecT a, VecT b, VecT c)
+                {
+                    return _mm256_fmadd_pd(a, b, c);
+                }
+            };
+
+            template <typename DataT>
+            struct Avx512Ops;
+
+            template <>
+            struct Avx512Ops<float32_t>
+            {
+                using VecT                       = __m512;
+                constexpr static int64_t VecSize = 16;
+
+                ROCWMMA_TARGET_AVX512 static inline VecT zero()
+                {
+                    return _mm512_setzero_ps();
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT load(float32_t const* p)
+                {
+                    return _mm512_loadu_ps(p);
+                }
+                ROCWMMA_TARGET_AVX512 static inline void store(float32_t* p, VecT v)
+                {
+                    _mm512_storeu_ps(p, v);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT bcast(float32_t const* p)
+                {
+                    return _mm512_set1_ps(*p);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT add(VecT a, VecT b)
+                {
+                    return _mm512_add_ps(a, b);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT fma(VecT a, VecT b, VecT c)
+                {
+                    return _mm512_fmadd_ps(a, b, c);
+                }
+            };
+
+            template <>
+            struct Avx512Ops<float64_t>
+            {
+                using VecT                       = __m512d;
+                constexpr static int64_t VecSize = 8;
+
+                ROCWMMA_TARGET_AVX512 static inline VecT zero()
+                {
+                    return _mm512_setzero_pd();
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT load(float64_t const* p)
+                {
+                    return _mm512_loadu_pd(p);
+                }
+                ROCWMMA_TARGET_AVX512 static inline void store(float64_t* p, VecT v)
+                {
+                    _mm512_storeu_pd(p, v);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT bcast(float64_t const* p)
+                {
+                    return _mm512_set1_pd(*p);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT add(VecT a, VecT b)
+                {
+                    return _mm512_add_pd(a, b);
+                }
+                ROCWMMA_TARGET_AVX512 static inline VecT fma(VecT a, VecT b, VecT c)
+                {
+                    return _mm512_fmadd_pd(a, b, c);
+                }
+            };
+
+            // 6 x (2 x VecSize) register-blocked micro-kernels.
+            // 12 accumulators + 2 B vectors + 1 A broadcast fit the
+            // 16 (AVX2) or 32 (AVX-512) vector register files.
+            template <typename ComputeT>
+            struct Avx2Kernel
+            {
+                using Ops = Avx2Ops<ComputeT>;
+
+                constexpr static int64_t MR = 6;
+                constexpr static int64_t NR = 2 * Ops::VecSize;
+
+                ROCWMMA_TARGET_AVX2 static inline void
+                    exec(int64_t kc, ComputeT const* a, ComputeT const* b, ComputeT* c, int64_t ldc)
+                {
+                    typename Ops::VecT acc[MR][2];
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        acc[i][0] = acc[i][1] = Ops::zero();
+                    }
+
+                    for(int64_t p = 0; p < kc; ++p, a += MR, b += NR)
+                    {
+                        auto b0 = Ops::load(b);
+                        auto b1 = Ops::load(b + Ops::VecSize);
+                        for(int64_t i = 0; i < MR; ++i)
+                        {
+                            auto ai   = Ops::bcast(a + i);
+                            acc[i][0] = Ops::fma(ai, b0, acc[i][0]);
+                            acc[i][1] = Ops::fma(ai, b1, acc[i][1]);
+                        }
+                    }
+
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        auto cRow = c + i * ldc;
+                        Ops::store(cRow, Ops::add(Ops::load(cRow), acc[i][0]));
+                        Ops::store(cRow + Ops::VecSize,
+                                   Ops::add(Ops::load(cRow + Ops::VecSize), acc[i][1]));
+                    }
+                }
+            };
+
+            template <typename ComputeT>
+            struct Avx512Kernel
+            {
+                using Ops = Avx512Ops<ComputeT>;
+
+                constexpr static int64_t MR = 6;
+                constexpr static int64_t NR = 2 * Ops::VecSize;
+
+                ROCWMMA_TARGET_AVX512 static inline void
+                    exec(int64_t kc, ComputeT const* a, ComputeT const* b, ComputeT* c, int64_t ldc)
+                {
+                    typename Ops::VecT acc[MR][2];
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        acc[i][0] = acc[i][1] = Ops::zero();
+                    }
+
+                    for(int64_t p = 0; p < kc; ++p, a += MR, b += NR)
+                    {
+                        auto b0 = Ops::load(b);
+                        auto b1 = Ops::load(b + Ops::VecSize);
+                        for(int64_t i = 0; i < MR; ++i)
+                        {
+                            auto ai   = Ops::bcast(a + i);
+                            acc[i][0] = Ops::fma(ai, b0, acc[i][0]);
+                            acc[i][1] = Ops::fma(ai, b1, acc[i][1]);
+                        }
+                    }
+
+                    for(int64_t i = 0; i < MR; ++i)
+                    {
+                        auto cRow = c + i * ldc;
+                        Ops::store(cRow, Ops::add(Ops::load(cRow), acc[i][0]));
+                        Ops::store(cRow + Ops::VecSize,
+                                   Ops::add(Ops::load(cRow + Ops::VecSize), acc[i][1]));
+                    }
+                }
+            };
+
+#undef ROCWMMA_TARGET_AVX2
+#undef ROCWMMA_TARGET_AVX512
+
+            enum struct SimdIsa : uint32_t
+            {
+                Scalar = 0u,
+                Avx2,
+                Avx512
+            };
+
+            inline SimdIsa hostSimdIsa()
+            {
+                static auto const isa = []() {
+                    __builtin_cpu_init();
+                    if(__builtin_cpu_supports("avx512f"))
+                    {
+                        return SimdIsa::Avx512;
+                    }
+                    else if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+                    {
+                        return SimdIsa::Avx2;
+                    }
+                    return SimdIsa::Scalar;
+                }();
+                return isa;
+            }
+
+#endif // ROCWMMA_HOST_GEMM_X86_SIMD
+
+            // Pack an (mc x kc) block of A into MR-row panels of ComputeT.
+            // Each panel is kc columns of MR contiguous values; rows past mc are zero padded.
+            template <int64_t MR, typename InputT, typename ComputeT, typename LayoutA>
+            inline void packA(ComputeT*     dst,
+                              InputT const* a,
+                              int64_t       lda,
+                              int64_t       row0,
+                              int64_t       col0,
+                              int64_t       mc,
+                              int64_t       kc)
+            {
+                for(int64_t ir = 0; ir < mc; ir += MR)
+                {
+                    auto rows = std::min(MR, mc - ir);
+                    for(int64_t p = 0; p < kc; ++p, dst += MR)
+                    {
+                        for(int64_t i = 0; i < MR; ++i)
+                        {
+                            if(i < rows)
+                            {
+                                auto row = row0 + ir + i;
+                                auto col = col0 + p;
+                                auto idx = std::is_same<LayoutA, row_major>::value ? row * lda + col
+                                                                                   : col * lda + row;
+                                dst[i]   = static_cast<ComputeT>(a[idx]);
+                            }
+                            else
+                            {
+                                dst[i] = static_cast<ComputeT>(0);
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Pack a (kc x nc) block of B into NR-col panels of ComputeT.
+            // Each panel is kc rows of NR contiguous values; cols past nc are zero padded.
+            template <int64_t NR, typename InputT, typename ComputeT, typename LayoutB>
+            inline void packB(ComputeT*     dst,
+                              InputT const* b,
+                              int64_t       ldb,
+                              int64_t       row0,
+                              int64_t       col0,
+                              int64_t       kc,
+                              int64_t       nc)
+            {
+                for(int64_t jr = 0; jr < nc; jr += NR)
+                {
+                    auto cols = std::min(NR, nc - jr);
+                    for(int64_t p = 0; p < kc; ++p, dst += NR)
+                    {
+                        for(int64_t j = 0; j < NR; ++j)
+                        {
+                            if(j < cols)
+                            {
+                                auto row = row0 + p;
+                                auto col = col0 + jr + j;
+                                auto idx = std::is_same<LayoutB, row_major>::value ? row * ldb + col
+                                                                                   : col * ldb + row;
+                                dst[j]   = static_cast<ComputeT>(b[idx]);
+                            }
+                            else
+                            {
+                                dst[j] = static_cast<ComputeT>(0);
+                            }
+                        }
+                    }
+                }
+            }
+
+            template <typename MicroKernel,
+                      typename InputT,
+                      typename OutputT,
+                      typename ComputeT,
+                      typename LayoutA,
+                      typename LayoutB,
+                      typename LayoutC,
+                      typename LayoutD>
+            void gemmBlocked(int64_t        m,
+                             int64_t        n,
+                             int64_t        k,
+                             InputT const*  a,
+                             InputT const*  b,
+                             OutputT const* c,
+                             OutputT*       d,
+                             int64_t        lda,
+                             int64_t        ldb,
+                             int64_t        ldc,
+                             int64_t        ldd,
+                             ComputeT       alpha,
+                             ComputeT       beta)
+            {
+                constexpr auto MR = MicroKernel::MR;
+                constexpr auto NR = MicroKernel::NR;
+
+                // Padded tile sizes, such that micro-kernels only see full tiles
+                constexpr auto MCPad = (BlockMC + MR - 1) / MR * MR;
+                constexpr auto NCPad = (BlockNC + NR - 1) / NR * NR;
+
+                auto tilesM = (m + BlockMC - 1) / BlockMC;
+                auto tilesN = (n + BlockNC - 1) / BlockNC;
+
+#pragma omp parallel
+                {
+                    // Thread-private packing and accumulation buffers
+                    std::vector<ComputeT> packedA(MCPad * BlockKC);
+                    std::vector<ComputeT> packedB(BlockKC * NCPad);
+                    std::vector<ComputeT> accum(MCPad * NCPad);
+
+#pragma omp for collapse(2) schedule(dynamic)
+                    for(int64_t tm = 0; tm < tilesM; ++tm)
+                    {
+                        for(int64_t tn = 0; tn < tilesN; ++tn)
+                        {
+                            auto row0 = tm * BlockMC;
+                            auto col0 = tn * BlockNC;
+                            auto mc   = std::min(BlockMC, m - row0);
+                            auto nc   = std::min(BlockNC, n - col0);
+
+                            std::fill(accum.begin(), accum.end(), static_cast<ComputeT>(0));
+
+                            for(int64_t pc = 0; pc < k; pc += BlockKC)
+                            {
+                                auto kc = std::min(BlockKC, k - pc);
+
+                                packB<NR, InputT, ComputeT, LayoutB>(
+                                    packedB.data(), b, ldb, pc, col0, kc, nc);
+                                packA<MR, InputT, ComputeT, LayoutA>(
+                                    packedA.data(), a, lda, row0, pc, mc, kc);
+
+                                for(int64_t jr = 0; jr < nc; jr += NR)
+                                {
+                                    for(int64_t ir = 0; ir < mc; ir += MR)
+                                    {
+                                        MicroKernel::exec(kc,
+                                                          packedA.data() + ir * kc,
+                                                          packedB.data() + jr * kc,
+                                                          accum.data() + ir * NCPad + jr,
+                                                          NCPad);
+                                    }
+                                }
+                            }
+
+                            // Epilogue: D = alpha * AB + beta * C
+                            for(int64_t i = 0; i < mc; ++i)
+                            {
+                                for(int64_t j = 0; j < nc; ++j)
+                                {
+                                    auto row  = row0 + i;
+                                    auto col  = col0 + j;
+                                    auto cIdx = std::is_same<LayoutC, row_major>::value
+                                                    ? row * ldc + col
+                                                    : col * ldc + row;
+                                    auto dIdx = std::is_same<LayoutD, row_major>::value
+                                                    ? row * ldd + col
+                                                    : col * ldd + row;
+
+                                    d[dIdx] = static_cast<OutputT>(
+                                        alpha * accum[i * NCPad + j]
+                                        + beta * static_cast<ComputeT>(c[cIdx]));
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+        } // namespace GemmCPU
+
+    } // namespace detail
+
+    // D = alpha * A * B + beta * C, with leading dimensions in elements
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_blocked_CPU(uint32_t       m,
+                          uint32_t       n,
+                          uint32_t       k,
+                          InputT const*  a,
+                          InputT const*  b,
+                          OutputT const* c,
+                          OutputT*       d,
+                          uint32_t       lda,
+                          uint32_t       ldb,
+                          uint32_t       ldc,
+                          uint32_t       ldd,
+                          ComputeT       alpha,
+                          ComputeT       beta)
+    {
+        using namespace detail::GemmCPU;
+
+#if ROCWMMA_HOST_GEMM_X86_SIMD
+        // Vectorized micro-kernels are available for native f32 and f64 accumulation,
+        // which covers all inputs with f32 / f64 ComputeT (f8, bf8, f16, bf16, xf32, f32, f64).
+        if constexpr(std::is_same<ComputeT, float32_t>::value
+                     || std::is_same<ComputeT, float64_t>::value)
+        {
+            switch(hostSimdIsa())
+            {
+            case SimdIsa::Avx512:
+                return gemmBlocked<Avx512Kernel<ComputeT>,
+                                   InputT,
+                                   OutputT,
+                                   ComputeT,
+                                   LayoutA,
+                                   LayoutB,
+                                   LayoutC,
+                                   LayoutD>(m, n, k, a, b, c, d, lda, ldb, ldc, ldd, alpha, beta);
+            case SimdIsa::Avx2:
+                return gemmBlocked<Avx2Kernel<ComputeT>,
+                                   InputT,
+                                   OutputT,
+                                   ComputeT,
+                                   LayoutA,
+                                   LayoutB,
+                                   LayoutC,
+                                   LayoutD>(m, n, k, a, b, c, d, lda, ldb, ldc, ldd, alpha, beta);
+            default:;
+            }
+        }
+#endif // ROCWMMA_HOST_GEMM_X86_SIMD
+
+        // Integral (i8 -> i32) and reduced precision accumulation use the portable kernel
+        gemmBlocked<ScalarKernel<ComputeT>,
+                    InputT,
+                    OutputT,
+                    ComputeT,
+                    LayoutA,
+                    LayoutB,
+                    LayoutC,
+                    LayoutD>(m, n, k, a, b, c, d, lda, ldb, ldc, ldd, alpha, beta);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_HOST_GEMM_HPP
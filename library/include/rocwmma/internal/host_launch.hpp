@@ -0,0 +1,350 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_HOST_LAUNCH_HPP
+#define ROCWMMA_HOST_LAUNCH_HPP
+
+#if !defined(__HIPCC_RTC__)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+#include "utils.hpp"
+
+namespace rocwmma
+{
+    namespace host
+    {
+        namespace detail
+        {
+            // Thrown to waves that wait on, or arrive at, an aborted barrier
+            struct WorkgroupAborted : public std::exception
+            {
+                const char* what() const noexcept override
+                {
+                    return "rocWMMA host workgroup aborted";
+                }
+            };
+
+            // Reusable barrier for the simulated waves of a workgroup
+            class WorkgroupBarrier
+            {
+            public:
+                explicit WorkgroupBarrier(uint32_t count)
+                    : mCount(count)
+                    , mWaiting(0u)
+                    , mGeneration(0u)
+                    , mAborted(false)
+                {
+                }
+
+                void arriveAndWait()
+                {
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    if(mAborted)
+                    {
+                        throw WorkgroupAborted();
+                    }
+
+                    auto generation = mGeneration;
+                    if(++mWaiting == mCount)
+                    {
+                        mWaiting = 0u;
+                        mGeneration++;
+                        mCondition.notify_all();
+                    }
+                    else
+                    {
+                        mCondition.wait(lock,
+                                        [&] { return mAborted || generation != mGeneration; });
+                        if(generation == mGeneration)
+                        {
+                            throw WorkgroupAborted();
+                        }
+                    }
+                }
+
+                // A wave that will never arrive again releases the others.
+                // Waiting and later arrivals throw WorkgroupAborted.
+                void abort()
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mAborted = true;
+                    mCondition.notify_all();
+                }
+
+            private:
+                std::mutex              mMutex;
+                std::condition_variable mCondition;
+                uint32_t                mCount;
+                uint32_t                mWaiting;
+                uint64_t                mGeneration;
+                bool                    mAborted;
+            };
+
+            // Execution resources for one workgroup in flight
+            struct WorkgroupSlot
+            {
+                explicit WorkgroupSlot(uint32_t waveCount, size_t sharedMemBytes)
+                    : mBarrier(waveCount)
+                    , mSharedMem(sharedMemBytes)
+                    , mWorkgroupId(0u)
+                {
+                }
+
+                WorkgroupBarrier  mBarrier;
+                std::vector<char> mSharedMem;
+                uint32_t          mWorkgroupId;
+            };
+
+        } // namespace detail
+
+        /*! \class WaveContext
+        *  \brief Execution context of one simulated wave in the host backend.
+        *
+        * Takes the place of the threadIdx / blockIdx built-ins in host kernels.
+        * Coordinates are in (x, y) order, as they are in MappingUtil.
+        */
+        class WaveContext
+        {
+        public:
+            WaveContext(Coord2d const&            workgroupCoord,
+                        Coord2d const&            workgroupCount,
+                        Coord2d const&            waveCoord,
+                        Coord2d const&            workgroupDim,
+                        detail::WorkgroupSlot&    slot)
+                : mWorkgroupCoord(workgroupCoord)
+                , mWorkgroupCount(workgroupCount)
+                , mWaveCoord(waveCoord)
+                , mWorkgroupDim(workgroupDim)
+                , mSlot(slot)
+            {
+            }
+
+            // Workgroup coordinate in the grid (blockIdx)
+            inline Coord2d workgroupCoord() const
+            {
+                return mWorkgroupCoord;
+            }
+
+            // Grid size in workgroups (gridDim)
+            inline Coord2d workgroupCount() const
+            {
+                return mWorkgroupCount;
+            }
+
+            // Wave coordinate in the workgroup
+            inline Coord2d waveCoord() const
+            {
+                return mWaveCoord;
+            }
+
+            // Workgroup size in waves
+            inline Coord2d workgroupDim() const
+            {
+                return mWorkgroupDim;
+            }
+
+            // Global wave coordinate in the grid
+            inline Coord2d globalWaveCoord() const
+            {
+                return make_coord2d(
+                    get<0>(mWorkgroupCoord) * get<0>(mWorkgroupDim) + get<0>(mWaveCoord),
+                    get<1>(mWorkgroupCoord) * get<1>(mWorkgroupDim) + get<1>(mWaveCoord));
+            }
+
+            // Row major wave order in the workgroup, as used by default cooperative IO
+            inline uint32_t waveIndex() const
+            {
+                return get<0>(mWaveCoord) * get<1>(mWorkgroupDim) + get<1>(mWaveCoord);
+            }
+
+            inline uint32_t waveCount() const
+            {
+                return get<0>(mWorkgroupDim) * get<1>(mWorkgroupDim);
+            }
+
+            // Workgroup shared memory (LDS), sized at launch
+            template <typename DataT = void>
+            inline DataT* sharedMemory() const
+            {
+                return reinterpret_cast<DataT*>(mSlot.mSharedMem.data());
+            }
+
+            // Synchronization point for all waves in the workgroup (__syncthreads)
+            inline void synchronize() const
+            {
+                mSlot.mBarrier.arriveAndWait();
+            }
+
+        private:
+            Coord2d                mWorkgroupCoord;
+            Coord2d                mWorkgroupCount;
+            Coord2d                mWaveCoord;
+            Coord2d                mWorkgroupDim;
+            detail::WorkgroupSlot& mSlot;
+        };
+
+        /**
+        * Runs a host kernel over a grid of workgroups of simulated waves.
+        *
+        * Each wave of a workgroup runs on its own thread so that waves may synchronize
+        * through WaveContext::synchronize(). Workgroups are distributed dynamically
+        * over as many concurrent workgroup slots as fit in threadCount.
+        *
+        * @param workgroupCount Grid size in workgroups (x, y)
+        * @param workgroupDim Workgroup size in waves (x, y)
+        * @param kernel Callable as kernel(WaveContext const&)
+        * @param sharedMemBytes Shared memory available to each workgroup
+        * @param threadCount Max host threads to use, 0 for hardware concurrency
+        * @throws The first exception thrown by a wave. Other waves of its workgroup are
+        *         released from WaveContext::synchronize() and abandon the workgroup.
+        *         Workgroups in flight on other slots complete; no new ones are started.
+        */
+        template <typename KernelT>
+        void launch_kernel(Coord2d const& workgroupCount,
+                           Coord2d const& workgroupDim,
+                           KernelT&&      kernel,
+                           size_t         sharedMemBytes = 0u,
+                           uint32_t       threadCount    = 0u)
+        {
+            auto const gridX       = get<0>(workgroupCount);
+            auto const gridY       = get<1>(workgroupCount);
+            auto const workgroups  = gridX * gridY;
+            auto const waveCount   = get<0>(workgroupDim) * get<1>(workgroupDim);
+            if(workgroups == 0u || waveCount == 0u)
+            {
+                return;
+            }
+
+            if(threadCount == 0u)
+            {
+                threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+
+            auto const slotCount
+                = std::min(std::max(threadCount / waveCount, 1u), workgroups);
+
+            std::vector<std::unique_ptr<detail::WorkgroupSlot>> slots(slotCount);
+            for(auto& slot : slots)
+            {
+                slot = std::make_unique<detail::WorkgroupSlot>(waveCount, sharedMemBytes);
+            }
+
+            std::atomic<uint32_t> nextWorkgroup(0u);
+            std::exception_ptr    error = nullptr;
+            std::mutex            errorMutex;
+
+            auto waveLoop = [&](detail::WorkgroupSlot& slot, uint32_t waveId) {
+                auto waveCoord = make_coord2d(waveId / get<1>(workgroupDim),
+                                              waveId % get<1>(workgroupDim));
+                try
+                {
+                    while(true)
+                    {
+                        // Wave 0 fetches the next workgroup for the slot
+                        if(waveId == 0u)
+                        {
+                            slot.mWorkgroupId = nextWorkgroup.fetch_add(1u);
+                        }
+                        slot.mBarrier.arriveAndWait();
+
+                        auto workgroupId = slot.mWorkgroupId;
+                        if(workgroupId >= workgroups)
+                        {
+                            break;
+                        }
+
+                        // Workgroups are ordered x-major as on device
+                        WaveContext context(
+                            make_coord2d(workgroupId % gridX, workgroupId / gridX),
+                            workgroupCount,
+                            waveCoord,
+                            workgroupDim,
+                            slot);
+                        kernel(static_cast<WaveContext const&>(context));
+
+                        // All waves retire before the slot is reused
+                        slot.mBarrier.arriveAndWait();
+                    }
+                }
+                catch(detail::WorkgroupAborted const&)
+                {
+                    // Released by a failing wave of the same workgroup, which reports the error
+                }
+                catch(...)
+                {
+                    // Keep the first error and stop handing out workgroups
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if(!error)
+                        {
+                            error = std::current_exception();
+                        }
+                    }
+                    nextWorkgroup.store(workgroups);
+
+                    // This wave will not arrive again, so the slot cannot continue.
+                    // Release its other waves instead of leaving them waiting.
+                    slot.mBarrier.abort();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(slotCount * waveCount);
+            for(auto& slot : slots)
+            {
+                for(uint32_t waveId = 0u; waveId < waveCount; waveId++)
+                {
+                    threads.emplace_back(waveLoop, std::ref(*slot), waveId);
+                }
+            }
+
+            for(auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+    } // namespace host
+
+} // namespace rocwmma
+
+#endif // !defined(__HIPCC_RTC__)
+
+#endif // ROCWMMA_HOST_LAUNCH_HPP
@@ -0,0 +1,195 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_INT4_HPP
+#define ROCWMMA_INT4_HPP
+
+#include "blend.hpp"
+#include "cache_policy.hpp"
+#include "io_layout.hpp"
+#include "io_shape.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    /*! \struct PackedIOConfig
+ *  \brief Input configuration of packed 4-bit fragments.
+ *
+ * Two consecutive K elements share a byte, the lower K in the low nibble. A packed
+ * matrix_a is then a BlockM x (BlockK / 2) block of bytes, and a packed matrix_b a
+ * (BlockK / 2) x BlockN block of bytes, each in the layout of the dense matrix.
+ *
+ * Bytes are mapped with the dense layout of the unpacked fragment at half its MaxVW.
+ * Lanes then hold the bytes of the same K as the unpacked fragment, and byte i holds
+ * its elements 2i and 2i + 1. Where K is contiguous in memory, each lane loads its
+ * bytes at full vector width.
+ *
+ * @tparam MatrixT fragment context as matrix_a or matrix_b
+ * @tparam BlockM/N/K dense block dimensions
+ * @tparam DataT packed data type as int4_t or uint4_t
+ * @tparam DataLayoutT in-memory layout as col_major or row_major
+ * @tparam UnpackedT data type of the unpacked fragment
+ */
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT,
+              typename UnpackedT>
+    struct PackedIOConfig
+    {
+        using IOShape = IOShape<MatrixT, BlockM, BlockN, BlockK>;
+        using DenseIOLayout
+            = IOLayout<MatrixT, IOShape::BlockDim, IOShape::KDim, UnpackedT, DataLayoutT, 1u>;
+
+        enum : uint32_t
+        {
+            // Elements per byte
+            PackRatio = 2u,
+
+            // Packed K dimension
+            KDim = IOShape::KDim / PackRatio,
+
+            // Vector size properties
+            MaxVW = DenseIOLayout::MaxVW / PackRatio,
+            VW    = (DenseIOLayout::VW == 1u) ? 1u : MaxVW,
+        };
+
+        using IOTraits = IOTraits<IOShape::BlockDim, KDim, uint8_t, VW>;
+
+        // Layout mapping for 1d / 2d
+        using DataLayout   = DataLayout::template Array1d<DataLayoutT>;
+        using MatrixLayout = conditional_t<
+            is_same<MatrixT, matrix_a>::value,
+            MatrixLayout::template ColNT<IOShape::BlockDim, KDim, uint8_t, DataLayoutT, VW, MaxVW>,
+            MatrixLayout::template RowNT<IOShape::BlockDim, KDim, uint8_t, DataLayoutT, VW, MaxVW>>;
+
+        template <typename CachePolicy>
+        using PolicyLoader = OpaqueLoad<IOShape::BlockDim,
+                                        KDim,
+                                        uint8_t,
+                                        DataLayout,
+                                        MatrixLayout,
+                                        VW,
+                                        CachePolicy>;
+
+        using Loader = PolicyLoader<cache_default>;
+
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Packed fragments must be matrix_a or matrix_b");
+        static_assert(is_same<DataT, int4_t>::value || is_same<DataT, uint4_t>::value,
+                      "Packed fragments must be int4_t or uint4_t");
+        static_assert(MaxVW >= 1u,
+                      "Dense MaxVW too small for packed fragments. Try increasing BlockK");
+    };
+
+    /*! \struct PackedUnpack
+ *  \brief Expands packed 4-bit registers into the registers of the unpacked fragment.
+ *
+ * Element 2i of the unpacked fragment is the low nibble of byte i, and element 2i + 1
+ * its high nibble. Each element is shifted by the zero point as (q - zeroPoint), then
+ * multiplied by the scale for floating point outputs.
+ *
+ * int8_t outputs are unpacked 8 elements per dword: both nibbles of all 4 bytes are
+ * masked out at once, offset with the zero point in a biased form that cannot carry
+ * across bytes, then interleaved with byte permutes.
+ *
+ * @tparam DataT packed data type as int4_t or uint4_t
+ */
+    template <typename DataT>
+    struct PackedUnpack
+    {
+        enum : uint32_t
+        {
+            // Sign extension bias of the 4-bit values
+            Bias = is_same<DataT, int4_t>::value ? 8u : 0u,
+
+            // Nibble masks of all bytes of a dword
+            NibbleMask = 0x0F0F0F0Fu,
+            BiasMask   = Bias * 0x01010101u,
+            SignMask   = 0x80808080u,
+        };
+
+        ROCWMMA_HOST_DEVICE static inline int32_t value(uint32_t nibble)
+        {
+            // Flipping the sign bit maps [-8, 7] to [0, 15] in order
+            return static_cast<int32_t>(nibble ^ Bias) - static_cast<int32_t>(Bias);
+        }
+
+        template <uint32_t PackedSize, uint32_t UnpackedSize>
+        ROCWMMA_DEVICE static inline void exec(VecT<int32_t, UnpackedSize>&      unpacked,
+                                               VecT<uint32_t, PackedSize> const& packed,
+                                               int32_t                           zeroPoint)
+        {
+            static_assert(UnpackedSize == 2u * PackedSize,
+                          "Packed and unpacked register counts do not match");
+
+            // Each biased byte (q + 0x80 - zeroPoint) stays within [0, 0xFF]
+            // and flipping its top bit yields the signed result.
+            auto offset = static_cast<uint32_t>(0x80 - static_cast<int32_t>(Bias) - zeroPoint)
+                          * 0x01010101u;
+
+#pragma unroll
+            for(uint32_t i = 0; i < PackedSize; i++)
+            {
+                auto lo = (((packed.data[i] & NibbleMask) ^ BiasMask) + offset) ^ SignMask;
+                auto hi = ((((packed.data[i] >> 4u) & NibbleMask) ^ BiasMask) + offset) ^ SignMask;
+
+                unpacked.data[2u * i]      = Blend::UnpackByteLo::exec(lo, hi);
+                unpacked.data[2u * i + 1u] = Blend::UnpackByteHi::exec(lo, hi);
+            }
+        }
+
+        template <typename OutputT, uint32_t PackedSize, uint32_t UnpackedSize>
+        ROCWMMA_DEVICE static inline void exec(VecT<OutputT, UnpackedSize>&     unpacked,
+                                               VecT<uint8_t, PackedSize> const& packed,
+                                               int32_t                          zeroPoint,
+                                               OutputT                          scale)
+        {
+            static_assert(UnpackedSize == 2u * PackedSize,
+                          "Packed and unpacked element counts do not match");
+
+#pragma unroll
+            for(uint32_t i = 0; i < PackedSize; i++)
+            {
+                uint32_t byte = packed.data[i];
+                auto     q0   = static_cast<float32_t>(value(byte & 0xFu) - zeroPoint);
+                auto     q1   = static_cast<float32_t>(value(byte >> 4u) - zeroPoint);
+
+                unpacked.data[2u * i]      = static_cast<OutputT>(q0) * scale;
+                unpacked.data[2u * i + 1u] = static_cast<OutputT>(q1) * scale;
+            }
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_INT4_HPP
@@ -27,6 +27,9 @@
 #define ROCWMMA_IO_CONFIG_HPP
 
 #include "broadcast.hpp"
+#include "buffer_load.hpp"
+#include "buffer_store.hpp"
+#include "cache_policy.hpp"
 #include "coop_load.hpp"
 #include "coop_store.hpp"
 #include "io_shape.hpp"
@@ -60,6 +63,11 @@ namespace rocwmma
  * @param MappingUtil global mapping utility for current fragment
  * @param Loader Issues load instructions for raw fragment data
  * @param Storer Issues store instructions for raw fragment data
+ * @param BufferLoader Issues buffer load instructions for raw fragment data
+ * @param BufferStorer Issues buffer store instructions for raw fragment data
+ * @param PolicyLoader / PolicyStorer Loader and Storer with explicit cache policy
+ * @param PolicyBufferLoader / PolicyBufferStorer BufferLoader and BufferStorer with explicit
+ *        cache policy
  */
 
     template <typename MatrixT,
@@ -81,19 +89,46 @@ namespace rocwmma
         using MappingUtil
             = MappingUtil<IOShape::BlockHeight, IOShape::BlockWidth, DataT, DataLayoutT>;
 
-        using Loader = OpaqueLoad<IOShape::BlockDim,
-                                  IOShape::KDim,
-                                  DataT,
-                                  typename IOLayout::DataLayout,
-                                  typename IOLayout::MatrixLayout,
-                                  IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyLoader = OpaqueLoad<IOShape::BlockDim,
+                                        IOShape::KDim,
+                                        DataT,
+                                        typename IOLayout::DataLayout,
+                                        typename IOLayout::MatrixLayout,
+                                        IOLayout::VW,
+                                        CachePolicy>;
 
-        using Storer = OpaqueStore<IOShape::BlockDim,
-                                   IOShape::KDim,
-                                   DataT,
-                                   typename IOLayout::DataLayout,
-                                   typename IOLayout::MatrixLayout,
-                                   IOLayout::VW>;
+        template <typename CachePolicy>
+        using PolicyStorer = OpaqueStore<IOShape::BlockDim,
+                                         IOShape::KDim,
+                                         DataT,
+                                         typename IOLayout::DataLayout,
+                                         typename IOLayout::MatrixLayout,
+                                         IOLayout::VW,
+                                         CachePolicy>;
+
+        template <typename CachePolicy>
+        using PolicyBufferLoader = BufferLoad<IOShape::BlockDim,
+                                              IOShape::KDim,
+                                              DataT,
+                                              typename IOLayout::DataLayout,
+                                              typename IOLayout::MatrixLayout,
+                                              IOLayout::VW,
+                                              CachePolicy>;
+
+        template <typename CachePolicy>
+        using PolicyBufferStorer = BufferStore<IOShape::BlockDim,
+                                               IOShape::KDim,
+                                               DataT,
+                                               typename IOLayout::DataLayout,
+                                               typename IOLayout::MatrixLayout,
+                                               IOLayout::VW,
+                                               CachePolicy>;
+
+        using Loader       = PolicyLoader<cache_default>;
+        using Storer       = PolicyStorer<cache_default>;
+        using BufferLoader = PolicyBufferLoader<cache_default>;
+        using BufferStorer = PolicyBufferStorer<cache_default>;
     };
 
     /************************************************
@@ -546,28 +546,36 @@ namespace rocwmma
                 };
 
                 ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+                {
+                    return baseOffset(threadIdx.x);
+                }
+
+                // Base offset of the given thread. Also used by the host backend to
+                // map simulated lanes.
+                ROCWMMA_HOST_DEVICE static inline typename Traits::MatrixCoordT
+                    baseOffset(uint32_t threadId)
                 {
                     // TODO: Use constexpr if on C++17
                     if constexpr(Traits::LargeDim)
                     {
-                        return make_coord2d(threadIdx.x % Traits::WaveSize, 0u);
+                        return make_coord2d(threadId % Traits::WaveSize, 0u);
                     }
                     else
                     {
-                        return make_coord2d(threadIdx.x % BlockDim,
-                                            (threadIdx.x / BlockDim) * MaxVectorWidth
+                        return make_coord2d(threadId % BlockDim,
+                                            (threadId / BlockDim) * MaxVectorWidth
                                                 % Traits::MaxKPerIO);
                     }
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
                 {
                     return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                        (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                        (uint32_t)Traits::VWSegs); // VW Segments
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strides()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
                 {
                     return make_vector(
                         make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -784,14 +792,14 @@ namespace rocwmma
                     using MatrixCoordT = Coord2d;
                 };
 
-                ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
                 {
                     return make_vector((uint32_t)Traits::BlockDimSegs, // BlockDim Segments
                                        (uint32_t)Traits::BlockKSegs, // BlockK Segments
                                        (uint32_t)Traits::VWSegs); // VW Segments
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strides()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
                 {
                     return make_vector(
                         make_coord2d((uint32_t)Traits::BlockDimStride_X,
@@ -802,17 +810,24 @@ namespace rocwmma
                 }
 
                 ROCWMMA_DEVICE static inline typename Traits::MatrixCoordT baseOffset()
+                {
+                    return baseOffset(threadIdx.x);
+                }
+
+                // Thread id variant for use from host
+                ROCWMMA_HOST_DEVICE static inline typename Traits::MatrixCoordT
+                    baseOffset(uint32_t threadId)
                 {
                     // TODO: Use constexpr if when C++ 17
                     if(Traits::LargeDim)
                     {
-                        return make_coord2d(threadIdx.x * MaxVectorWidth % Traits::MaxElementsPerIO,
+                        return make_coord2d(threadId * MaxVectorWidth % Traits::MaxElementsPerIO,
                                             0u);
                     }
                     else
                     {
-                        return make_coord2d(threadIdx.x * MaxVectorWidth % BlockDim,
-                                            threadIdx.x * MaxVectorWidth / BlockDim
+                        return make_coord2d(threadId * MaxVectorWidth % BlockDim,
+                                            threadId * MaxVectorWidth / BlockDim
                                                 % Traits::MaxKPerIO);
                     }
                 }
@@ -925,12 +940,18 @@ namespace rocwmma
                     return swap(Traits::OrthoLayout::baseOffset());
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+                ROCWMMA_HOST_DEVICE static inline typename Traits::MatrixCoordT
+                    baseOffset(uint32_t threadId)
+                {
+                    return swap(Traits::OrthoLayout::baseOffset(threadId));
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
                 {
                     return Traits::OrthoLayout::strideCounts();
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strides()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
                 {
                     auto t = Traits::OrthoLayout::strides();
                     return make_vector(swap(get<0>(t)), swap(get<1>(t)), swap(get<2>(t)));
@@ -970,12 +991,18 @@ namespace rocwmma
                     return swap(Traits::OrthoLayout::baseOffset());
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strideCounts()
+                ROCWMMA_HOST_DEVICE static inline typename Traits::MatrixCoordT
+                    baseOffset(uint32_t threadId)
+                {
+                    return swap(Traits::OrthoLayout::baseOffset(threadId));
+                }
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strideCounts()
                 {
                     return Traits::OrthoLayout::strideCounts();
                 }
 
-                ROCWMMA_DEVICE constexpr static inline auto strides()
+                ROCWMMA_HOST_DEVICE constexpr static inline auto strides()
                 {
                     auto t = Traits::OrthoLayout::strides();
                     return make_vector(swap(get<0>(t)), swap(get<1>(t)), swap(get<2>(t)));
@@ -98,10 +98,10 @@ namespace rocwmma
             };
 
             // Determine the leading dimension of a matrix.
-            ROCWMMA_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
+            ROCWMMA_HOST_DEVICE constexpr static inline auto leadingDim(MatrixSizeT const& matrixSize);
 
             // Global data coordinate space (1d element) transform for a matrix coordinate.
-            ROCWMMA_DEVICE constexpr static inline auto
+            ROCWMMA_HOST_DEVICE constexpr static inline auto
                 fromMatrixCoord(MatrixCoordT const& matrixCoord, uint32_t leadingDim);
         };
 
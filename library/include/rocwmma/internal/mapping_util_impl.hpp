@@ -133,14 +133,14 @@ namespace rocwmma
 
         /// DataSpace
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::leadingDim(MatrixSizeT const& matrixSize)
         {
             return get<MinorIndex>(matrixSize);
         }
 
         template <typename DataOrientation>
-        ROCWMMA_DEVICE constexpr inline auto
+        ROCWMMA_HOST_DEVICE constexpr inline auto
             DataSpace<DataOrientation>::fromMatrixCoord(MatrixCoordT const& matrixCoord,
                                                         uint32_t            leadingDim)
         {
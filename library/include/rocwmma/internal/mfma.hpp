@@ -131,6 +131,91 @@ namespace rocwmma
         }
     };
 
+#if ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
+    /*! \struct MfmaEmulator
+    *  \brief Host emulation of Mfma::exec for a full fragment block.
+    *
+    * Register files are unpacked and lane-major for the entire wave, in the same
+    * element order as the unpacked fragment registers. As in Mfma::exec, each
+    * successive MFMA consumes the next ARegCount / BRegCount elements of every lane
+    * and accumulates into D in order.
+    *
+    * @tparam InputT Input data type of A / B
+    * @tparam ComputeT Data type of C / D
+    * @tparam BlockM / BlockN / BlockK Fragment block dimensions
+    * @tparam ArchId Target architecture to emulate
+    */
+    template <typename InputT,
+              typename ComputeT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              uint32_t ArchId = Constants::AMDGCN_ARCH_ID_GFX942>
+    struct MfmaEmulator
+    {
+        using MFMA = detail::amdgcn_mfma_emulator<InputT, ComputeT, BlockM, BlockN, ArchId>;
+
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                MfmaCount = BlockK / MFMA::Traits::KPerMfma,
+                MinK      = MFMA::Traits::KPerMfma,
+                WaveSize  = MFMA::Traits::WaveSize,
+                ARegCount = MfmaCount * MFMA::Traits::ARegCount,
+                BRegCount = MfmaCount * MFMA::Traits::BRegCount,
+                CRegCount = MFMA::Traits::CRegCount,
+                DRegCount = MFMA::Traits::DRegCount,
+            };
+
+            // Sanity checks
+            static_assert(BlockK >= MinK, "BlockK is not a minimum of MinK");
+            static_assert(BlockK % MinK == 0, "BlockK is not a multiple of MinK");
+        };
+
+        ROCWMMA_HOST static inline void exec(InputT const*   regsA,
+                                             InputT const*   regsB,
+                                             ComputeT const* regsC,
+                                             ComputeT*       regsD)
+        {
+            constexpr uint32_t WaveSize   = Traits::WaveSize;
+            constexpr uint32_t MfmaRegsA  = MFMA::Traits::ARegCount;
+            constexpr uint32_t MfmaRegsB  = MFMA::Traits::BRegCount;
+            constexpr uint32_t AccumCount = WaveSize * Traits::CRegCount;
+
+            for(uint32_t i = 0u; i < AccumCount; i++)
+            {
+                regsD[i] = regsC[i];
+            }
+
+            InputT mfmaA[WaveSize * MfmaRegsA];
+            InputT mfmaB[WaveSize * MfmaRegsB];
+
+            // Accumulate over MFMA count
+            for(uint32_t i = 0u; i < Traits::MfmaCount; i++)
+            {
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t r = 0u; r < MfmaRegsA; r++)
+                    {
+                        mfmaA[lane * MfmaRegsA + r]
+                            = regsA[lane * Traits::ARegCount + i * MfmaRegsA + r];
+                    }
+                    for(uint32_t r = 0u; r < MfmaRegsB; r++)
+                    {
+                        mfmaB[lane * MfmaRegsB + r]
+                            = regsB[lane * Traits::BRegCount + i * MfmaRegsB + r];
+                    }
+                }
+
+                MFMA::exec(mfmaA, mfmaB, regsD, regsD);
+            }
+        }
+    };
+
+#endif // ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_MFMA_HPP
@@ -26,8 +26,10 @@
 #ifndef ROCWMMA_MFMA_IMPL_HPP
 #define ROCWMMA_MFMA_IMPL_HPP
 
+#include "constants.hpp"
 #include "convert.hpp"
 #include "io_traits.hpp"
+#include "mma_emulator.hpp"
 #include "types.hpp"
 #include "vector.hpp"
 
@@ -1112,6 +1114,153 @@ namespace rocwmma
 
 #endif // ROCWMMA_ARCH_GFX9
 
+        // K-dimension of the MFMA instruction selected for the given target.
+        // KPerMfma = 0 indicates the combination has no MFMA instruction.
+        template <typename InputT, uint32_t BlockM, uint32_t ArchId>
+        struct amdgcn_mfma_emulator_k
+        {
+        private:
+            constexpr static bool IsGfx908 = (ArchId == Constants::AMDGCN_ARCH_ID_GFX908);
+            constexpr static bool IsGfx94x = (ArchId == Constants::AMDGCN_ARCH_ID_GFX940)
+                                             || (ArchId == Constants::AMDGCN_ARCH_ID_GFX941)
+                                             || (ArchId == Constants::AMDGCN_ARCH_ID_GFX942);
+
+            constexpr static uint32_t select()
+            {
+                // 32x32 instructions have half the K of their 16x16 counterparts
+                constexpr uint32_t Div = (BlockM == 32u) ? 2u : 1u;
+
+                if constexpr(BlockM != 16u && BlockM != 32u)
+                {
+                    return 0u;
+                }
+#if !ROCWMMA_NO_HALF
+                else if constexpr(is_same_v<InputT, hfloat16_t>)
+                {
+                    return 16u / Div;
+                }
+#endif // !ROCWMMA_NO_HALF
+                else if constexpr(is_same_v<InputT, float16_t>)
+                {
+                    return 16u / Div;
+                }
+                else if constexpr(is_same_v<InputT, bfloat16_t>)
+                {
+                    return (IsGfx908 ? 8u : 16u) / Div;
+                }
+                else if constexpr(is_same_v<InputT, int8_t>)
+                {
+                    return (IsGfx94x ? 32u : 16u) / Div;
+                }
+                else if constexpr(is_same_v<InputT, float32_t>)
+                {
+                    return 4u / Div;
+                }
+                else if constexpr(is_same_v<InputT, float64_t>)
+                {
+                    return (!IsGfx908 && BlockM == 16u) ? 4u : 0u;
+                }
+                else if constexpr(is_same_v<InputT, float8_t> || is_same_v<InputT, bfloat8_t>)
+                {
+                    return IsGfx94x ? 32u / Div : 0u;
+                }
+                else if constexpr(is_same_v<InputT, xfloat32_t>)
+                {
+                    return IsGfx94x ? 8u / Div : 0u;
+                }
+                else
+                {
+                    return 0u;
+                }
+            }
+
+        public:
+            enum : uint32_t
+            {
+                KPerMfma = select()
+            };
+        };
+
+#if ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
+        /*! \struct amdgcn_mfma_emulator
+        *  \brief Host emulator of a single MFMA instruction.
+        *
+        * Mirrors amdgcn_mfma for the given target architecture, including the
+        * fp32 MFMA unit used for f16 / bf16 accumulation, with conversion of C and D
+        * at the instruction boundary. Register files are unpacked and lane-major
+        * for the entire wave. See BlockMmaEmulator for the register mapping.
+        *
+        * @tparam InputT Input data type of A / B
+        * @tparam ComputeT Data type of C / D
+        * @tparam BlockM / BlockN Block dimensions of the instruction
+        * @tparam ArchId Target architecture to emulate
+        */
+        template <typename InputT,
+                  typename ComputeT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t ArchId = Constants::AMDGCN_ARCH_ID_GFX942>
+        struct amdgcn_mfma_emulator
+        {
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerMfma  = amdgcn_mfma_emulator_k<InputT, BlockM, ArchId>::KPerMfma,
+                    WaveSize  = Constants::AMDGCN_WAVE_SIZE_64,
+                    ARegCount = BlockM * KPerMfma / WaveSize,
+                    BRegCount = BlockN * KPerMfma / WaveSize,
+                    CRegCount = BlockM * BlockN / WaveSize,
+                    DRegCount = CRegCount,
+
+                    // Modeled dot product width: the K elements of one lane
+                    KPerGroup = ARegCount,
+
+                    // f64 accumulators do not group rows
+                    AccVW = is_same_v<ComputeT, float64_t> ? 1u : 4u
+                };
+            };
+
+            static_assert(Traits::KPerMfma > 0u, "Unsupported MFMA for the target architecture");
+            static_assert(BlockM == BlockN, "MFMA blocks must be square");
+
+            using Emulator = BlockMmaEmulator<InputT,
+                                              BlockM,
+                                              BlockN,
+                                              Traits::KPerMfma,
+                                              Traits::ARegCount,
+                                              Traits::KPerGroup,
+                                              Traits::AccVW,
+                                              Traits::WaveSize>;
+            using AccumT   = typename Emulator::AccumT;
+
+            ROCWMMA_HOST static inline void exec(InputT const*   regsA,
+                                                 InputT const*   regsB,
+                                                 ComputeT const* regsC,
+                                                 ComputeT*       regsD)
+            {
+                constexpr uint32_t AccCount = Traits::WaveSize * Traits::CRegCount;
+
+                // MFMA unit compute type is always fp32 for 16b accumulation.
+                // Upconvert C, emulate, then down convert D
+                AccumT accum[AccCount];
+                for(uint32_t i = 0u; i < AccCount; i++)
+                {
+                    accum[i] = convert<AccumT>(regsC[i]);
+                }
+
+                Emulator::exec(regsA, regsB, accum);
+
+                for(uint32_t i = 0u; i < AccCount; i++)
+                {
+                    regsD[i] = convert<ComputeT>(accum[i]);
+                }
+            }
+        };
+
+#endif // ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
     } // namespace detail
 
 } // namespace rocwmma
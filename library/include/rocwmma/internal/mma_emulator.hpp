@@ -0,0 +1,273 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_MMA_EMULATOR_HPP
+#define ROCWMMA_MMA_EMULATOR_HPP
+
+#if !defined(__HIPCC_RTC__)
+#include <cmath>
+#endif // !defined(__HIPCC_RTC__)
+
+#include "types.hpp"
+#include "types_ext.hpp"
+
+// Element-wise fma on host vectors (Clang)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_elementwise_fma)
+#define ROCWMMA_EMULATOR_VECTOR_FMA 1
+#endif // __has_builtin(__builtin_elementwise_fma)
+#endif // defined(__has_builtin)
+#if !defined(ROCWMMA_EMULATOR_VECTOR_FMA)
+#define ROCWMMA_EMULATOR_VECTOR_FMA 0
+#endif // !defined(ROCWMMA_EMULATOR_VECTOR_FMA)
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        /*! \struct MmaEmulatorTraits
+        *  \brief Arithmetic model of the matrix core MAC for a given input type.
+        *
+        * Narrow float inputs (f8, bf8, f16, bf16, xf32) are modeled as a dot product unit:
+        * the products of a group of K elements are summed with the accumulator exactly
+        * (in GroupT = f64) and rounded once to the f32 accumulator per group.
+        * This is exact unless the terms of a group span more than 53 bits of magnitude.
+        * f32 and f64 inputs are modeled as one fused multiply-add per K element.
+        * i8 products are accumulated in i32 with two's complement wrap-around.
+        *
+        * @tparam InputT Input data type of A / B
+        */
+        template <typename InputT>
+        struct MmaEmulatorTraits
+        {
+            using AccumT = float32_t;
+            using GroupT = float64_t;
+
+            constexpr static bool Fused = false;
+        };
+
+        template <>
+        struct MmaEmulatorTraits<float32_t>
+        {
+            using AccumT = float32_t;
+            using GroupT = float32_t;
+
+            constexpr static bool Fused = true;
+        };
+
+        template <>
+        struct MmaEmulatorTraits<float64_t>
+        {
+            using AccumT = float64_t;
+            using GroupT = float64_t;
+
+            constexpr static bool Fused = true;
+        };
+
+        template <>
+        struct MmaEmulatorTraits<int8_t>
+        {
+            using AccumT = int32_t;
+            using GroupT = uint32_t;
+
+            constexpr static bool Fused = false;
+        };
+
+        // Host SIMD vector of N elements. GCC vector extensions are understood by
+        // both GCC and Clang, and lower to the widest vector ISA of the host target.
+        template <typename T, uint32_t N>
+        struct MmaEmulatorVec
+        {
+            typedef T Type __attribute__((vector_size(N * sizeof(T))));
+        };
+
+        /*! \struct BlockMmaEmulator
+        *  \brief Host emulation of a single block MAC instruction D = A x B + C
+        *         over the unpacked register file of an entire wave.
+        *
+        * Register files are lane-major: element r of lane l lives at [l * RegCount + r].
+        *
+        * A / B register mapping (same for MFMA and WMMA):
+        * lane l, register r holds A(l % BlockM, (l / BlockM) * KPerLane + r),
+        * or B((l / BlockN) * KPerLane + r, l % BlockN). Only the first InputLanes
+        * lanes contribute; WMMA replicates its inputs in the upper half-wave.
+        *
+        * Accumulator register mapping:
+        * lane l, register r holds C(row, l % BlockN) where rows are grouped in
+        * AccVW consecutive registers per lane, followed by the next group of lanes:
+        * row = (r / AccVW) * (AccVW * WaveSize / BlockN) + (l / BlockN) * AccVW + r % AccVW
+        *
+        * K is consumed in ascending groups of KPerGroup elements, each rounded once
+        * (see MmaEmulatorTraits). The grouping is a model of the instruction's dot product
+        * width: results are not guaranteed to be bit-identical to the device.
+        * Rows of C and B are held in host SIMD vectors of BlockN elements, so each
+        * multiply-accumulate step updates a full row of the tile.
+        *
+        * @tparam InputT Input data type of A / B
+        * @tparam BlockM / BlockN Block dimensions of the instruction
+        * @tparam KPerMma K dimension of the instruction
+        * @tparam KPerLane Count of K elements held per lane for A / B
+        * @tparam KPerGroup Count of K elements per dot product rounding step
+        * @tparam AccVW Consecutive accumulator rows held per lane
+        * @tparam WaveSize Count of lanes in the wave
+        */
+        template <typename InputT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t KPerMma,
+                  uint32_t KPerLane,
+                  uint32_t KPerGroup,
+                  uint32_t AccVW,
+                  uint32_t WaveSize>
+        struct BlockMmaEmulator
+        {
+            using MacTraits = MmaEmulatorTraits<InputT>;
+            using AccumT    = typename MacTraits::AccumT;
+            using GroupT    = typename MacTraits::GroupT;
+            using AccumVecT = typename MmaEmulatorVec<AccumT, BlockN>::Type;
+            using GroupVecT = typename MmaEmulatorVec<GroupT, BlockN>::Type;
+
+            enum : uint32_t
+            {
+                InputLanesA = BlockM * KPerMma / KPerLane,
+                InputLanesB = BlockN * KPerMma / KPerLane,
+                AccRegCount = BlockM * BlockN / WaveSize,
+            };
+
+            static_assert(InputLanesA <= WaveSize && InputLanesB <= WaveSize,
+                          "Inputs exceed the wave size");
+            static_assert(KPerMma % KPerLane == 0u, "KPerMma must be a multiple of KPerLane");
+            static_assert(KPerMma % KPerGroup == 0u, "KPerMma must be a multiple of KPerGroup");
+            static_assert(!MacTraits::Fused || KPerGroup == 1u,
+                          "Fused multiply-add steps do not group K");
+            static_assert(AccRegCount % AccVW == 0u, "Accumulator VW must divide register count");
+
+            ROCWMMA_HOST static inline void
+                exec(InputT const* regsA, InputT const* regsB, AccumT* regsAcc)
+            {
+                GroupT    tileA[BlockM][KPerMma];
+                GroupVecT tileB[KPerMma];
+                AccumVecT tileAcc[BlockM];
+
+                // Gather the wave registers into dense tiles
+                for(uint32_t lane = 0u; lane < InputLanesA; lane++)
+                {
+                    for(uint32_t r = 0u; r < KPerLane; r++)
+                    {
+                        tileA[lane % BlockM][(lane / BlockM) * KPerLane + r]
+                            = static_cast<GroupT>(convert<AccumT>(regsA[lane * KPerLane + r]));
+                    }
+                }
+
+                for(uint32_t lane = 0u; lane < InputLanesB; lane++)
+                {
+                    for(uint32_t r = 0u; r < KPerLane; r++)
+                    {
+                        tileB[(lane / BlockN) * KPerLane + r][lane % BlockN]
+                            = static_cast<GroupT>(convert<AccumT>(regsB[lane * KPerLane + r]));
+                    }
+                }
+
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t r = 0u; r < AccRegCount; r++)
+                    {
+                        tileAcc[accRow(lane, r)][lane % BlockN] = regsAcc[lane * AccRegCount + r];
+                    }
+                }
+
+                // Multiply-accumulate rows of C in K order
+                for(uint32_t i = 0u; i < BlockM; i++)
+                {
+                    if constexpr(MacTraits::Fused)
+                    {
+                        for(uint32_t k = 0u; k < KPerMma; k++)
+                        {
+                            tileAcc[i] = fma(splat(tileA[i][k]), tileB[k], tileAcc[i]);
+                        }
+                    }
+                    else
+                    {
+                        for(uint32_t k = 0u; k < KPerMma; k += KPerGroup)
+                        {
+                            auto sum = __builtin_convertvector(tileAcc[i], GroupVecT);
+                            for(uint32_t g = 0u; g < KPerGroup; g++)
+                            {
+                                sum += splat(tileA[i][k + g]) * tileB[k + g];
+                            }
+                            tileAcc[i] = __builtin_convertvector(sum, AccumVecT);
+                        }
+                    }
+                }
+
+                // Scatter back to the wave registers
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t r = 0u; r < AccRegCount; r++)
+                    {
+                        regsAcc[lane * AccRegCount + r] = tileAcc[accRow(lane, r)][lane % BlockN];
+                    }
+                }
+            }
+
+        private:
+            ROCWMMA_HOST constexpr static inline uint32_t accRow(uint32_t lane, uint32_t reg)
+            {
+                return (reg / AccVW) * (AccVW * WaveSize / BlockN) + (lane / BlockN) * AccVW
+                       + reg % AccVW;
+            }
+
+            ROCWMMA_HOST static inline GroupVecT splat(GroupT value)
+            {
+                GroupVecT result;
+                for(uint32_t j = 0u; j < BlockN; j++)
+                {
+                    result[j] = value;
+                }
+                return result;
+            }
+
+            ROCWMMA_HOST static inline GroupVecT
+                fma(GroupVecT const& a, GroupVecT const& b, GroupVecT const& c)
+            {
+#if ROCWMMA_EMULATOR_VECTOR_FMA
+                return __builtin_elementwise_fma(a, b, c);
+#else
+                GroupVecT result;
+                for(uint32_t j = 0u; j < BlockN; j++)
+                {
+                    result[j] = std::fma(a[j], b[j], c[j]);
+                }
+                return result;
+#endif // ROCWMMA_EMULATOR_VECTOR_FMA
+            }
+        };
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_MMA_EMULATOR_HPP
@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_OPAQUE_LOAD_HPP
 #define ROCWMMA_OPAQUE_LOAD_HPP
 
+#include "cache_policy.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "tuple.hpp"
@@ -38,19 +39,51 @@ namespace rocwmma
     namespace detail
     {
 
-        template <typename DataT, uint32_t VectorWidth>
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
         struct amdgcn_opaque_load
         {
             static_assert(VectorWidth > 0, "Vector width must be greater than 0");
             static_assert(sizeof(DataT[VectorWidth]) == sizeof(VecT<DataT, VectorWidth>),
                           "Cannot vectorize input");
 
-            using LoadT = VecT<DataT, VectorWidth>;
+            using LoadT  = VecT<DataT, VectorWidth>;
+            using Access = amdgcn_global_access<CachePolicy>;
 
             ROCWMMA_DEVICE static inline void
                 exec(LoadT& data, DataT const* dataPtr, index_t offset = 0)
             {
-                data = *reinterpret_cast<LoadT const*>(&(dataPtr[offset]));
+                data = Access::load(reinterpret_cast<LoadT const*>(&(dataPtr[offset])));
+            }
+        };
+
+        // Bounds-checked load of a vector that may straddle the matrix edge.
+        // Only the first validCount elements are read, the rest are zero-filled.
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
+        struct amdgcn_predicated_load
+        {
+            using Loader = amdgcn_opaque_load<DataT, VectorWidth, CachePolicy>;
+            using LoadT  = typename Loader::LoadT;
+            using Access = typename Loader::Access;
+
+            ROCWMMA_DEVICE static inline void
+                exec(LoadT& data, DataT const* dataPtr, uint32_t validCount)
+            {
+                if(validCount >= VectorWidth)
+                {
+                    Loader::exec(data, dataPtr);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        data[i] = static_cast<DataT>(0.0f);
+                        if(i < validCount)
+                        {
+                            data[i] = Access::load(dataPtr + i);
+                        }
+                    }
+                }
             }
         };
 
@@ -61,7 +94,8 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
     struct OpaqueLoad
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
@@ -69,9 +103,12 @@ namespace rocwmma
         struct Traits
         {
             // Raw IO on unpacked register data.
-            using Loader  = detail::amdgcn_opaque_load<DataT, VectorWidth>;
-            using LoadT   = typename Loader::LoadT;
-            using OutputT = VecT<DataT, IOTraits::UnpackedSize>;
+            using Loader = detail::amdgcn_opaque_load<DataT, VectorWidth, CachePolicy>;
+            using PredicatedLoader
+                = detail::amdgcn_predicated_load<DataT, VectorWidth, CachePolicy>;
+            using LoadT        = typename Loader::LoadT;
+            using OutputT      = VecT<DataT, IOTraits::UnpackedSize>;
+            using MatrixCoordT = Coord2d;
         };
 
         using LoadVecTraits = VecTraits<typename Traits::LoadT>;
@@ -114,6 +151,64 @@ namespace rocwmma
             }
         }
 
+        // Number of in-bounds elements of the vector at coord.
+        // Vectors are contiguous in the minor dimension of the data layout.
+        ROCWMMA_DEVICE static inline uint32_t
+            validCount(typename Traits::MatrixCoordT const& coord,
+                       typename Traits::MatrixCoordT const& extent)
+        {
+            auto major       = get<DataLayout::MajorIndex>(coord);
+            auto minor       = get<DataLayout::MinorIndex>(coord);
+            auto majorExtent = get<DataLayout::MajorIndex>(extent);
+            auto minorExtent = get<DataLayout::MinorIndex>(extent);
+            return (major < majorExtent && minor < minorExtent) ? minorExtent - minor : 0u;
+        }
+
+        // Bounds-checked unroll: tracks the matrix coordinate of each vector
+        // alongside its address.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto
+            unroll_right(Iterator&                            out,
+                         DataT const*                         dataPtr,
+                         uint32_t                             ldm,
+                         typename Traits::MatrixCoordT        coord,
+                         typename Traits::MatrixCoordT const& extent,
+                         StrideCounts&&                       strideCounts,
+                         Strides2d&&                          strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the load
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::PredicatedLoader::exec(*out, dataPtr, validCount(coord, extent));
+                    dataPtr += strideOffset;
+                    coord += stride2d;
+                    out++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        out, dataPtr, ldm, coord, extent, strideCounts, strides2d);
+                    dataPtr += strideOffset;
+                    coord += stride2d;
+                }
+            }
+        }
+
         ROCWMMA_DEVICE static void
             exec(typename Traits::OutputT& data, DataT const* dataPtr, uint32_t ldm)
         {
@@ -137,6 +232,29 @@ namespace rocwmma
                          MatrixLayout::strideCounts(),
                          MatrixLayout::strides());
         }
+
+        // Bounds-checked load. Extent is the (rows, cols) count of valid matrix
+        // elements starting at dataPtr. Out-of-bounds elements are zero-filled
+        // and never dereferenced.
+        ROCWMMA_DEVICE static void exec(typename Traits::OutputT&            data,
+                                        DataT const*                         dataPtr,
+                                        uint32_t                             ldm,
+                                        typename Traits::MatrixCoordT const& extent)
+        {
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<LoadVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            unroll_right(it,
+                         dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                         ldm,
+                         baseOffset2d,
+                         extent,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
     };
 
 } // namespace rocwmma
@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_OPAQUE_STORE_HPP
 #define ROCWMMA_OPAQUE_STORE_HPP
 
+#include "cache_policy.hpp"
 #include "io_traits.hpp"
 #include "layout.hpp"
 #include "types.hpp"
@@ -37,7 +38,7 @@ namespace rocwmma
     namespace detail
     {
 
-        template <typename DataT, uint32_t VectorWidth>
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
         struct amdgcn_opaque_store
         {
             static_assert(VectorWidth > 0, "Vector width must be greater than 0");
@@ -45,10 +46,42 @@ namespace rocwmma
                           "Cannot vectorize output");
 
             using StoreT = VecT<DataT, VectorWidth>;
+            using Access = amdgcn_global_access<CachePolicy>;
+
             ROCWMMA_DEVICE static inline void
                 exec(DataT* dataPtr, StoreT const& data, index_t offset = 0)
             {
-                *reinterpret_cast<StoreT*>(&(dataPtr[offset])) = data;
+                Access::store(reinterpret_cast<StoreT*>(&(dataPtr[offset])), data);
+            }
+        };
+
+        // Bounds-checked store of a vector that may straddle the matrix edge.
+        // Only the first validCount elements are written.
+        template <typename DataT, uint32_t VectorWidth, typename CachePolicy = cache_default>
+        struct amdgcn_predicated_store
+        {
+            using Storer = amdgcn_opaque_store<DataT, VectorWidth, CachePolicy>;
+            using StoreT = typename Storer::StoreT;
+            using Access = typename Storer::Access;
+
+            ROCWMMA_DEVICE static inline void
+                exec(DataT* dataPtr, StoreT const& data, uint32_t validCount)
+            {
+                if(validCount >= VectorWidth)
+                {
+                    Storer::exec(dataPtr, data);
+                }
+                else
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < VectorWidth; i++)
+                    {
+                        if(i < validCount)
+                        {
+                            Access::store(dataPtr + i, static_cast<DataT>(data[i]));
+                        }
+                    }
+                }
             }
         };
 
@@ -59,16 +92,20 @@ namespace rocwmma
               typename DataT,
               class DataLayout,
               class MatrixLayout,
-              uint32_t VectorWidth>
+              uint32_t VectorWidth,
+              typename CachePolicy = cache_default>
     struct OpaqueStore
     {
         using IOTraits = IOTraits<BlockDim, BlockK, DataT, VectorWidth>;
         struct Traits
         {
             // Raw IO on unpacked register data.
-            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth>;
-            using StoreT = typename Storer::StoreT;
-            using InputT = VecT<DataT, IOTraits::UnpackedSize>;
+            using Storer = detail::amdgcn_opaque_store<DataT, VectorWidth, CachePolicy>;
+            using PredicatedStorer
+                = detail::amdgcn_predicated_store<DataT, VectorWidth, CachePolicy>;
+            using StoreT       = typename Storer::StoreT;
+            using InputT       = VecT<DataT, IOTraits::UnpackedSize>;
+            using MatrixCoordT = Coord2d;
         };
 
         using StoreVecTraits = VecTraits<typename Traits::StoreT>;
@@ -109,6 +146,64 @@ namespace rocwmma
             }
         }
 
+        // Number of in-bounds elements of the vector at coord.
+        // Vectors are contiguous in the minor dimension of the data layout.
+        ROCWMMA_DEVICE static inline uint32_t
+            validCount(typename Traits::MatrixCoordT const& coord,
+                       typename Traits::MatrixCoordT const& extent)
+        {
+            auto major       = get<DataLayout::MajorIndex>(coord);
+            auto minor       = get<DataLayout::MinorIndex>(coord);
+            auto majorExtent = get<DataLayout::MajorIndex>(extent);
+            auto minorExtent = get<DataLayout::MinorIndex>(extent);
+            return (major < majorExtent && minor < minorExtent) ? minorExtent - minor : 0u;
+        }
+
+        // Bounds-checked unroll: tracks the matrix coordinate of each vector
+        // alongside its address.
+        template <size_t Depth = 0,
+                  typename Iterator,
+                  typename StrideCounts,
+                  typename Strides2d>
+        ROCWMMA_DEVICE static inline auto
+            unroll_right(DataT*                               dataPtr,
+                         Iterator&                            in,
+                         uint32_t                             ldm,
+                         typename Traits::MatrixCoordT        coord,
+                         typename Traits::MatrixCoordT const& extent,
+                         StrideCounts&&                       strideCounts,
+                         Strides2d&&                          strides2d)
+        {
+            auto stride2d     = get<Depth>(strides2d);
+            auto strideOffset = DataLayout::fromMatrixCoord(stride2d, ldm);
+            auto strideCount  = get<Depth>(strideCounts);
+
+            // Last depth layer will invoke the store
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    Traits::PredicatedStorer::exec(dataPtr, *in, validCount(coord, extent));
+                    dataPtr += strideOffset;
+                    coord += stride2d;
+                    in++;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        dataPtr, in, ldm, coord, extent, strideCounts, strides2d);
+                    dataPtr += strideOffset;
+                    coord += stride2d;
+                }
+            }
+        }
+
         ROCWMMA_DEVICE static void
             exec(DataT* dataPtr, typename Traits::InputT const& data, uint32_t ldm)
         {
@@ -131,6 +226,28 @@ namespace rocwmma
                          MatrixLayout::strideCounts(),
                          MatrixLayout::strides());
         }
+
+        // Bounds-checked store. Extent is the (rows, cols) count of valid matrix
+        // elements starting at dataPtr. Out-of-bounds elements are not written.
+        ROCWMMA_DEVICE static void exec(DataT*                               dataPtr,
+                                        typename Traits::InputT const&       data,
+                                        uint32_t                             ldm,
+                                        typename Traits::MatrixCoordT const& extent)
+        {
+            auto baseOffset2d = MatrixLayout::baseOffset();
+            auto it           = makeVectorIterator<StoreVecTraits::size()>(data).begin();
+
+            static_assert(decltype(it)::range() == IOTraits::IOCount,
+                          "IOCount inconsistent with iterator range");
+
+            unroll_right(dataPtr + DataLayout::fromMatrixCoord(baseOffset2d, ldm),
+                         it,
+                         ldm,
+                         baseOffset2d,
+                         extent,
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
     };
 
 } // namespace rocwmma
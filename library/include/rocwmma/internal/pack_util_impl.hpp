@@ -215,6 +215,31 @@ namespace rocwmma
         using PackedT   = float64_t;
     };
 
+    // Packed 4-bit types are handled as bytes of two elements
+    template <>
+    struct PackTraits<int4_t>
+    {
+        enum : uint32_t
+        {
+            PackRatio = 4
+        };
+
+        using UnpackedT = uint8_t;
+        using PackedT   = uint32_t;
+    };
+
+    template <>
+    struct PackTraits<uint4_t>
+    {
+        enum : uint32_t
+        {
+            PackRatio = 4
+        };
+
+        using UnpackedT = uint8_t;
+        using PackedT   = uint32_t;
+    };
+
     template <typename DataT>
     template <uint32_t PadIdx /*= 0u*/, uint32_t GetIdx /*= 0u*/, uint32_t VecSize>
     ROCWMMA_DEVICE /*static*/ inline decltype(auto)
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_PHILOX_HPP
+#define ROCWMMA_PHILOX_HPP
+
+#include "types.hpp"
+#include "utility/type_traits.hpp"
+
+namespace rocwmma
+{
+    // Stateless counter-based generator (Philox4x32-10, Salmon et al. SC'11).
+    // The output is a pure function of (counter, key), so host and device
+    // produce identical streams regardless of thread count or visiting order.
+    // Used to fill test and sample matrices.
+    struct Philox4x32
+    {
+        using CounterT = uint32_t[4];
+        using KeyT     = uint32_t[2];
+
+        static constexpr uint32_t Rounds = 10u;
+        static constexpr uint32_t M0     = 0xD2511F53u;
+        static constexpr uint32_t M1     = 0xCD9E8D57u;
+        static constexpr uint32_t W0     = 0x9E3779B9u;
+        static constexpr uint32_t W1     = 0xBB67AE85u;
+
+        ROCWMMA_HOST_DEVICE static inline void
+            mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+        {
+            auto product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+            hi           = static_cast<uint32_t>(product >> 32u);
+            lo           = static_cast<uint32_t>(product);
+        }
+
+        // Generates four 32b words in place of the counter
+        ROCWMMA_HOST_DEVICE static inline void generate(CounterT& ctr, KeyT key)
+        {
+            uint32_t k0 = key[0];
+            uint32_t k1 = key[1];
+
+            for(uint32_t r = 0u; r < Rounds; r++)
+            {
+                uint32_t hi0, lo0, hi1, lo1;
+                mulhilo(M0, ctr[0], hi0, lo0);
+                mulhilo(M1, ctr[2], hi1, lo1);
+
+                ctr[0] = hi1 ^ ctr[1] ^ k0;
+                ctr[1] = lo1;
+                ctr[2] = hi0 ^ ctr[3] ^ k1;
+                ctr[3] = lo0;
+
+                k0 += W0;
+                k1 += W1;
+            }
+        }
+
+        // Random 32b word for element (row, col) of the matrix identified by
+        // (seed, matrixId). Independent of the matrix storage layout.
+        ROCWMMA_HOST_DEVICE static inline uint32_t
+            element(uint64_t seed, uint32_t matrixId, uint32_t row, uint32_t col)
+        {
+            CounterT ctr = {row, col, matrixId, 0u};
+            KeyT     key = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32u)};
+            generate(ctr, key);
+            return ctr[0];
+        }
+
+        // Maps the random word to the same small signed integer set as the
+        // deterministic fill, so validation tolerances are unchanged.
+        template <typename DataT>
+        ROCWMMA_HOST_DEVICE static inline DataT
+            value(uint64_t seed, uint32_t matrixId, uint32_t row, uint32_t col)
+        {
+            auto value = element(seed, matrixId, row, col) % 5u;
+            return ((value % 3u) && is_signed<DataT>::value) ? -static_cast<DataT>(value)
+                                                             : static_cast<DataT>(value);
+        }
+    };
+
+    // Default seed for generated test and sample data
+    static constexpr uint64_t PhiloxDefaultSeed = 0x5EEDC0DE1234ABCDull;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_PHILOX_HPP
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REDUCE_HPP
+#define ROCWMMA_REDUCE_HPP
+
+#include "dpp.hpp"
+#include "permute.hpp"
+#include "swizzle.hpp"
+#include "type_traits.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    namespace reduction
+    {
+        /*
+        * Reduction ops combine two partial results:
+        *
+        *   template <typename DataT>
+        *   ROCWMMA_HOST_DEVICE DataT operator()(DataT lhs, DataT rhs) const;
+        *
+        * Ops must be associative and commutative: the order in which partials
+        * are combined is unspecified, but all lanes holding the same row or
+        * col obtain bitwise identical results.
+        */
+
+        struct sum
+        {
+            template <typename DataT>
+            ROCWMMA_HOST_DEVICE inline DataT operator()(DataT lhs, DataT rhs) const
+            {
+                return lhs + rhs;
+            }
+        };
+
+        struct max
+        {
+            template <typename DataT>
+            ROCWMMA_HOST_DEVICE inline DataT operator()(DataT lhs, DataT rhs) const
+            {
+                return lhs > rhs ? lhs : rhs;
+            }
+        };
+
+        struct min
+        {
+            template <typename DataT>
+            ROCWMMA_HOST_DEVICE inline DataT operator()(DataT lhs, DataT rhs) const
+            {
+                return lhs < rhs ? lhs : rhs;
+            }
+        };
+
+    } // namespace reduction
+
+    namespace detail
+    {
+        // Partials are combined in at least 32b precision: sub-dword types are widened.
+        template <typename DataT>
+        using ReduceT = conditional_t<(sizeof(DataT) >= sizeof(uint32_t)),
+                                      DataT,
+                                      conditional_t<is_integral<DataT>::value, int32_t, float32_t>>;
+
+        // Value and position of the running maximum. Ties resolve to the lower index.
+        template <typename DataT>
+        struct ArgMax
+        {
+            DataT    value;
+            uint32_t index;
+        };
+
+        struct ArgMaxOp
+        {
+            template <typename DataT>
+            ROCWMMA_DEVICE inline ArgMax<DataT> operator()(ArgMax<DataT> const& lhs,
+                                                           ArgMax<DataT> const& rhs) const
+            {
+                return (rhs.value > lhs.value || (rhs.value == lhs.value && rhs.index < lhs.index))
+                           ? rhs
+                           : lhs;
+            }
+        };
+
+        // Applies a 32b cross-lane op to each dword of any dword multiple sized type
+        template <typename CrossLaneOp, typename DataT>
+        ROCWMMA_DEVICE inline DataT crossLaneExec(DataT const& value)
+        {
+            static_assert(sizeof(DataT) % sizeof(uint32_t) == 0u,
+                          "Cross-lane data must be a multiple of 32b");
+            constexpr uint32_t DwordCount = sizeof(DataT) / sizeof(uint32_t);
+
+            VecT<uint32_t, DwordCount> dwords;
+            auto const                 src = reinterpret_cast<uint32_t const*>(&value);
+#pragma unroll
+            for(uint32_t i = 0; i < DwordCount; i++)
+            {
+                dwords.data[i] = src[i];
+            }
+
+            dwords = CrossLaneOp::exec(dwords);
+
+            DataT result;
+            auto  dst = reinterpret_cast<uint32_t*>(&result);
+#pragma unroll
+            for(uint32_t i = 0; i < DwordCount; i++)
+            {
+                dst[i] = dwords.data[i];
+            }
+            return result;
+        }
+
+        // One stage of a butterfly all-reduce: every lane exchanges with a partner
+        // in the other half of its aligned group of 2 * Stride lanes. Within rows of
+        // 16 lanes, mirrored partners are reached with DPP. Beyond, partners at the
+        // same position (lane ^ Stride) are reached with swizzle and permute, which
+        // keeps lane % Stride intact.
+        template <uint32_t Stride>
+        struct ButterflyStage;
+
+        template <>
+        struct ButterflyStage<1u>
+        {
+            using CrossLaneOp = Dpp::Reverse2<>;
+        };
+
+        template <>
+        struct ButterflyStage<2u>
+        {
+            using CrossLaneOp = Dpp::Reverse4<>;
+        };
+
+        template <>
+        struct ButterflyStage<4u>
+        {
+            using CrossLaneOp = Dpp::Reverse8<>;
+        };
+
+        template <>
+        struct ButterflyStage<8u>
+        {
+            using CrossLaneOp = Dpp::Reverse16<>;
+        };
+
+        template <>
+        struct ButterflyStage<16u>
+        {
+            using CrossLaneOp = Swizzle::Swap16;
+        };
+
+        template <>
+        struct ButterflyStage<32u>
+        {
+            using CrossLaneOp = Permute::RotateWaveL<32u>;
+        };
+
+        // Combines partials across lanes with strides in [Stride, EndStride)
+        template <uint32_t Stride, uint32_t EndStride, typename PartialT, typename CombineOp>
+        ROCWMMA_DEVICE inline PartialT butterflyReduce(PartialT const& partial, CombineOp const& op)
+        {
+            if constexpr(Stride < EndStride)
+            {
+                using CrossLaneOp = typename ButterflyStage<Stride>::CrossLaneOp;
+                return butterflyReduce<Stride * 2u, EndStride>(
+                    op(partial, crossLaneExec<CrossLaneOp>(partial)), op);
+            }
+            else
+            {
+                return partial;
+            }
+        }
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_REDUCE_HPP
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SMFMAC_HPP
+#define ROCWMMA_SMFMAC_HPP
+
+#include "config.hpp"
+#include "io_traits.hpp"
+#include "type_traits.hpp"
+#include "vector.hpp"
+#include "vector_iterator.hpp"
+
+#include "smfmac_impl.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Sparse MFMA is usable if the instruction exists and its K tiles BlockK
+        template <typename InputT,
+                  typename ComputeT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK>
+        struct SmfmacSelector
+        {
+        private:
+            enum : uint32_t
+            {
+                KPerSmfmac = amdgcn_smfmac<InputT, ComputeT, BlockM, BlockN>::Traits::KPerSmfmac
+            };
+
+        public:
+            constexpr static bool Result = (BlockM == BlockN) && (KPerSmfmac > 0u)
+                                           && (BlockK % max((uint32_t)KPerSmfmac, 1u) == 0u);
+        };
+
+    } // namespace detail
+
+    // Sparse MFMA interface.
+    // Without a sparse instruction for the block, Supported = false and sparse mma
+    // falls back to decompressing A for the dense path.
+    template <typename InputT,
+              typename ComputeT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename Enabler = void>
+    struct Smfmac
+    {
+        constexpr static bool Supported = false;
+    };
+
+    // Unlock the smfmac backend on supported targets
+    template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK>
+    struct Smfmac<
+        InputT,
+        ComputeT,
+        BlockM,
+        BlockN,
+        BlockK,
+        enable_if_t<detail::SmfmacSelector<InputT, ComputeT, BlockM, BlockN, BlockK>::Result>>
+    {
+        constexpr static bool Supported = true;
+
+        // Full-fragment IO traits. A holds half of the dense K.
+        using IOTraitsA   = IOTraits<BlockM, BlockK / 2u, InputT>;
+        using IOTraitsB   = IOTraits<BlockK, BlockN, InputT>;
+        using IOTraitsAcc = IOTraits<BlockM, BlockN, ComputeT>;
+
+        // Functional
+        using SMFMAC = detail::amdgcn_smfmac<InputT, ComputeT, BlockM, BlockN>;
+
+        // Per-SMFMAC iterative vector requirements
+        using VecTraitsA = VecTraits<typename SMFMAC::Traits::ARegsT>;
+        using VecTraitsB = VecTraits<typename SMFMAC::Traits::BRegsT>;
+        using VecTraitsC = VecTraits<typename SMFMAC::Traits::CRegsT>;
+        using VecTraitsD = VecTraits<typename SMFMAC::Traits::DRegsT>;
+
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                SmfmacCount = BlockK / SMFMAC::Traits::KPerSmfmac,
+                IndexSets   = SMFMAC::Traits::IndexSets,
+                IndexCount  = (SmfmacCount + IndexSets - 1u) / IndexSets,
+
+                // Compressed A elements per lane for each smfmac
+                AElementsPerSmfmac = IOTraitsA::UnpackedSize / SmfmacCount,
+            };
+
+            // Create full-fragment vector sizes
+            using ARegsT = typename VecTraitsA::template VecT<typename VecTraitsA::DataT,
+                                                              SmfmacCount * VecTraitsA::size()>;
+            using BRegsT = typename VecTraitsB::template VecT<typename VecTraitsB::DataT,
+                                                              SmfmacCount * VecTraitsB::size()>;
+            using CRegsT = typename VecTraitsC::template VecT<>;
+            using DRegsT = typename VecTraitsD::template VecT<>;
+
+            // One 2-bit index per compressed A element
+            using IndexT = VecT<uint32_t, IndexCount>;
+
+            // Each index set covers the compressed A elements of one smfmac
+            static_assert(AElementsPerSmfmac * 2u * IndexSets == 32u,
+                          "Unexpected index set size");
+
+            // Full fragment counts must match packed IO counts
+            static_assert(VecTraits<ARegsT>::size() == IOTraitsA::PackedSize,
+                          "Unexpected packed vector size for A");
+            static_assert(VecTraits<BRegsT>::size() == IOTraitsB::PackedSize,
+                          "Unexpected packed vector size for B");
+            static_assert(VecTraits<CRegsT>::size() == IOTraitsAcc::PackedSize,
+                          "Unexpected packed vector size for C");
+            static_assert(VecTraits<DRegsT>::size() == IOTraitsAcc::PackedSize,
+                          "Unexpected packed vector size for D");
+        };
+
+        // The index set is an instruction immediate, so the smfmac chain is unrolled
+        // at compile time.
+        template <uint32_t Index = 0u, typename IteratorA, typename IteratorB>
+        ROCWMMA_DEVICE static inline void unroll(typename Traits::DRegsT&       result,
+                                                 IteratorA&                     aIt,
+                                                 IteratorB&                     bIt,
+                                                 typename Traits::IndexT const& regsIdx)
+        {
+            if constexpr(Index < Traits::SmfmacCount)
+            {
+                result = SMFMAC::template exec<Index % Traits::IndexSets>(
+                    *aIt, *bIt, result, regsIdx.data[Index / Traits::IndexSets]);
+                aIt++;
+                bIt++;
+                unroll<Index + 1u>(result, aIt, bIt, regsIdx);
+            }
+        }
+
+        ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                               typename Traits::BRegsT const& regsB,
+                                               typename Traits::CRegsT const& regsC,
+                                               typename Traits::IndexT const& regsIdx) ->
+            typename Traits::DRegsT
+        {
+            typename Traits::DRegsT result = regsC;
+
+            // Iterate over SMFMAC input requirements
+            auto aIt = makeVectorIterator<VecTraitsA::size()>(regsA).begin();
+            auto bIt = makeVectorIterator<VecTraitsB::size()>(regsB).begin();
+
+            // Accumulate over SMFMAC count
+            unroll(result, aIt, bIt, regsIdx);
+            return result;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SMFMAC_HPP
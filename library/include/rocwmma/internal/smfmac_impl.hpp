@@ -0,0 +1,278 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SMFMAC_IMPL_HPP
+#define ROCWMMA_SMFMAC_IMPL_HPP
+
+#include "constants.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+
+    namespace detail
+    {
+        // Sparse MFMA: A holds the 2:4 compressed K, B holds the dense K.
+        // The index register carries the 2-bit position of each compressed A element
+        // within its group of 4 dense K. One index register holds IndexSets sets of
+        // indices, the set for each instruction is selected by the ABID immediate.
+        template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN>
+        struct amdgcn_smfmac
+        {
+            // No sparse instruction on this target
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 0u
+                };
+            };
+        };
+
+// Sparse MFMA is gfx94x specific
+#if ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+
+        template <>
+        struct amdgcn_smfmac<float16_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32u,
+                    IndexSets  = 4u
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_f16(
+                    reinterpret_cast<VRegF16x4 const&>(regsA).data,
+                    reinterpret_cast<VRegF16x8 const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    IndexSet)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<float16_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 16u,
+                    IndexSets  = 4u
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_f16(
+                    reinterpret_cast<VRegF16x4 const&>(regsA).data,
+                    reinterpret_cast<VRegF16x8 const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    IndexSet)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32u,
+                    IndexSets  = 4u
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x4;
+                using DRegsT = AccRegF32x4;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                // Built-in expects unpacked vectors of short.
+                using TypeInA = VecT<short, 4>;
+                using TypeInB = VecT<short, 8>;
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_16x16x32_bf16(
+                    reinterpret_cast<TypeInA const&>(regsA).data,
+                    reinterpret_cast<TypeInB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    IndexSet)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<bfloat16_t, float32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 16u,
+                    IndexSets  = 4u
+                };
+                using ARegsT = VRegF32x2;
+                using BRegsT = VRegF32x4;
+                using CRegsT = AccRegF32x16;
+                using DRegsT = AccRegF32x16;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                // Built-in expects unpacked vectors of short.
+                using TypeInA = VecT<short, 4>;
+                using TypeInB = VecT<short, 8>;
+
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_f32_32x32x16_bf16(
+                    reinterpret_cast<TypeInA const&>(regsA).data,
+                    reinterpret_cast<TypeInB const&>(regsB).data,
+                    regsC.data,
+                    static_cast<int>(regsIdx),
+                    0,
+                    IndexSet)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<int8_t, int32_t, 16, 16>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 64u,
+                    IndexSets  = 2u
+                };
+                using ARegsT = VRegI32x2;
+                using BRegsT = VRegI32x4;
+                using CRegsT = AccRegI32x4;
+                using DRegsT = AccRegI32x4;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_16x16x64_i8(
+                    regsA.data, regsB.data, regsC.data, static_cast<int>(regsIdx), 0, IndexSet)};
+                return result;
+            }
+        };
+
+        template <>
+        struct amdgcn_smfmac<int8_t, int32_t, 32, 32>
+        {
+            // Packed register traits
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerSmfmac = 32u,
+                    IndexSets  = 2u
+                };
+                using ARegsT = VRegI32x2;
+                using BRegsT = VRegI32x4;
+                using CRegsT = AccRegI32x16;
+                using DRegsT = AccRegI32x16;
+            };
+
+            template <uint32_t IndexSet>
+            ROCWMMA_DEVICE static inline auto exec(typename Traits::ARegsT const& regsA,
+                                                   typename Traits::BRegsT const& regsB,
+                                                   typename Traits::CRegsT const& regsC,
+                                                   uint32_t                       regsIdx) ->
+                typename Traits::DRegsT
+            {
+                typename Traits::DRegsT result;
+                result.data = {__builtin_amdgcn_smfmac_i32_32x32x32_i8(
+                    regsA.data, regsB.data, regsC.data, static_cast<int>(regsIdx), 0, IndexSet)};
+                return result;
+            }
+        };
+
+#endif // ROCWMMA_ARCH_GFX940 || ROCWMMA_ARCH_GFX941 || ROCWMMA_ARCH_GFX942
+
+    } // namespace detail
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SMFMAC_IMPL_HPP
@@ -0,0 +1,264 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_HPP
+#define ROCWMMA_SPARSE_HPP
+
+#include "cache_policy.hpp"
+#include "io_layout.hpp"
+#include "io_traits.hpp"
+#include "layout.hpp"
+#include "opaque_load.hpp"
+#include "tuple.hpp"
+#include "types.hpp"
+#include "vector.hpp"
+
+namespace rocwmma
+{
+    /*! \struct SparseIOConfig
+ *  \brief Input configuration of 2:4 structured sparse matrix_a fragments.
+ *
+ * Each group of 4 consecutive K elements of a row of A keeps at most 2 non-zeros.
+ * The compressed values form a BlockM x (BlockK / 2) block, and each value has a
+ * 2-bit index of its position within the dense group.
+ *
+ * Values are mapped with the ColNT layout at half of the dense matrix_a MaxVW. Lanes
+ * then hold the values of the same dense K as the dense matrix_a and matrix_b
+ * fragments, and compressed registers 2i and 2i + 1 hold the kept elements of dense
+ * registers 4i to 4i + 3.
+ *
+ * Metadata is a row_major array of bytes: byte c of row m holds the indices of the
+ * compressed columns 4c to 4c + 3, at bits [2j + 1 : 2j] for column 4c + j.
+ * In registers, indices are packed 16 per dword in the order of the compressed
+ * registers, which is the index operand format of the sparse MFMA instructions.
+ *
+ * @tparam BlockM/N/K dense block dimensions
+ * @tparam DataT data type
+ * @tparam DataLayoutT in-memory layout of the compressed values as col_major or row_major
+ */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct SparseIOConfig
+    {
+        using DenseIOLayout = IOLayout<matrix_a, BlockM, BlockK, DataT, DataLayoutT, 1u>;
+
+        enum : uint32_t
+        {
+            // Dense K elements per group, of which GroupNnz are kept
+            GroupSize = 4u,
+            GroupNnz  = 2u,
+
+            // Compressed K dimension
+            KDim = BlockK * GroupNnz / GroupSize,
+
+            // Vector size properties
+            MaxVW = DenseIOLayout::MaxVW * GroupNnz / GroupSize,
+            VW    = is_same<DataLayoutT, row_major>::value ? MaxVW : 1u,
+
+            // Packed index properties
+            IndexBits      = 2u,
+            IndicesPerByte = 8u / IndexBits,
+            IndicesPerReg  = 32u / IndexBits,
+        };
+
+        using IOTraits = IOTraits<BlockM, KDim, DataT, VW>;
+
+        // Layout mapping for 1d / 2d
+        using DataLayout = DataLayout::template Array1d<DataLayoutT>;
+        using MatrixLayout
+            = MatrixLayout::template ColNT<BlockM, KDim, DataT, DataLayoutT, VW, MaxVW>;
+
+        enum : uint32_t
+        {
+            IndexCount = ceilDiv((uint32_t)IOTraits::UnpackedSize, (uint32_t)IndicesPerReg)
+        };
+
+        using IndexT = VecT<uint32_t, IndexCount>;
+
+        template <typename CachePolicy>
+        using PolicyLoader
+            = OpaqueLoad<BlockM, KDim, DataT, DataLayout, MatrixLayout, VW, CachePolicy>;
+
+        using Loader = PolicyLoader<cache_default>;
+
+        // Groups and metadata bytes must stay within the vectors of each lane
+        static_assert(BlockK % (GroupSize * IndicesPerByte / GroupNnz) == 0u,
+                      "BlockK must be a multiple of the dense K of a metadata byte");
+        static_assert(MaxVW % IndicesPerByte == 0u,
+                      "Dense matrix_a MaxVW too small for sparse fragments. Try increasing BlockK");
+    };
+
+    /*! \struct SparseIndexLoad
+ *  \brief Loads the packed indices of a sparse fragment from metadata bytes.
+ *
+ * Walks the compressed values layout in register order. The first register of each
+ * metadata byte fetches it, and places its 4 indices in the index register.
+ *
+ * @tparam SparseIOConfig the sparse fragment configuration
+ */
+    template <typename SparseIOConfig>
+    struct SparseIndexLoad
+    {
+        using MatrixLayout = typename SparseIOConfig::MatrixLayout;
+        using IndexT       = typename SparseIOConfig::IndexT;
+
+        enum : uint32_t
+        {
+            VectorWidth    = SparseIOConfig::VW,
+            IndexBits      = SparseIOConfig::IndexBits,
+            IndicesPerByte = SparseIOConfig::IndicesPerByte,
+            IndicesPerReg  = SparseIOConfig::IndicesPerReg,
+        };
+
+        template <size_t Depth = 0, typename StrideCounts, typename Strides2d>
+        ROCWMMA_DEVICE static inline void unroll_right(IndexT&        indices,
+                                                       uint32_t&      reg,
+                                                       uint8_t const* meta,
+                                                       uint32_t       ldmeta,
+                                                       Coord2d        coord,
+                                                       StrideCounts&& strideCounts,
+                                                       Strides2d&&    strides2d)
+        {
+            auto stride2d    = get<Depth>(strides2d);
+            auto strideCount = get<Depth>(strideCounts);
+
+            // Last depth layer will load the metadata
+            if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+#pragma unroll
+                    for(uint32_t j = 0; j < VectorWidth; j++)
+                    {
+                        auto index = reg + j;
+                        if(index % IndicesPerByte == 0u)
+                        {
+                            auto col  = get<1>(coord) + j;
+                            auto byte = static_cast<uint32_t>(
+                                meta[get<0>(coord) * ldmeta + col / IndicesPerByte]);
+                            indices.data[index / IndicesPerReg]
+                                |= byte << (IndexBits * (index % IndicesPerReg));
+                        }
+                    }
+                    reg += VectorWidth;
+                    coord += stride2d;
+                }
+            }
+            // Recurse to the next nested layer
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < strideCount; i++)
+                {
+                    unroll_right<Depth + 1>(
+                        indices, reg, meta, ldmeta, coord, strideCounts, strides2d);
+                    coord += stride2d;
+                }
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void
+            exec(IndexT& indices, uint8_t const* meta, uint32_t ldmeta)
+        {
+#pragma unroll
+            for(uint32_t i = 0; i < VecTraits<IndexT>::size(); i++)
+            {
+                indices.data[i] = 0u;
+            }
+
+            uint32_t reg = 0u;
+            unroll_right(indices,
+                         reg,
+                         meta,
+                         ldmeta,
+                         MatrixLayout::baseOffset(),
+                         MatrixLayout::strideCounts(),
+                         MatrixLayout::strides());
+        }
+    };
+
+    /*! \struct SparseDecompress
+ *  \brief Expands compressed registers into dense matrix_a registers.
+ *
+ * Dense registers 4i to 4i + 3 receive compressed registers 2i and 2i + 1 at their
+ * indexed positions, and zero elsewhere. Positions are selected rather than indexed,
+ * so the registers are never spilled for dynamic access.
+ *
+ * @tparam SparseIOConfig the sparse fragment configuration
+ */
+    template <typename SparseIOConfig>
+    struct SparseDecompress
+    {
+        using IndexT = typename SparseIOConfig::IndexT;
+
+        enum : uint32_t
+        {
+            GroupSize     = SparseIOConfig::GroupSize,
+            GroupNnz      = SparseIOConfig::GroupNnz,
+            IndexBits     = SparseIOConfig::IndexBits,
+            IndicesPerReg = SparseIOConfig::IndicesPerReg,
+        };
+
+        ROCWMMA_DEVICE static inline uint32_t index(IndexT const& indices, uint32_t reg)
+        {
+            return (indices.data[reg / IndicesPerReg] >> (IndexBits * (reg % IndicesPerReg)))
+                   & ((1u << IndexBits) - 1u);
+        }
+
+        template <typename DenseT, typename ValuesT>
+        ROCWMMA_DEVICE static inline void
+            exec(DenseT& dense, ValuesT const& values, IndexT const& indices)
+        {
+            using DataT = typename VecTraits<ValuesT>::DataT;
+
+            constexpr uint32_t GroupCount = VecTraits<ValuesT>::size() / GroupNnz;
+            static_assert(VecTraits<DenseT>::size() == GroupCount * GroupSize,
+                          "Dense and compressed register counts do not match");
+
+#pragma unroll
+            for(uint32_t i = 0; i < GroupCount; i++)
+            {
+                auto index0 = index(indices, GroupNnz * i);
+                auto index1 = index(indices, GroupNnz * i + 1u);
+
+#pragma unroll
+                for(uint32_t j = 0; j < GroupSize; j++)
+                {
+                    dense.data[GroupSize * i + j]
+                        = (index0 == j) ? values.data[GroupNnz * i]
+                                        : ((index1 == j) ? values.data[GroupNnz * i + 1u]
+                                                         : static_cast<DataT>(0.0f));
+                }
+            }
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_HPP
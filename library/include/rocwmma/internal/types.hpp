@@ -64,6 +64,9 @@ namespace rocwmma
  * h16 = __half
  * bf16 = bfloat16
  *
+ * Packed Data Types:
+ * int4 / uint4 = 4-bit integers, two per byte
+ *
  */
 
     // Native types
@@ -111,6 +114,17 @@ namespace rocwmma
 
     // clang-format off
 
+    // Packed data type meta-tags.
+    // Elements are stored two per byte, the first in the low nibble.
+    /*! \struct int4_t
+ *  \brief Signed 4-bit integer in [-8, 7]
+ */
+    struct int4_t{};
+    /*! \struct uint4_t
+ *  \brief Unsigned 4-bit integer in [0, 15]
+ */
+    struct uint4_t{};
+
     // Data layout meta-tags
     /*! \struct row_major
  *  \brief Data/In-memory Layout as Row Major
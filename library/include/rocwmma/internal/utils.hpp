@@ -291,6 +291,18 @@ namespace rocwmma
         return "u32";
     }
 
+    template <>
+    constexpr const char* dataTypeToString<int4_t>()
+    {
+        return "i4";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<uint4_t>()
+    {
+        return "u4";
+    }
+
     template <>
     constexpr const char* dataTypeToString<row_major>()
     {
@@ -172,6 +172,94 @@ namespace rocwmma
 
 #endif // ROCWMMA_ARCH_GFX11
 
+#if ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
+    /*! \struct WmmaEmulator
+    *  \brief Host emulation of Wmma::exec for a full fragment block.
+    *
+    * Register files are unpacked and lane-major for the entire wave, in the same
+    * element order as the unpacked fragment registers.
+    * As in Wmma::exec, the inputs of each WMMA are built by interleaving the packed
+    * dwords of every lane with those of its Swap16 partner (lane ^ 16): even dwords
+    * are local and odd dwords come from the partner.
+    *
+    * @tparam InputT Input data type of A / B
+    * @tparam ComputeT Data type of C / D
+    * @tparam BlockM / BlockN / BlockK Fragment block dimensions
+    */
+    template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK>
+    struct WmmaEmulator
+    {
+        using WMMA = detail::amdgcn_wmma_emulator<InputT, ComputeT, BlockM, BlockN>;
+
+        struct Traits
+        {
+            enum : uint32_t
+            {
+                WmmaCount = BlockK / WMMA::Traits::KPerWmma,
+                MinK      = WMMA::Traits::KPerWmma,
+                WaveSize  = WMMA::Traits::WaveSize,
+                ARegCount = BlockM * BlockK / WaveSize,
+                BRegCount = BlockN * BlockK / WaveSize,
+                CRegCount = WMMA::Traits::CRegCount,
+                DRegCount = WMMA::Traits::DRegCount,
+
+                // Fragment elements consumed per lane, per WMMA
+                RegsPerWmma = ARegCount / WmmaCount,
+
+                // Elements per 32b packed register
+                PackRatio = sizeof(InputT) < 4u ? 4u / (uint32_t)sizeof(InputT) : 1u,
+            };
+
+            // Sanity checks
+            static_assert(BlockK >= MinK, "BlockK is not a minimum of MinK");
+            static_assert(BlockK % MinK == 0, "BlockK is not a multiple of MinK");
+            static_assert(RegsPerWmma * 2u == WMMA::Traits::ARegCount,
+                          "WMMA input size mismatch");
+        };
+
+        ROCWMMA_HOST static inline void exec(InputT const*   regsA,
+                                             InputT const*   regsB,
+                                             ComputeT const* regsC,
+                                             ComputeT*       regsD)
+        {
+            constexpr uint32_t WaveSize   = Traits::WaveSize;
+            constexpr uint32_t WmmaRegs   = WMMA::Traits::ARegCount;
+            constexpr uint32_t PackRatio  = Traits::PackRatio;
+            constexpr uint32_t AccumCount = WaveSize * Traits::CRegCount;
+
+            for(uint32_t i = 0u; i < AccumCount; i++)
+            {
+                regsD[i] = regsC[i];
+            }
+
+            InputT wmmaA[WaveSize * WmmaRegs];
+            InputT wmmaB[WaveSize * WmmaRegs];
+
+            // Accumulate over WMMA count
+            for(uint32_t i = 0u; i < Traits::WmmaCount; i++)
+            {
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    for(uint32_t e = 0u; e < WmmaRegs; e++)
+                    {
+                        auto dword   = e / PackRatio;
+                        auto srcLane = (dword % 2u == 0u) ? lane : (lane ^ 16u);
+                        auto srcReg  = i * Traits::RegsPerWmma + (dword / 2u) * PackRatio
+                                      + e % PackRatio;
+
+                        wmmaA[lane * WmmaRegs + e] = regsA[srcLane * Traits::ARegCount + srcReg];
+                        wmmaB[lane * WmmaRegs + e] = regsB[srcLane * Traits::BRegCount + srcReg];
+                    }
+                }
+
+                WMMA::exec(wmmaA, wmmaB, regsD, regsD);
+            }
+        }
+    };
+
+#endif // ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_WMMA_HPP
@@ -26,6 +26,8 @@
 #ifndef ROCWMMA_WMMA_IMPL_HPP
 #define ROCWMMA_WMMA_IMPL_HPP
 
+#include "constants.hpp"
+#include "mma_emulator.hpp"
 #include "permute.hpp"
 
 namespace rocwmma
@@ -235,6 +237,84 @@ namespace rocwmma
 
 #endif // ROCWMMA_ARCH_GFX11
 
+#if ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
+        /*! \struct amdgcn_wmma_emulator
+        *  \brief Host emulator of a single wave32 WMMA instruction.
+        *
+        * Register files are unpacked and lane-major for the entire wave.
+        * A / B: lanes [0, 16) hold 16 K values of row (col) l; the replicated
+        * upper half-wave is not read.
+        * C / D: lane l, register r holds C(2 * r + l / 16, l % 16). Accumulator
+        * registers are unpadded; f16 / bf16 accumulation is modeled on the fp32
+        * datapath with conversion at the instruction boundary.
+        *
+        * @tparam InputT Input data type of A / B
+        * @tparam ComputeT Data type of C / D
+        * @tparam BlockM / BlockN Block dimensions of the instruction
+        */
+        template <typename InputT, typename ComputeT, uint32_t BlockM, uint32_t BlockN>
+        struct amdgcn_wmma_emulator
+        {
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    KPerWmma  = 16u,
+                    WaveSize  = Constants::AMDGCN_WAVE_SIZE_32,
+                    ARegCount = KPerWmma,
+                    BRegCount = KPerWmma,
+                    CRegCount = BlockM * BlockN / WaveSize,
+                    DRegCount = CRegCount,
+
+                    // Modeled dot product width: the K elements of one packed dword
+                    KPerGroup = 4u / (uint32_t)sizeof(InputT),
+                };
+            };
+
+            static_assert(BlockM == 16u && BlockN == 16u, "WMMA supports only 16x16 blocks");
+            static_assert(
+                is_same_v<InputT, float16_t> || is_same_v<InputT, bfloat16_t>
+#if !ROCWMMA_NO_HALF
+                    || is_same_v<InputT, hfloat16_t>
+#endif // !ROCWMMA_NO_HALF
+                    || (is_same_v<InputT, int8_t> && is_same_v<ComputeT, int32_t>),
+                "Unsupported WMMA input type");
+
+            using Emulator = BlockMmaEmulator<InputT,
+                                              BlockM,
+                                              BlockN,
+                                              Traits::KPerWmma,
+                                              Traits::ARegCount,
+                                              Traits::KPerGroup,
+                                              1u,
+                                              Traits::WaveSize>;
+            using AccumT   = typename Emulator::AccumT;
+
+            ROCWMMA_HOST static inline void exec(InputT const*   regsA,
+                                                 InputT const*   regsB,
+                                                 ComputeT const* regsC,
+                                                 ComputeT*       regsD)
+            {
+                constexpr uint32_t AccCount = Traits::WaveSize * Traits::CRegCount;
+
+                AccumT accum[AccCount];
+                for(uint32_t i = 0u; i < AccCount; i++)
+                {
+                    accum[i] = convert<AccumT>(regsC[i]);
+                }
+
+                Emulator::exec(regsA, regsB, accum);
+
+                for(uint32_t i = 0u; i < AccCount; i++)
+                {
+                    regsD[i] = convert<ComputeT>(accum[i]);
+                }
+            }
+        };
+
+#endif // ROCWMMA_ARCH_HOST && !defined(__HIPCC_RTC__)
+
     } // namespace detail
 
 } // namespace rocwmma
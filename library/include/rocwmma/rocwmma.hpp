@@ -27,6 +27,8 @@
 #define ROCWMMA_API_HPP
 
 #include "internal/accessors.hpp"
+#include "internal/buffer_resource.hpp"
+#include "internal/cache_policy.hpp"
 #include "internal/io_traits.hpp"
 #include "internal/pack_util.hpp"
 #include "internal/types.hpp"
@@ -252,6 +254,31 @@ namespace rocwmma
         using element_type                     = DataT;
     };
 
+    /*! \class buffer_resource
+ *  \brief Buffer resource descriptor over a range of global memory
+ *
+ * @tparam DataT data type
+ *
+ * Fragment loads and stores through a buffer resource address their elements with a
+ * wave-uniform base and 32-bit offsets instead of 64-bit pointers, saving address registers.
+ * Accesses beyond the end of the range are handled by the hardware: loads return zero
+ * and stores are dropped.
+ *
+ * @note The base address and element count must be uniform across the wavefront,
+ * and the range must be smaller than 2GB.
+ */
+    template <typename DataT>
+    class buffer_resource
+    {
+    public:
+        ROCWMMA_DEVICE buffer_resource(DataT const* base, uint32_t elementCount);
+
+        //! Largest range in bytes that a buffer resource can address
+        constexpr static uint64_t max_bytes = detail::amdgcn_make_buffer_rsrc::OobOffset;
+
+        detail::BufferRsrcT mRsrc;
+    };
+
     //! Fills the entire fragment with the desired value.
     /*!
       \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
@@ -276,12 +303,14 @@ namespace rocwmma
       \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
       \param data Data pointer to global/local memory
       \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -298,28 +327,89 @@ namespace rocwmma
       \param data Data pointer to global/local memory
       \param ldm Leading dimension size
       \param layout Matrix layout
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
                                          const DataT*                                      data,
                                          uint32_t                                          ldm,
                                          layout_t                                          layout);
 
+    //! Loads a partial fragment from the data pointer according to its matrix layout. Only the validRows x validCols elements starting at the data pointer are read, the remaining fragment elements are zero-filled. Use for edge tiles of matrices whose sizes are not multiples of the block size. Fully in-bounds tiles take the same path as the unchecked overload.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param data Data pointer to global/local memory
+      \param ldm Leading dimension size
+      \param validRows Number of valid matrix rows starting at data
+      \param validCols Number of valid matrix columns starting at data
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         const DataT*                                                  data,
+                         uint32_t                                                      ldm,
+                         uint32_t                                                      validRows,
+                         uint32_t                                                      validCols);
+
+    //! Loads a partial fragment from the data pointer according to its matrix layout, zero-filling elements outside of validRows x validCols. This overload provides a run-time ability to choose the data layout of the target fragment.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param data Data pointer to global/local memory
+      \param ldm Leading dimension size
+      \param layout Matrix layout
+      \param validRows Number of valid matrix rows starting at data
+      \param validCols Number of valid matrix columns starting at data
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                      data,
+                                         uint32_t                                          ldm,
+                                         layout_t                                          layout,
+                                         uint32_t validRows,
+                                         uint32_t validCols);
+
     //! Stores the entire fragment to the data pointer according to its matrix and data layouts. Data pointer may point to either local or global memory.
     /*!
       \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
       \param data Data pointer to global/local memory
       \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -336,18 +426,186 @@ namespace rocwmma
       \param data Data pointer to global/local memory
       \param ldm Leading dimension size
       \param layout Data layout
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void
         store_matrix_sync(DataT*                                                  data,
                           fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
                           uint32_t                                                ldm,
                           layout_t                                                layout);
 
+    //! Stores a partial fragment to the data pointer according to its matrix and data layouts. Only the validRows x validCols elements starting at the data pointer are written. Use for edge tiles of matrices whose sizes are not multiples of the block size.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param data Data pointer to global/local memory
+      \param ldm Leading dimension size
+      \param validRows Number of valid matrix rows starting at data
+      \param validCols Number of valid matrix columns starting at data
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                              data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t                                                            ldm,
+                          uint32_t validRows,
+                          uint32_t validCols);
+
+    //! Stores a partial fragment to the data pointer according to its matrix layout, skipping elements outside of validRows x validCols. This overload provides a run-time ability to choose the data layout of the target fragment.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param data Data pointer to global/local memory
+      \param ldm Leading dimension size
+      \param layout Data layout
+      \param validRows Number of valid matrix rows starting at data
+      \param validCols Number of valid matrix columns starting at data
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                  data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                          uint32_t                                                ldm,
+                          layout_t                                                layout,
+                          uint32_t                                                validRows,
+                          uint32_t                                                validCols);
+
+    //! Loads the entire fragment from a global memory buffer according to its matrix and data layouts, using buffer load instructions.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param buffer Buffer resource over global memory
+      \param offset Element offset of the fragment block in the buffer. Must be uniform across the wavefront.
+      \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         buffer_resource<DataT> const&                                 buffer,
+                         uint32_t                                                      offset,
+                         uint32_t                                                      ldm);
+
+    //! Loads a partial fragment from a global memory buffer according to its matrix and data layouts, using buffer load instructions. Elements outside of validRows x validCols are zero-filled by the hardware range check.
+    /*!
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param buffer Buffer resource over global memory
+      \param offset Element offset of the fragment block in the buffer. Must be uniform across the wavefront.
+      \param ldm Leading dimension size
+      \param validRows Number of valid matrix rows starting at offset
+      \param validCols Number of valid matrix columns starting at offset
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         buffer_resource<DataT> const&                                 buffer,
+                         uint32_t                                                      offset,
+                         uint32_t                                                      ldm,
+                         uint32_t                                                      validRows,
+                         uint32_t                                                      validCols);
+
+    //! Stores the entire fragment to a global memory buffer according to its matrix and data layouts, using buffer store instructions.
+    /*!
+      \param buffer Buffer resource over global memory
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param offset Element offset of the fragment block in the buffer. Must be uniform across the wavefront.
+      \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(buffer_resource<DataT> const& buffer,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t offset,
+                          uint32_t ldm);
+
+    //! Stores a partial fragment to a global memory buffer according to its matrix and data layouts, using buffer store instructions. Elements outside of validRows x validCols are dropped by the hardware range check.
+    /*!
+      \param buffer Buffer resource over global memory
+      \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
+      \param offset Element offset of the fragment block in the buffer. Must be uniform across the wavefront.
+      \param ldm Leading dimension size
+      \param validRows Number of valid matrix rows starting at offset
+      \param validCols Number of valid matrix columns starting at offset
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(buffer_resource<DataT> const& buffer,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t offset,
+                          uint32_t ldm,
+                          uint32_t validRows,
+                          uint32_t validCols);
+
     //! Performs the Multiply-Accumulate operation on the fragments A, B, C and D(D = A * B + C)
     /*!
       \param d Accumulator output D
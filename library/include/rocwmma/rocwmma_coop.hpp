@@ -51,6 +51,13 @@
  *
  * Fragments are stored in packed registers in optimal load / store patterns.
  * In-register elements have no guaranteed order, which have been optimized for loading / storing efficiency.
+ *
+ * \n
+ * **copy_matrix_coop_async / wait_matrix_coop_async**
+ *
+ * Cooperatively copies a fragment's block from global memory to LDS. Where supported,
+ * data moves directly into LDS without occupying registers and the copy completes
+ * asynchronously. Otherwise, the copy is staged in the fragment's registers.
  */
 
 namespace rocwmma
@@ -73,12 +80,14 @@ namespace rocwmma
       \param waveIndex Index assignment of current wave in collaboration
       \param waveCount Number of waves assigned for collaboration
       \param splitCount Number of work items to split the operation
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -110,12 +119,14 @@ namespace rocwmma
       \param ldm Leading dimension size
       \param waveIndex Index assignment of current wave in collaboration
       \param waveCount Number of waves assigned for collaboration
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -143,12 +154,14 @@ namespace rocwmma
       \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
       \param data Data pointer to global/local memory
       \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -180,6 +193,7 @@ namespace rocwmma
       \param waveIndex Index assignment of current wave in collaboration
       \tparam uint32_t WaveCount
       \tparam uint32_t SplitCount
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
@@ -187,6 +201,7 @@ namespace rocwmma
     */
     template <uint32_t WaveCount,
               uint32_t SplitCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -220,12 +235,14 @@ namespace rocwmma
       \param ldm Leading dimension size
       \param waveIndex Index assignment of current wave in collaboration
       \tparam uint32_t WaveCount
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
     template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -256,12 +273,14 @@ namespace rocwmma
       \param waveIndex Index assignment of current wave in collaboration
       \param waveCount Number of waves assigned for collaboration
       \param splitCount Number of work items to split the operation
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -293,12 +312,14 @@ namespace rocwmma
       \param ldm Leading dimension size
       \param waveIndex Index assignment of current wave in collaboration
       \param waveCount Number of waves assigned for collaboration
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -325,12 +346,14 @@ namespace rocwmma
       \param data Data pointer to global/local memory
       \param frag Fragment of type MatrixT with its associated block sizes, data type and layout
       \param ldm Leading dimension size
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
-    template <typename MatrixT,
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -362,6 +385,7 @@ namespace rocwmma
       \param waveIndex Index assignment of current wave in collaboration
       \tparam WaveCount Number of waves participating
       \tparam SplitCount Number of work items
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
@@ -369,6 +393,7 @@ namespace rocwmma
     */
     template <uint32_t WaveCount,
               uint32_t SplitCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -403,12 +428,14 @@ namespace rocwmma
       \param ldm Leading dimension size
       \param waveIndex Index assignment of current wave in collaboration
       \tparam WaveCount Number of waves participating
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
       \tparam MatrixT fragment context
       \tparam BlockM/N/K block dimensions
       \tparam DataT data type
       \tparam DataLayout in-memory layout as col_major or row_major
     */
     template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -421,6 +448,76 @@ namespace rocwmma
         uint32_t                                                            ldm,
         uint32_t                                                            waveIndex);
 
+    //! Cooperative Async Copy - Starts copying the entire block of a fragment from global memory to LDS
+    //! cooperatively across waves. Each cooperative wave is responsible in copying a portion of the block.
+    //! On targets with LDS-direct loads, the data bypasses registers and the copy completes asynchronously.
+    //! Otherwise, the current wave's portion is loaded into the stage fragment and written to LDS in
+    //! wait_matrix_coop_async. The copy must always be completed with wait_matrix_coop_async, followed by
+    //! synchronize_workgroup before the LDS data is read.
+    //!
+    //! Row starting addresses of data and ldsData in the minor dimension of DataLayout must be 4 byte aligned.
+    /*!
+      \param stage Fragment of type MatrixT with its associated block sizes, data type and layout.
+      Holds the current wave's portion of data in the register-staged fallback.
+      \param ldsData Data pointer to local memory
+      \param ldlds Leading dimension size of local memory
+      \param data Data pointer to global memory
+      \param ldm Leading dimension size of global memory
+      \param waveIndex Index assignment of current wave in collaboration
+      \tparam WaveCount Number of waves participating
+      \tparam CachePolicy cache policy tag for the global memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <uint32_t WaveCount,
+              typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        copy_matrix_coop_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& stage,
+                               DataT* ldsData,
+                               uint32_t                                                      ldlds,
+                               const DataT*                                                  data,
+                               uint32_t                                                      ldm,
+                               uint32_t waveIndex);
+
+    //! Cooperative Async Copy Wait - Completes copies started by copy_matrix_coop_async from the current wave.
+    //! Up to PendingCopies of the most recently started copies may remain in flight, which allows
+    //! multi-stage prefetching. PendingCopies is ignored by the register-staged fallback, where the
+    //! wait writes the stage fragment to LDS. Copies from other waves are visible after a subsequent
+    //! synchronize_workgroup.
+    /*!
+      \param stage Fragment of type MatrixT that was passed to copy_matrix_coop_async
+      \param ldsData Data pointer to local memory
+      \param ldlds Leading dimension size of local memory
+      \param waveIndex Index assignment of current wave in collaboration
+      \tparam WaveCount Number of waves participating
+      \tparam PendingCopies Number of copies that may remain in flight, defaults to 0
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+    */
+    template <uint32_t WaveCount,
+              uint32_t PendingCopies = 0u,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void wait_matrix_coop_async(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& stage,
+        DataT*                                                              ldsData,
+        uint32_t                                                            ldlds,
+        uint32_t                                                            waveIndex);
+
 } // namespace rocwmma
 
 #include "rocwmma_coop_impl.hpp"
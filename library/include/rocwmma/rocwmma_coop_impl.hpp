@@ -26,6 +26,7 @@
 #ifndef ROCWMMA_COOP_API_IMPL_HPP
 #define ROCWMMA_COOP_API_IMPL_HPP
 
+#include "internal/coop_async_copy.hpp"
 #include "internal/coop_io_config.hpp"
 #include "internal/coop_load.hpp"
 #include "internal/coop_store.hpp"
@@ -34,7 +35,8 @@
 
 namespace rocwmma
 {
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -49,10 +51,11 @@ namespace rocwmma
                               uint32_t splitCount)
     {
         // splitCount unused
-        load_matrix_coop_sync(frag, data, ldm, waveIndex, waveCount);
+        load_matrix_coop_sync<CachePolicy>(frag, data, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -67,7 +70,7 @@ namespace rocwmma
     {
 
         using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetCoopIOConfig_t<FragT>::Loader;
+        using Loader = typename GetCoopIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayout, void>::value,
@@ -84,7 +87,8 @@ namespace rocwmma
         Loader::exec(frag.mAccess, data, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -104,11 +108,12 @@ namespace rocwmma
 
         auto waveIndex = get<0>(waveCoord) * get<1>(wgDim) + get<1>(waveCoord);
         auto waveCount = get<0>(wgDim) * get<1>(wgDim);
-        load_matrix_coop_sync(frag, data, ldm, waveIndex, waveCount);
+        load_matrix_coop_sync<CachePolicy>(frag, data, ldm, waveIndex, waveCount);
     }
 
     template <uint32_t WaveCount,
               uint32_t SplitCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -122,10 +127,11 @@ namespace rocwmma
                               uint32_t waveIndex)
     {
         // SplitCount is unused
-        load_matrix_coop_sync<WaveCount>(frag, data, ldm, waveIndex);
+        load_matrix_coop_sync<WaveCount, CachePolicy>(frag, data, ldm, waveIndex);
     }
 
     template <uint32_t WaveCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -138,8 +144,9 @@ namespace rocwmma
                               uint32_t                                                      ldm,
                               uint32_t waveIndex)
     {
-        using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetCoopIOConfig_t<FragT, WaveCount>::Loader;
+        using FragT = decay_t<decltype(frag)>;
+        using Loader
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayout, void>::value,
@@ -156,7 +163,8 @@ namespace rocwmma
         Loader::template exec<WaveCount>(frag.mAccess, data, ldm, waveIndex);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -171,10 +179,11 @@ namespace rocwmma
         uint32_t                                                            splitCount)
     {
         // splitCount unused
-        store_matrix_coop_sync(data, frag, ldm, waveIndex, waveCount);
+        store_matrix_coop_sync<CachePolicy>(data, frag, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -188,7 +197,7 @@ namespace rocwmma
         uint32_t                                                            waveCount)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetCoopIOConfig_t<FragT>::Storer;
+        using Storer = typename GetCoopIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayout, void>::value,
@@ -205,7 +214,8 @@ namespace rocwmma
         Storer::exec(data, frag.mAccess, ldm, waveIndex, waveCount);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -225,11 +235,12 @@ namespace rocwmma
 
         auto waveIndex = get<0>(waveCoord) * get<1>(wgDim) + get<1>(waveCoord);
         auto waveCount = get<0>(wgDim) * get<1>(wgDim);
-        store_matrix_coop_sync(data, frag, ldm, waveIndex, waveCount);
+        store_matrix_coop_sync<CachePolicy>(data, frag, ldm, waveIndex, waveCount);
     }
 
     template <uint32_t WaveCount,
               uint32_t SplitCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -245,10 +256,11 @@ namespace rocwmma
         // Implicit unpack and store
         // Note: the frag is only be partially filled with useful data.
         // Layout and thread locality is not guaranteed.
-        store_matrix_coop_sync<WaveCount>(data, frag, ldm, waveIndex);
+        store_matrix_coop_sync<WaveCount, CachePolicy>(data, frag, ldm, waveIndex);
     }
 
     template <uint32_t WaveCount,
+              typename CachePolicy,
               typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
@@ -262,8 +274,9 @@ namespace rocwmma
         uint32_t                                                            waveIndex)
     {
 
-        using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetCoopIOConfig_t<FragT, WaveCount>::Storer;
+        using FragT = decay_t<decltype(frag)>;
+        using Storer
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyStorer<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayout, void>::value,
@@ -280,6 +293,69 @@ namespace rocwmma
         Storer::template exec<WaveCount>(data, frag.mAccess, ldm, waveIndex);
     }
 
+    template <uint32_t WaveCount,
+              typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        copy_matrix_coop_async(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& stage,
+                               DataT* ldsData,
+                               uint32_t                                                      ldlds,
+                               const DataT*                                                  data,
+                               uint32_t                                                      ldm,
+                               uint32_t waveIndex)
+    {
+        using FragT = decay_t<decltype(stage)>;
+        using Copier
+            = typename GetCoopIOConfig_t<FragT, WaveCount>::template PolicyAsyncCopier<CachePolicy>;
+
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        if constexpr(Copier::template isDirect<WaveCount>())
+        {
+            // Global -> LDS, registers untouched
+            Copier::template exec<WaveCount>(ldsData, ldlds, data, ldm, waveIndex);
+        }
+        else
+        {
+            // Register-staged: global -> stage, LDS write deferred to the wait
+            load_matrix_coop_sync<WaveCount, CachePolicy>(stage, data, ldm, waveIndex);
+        }
+    }
+
+    template <uint32_t WaveCount,
+              uint32_t PendingCopies,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void wait_matrix_coop_async(
+        fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& stage,
+        DataT*                                                              ldsData,
+        uint32_t                                                            ldlds,
+        uint32_t                                                            waveIndex)
+    {
+        using FragT  = decay_t<decltype(stage)>;
+        using Copier = typename GetCoopIOConfig_t<FragT, WaveCount>::AsyncCopier;
+
+        if constexpr(Copier::template isDirect<WaveCount>())
+        {
+            Copier::template wait<WaveCount, PendingCopies>();
+        }
+        else
+        {
+            store_matrix_coop_sync<WaveCount>(ldsData, stage, ldlds, waveIndex);
+        }
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_COOP_API_IMPL_HPP
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_API_HPP
+#define ROCWMMA_EPILOGUE_API_HPP
+
+#include "rocwmma.hpp"
+
+#include "internal/epilogue.hpp"
+
+/**
+ * ROCWMMAEpilogue complements the ROCWMMA API with fused accumulator epilogues.
+ * Bias, activation, scaling, residual add and type conversion are applied to the
+ * accumulator fragment in registers, before the single store of the result.
+ *
+ * \n
+ * **apply_epilogue / store_matrix_epilogue_sync**
+ *
+ * Epilogue ops are functors applied to each accumulator element together with the
+ * element's (row, col) matrix coordinate. Coordinates are derived from the
+ * accumulator matrix layout and offset by the fragment's matrix coordinate,
+ * so that per-row / per-column vectors and matrices may be indexed directly.
+ *
+ * Built-in ops live in the rocwmma::epilogue namespace:
+ * - bias_row / bias_col: per-row or per-column bias vector
+ * - relu / gelu / silu: activations
+ * - scale / scale_row / scale_col: per-tensor or per-channel scale
+ * - residual_add: adds beta * R for a residual matrix R
+ * - saturate: clamps to the finite range of a narrower output type
+ * - chain / make_chain: applies a sequence of ops left to right
+ */
+
+namespace rocwmma
+{
+    //! Applies an epilogue op to each element of an accumulator fragment in place.
+    /*!
+      \param frag Accumulator fragment
+      \param op Epilogue functor, invoked as op(value, row, col) for each element
+      \param row Matrix row coordinate of the fragment origin
+      \param col Matrix column coordinate of the fragment origin
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+      \tparam EpilogueOp epilogue functor type
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void
+        apply_epilogue(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                       EpilogueOp const&                                                op,
+                       uint32_t                                                         row,
+                       uint32_t                                                         col);
+
+    //! Applies an epilogue op to the accumulator, converts the result to OutputT
+    //! and stores it to memory. The source fragment is unchanged.
+    //! Accumulators of OutputT and DataT must share the same register element order.
+    /*!
+      \param data Data pointer to the fragment origin in memory
+      \param frag Accumulator fragment
+      \param ldm Leading dimension size
+      \param op Epilogue functor, invoked as op(value, row, col) for each element
+      \param row Matrix row coordinate of the fragment origin
+      \param col Matrix column coordinate of the fragment origin
+      \tparam CachePolicy cache policy tag for the store, defaults to cache_default
+      \tparam BlockM/N/K block dimensions
+      \tparam OutputT output data type
+      \tparam DataT accumulator data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+      \tparam EpilogueOp epilogue functor type
+    */
+    template <typename CachePolicy = cache_default,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename OutputT,
+              typename DataT,
+              typename DataLayout,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void store_matrix_epilogue_sync(
+        OutputT*                                                                data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        uint32_t                                                                ldm,
+        EpilogueOp const&                                                       op,
+        uint32_t                                                                row,
+        uint32_t                                                                col);
+
+    //! Applies an epilogue op to the accumulator, converts the result to OutputT
+    //! and stores it to memory with the layout given at run-time. The source fragment is unchanged.
+    //! Accumulators of OutputT and DataT must share the same register element order.
+    /*!
+      \param data Data pointer to the fragment origin in memory
+      \param frag Accumulator fragment
+      \param ldm Leading dimension size
+      \param layout Data layout of the stored matrix
+      \param op Epilogue functor, invoked as op(value, row, col) for each element
+      \param row Matrix row coordinate of the fragment origin
+      \param col Matrix column coordinate of the fragment origin
+      \tparam CachePolicy cache policy tag for the store, defaults to cache_default
+      \tparam BlockM/N/K block dimensions
+      \tparam OutputT output data type
+      \tparam DataT accumulator data type
+      \tparam EpilogueOp epilogue functor type
+    */
+    template <typename CachePolicy = cache_default,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename OutputT,
+              typename DataT,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void store_matrix_epilogue_sync(
+        OutputT*                                                    data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT> const& frag,
+        uint32_t                                                    ldm,
+        layout_t                                                    layout,
+        EpilogueOp const&                                           op,
+        uint32_t                                                    row,
+        uint32_t                                                    col);
+
+} // namespace rocwmma
+
+#include "rocwmma_epilogue_impl.hpp"
+
+#endif // ROCWMMA_EPILOGUE_API_HPP
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_EPILOGUE_API_IMPL_HPP
+#define ROCWMMA_EPILOGUE_API_IMPL_HPP
+
+#include "internal/epilogue.hpp"
+
+#include "rocwmma_epilogue.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Walks the accumulator registers in order, alongside the matrix coordinate
+        // of each element. With VW = 1, each IO of the matrix layout is one element.
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+        struct ApplyEpilogue
+        {
+            using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+            using IOLayout     = typename GetIOConfig_t<FragRowMajor>::IOLayout;
+            using MatrixLayout = typename IOLayout::MatrixLayout;
+
+            static_assert(IOLayout::VW == 1u, "Expected one element per IO");
+
+            template <size_t Depth = 0,
+                      typename AccessT,
+                      typename EpilogueOp,
+                      typename StrideCounts,
+                      typename Strides2d>
+            ROCWMMA_DEVICE static inline void unroll_right(AccessT&          data,
+                                                           uint32_t&         index,
+                                                           Coord2d           coord,
+                                                           EpilogueOp const& op,
+                                                           StrideCounts&&    strideCounts,
+                                                           Strides2d&&       strides2d)
+            {
+                auto stride2d    = get<Depth>(strides2d);
+                auto strideCount = get<Depth>(strideCounts);
+
+                // Last depth layer will invoke the op
+                if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        data.data[index] = op(data.data[index], get<0>(coord), get<1>(coord));
+                        coord += stride2d;
+                        index++;
+                    }
+                }
+                // Recurse to the next nested layer
+                else
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        unroll_right<Depth + 1>(data, index, coord, op, strideCounts, strides2d);
+                        coord += stride2d;
+                    }
+                }
+            }
+
+            template <typename AccessT, typename EpilogueOp>
+            ROCWMMA_DEVICE static inline void
+                exec(AccessT& data, EpilogueOp const& op, uint32_t row, uint32_t col)
+            {
+                uint32_t index = 0u;
+                unroll_right(data,
+                             index,
+                             MatrixLayout::baseOffset() + make_coord2d(row, col),
+                             op,
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+        };
+
+    } // namespace detail
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void
+        apply_epilogue(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                       EpilogueOp const&                                                op,
+                       uint32_t                                                         row,
+                       uint32_t                                                         col)
+    {
+        // Register order of accumulator elements does not depend on the data layout
+        detail::ApplyEpilogue<BlockM, BlockN, BlockK, DataT>::exec(frag.mAccess, op, row, col);
+    }
+
+    template <typename CachePolicy,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename OutputT,
+              typename DataT,
+              typename DataLayout,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void store_matrix_epilogue_sync(
+        OutputT*                                                                data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        uint32_t                                                                ldm,
+        EpilogueOp const&                                                       op,
+        uint32_t                                                                row,
+        uint32_t                                                                col)
+    {
+        using FragOut = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, DataLayout>;
+
+        static_assert(GetIOConfig_t<FragOut>::IOLayout::MaxVW
+                          == GetIOConfig_t<decay_t<decltype(frag)>>::IOLayout::MaxVW,
+                      "Accumulator register orders of output and input types do not match");
+
+        auto result = frag;
+        apply_epilogue(result, op, row, col);
+
+        FragOut fragOut;
+#pragma unroll
+        for(uint32_t i = 0; i < fragOut.num_elements; i++)
+        {
+            fragOut.x[i] = static_cast<OutputT>(result.x[i]);
+        }
+
+        store_matrix_sync<CachePolicy>(data, fragOut, ldm);
+    }
+
+    template <typename CachePolicy,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename OutputT,
+              typename DataT,
+              typename EpilogueOp>
+    ROCWMMA_DEVICE void store_matrix_epilogue_sync(
+        OutputT*                                                    data,
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT> const& frag,
+        uint32_t                                                    ldm,
+        layout_t                                                    layout,
+        EpilogueOp const&                                           op,
+        uint32_t                                                    row,
+        uint32_t                                                    col)
+    {
+        using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_epilogue_sync<CachePolicy>(
+                data, reinterpret_cast<FragRowMajor const&>(frag), ldm, op, row, col);
+        }
+        else
+        {
+            store_matrix_epilogue_sync<CachePolicy>(
+                data, reinterpret_cast<FragColMajor const&>(frag), ldm, op, row, col);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_EPILOGUE_API_IMPL_HPP
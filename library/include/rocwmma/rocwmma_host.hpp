@@ -0,0 +1,423 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_HOST_API_HPP
+#define ROCWMMA_HOST_API_HPP
+
+#include "internal/coop_io_config.hpp"
+#include "internal/host_launch.hpp"
+#include "internal/io_config.hpp"
+#include "internal/types.hpp"
+
+/**
+ * rocWMMA host backend
+ *
+ * Runs rocWMMA fragment code on the CPU, without a GPU. A host kernel is written
+ * from the perspective of one wave, with the same fragment operations as the
+ * device API in the rocwmma::host namespace. Kernels are launched over a grid
+ * of workgroups with host::launch_kernel, which provides each wave with a
+ * WaveContext in place of the threadIdx / blockIdx built-ins.
+ *
+ * \n
+ * **Simulated wave**
+ *
+ * A host fragment holds the register file of the entire wave. Each fragment
+ * element is a simulated vector register of ROCWMMA_HOST_WAVE_SIZE (64 or 32) lanes,
+ * stored contiguously so that loops over lanes map onto host SIMD lanes.
+ *
+ * \n
+ * **load_matrix_sync / store_matrix_sync**
+ *
+ * Lanes are mapped to memory through the same IOConfig, MatrixLayout and DataLayout
+ * as the device fragment, so element ordering in registers matches the device loader.
+ *
+ * \n
+ * **mma_sync**
+ *
+ * Block multiply-accumulate runs on the MfmaEmulator (wave64) or WmmaEmulator
+ * (wave32) with the fragment registers as operands, following the device instruction
+ * sequence. Rounding follows the emulator's dot product model, which is close to but
+ * not guaranteed bit-identical with the device. Blocks and types without a matching
+ * instruction do not compile.
+ *
+ * \n
+ * **load_matrix_coop_sync / store_matrix_coop_sync**
+ *
+ * Cooperative IO splits work amongst waves of the workgroup in the same way as
+ * the device CooperativeLoad / CooperativeStore.
+ *
+ * \n
+ * **synchronize_workgroup**
+ *
+ * Synchronization point for all simulated waves in a workgroup. If a wave of the
+ * workgroup throws, waves waiting at or later reaching the barrier are released with
+ * an exception, and launch_kernel rethrows the original error once all threads join.
+ */
+
+#if !defined(__HIPCC_RTC__)
+
+namespace rocwmma
+{
+    namespace host
+    {
+        /**
+         * \defgroup RocwmmaHost ROCWMMA Host API
+         *
+         * @brief ROCWMMA host fragment and its API function definitions.
+         * @{
+         */
+
+        /*! \class fragment
+         *  \brief Host fragment holding the register file of one simulated wave
+         *
+         * @tparam MatrixT - fragment context
+         * @tparam BlockM/N/K - block dimensions
+         * @tparam DataT - data type
+         * @tparam DataLayout - in-memory layout as col_major or row_major
+         *
+         * RegisterT - One simulated vector register; the element of each lane
+         * StorageT - Register file of Size registers
+         *
+         * @note Elements have the same (unspecified) order as in device fragments.
+         */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout = void>
+        class fragment
+        {
+        public:
+            using IOConfig = rocwmma::IOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>;
+            using IOShape  = typename IOConfig::IOShape;
+            using IOTraits = typename IOConfig::IOTraits;
+
+            struct Traits
+            {
+                enum : uint32_t
+                {
+                    WaveSize = IOTraits::ThreadsPerIO,
+                    Size     = IOTraits::UnpackedSize
+                };
+
+                using RegisterT = DataT[WaveSize];
+                using StorageT  = RegisterT[Size];
+            };
+
+            // Element of the given lane, equivalent to device fragment::x[index]
+            inline DataT&       operator()(uint32_t lane, uint32_t index);
+            inline DataT const& operator()(uint32_t lane, uint32_t index) const;
+
+            // Register holding the element index of all lanes
+            inline typename Traits::RegisterT&       operator[](uint32_t index);
+            inline typename Traits::RegisterT const& operator[](uint32_t index) const;
+
+            // Traits
+            constexpr static inline uint32_t height();
+            constexpr static inline uint32_t width();
+            constexpr static inline uint32_t blockDim();
+            constexpr static inline uint32_t kDim();
+            constexpr static inline uint32_t size();
+
+            alignas(64) typename Traits::StorageT mRegs;
+
+            constexpr static uint32_t num_elements = Traits::Size;
+            using element_type                     = DataT;
+        };
+
+        //! Fills the entire fragment with the desired value.
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param value Value of type DataT.
+          \tparam Matrix fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+          \tparam DataLayout in-memory layout as col_major or row_major
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void fill_fragment(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                           DataT                                                         value);
+
+        //! Loads the entire fragment from the data pointer according to its matrix and data layouts.
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param data Data pointer to host memory
+          \param ldm Leading dimension size
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+          \tparam DataLayout in-memory layout as col_major or row_major
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                              const DataT*                                                  data,
+                              uint32_t                                                      ldm);
+
+        //! Loads the entire fragment from the data pointer according to its matrix layout, with run-time choice of data layout.
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes and data type
+          \param data Data pointer to host memory
+          \param ldm Leading dimension size
+          \param layout Data layout
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT>
+        void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                              const DataT*                                      data,
+                              uint32_t                                          ldm,
+                              layout_t                                          layout);
+
+        //! Stores the entire fragment to the data pointer according to its matrix and data layouts.
+        /*!
+          \param data Data pointer to host memory
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param ldm Leading dimension size
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+          \tparam DataLayout in-memory layout as col_major or row_major
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm);
+
+        //! Stores the entire fragment to the data pointer according to its matrix layout, with run-time choice of data layout.
+        /*!
+          \param data Data pointer to host memory
+          \param frag Host fragment of type MatrixT with its associated block sizes and data type
+          \param ldm Leading dimension size
+          \param layout Data layout
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT>
+        void store_matrix_sync(DataT*                                                  data,
+                               fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                               uint32_t                                                ldm,
+                               layout_t                                                layout);
+
+        //! Performs the Multiply-Accumulate operation on the fragments A, B, C and D(D = A * B + C)
+        /*!
+          \param d Accumulator output D
+          \param a Input fragment A
+          \param b Input fragment B
+          \param c Input accumulator fragment C
+          \tparam BlockM/N/K block dimensions
+          \tparam InputT data type of input frags A and B
+          \tparam ComputeT data type of accumulator fragment C / D
+          \tparam LayoutA in-memory layout of frag A as col_major or row_major
+          \tparam LayoutB in-memory layout of frag B as col_major or row_major
+          \note Frag c = d is valid
+        */
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename ComputeT,
+                  typename LayoutA,
+                  typename LayoutB,
+                  typename LayoutC,
+                  typename LayoutD>
+        void mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                      fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                      fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                      fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
+
+        //! Cooperative Load Matrix - Loads the portion of the fragment assigned to the wave in the collaboration pool [0, waveCount).
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param data Data pointer to host memory
+          \param ldm Leading dimension size
+          \param waveIndex Index assignment of current wave in collaboration
+          \param waveCount Number of waves assigned for collaboration
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+          \tparam DataLayout in-memory layout as col_major or row_major
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            uint32_t                                                      waveIndex,
+            uint32_t                                                      waveCount);
+
+        //! Cooperative Load Matrix with all waves of the workgroup participating in row major order.
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param data Data pointer to host memory
+          \param ldm Leading dimension size
+          \param context Context of the current wave
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            WaveContext const&                                            context);
+
+        //! Cooperative Load Matrix with a compile-time wave count.
+        /*!
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param data Data pointer to host memory
+          \param ldm Leading dimension size
+          \param waveIndex Index assignment of current wave in collaboration
+          \tparam WaveCount Number of waves participating in the fragment load
+        */
+        template <uint32_t WaveCount,
+                  typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            uint32_t                                                      waveIndex);
+
+        //! Cooperative Store Matrix - Stores the portion of the fragment assigned to the wave in the collaboration pool [0, waveCount).
+        /*!
+          \param data Data pointer to host memory
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param ldm Leading dimension size
+          \param waveIndex Index assignment of current wave in collaboration
+          \param waveCount Number of waves assigned for collaboration
+          \tparam MatrixT fragment context
+          \tparam BlockM/N/K block dimensions
+          \tparam DataT data type
+          \tparam DataLayout in-memory layout as col_major or row_major
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            uint32_t                                                            waveIndex,
+            uint32_t                                                            waveCount);
+
+        //! Cooperative Store Matrix with all waves of the workgroup participating in row major order.
+        /*!
+          \param data Data pointer to host memory
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param ldm Leading dimension size
+          \param context Context of the current wave
+        */
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            WaveContext const&                                                  context);
+
+        //! Cooperative Store Matrix with a compile-time wave count.
+        /*!
+          \param data Data pointer to host memory
+          \param frag Host fragment of type MatrixT with its associated block sizes, data type and layout
+          \param ldm Leading dimension size
+          \param waveIndex Index assignment of current wave in collaboration
+          \tparam WaveCount Number of waves participating in the fragment store
+        */
+        template <uint32_t WaveCount,
+                  typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            uint32_t                                                            waveIndex);
+
+        //! Synchronization point for all simulated waves in a workgroup.
+        /*!
+          \param context Context of the current wave
+        */
+        inline void synchronize_workgroup(WaveContext const& context);
+
+        /** @}*/
+
+    } // namespace host
+
+} // namespace rocwmma
+
+#include "rocwmma_host_impl.hpp"
+
+#endif // !defined(__HIPCC_RTC__)
+
+#endif // ROCWMMA_HOST_API_HPP
@@ -0,0 +1,713 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_HOST_API_IMPL_HPP
+#define ROCWMMA_HOST_API_IMPL_HPP
+
+#include <algorithm>
+#include <array>
+
+#include "rocwmma_host.hpp"
+
+#include "internal/constants.hpp"
+#include "internal/convert.hpp"
+#include "internal/mfma.hpp"
+#include "internal/types.hpp"
+#include "internal/utils.hpp"
+#include "internal/wmma.hpp"
+
+namespace rocwmma
+{
+    namespace host
+    {
+        namespace detail
+        {
+            /*! \struct HostIOMap
+            *  \brief Maps the simulated register file of an IO configuration to matrix coordinates.
+            *
+            * Register r of lane l holds the matrix element at:
+            * MatrixLayout::baseOffset(l) + ioOffset(r / VW) + vwOffset(r % VW)
+            * where IO iterations are ordered as in the unrolled device loader
+            * (outer stride dimension first).
+            */
+            template <typename IOConfigT>
+            struct HostIOMap
+            {
+                using IOLayout     = typename IOConfigT::IOLayout;
+                using IOTraits     = typename IOConfigT::IOTraits;
+                using MatrixLayout = typename IOLayout::MatrixLayout;
+                using DataLayout   = typename IOLayout::DataLayout;
+
+                enum : uint32_t
+                {
+                    WaveSize = IOTraits::ThreadsPerIO,
+                    VW       = IOLayout::VW,
+                    IOCount  = IOTraits::IOCount,
+                    RegCount = IOTraits::UnpackedSize
+                };
+
+                static_assert(IOCount * VW == RegCount, "IO count inconsistent with fragment size");
+
+                static inline std::array<Coord2d, WaveSize> const& laneOffsets()
+                {
+                    static auto const offsets = [] {
+                        std::array<Coord2d, WaveSize> result;
+                        for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                        {
+                            result[lane] = MatrixLayout::baseOffset(lane);
+                        }
+                        return result;
+                    }();
+                    return offsets;
+                }
+
+                static inline std::array<Coord2d, IOCount> const& ioOffsets()
+                {
+                    static auto const offsets = [] {
+                        constexpr auto counts  = MatrixLayout::strideCounts();
+                        constexpr auto strides = MatrixLayout::strides();
+                        static_assert(VecTraits<decay_t<decltype(counts)>>::size() == 3u,
+                                      "Expected BlockDim, BlockK and VW stride dimensions");
+
+                        std::array<Coord2d, IOCount> result;
+                        for(uint32_t io = 0u; io < IOCount; io++)
+                        {
+                            // Innermost stride dimension is fastest
+                            uint32_t i2 = io % get<2>(counts);
+                            uint32_t i1 = io / get<2>(counts) % get<1>(counts);
+                            uint32_t i0 = io / (get<2>(counts) * get<1>(counts));
+                            result[io]  = make_coord2d(i0 * get<0>(get<0>(strides))
+                                                          + i1 * get<0>(get<1>(strides))
+                                                          + i2 * get<0>(get<2>(strides)),
+                                                      i0 * get<1>(get<0>(strides))
+                                                          + i1 * get<1>(get<1>(strides))
+                                                          + i2 * get<1>(get<2>(strides)));
+                        }
+                        return result;
+                    }();
+                    return offsets;
+                }
+
+                // Vector elements are contiguous in the minor data dimension
+                constexpr static inline Coord2d vwOffset(uint32_t v)
+                {
+                    return DataLayout::MinorIndex == 1u ? make_coord2d(0u, v)
+                                                        : make_coord2d(v, 0u);
+                }
+
+                // Flattened index of each (register, lane) into the row major block
+                static inline std::array<uint32_t, RegCount * WaveSize> const& blockOffsets()
+                {
+                    static auto const offsets = [] {
+                        constexpr uint32_t BlockWidth = IOConfigT::IOShape::BlockWidth;
+                        std::array<uint32_t, RegCount * WaveSize> result;
+                        auto const& lanes = laneOffsets();
+                        auto const& ios   = ioOffsets();
+                        for(uint32_t r = 0u; r < RegCount; r++)
+                        {
+                            auto regOffset = ios[r / VW] + vwOffset(r % VW);
+                            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                            {
+                                auto coord = lanes[lane] + regOffset;
+                                result[r * WaveSize + lane]
+                                    = get<0>(coord) * BlockWidth + get<1>(coord);
+                            }
+                        }
+                        return result;
+                    }();
+                    return offsets;
+                }
+
+                // Loads ioCount iterations, starting at ioBegin, into registers [0, ioCount * VW)
+                template <typename DataT>
+                static inline void load(DataT (*regs)[WaveSize],
+                                        DataT const* data,
+                                        uint32_t     ldm,
+                                        uint32_t     ioBegin = 0u,
+                                        uint32_t     ioCount = IOCount)
+                {
+                    uint32_t    laneData[WaveSize];
+                    auto const& lanes = laneOffsets();
+                    for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                    {
+                        laneData[lane] = DataLayout::fromMatrixCoord(lanes[lane], ldm);
+                    }
+
+                    auto const& ios = ioOffsets();
+                    for(uint32_t i = 0u; i < ioCount; i++)
+                    {
+                        auto ioData = data + DataLayout::fromMatrixCoord(ios[ioBegin + i], ldm);
+                        for(uint32_t v = 0u; v < VW; v++)
+                        {
+                            auto& reg = regs[i * VW + v];
+                            auto  src = ioData + v;
+#pragma omp simd
+                            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                            {
+                                reg[lane] = src[laneData[lane]];
+                            }
+                        }
+                    }
+                }
+
+                // Stores registers [0, ioCount * VW) to ioCount iterations, starting at ioBegin
+                template <typename DataT>
+                static inline void store(DataT*             data,
+                                         DataT const (*regs)[WaveSize],
+                                         uint32_t           ldm,
+                                         uint32_t           ioBegin = 0u,
+                                         uint32_t           ioCount = IOCount)
+                {
+                    uint32_t    laneData[WaveSize];
+                    auto const& lanes = laneOffsets();
+                    for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                    {
+                        laneData[lane] = DataLayout::fromMatrixCoord(lanes[lane], ldm);
+                    }
+
+                    auto const& ios = ioOffsets();
+                    for(uint32_t i = 0u; i < ioCount; i++)
+                    {
+                        auto ioData = data + DataLayout::fromMatrixCoord(ios[ioBegin + i], ldm);
+                        for(uint32_t v = 0u; v < VW; v++)
+                        {
+                            auto& reg = regs[i * VW + v];
+                            auto  dst = ioData + v;
+#pragma omp simd
+                            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                            {
+                                dst[laneData[lane]] = reg[lane];
+                            }
+                        }
+                    }
+                }
+
+                // Cooperative range of IO iterations for the given wave, as in CooperativeLoad
+                template <typename CoopT>
+                static inline bool coopRange(uint32_t  waveIndex,
+                                             uint32_t  waveCount,
+                                             uint32_t& ioBegin,
+                                             uint32_t& ioCount)
+                {
+                    constexpr uint32_t VWSegs = get<2>(MatrixLayout::strideCounts());
+                    constexpr uint32_t TotalWorkItems = IOCount / VWSegs;
+
+                    auto maxWaves = CoopT::calcMaxWaves(TotalWorkItems, waveCount);
+                    if(waveIndex >= maxWaves)
+                    {
+                        return false;
+                    }
+
+                    auto workItemsPerWave = std::max(TotalWorkItems / maxWaves, 1u);
+                    ioBegin               = waveIndex * workItemsPerWave * VWSegs;
+                    ioCount               = workItemsPerWave * VWSegs;
+                    return true;
+                }
+            };
+
+            // Register mapping of an accumulator without data layout. Row and col major
+            // accumulator layouts have consistent register ordering, so either applies.
+            template <typename FragT>
+            struct HostFragMap
+            {
+                using type = HostIOMap<typename FragT::IOConfig>;
+            };
+
+            template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+            struct HostFragMap<fragment<accumulator, BlockM, BlockN, BlockK, DataT, void>>
+            {
+                using type
+                    = HostIOMap<IOConfig<accumulator, BlockM, BlockN, BlockK, DataT, row_major>>;
+            };
+
+            template <typename FragT>
+            using HostFragMap_t = typename HostFragMap<FragT>::type;
+
+            // Block MMA of the simulated wave: MFMA for wave64, WMMA for wave32.
+            // Supported reports whether the instruction exists for the block and types.
+            template <typename InputT,
+                      typename ComputeT,
+                      uint32_t BlockM,
+                      uint32_t BlockN,
+                      uint32_t BlockK,
+                      bool IsWave64
+                      = (Constants::AMDGCN_WAVE_SIZE == Constants::AMDGCN_WAVE_SIZE_64)>
+            struct HostMma
+            {
+            private:
+                enum : uint32_t
+                {
+                    KPerMfma = rocwmma::detail::amdgcn_mfma_emulator_k<
+                        InputT,
+                        BlockM,
+                        Constants::AMDGCN_ARCH_ID_GFX942>::KPerMfma
+                };
+
+            public:
+                using Emulator = MfmaEmulator<InputT, ComputeT, BlockM, BlockN, BlockK>;
+
+                static constexpr bool Supported
+                    = (KPerMfma > 0u) && (BlockM == BlockN) && (BlockK % KPerMfma == 0u);
+            };
+
+            template <typename InputT,
+                      typename ComputeT,
+                      uint32_t BlockM,
+                      uint32_t BlockN,
+                      uint32_t BlockK>
+            struct HostMma<InputT, ComputeT, BlockM, BlockN, BlockK, false>
+            {
+                using Emulator = WmmaEmulator<InputT, ComputeT, BlockM, BlockN, BlockK>;
+
+                static constexpr bool Supported
+                    = (BlockM == 16u) && (BlockN == 16u) && (BlockK % 16u == 0u)
+                      && (is_same<InputT, float16_t>::value || is_same<InputT, bfloat16_t>::value
+#if !ROCWMMA_NO_HALF
+                          || is_same<InputT, hfloat16_t>::value
+#endif // !ROCWMMA_NO_HALF
+                          || (is_same<InputT, int8_t>::value && is_same<ComputeT, int32_t>::value));
+            };
+
+        } // namespace detail
+
+        // fragment implementations
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        inline DataT& fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::operator()(
+            uint32_t lane, uint32_t index)
+        {
+            return mRegs[index][lane];
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        inline DataT const&
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::operator()(
+                uint32_t lane, uint32_t index) const
+        {
+            return mRegs[index][lane];
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        inline auto
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::operator[](uint32_t index)
+                -> typename Traits::RegisterT&
+        {
+            return mRegs[index];
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        inline auto fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::operator[](
+            uint32_t index) const -> typename Traits::RegisterT const&
+        {
+            return mRegs[index];
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        constexpr inline uint32_t fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::height()
+        {
+            return IOShape::BlockHeight;
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        constexpr inline uint32_t fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::width()
+        {
+            return IOShape::BlockWidth;
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        constexpr inline uint32_t
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::blockDim()
+        {
+            return IOShape::BlockDim;
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        constexpr inline uint32_t fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::kDim()
+        {
+            return IOShape::KDim;
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        constexpr inline uint32_t fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>::size()
+        {
+            return num_elements;
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void fill_fragment(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                           DataT                                                         value)
+        {
+            using FragT = decay_t<decltype(frag)>;
+            std::fill_n(&frag.mRegs[0][0], FragT::Traits::Size * FragT::Traits::WaveSize, value);
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                              const DataT*                                                  data,
+                              uint32_t                                                      ldm)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide layout information. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using FragT = decay_t<decltype(frag)>;
+            detail::HostFragMap_t<FragT>::load(frag.mRegs, data, ldm);
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT>
+        void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                              const DataT*                                      data,
+                              uint32_t                                          ldm,
+                              layout_t                                          layout)
+        {
+            using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+            using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+            // Dispatch on layout type
+            if(layout == layout_t::mem_row_major)
+            {
+                load_matrix_sync(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
+            }
+            else
+            {
+                load_matrix_sync(reinterpret_cast<FragColMajor&>(frag), data, ldm);
+            }
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide data layout. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using FragT = decay_t<decltype(frag)>;
+            detail::HostFragMap_t<FragT>::store(data, frag.mRegs, ldm);
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT>
+        void store_matrix_sync(DataT*                                                  data,
+                               fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                               uint32_t                                                ldm,
+                               layout_t                                                layout)
+        {
+            using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+            using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+            // Dispatch on layout type
+            if(layout == layout_t::mem_row_major)
+            {
+                store_matrix_sync(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+            }
+            else
+            {
+                store_matrix_sync(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+            }
+        }
+
+        template <uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename InputT,
+                  typename ComputeT,
+                  typename LayoutA,
+                  typename LayoutB,
+                  typename LayoutC,
+                  typename LayoutD>
+        void mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                      fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA> const&      a,
+                      fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                      fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
+        {
+            using FragA   = decay_t<decltype(a)>;
+            using FragB   = decay_t<decltype(b)>;
+            using FragAcc = decay_t<decltype(d)>;
+            using HostMma = detail::HostMma<InputT, ComputeT, BlockM, BlockN, BlockK>;
+
+            static_assert(HostMma::Supported,
+                          "No MFMA / WMMA instruction for the block size and data types");
+
+            constexpr uint32_t WaveSize = Constants::AMDGCN_WAVE_SIZE;
+
+            // Registers are passed through in fragment order, as on device.
+            // The emulators take lane-major register files.
+            InputT   regsA[WaveSize * FragA::num_elements];
+            InputT   regsB[WaveSize * FragB::num_elements];
+            ComputeT regsAcc[WaveSize * FragAcc::num_elements];
+
+            for(uint32_t lane = 0u; lane < WaveSize; lane++)
+            {
+                for(uint32_t r = 0u; r < FragA::num_elements; r++)
+                {
+                    regsA[lane * FragA::num_elements + r] = a.mRegs[r][lane];
+                }
+                for(uint32_t r = 0u; r < FragB::num_elements; r++)
+                {
+                    regsB[lane * FragB::num_elements + r] = b.mRegs[r][lane];
+                }
+                for(uint32_t r = 0u; r < FragAcc::num_elements; r++)
+                {
+                    regsAcc[lane * FragAcc::num_elements + r] = c.mRegs[r][lane];
+                }
+            }
+
+            HostMma::Emulator::exec(regsA, regsB, regsAcc, regsAcc);
+
+            for(uint32_t r = 0u; r < FragAcc::num_elements; r++)
+            {
+                for(uint32_t lane = 0u; lane < WaveSize; lane++)
+                {
+                    d.mRegs[r][lane] = regsAcc[lane * FragAcc::num_elements + r];
+                }
+            }
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            uint32_t                                                      waveIndex,
+            uint32_t                                                      waveCount)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide layout information. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using CoopConfig
+                = CoopIOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, 1u>;
+            using IOMap = detail::HostIOMap<CoopConfig>;
+
+            // Note: the frag will only be partially filled with useful data.
+            uint32_t ioBegin, ioCount;
+            if(IOMap::template coopRange<typename CoopConfig::Loader>(
+                   waveIndex, waveCount, ioBegin, ioCount))
+            {
+                IOMap::load(frag.mRegs, data, ldm, ioBegin, ioCount);
+            }
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            WaveContext const&                                            context)
+        {
+            load_matrix_coop_sync(frag, data, ldm, context.waveIndex(), context.waveCount());
+        }
+
+        template <uint32_t WaveCount,
+                  typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void load_matrix_coop_sync(
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+            const DataT*                                                  data,
+            uint32_t                                                      ldm,
+            uint32_t                                                      waveIndex)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide layout information. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using CoopConfig
+                = CoopIOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, WaveCount>;
+            using IOMap = detail::HostIOMap<CoopConfig>;
+
+            uint32_t ioBegin, ioCount;
+            if(IOMap::template coopRange<typename CoopConfig::Loader>(
+                   waveIndex, WaveCount, ioBegin, ioCount))
+            {
+                IOMap::load(frag.mRegs, data, ldm, ioBegin, ioCount);
+            }
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            uint32_t                                                            waveIndex,
+            uint32_t                                                            waveCount)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide data layout. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using CoopConfig
+                = CoopIOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, 1u>;
+            using IOMap = detail::HostIOMap<CoopConfig>;
+
+            uint32_t ioBegin, ioCount;
+            if(IOMap::template coopRange<typename CoopConfig::Storer>(
+                   waveIndex, waveCount, ioBegin, ioCount))
+            {
+                IOMap::store(data, frag.mRegs, ldm, ioBegin, ioCount);
+            }
+        }
+
+        template <typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            WaveContext const&                                                  context)
+        {
+            store_matrix_coop_sync(data, frag, ldm, context.waveIndex(), context.waveCount());
+        }
+
+        template <uint32_t WaveCount,
+                  typename MatrixT,
+                  uint32_t BlockM,
+                  uint32_t BlockN,
+                  uint32_t BlockK,
+                  typename DataT,
+                  typename DataLayout>
+        void store_matrix_coop_sync(
+            DataT*                                                              data,
+            fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+            uint32_t                                                            ldm,
+            uint32_t                                                            waveIndex)
+        {
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Must provide data layout. Either statically assign data layout in "
+                          "fragment declaration or use the run-time function overload.");
+
+            using CoopConfig
+                = CoopIOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, WaveCount>;
+            using IOMap = detail::HostIOMap<CoopConfig>;
+
+            uint32_t ioBegin, ioCount;
+            if(IOMap::template coopRange<typename CoopConfig::Storer>(
+                   waveIndex, WaveCount, ioBegin, ioCount))
+            {
+                IOMap::store(data, frag.mRegs, ldm, ioBegin, ioCount);
+            }
+        }
+
+        inline void synchronize_workgroup(WaveContext const& context)
+        {
+            context.synchronize();
+        }
+
+    } // namespace host
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_HOST_API_IMPL_HPP
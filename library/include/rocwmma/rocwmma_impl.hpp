@@ -31,6 +31,9 @@
 #include "internal/accessors.hpp"
 #include "internal/blend.hpp"
 #include "internal/broadcast.hpp"
+#include "internal/buffer_load.hpp"
+#include "internal/buffer_resource.hpp"
+#include "internal/buffer_store.hpp"
 #include "internal/constants.hpp"
 #include "internal/convert.hpp"
 #include "internal/dpp.hpp"
@@ -226,7 +229,8 @@ namespace rocwmma
         Broadcaster::exec(frag.mAccess, value);
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -238,7 +242,7 @@ namespace rocwmma
                          uint32_t                                                      ldm)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Loader = typename GetIOConfig_t<FragT>::Loader;
+        using Loader = typename GetIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
 
         // Sanity checks
         static_assert(!is_same<DataLayout, void>::value,
@@ -253,7 +257,12 @@ namespace rocwmma
         Loader::exec(frag.mAccess, data, ldm);
     }
 
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
                                          const DataT*                                      data,
                                          uint32_t                                          ldm,
@@ -265,15 +274,83 @@ namespace rocwmma
         // Dispatch on layout type
         if(layout == layout_t::mem_row_major)
         {
-            load_matrix_sync(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
+            load_matrix_sync<CachePolicy>(reinterpret_cast<FragRowMajor&>(frag), data, ldm);
         }
         else
         {
-            load_matrix_sync(reinterpret_cast<FragColMajor&>(frag), data, ldm);
+            load_matrix_sync<CachePolicy>(reinterpret_cast<FragColMajor&>(frag), data, ldm);
         }
     }
 
-    template <typename MatrixT,
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         const DataT*                                                  data,
+                         uint32_t                                                      ldm,
+                         uint32_t                                                      validRows,
+                         uint32_t                                                      validCols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Loader  = typename GetIOConfig_t<FragT>::template PolicyLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide layout information. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Interior tiles take the unchecked path
+        if(validRows >= IOShape::BlockHeight && validCols >= IOShape::BlockWidth)
+        {
+            Loader::exec(frag.mAccess, data, ldm);
+        }
+        else
+        {
+            Loader::exec(frag.mAccess, data, ldm, make_coord2d(validRows, validCols));
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT>& frag,
+                                         const DataT*                                      data,
+                                         uint32_t                                          ldm,
+                                         layout_t                                          layout,
+                                         uint32_t validRows,
+                                         uint32_t validCols)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            load_matrix_sync<CachePolicy>(
+                reinterpret_cast<FragRowMajor&>(frag), data, ldm, validRows, validCols);
+        }
+        else
+        {
+            load_matrix_sync<CachePolicy>(
+                reinterpret_cast<FragColMajor&>(frag), data, ldm, validRows, validCols);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
               uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -285,7 +362,7 @@ namespace rocwmma
                           uint32_t                                                            ldm)
     {
         using FragT  = decay_t<decltype(frag)>;
-        using Storer = typename GetIOConfig_t<FragT>::Storer;
+        using Storer = typename GetIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
 
         // Sanity check
         static_assert(!is_same<DataLayout, void>::value,
@@ -300,7 +377,12 @@ namespace rocwmma
         Storer::exec(data, frag.mAccess, ldm);
     }
 
-    template <typename MatrixT, uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
     ROCWMMA_DEVICE void
         store_matrix_sync(DataT*                                                  data,
                           fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
@@ -313,11 +395,223 @@ namespace rocwmma
         // Dispatch on layout type
         if(layout == layout_t::mem_row_major)
         {
-            store_matrix_sync(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+            store_matrix_sync<CachePolicy>(data, reinterpret_cast<FragRowMajor const&>(frag), ldm);
+        }
+        else
+        {
+            store_matrix_sync<CachePolicy>(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                              data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t                                                            ldm,
+                          uint32_t validRows,
+                          uint32_t validCols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Storer  = typename GetIOConfig_t<FragT>::template PolicyStorer<CachePolicy>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide data layout. Either statically assign data layout in "
+                      "fragment declaration or use the run-time function overload.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Interior tiles take the unchecked path
+        if(validRows >= IOShape::BlockHeight && validCols >= IOShape::BlockWidth)
+        {
+            Storer::exec(data, frag.mAccess, ldm);
+        }
+        else
+        {
+            Storer::exec(data, frag.mAccess, ldm, make_coord2d(validRows, validCols));
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(DataT*                                                  data,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT> const& frag,
+                          uint32_t                                                ldm,
+                          layout_t                                                layout,
+                          uint32_t                                                validRows,
+                          uint32_t                                                validCols)
+    {
+        using FragRowMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, row_major>;
+        using FragColMajor = fragment<MatrixT, BlockM, BlockN, BlockK, DataT, col_major>;
+
+        // Dispatch on layout type
+        if(layout == layout_t::mem_row_major)
+        {
+            store_matrix_sync<CachePolicy>(
+                data, reinterpret_cast<FragRowMajor const&>(frag), ldm, validRows, validCols);
+        }
+        else
+        {
+            store_matrix_sync<CachePolicy>(
+                data, reinterpret_cast<FragColMajor const&>(frag), ldm, validRows, validCols);
+        }
+    }
+
+    template <typename DataT>
+    ROCWMMA_DEVICE buffer_resource<DataT>::buffer_resource(DataT const* base, uint32_t elementCount)
+        : mRsrc(detail::amdgcn_make_buffer_rsrc::exec(base, elementCount * sizeof(DataT)))
+    {
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         buffer_resource<DataT> const&                                 buffer,
+                         uint32_t                                                      offset,
+                         uint32_t                                                      ldm)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Loader = typename GetIOConfig_t<FragT>::template PolicyBufferLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide layout information. Statically assign data layout in "
+                      "fragment declaration.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Load then implicit pack
+        Loader::exec(frag.mAccess, buffer.mRsrc, offset, ldm);
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         buffer_resource<DataT> const&                                 buffer,
+                         uint32_t                                                      offset,
+                         uint32_t                                                      ldm,
+                         uint32_t                                                      validRows,
+                         uint32_t                                                      validCols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Loader  = typename GetIOConfig_t<FragT>::template PolicyBufferLoader<CachePolicy>;
+
+        // Sanity checks
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide layout information. Statically assign data layout in "
+                      "fragment declaration.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Interior tiles take the unchecked path
+        if(validRows >= IOShape::BlockHeight && validCols >= IOShape::BlockWidth)
+        {
+            Loader::exec(frag.mAccess, buffer.mRsrc, offset, ldm);
+        }
+        else
+        {
+            Loader::exec(
+                frag.mAccess, buffer.mRsrc, offset, ldm, make_coord2d(validRows, validCols));
+        }
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(buffer_resource<DataT> const& buffer,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t offset,
+                          uint32_t ldm)
+    {
+        using FragT  = decay_t<decltype(frag)>;
+        using Storer = typename GetIOConfig_t<FragT>::template PolicyBufferStorer<CachePolicy>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide data layout. Statically assign data layout in "
+                      "fragment declaration.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Implicit unpack and then store
+        Storer::exec(frag.mAccess, buffer.mRsrc, offset, ldm);
+    }
+
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        store_matrix_sync(buffer_resource<DataT> const& buffer,
+                          fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+                          uint32_t offset,
+                          uint32_t ldm,
+                          uint32_t validRows,
+                          uint32_t validCols)
+    {
+        using FragT   = decay_t<decltype(frag)>;
+        using IOShape = GetIOShape_t<FragT>;
+        using Storer  = typename GetIOConfig_t<FragT>::template PolicyBufferStorer<CachePolicy>;
+
+        // Sanity check
+        static_assert(!is_same<DataLayout, void>::value,
+                      "Must provide data layout. Statically assign data layout in "
+                      "fragment declaration.");
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Storer::Traits::InputT>::value,
+            "Fragment access and store input types do not match");
+
+        // Interior tiles take the unchecked path
+        if(validRows >= IOShape::BlockHeight && validCols >= IOShape::BlockWidth)
+        {
+            Storer::exec(frag.mAccess, buffer.mRsrc, offset, ldm);
         }
         else
         {
-            store_matrix_sync(data, reinterpret_cast<FragColMajor const&>(frag), ldm);
+            Storer::exec(
+                frag.mAccess, buffer.mRsrc, offset, ldm, make_coord2d(validRows, validCols));
         }
     }
 
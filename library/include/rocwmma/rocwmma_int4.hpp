@@ -0,0 +1,294 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_INT4_API_HPP
+#define ROCWMMA_INT4_API_HPP
+
+#include "rocwmma.hpp"
+
+#include "internal/int4.hpp"
+
+/**
+ * ROCWMMAInt4 complements the ROCWMMA API with packed 4-bit integer inputs, as used by
+ * weight-only quantized models.
+ *
+ * \n
+ * **Packed format**
+ *
+ * int4_t and uint4_t elements are stored two per byte along K: elements k and k + 1
+ * (k even) share a byte, element k in the low nibble. A packed M x K matrix_a is then
+ * an M x (K / 2) matrix of bytes, and a packed K x N matrix_b a (K / 2) x N matrix of
+ * bytes, in the layout of the dense matrix. Leading dimensions are in bytes.
+ *
+ * \n
+ * **packed_fragment**
+ *
+ * A matrix_a or matrix_b fragment holding the packed bytes of a block. Lanes hold the
+ * bytes of the same K as the fragment of UnpackedT they unpack into, so loads move half
+ * the bytes of an int8_t fragment, at full vector width where K is contiguous.
+ *
+ * \n
+ * **unpack_fragment**
+ *
+ * Expands a packed_fragment in registers into a fragment of UnpackedT, as
+ * (q - zeroPoint) for int8_t, or (q - zeroPoint) * scale for floating point types. The
+ * result feeds the int8 or f16 / bf16 mma_sync. Per-channel scales of a matrix_b can be
+ * applied to the accumulator instead, e.g. with epilogue::scale_col.
+ *
+ * Packed fragments require the unpacked fragment to hold a multiple of 8 elements per
+ * lane, e.g. BlockK >= 32 for 16 x 16 blocks or BlockK >= 16 for 32 x 32 blocks.
+ */
+
+namespace rocwmma
+{
+    /*! \class packed_fragment
+ *  \brief Packed 4-bit matrix_a or matrix_b fragment
+ *
+ * @tparam MatrixT fragment context as matrix_a or matrix_b
+ * @tparam BlockM/N/K dense block dimensions
+ * @tparam DataT packed data type as int4_t or uint4_t
+ * @tparam DataLayout in-memory layout as col_major or row_major
+ * @tparam UnpackedT data type of the fragment to unpack into, defaults to int8_t
+ *
+ * AccessT - Unpacked bytes of two elements each
+ * StorageT - Packed bytes, 4 per register
+ *
+ * @note Bytes are stored in packed registers, however elements have no guaranteed order.
+ */
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT = int8_t>
+    class __align__(4) packed_fragment
+    {
+    public:
+        using IOConfig
+            = PackedIOConfig<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>;
+        using IOTraits = typename IOConfig::IOTraits;
+
+        struct Traits
+        {
+        private:
+            using PackedElementT   = typename PackTraits<DataT>::PackedT;
+            using UnpackedElementT = typename PackTraits<DataT>::UnpackedT;
+
+        public:
+            using AccessT  = VecT<UnpackedElementT, IOTraits::UnpackedSize>;
+            using StorageT = VecT<PackedElementT, IOTraits::PackedSize>;
+
+            constexpr static uint32_t Size = IOTraits::UnpackedSize;
+
+            static_assert(IOTraits::UnpackedSize % IOTraits::PackedSize == 0,
+                          "Unable to pack fragment elements");
+            static_assert(IOTraits::UnpackedSize % PackTraits<DataT>::PackRatio == 0,
+                          "Packed fragments require 8 elements per lane. Try increasing BlockK");
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Packed fragments require a static data layout");
+        };
+
+        ROCWMMA_DEVICE                  packed_fragment() = default;
+        ROCWMMA_DEVICE                  packed_fragment(const packed_fragment& other);
+        ROCWMMA_DEVICE packed_fragment& operator=(const packed_fragment& other);
+
+        // Accessors of the packed bytes
+        ROCWMMA_DEVICE inline uint8_t&                         operator[](uint32_t index);
+        ROCWMMA_DEVICE inline uint8_t const&                   operator[](uint32_t index) const;
+        ROCWMMA_DEVICE inline typename Traits::StorageT&       operator*();
+        ROCWMMA_DEVICE inline typename Traits::StorageT const& operator*() const;
+
+        // Traits of the dense block
+        ROCWMMA_DEVICE constexpr static inline uint32_t height();
+        ROCWMMA_DEVICE constexpr static inline uint32_t width();
+        ROCWMMA_DEVICE constexpr static inline uint32_t size();
+
+        union
+        {
+            typename Traits::StorageT             mStorage; // Packed
+            typename Traits::AccessT              mAccess; // Unpacked
+            typename Traits::AccessT::Native_vec_ x; // Nuanced access
+            static_assert(sizeof(typename Traits::AccessT) == sizeof(typename Traits::StorageT),
+                          "Storage type and access type should be views into the same raw data");
+        };
+        constexpr static uint32_t num_elements = Traits::Size;
+        using element_type                     = DataT;
+    };
+
+    //! Loads the packed bytes of a 4-bit block into a packed fragment.
+    /*!
+      \param frag Packed fragment, with its layout determined statically.
+      \param data Pointer to the packed bytes of the block.
+      \param ldm Leading dimension in bytes of the packed matrix
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K dense block dimensions
+      \tparam DataT packed data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+      \tparam UnpackedT data type of the fragment to unpack into
+      \note For the block at dense coordinate (row, col), data points to the packed
+      byte (row, col / 2) of a matrix_a, or (row / 2, col) of a matrix_b.
+    */
+    template <typename CachePolicy = cache_default,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>& frag,
+        const uint8_t*                                                                  data,
+        uint32_t                                                                        ldm);
+
+    //! Unpacks a packed fragment into a fragment of UnpackedT as (q - zeroPoint).
+    /*!
+      \param dst Unpacked fragment
+      \param src Packed fragment
+      \param zeroPoint Zero point subtracted from each element
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K dense block dimensions
+      \tparam DataT packed data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+      \tparam UnpackedT data type of the unpacked fragment
+      \note For int8_t, results must stay within [-128, 127], e.g. zeroPoint within
+      [-112, 112].
+    */
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void unpack_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, UnpackedT, DataLayout>&                    dst,
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT> const& src,
+        int32_t zeroPoint = 0);
+
+    //! Unpacks a packed fragment into a fragment of UnpackedT as (q - zeroPoint) * scale.
+    /*!
+      \param dst Unpacked fragment
+      \param src Packed fragment
+      \param zeroPoint Zero point subtracted from each element
+      \param scale Scale multiplied with each element
+      \tparam MatrixT fragment context
+      \tparam BlockM/N/K dense block dimensions
+      \tparam DataT packed data type
+      \tparam DataLayout in-memory layout as col_major or row_major
+      \tparam UnpackedT floating point data type of the unpacked fragment
+      \note Integer results are not scaled: scale the accumulator instead.
+    */
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void unpack_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, UnpackedT, DataLayout>&                    dst,
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT> const& src,
+        int32_t   zeroPoint,
+        UnpackedT scale);
+
+#if !defined(__HIPCC_RTC__)
+
+    //! Packs a dense matrix of 4-bit values two per byte along K.
+    /*!
+      \param packed Output packed matrix
+      \param values Dense M x N matrix of values within the range of the packed type
+      \param m Row count
+      \param n Column count
+      \param ld Leading dimension of the dense matrix
+      \param ldp Leading dimension in bytes of the packed matrix
+      \tparam MatrixT matrix_a to pack along columns, or matrix_b to pack along rows
+      \tparam DataLayout in-memory layout of the dense and packed matrices
+      \note The K dimension, columns of a matrix_a or rows of a matrix_b, must be even.
+    */
+    template <typename MatrixT, typename DataLayout>
+    ROCWMMA_HOST void pack_int4(uint8_t*      packed,
+                                int8_t const* values,
+                                uint32_t      m,
+                                uint32_t      n,
+                                uint32_t      ld,
+                                uint32_t      ldp);
+
+    //! Unpacks a packed 4-bit matrix into a dense matrix of values.
+    /*!
+      \param values Output dense M x N matrix
+      \param packed Packed matrix
+      \param m Row count
+      \param n Column count
+      \param ld Leading dimension of the dense matrix
+      \param ldp Leading dimension in bytes of the packed matrix
+      \tparam DataT packed data type as int4_t or uint4_t
+      \tparam MatrixT matrix_a packed along columns, or matrix_b packed along rows
+      \tparam DataLayout in-memory layout of the dense and packed matrices
+    */
+    template <typename DataT, typename MatrixT, typename DataLayout>
+    ROCWMMA_HOST void unpack_int4(int8_t*        values,
+                                  uint8_t const* packed,
+                                  uint32_t       m,
+                                  uint32_t       n,
+                                  uint32_t       ld,
+                                  uint32_t       ldp);
+
+    //! Dequantizes a packed 4-bit matrix as (q - zeroPoint) * scale.
+    /*!
+      \param output Output dense M x N matrix
+      \param packed Packed matrix
+      \param m Row count
+      \param n Column count
+      \param ld Leading dimension of the dense matrix
+      \param ldp Leading dimension in bytes of the packed matrix
+      \param zeroPoint Zero point subtracted from each element
+      \param scale Scale multiplied with each element
+      \tparam DataT packed data type as int4_t or uint4_t
+      \tparam MatrixT matrix_a packed along columns, or matrix_b packed along rows
+      \tparam DataLayout in-memory layout of the dense and packed matrices
+      \tparam OutputT output data type
+      \note This is the reference of unpack_fragment followed by a dense mma_sync.
+    */
+    template <typename DataT, typename MatrixT, typename DataLayout, typename OutputT>
+    ROCWMMA_HOST void dequantize_int4(OutputT*       output,
+                                      uint8_t const* packed,
+                                      uint32_t       m,
+                                      uint32_t       n,
+                                      uint32_t       ld,
+                                      uint32_t       ldp,
+                                      int32_t        zeroPoint = 0,
+                                      float32_t      scale     = 1.0f);
+
+#endif // !defined(__HIPCC_RTC__)
+
+} // namespace rocwmma
+
+#include "rocwmma_int4_impl.hpp"
+
+#endif // ROCWMMA_INT4_API_HPP
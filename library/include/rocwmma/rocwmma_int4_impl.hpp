@@ -0,0 +1,352 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_INT4_API_IMPL_HPP
+#define ROCWMMA_INT4_API_IMPL_HPP
+
+#include "internal/int4.hpp"
+
+#include "rocwmma_int4.hpp"
+
+namespace rocwmma
+{
+    // packed_fragment implementations
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::
+            packed_fragment(const packed_fragment& other)
+        : mStorage(other.mStorage)
+    {
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>&
+                   packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::
+                   operator=(const packed_fragment& other)
+    {
+        mStorage = other.mStorage;
+        return *this;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE inline uint8_t&
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::operator[](
+            uint32_t index)
+    {
+        return mAccess.data[index];
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE inline uint8_t const&
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::operator[](
+            uint32_t index) const
+    {
+        return mAccess.data[index];
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE inline auto
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::operator*()
+            -> typename Traits::StorageT&
+    {
+        return mStorage;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE inline auto
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::operator*()
+            const -> typename Traits::StorageT const&
+    {
+        return mStorage;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::height()
+    {
+        return IOConfig::IOShape::BlockHeight;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::width()
+    {
+        return IOConfig::IOShape::BlockWidth;
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>::size()
+    {
+        return num_elements;
+    }
+
+    // API implementations
+    template <typename CachePolicy,
+              typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void load_matrix_sync(
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT>& frag,
+        const uint8_t*                                                                  data,
+        uint32_t                                                                        ldm)
+    {
+        using FragT    = decay_t<decltype(frag)>;
+        using IOConfig = typename FragT::IOConfig;
+        using Loader   = typename IOConfig::template PolicyLoader<CachePolicy>;
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Load bytes then implicit pack
+        Loader::exec(frag.mAccess, data, ldm);
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void unpack_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, UnpackedT, DataLayout>&                    dst,
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT> const& src,
+        int32_t zeroPoint)
+    {
+        using FragDst  = decay_t<decltype(dst)>;
+        using IOConfig = typename decay_t<decltype(src)>::IOConfig;
+
+        static_assert(GetIOConfig_t<FragDst>::IOLayout::MaxVW
+                          == IOConfig::PackRatio * IOConfig::MaxVW,
+                      "Packed and unpacked fragment layouts do not match");
+
+        if constexpr(is_same<UnpackedT, int8_t>::value)
+        {
+            PackedUnpack<DataT>::exec(dst.mStorage, src.mStorage, zeroPoint);
+        }
+        else
+        {
+            PackedUnpack<DataT>::exec(
+                dst.mAccess, src.mAccess, zeroPoint, static_cast<UnpackedT>(1.0f));
+        }
+    }
+
+    template <typename MatrixT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename UnpackedT>
+    ROCWMMA_DEVICE void unpack_fragment(
+        fragment<MatrixT, BlockM, BlockN, BlockK, UnpackedT, DataLayout>&                    dst,
+        packed_fragment<MatrixT, BlockM, BlockN, BlockK, DataT, DataLayout, UnpackedT> const& src,
+        int32_t   zeroPoint,
+        UnpackedT scale)
+    {
+        using FragDst  = decay_t<decltype(dst)>;
+        using IOConfig = typename decay_t<decltype(src)>::IOConfig;
+
+        static_assert(!is_same<UnpackedT, int8_t>::value,
+                      "int8_t results cannot be scaled. Scale the accumulator instead");
+        static_assert(GetIOConfig_t<FragDst>::IOLayout::MaxVW
+                          == IOConfig::PackRatio * IOConfig::MaxVW,
+                      "Packed and unpacked fragment layouts do not match");
+
+        PackedUnpack<DataT>::exec(dst.mAccess, src.mAccess, zeroPoint, scale);
+    }
+
+#if !defined(__HIPCC_RTC__)
+
+    namespace detail
+    {
+        template <typename DataLayout>
+        ROCWMMA_HOST inline uint64_t int4Offset(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return is_same<DataLayout, row_major>::value
+                       ? static_cast<uint64_t>(row) * ld + col
+                       : static_cast<uint64_t>(col) * ld + row;
+        }
+
+        // Packed byte of the dense element (row, col), packed along K
+        template <typename MatrixT, typename DataLayout>
+        ROCWMMA_HOST inline uint64_t int4PackedOffset(uint32_t row, uint32_t col, uint32_t ldp)
+        {
+            return is_same<MatrixT, matrix_a>::value
+                       ? int4Offset<DataLayout>(row, col / 2u, ldp)
+                       : int4Offset<DataLayout>(row / 2u, col, ldp);
+        }
+
+        // Nibble shift of the dense element (row, col): even K in the low nibble
+        template <typename MatrixT>
+        ROCWMMA_HOST inline uint32_t int4Shift(uint32_t row, uint32_t col)
+        {
+            return 4u * ((is_same<MatrixT, matrix_a>::value ? col : row) % 2u);
+        }
+
+    } // namespace detail
+
+    template <typename MatrixT, typename DataLayout>
+    ROCWMMA_HOST void pack_int4(uint8_t*      packed,
+                                int8_t const* values,
+                                uint32_t      m,
+                                uint32_t      n,
+                                uint32_t      ld,
+                                uint32_t      ldp)
+    {
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Packed matrices must be matrix_a or matrix_b");
+
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t col = 0u; col < n; col++)
+            {
+                auto     offset = detail::int4PackedOffset<MatrixT, DataLayout>(row, col, ldp);
+                auto     shift  = detail::int4Shift<MatrixT>(row, col);
+                uint32_t nibble = values[detail::int4Offset<DataLayout>(row, col, ld)] & 0xF;
+
+                // Keep the other nibble of the byte
+                packed[offset] = static_cast<uint8_t>((packed[offset] & ~(0xFu << shift))
+                                                      | (nibble << shift));
+            }
+        }
+    }
+
+    template <typename DataT, typename MatrixT, typename DataLayout>
+    ROCWMMA_HOST void unpack_int4(int8_t*        values,
+                                  uint8_t const* packed,
+                                  uint32_t       m,
+                                  uint32_t       n,
+                                  uint32_t       ld,
+                                  uint32_t       ldp)
+    {
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Packed matrices must be matrix_a or matrix_b");
+
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t col = 0u; col < n; col++)
+            {
+                auto offset = detail::int4PackedOffset<MatrixT, DataLayout>(row, col, ldp);
+                auto nibble = (packed[offset] >> detail::int4Shift<MatrixT>(row, col)) & 0xFu;
+
+                values[detail::int4Offset<DataLayout>(row, col, ld)]
+                    = static_cast<int8_t>(PackedUnpack<DataT>::value(nibble));
+            }
+        }
+    }
+
+    template <typename DataT, typename MatrixT, typename DataLayout, typename OutputT>
+    ROCWMMA_HOST void dequantize_int4(OutputT*       output,
+                                      uint8_t const* packed,
+                                      uint32_t       m,
+                                      uint32_t       n,
+                                      uint32_t       ld,
+                                      uint32_t       ldp,
+                                      int32_t        zeroPoint,
+                                      float32_t      scale)
+    {
+        static_assert(is_same<MatrixT, matrix_a>::value || is_same<MatrixT, matrix_b>::value,
+                      "Packed matrices must be matrix_a or matrix_b");
+
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t col = 0u; col < n; col++)
+            {
+                auto offset = detail::int4PackedOffset<MatrixT, DataLayout>(row, col, ldp);
+                auto nibble = (packed[offset] >> detail::int4Shift<MatrixT>(row, col)) & 0xFu;
+                auto q      = PackedUnpack<DataT>::value(nibble) - zeroPoint;
+
+                output[detail::int4Offset<DataLayout>(row, col, ld)]
+                    = static_cast<OutputT>(static_cast<float32_t>(q) * scale);
+            }
+        }
+    }
+
+#endif // !defined(__HIPCC_RTC__)
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_INT4_API_IMPL_HPP
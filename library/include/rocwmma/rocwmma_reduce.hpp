@@ -0,0 +1,173 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REDUCE_API_HPP
+#define ROCWMMA_REDUCE_API_HPP
+
+#include "rocwmma.hpp"
+
+#include "internal/reduce.hpp"
+
+/**
+ * ROCWMMAReduce complements the ROCWMMA API with row and column reductions of
+ * accumulator fragments, computed entirely in registers.
+ *
+ * \n
+ * **reduce_rows / reduce_cols**
+ *
+ * Partials held by each lane are first combined in-register, following the
+ * accumulator matrix layout, then across lanes with butterfly exchanges over the
+ * DPP, swizzle and permute cross-lane backends. No LDS is used.
+ * Results are either broadcast back into the fragment, such that every element
+ * of a row (or column) holds the reduction of that row (or column), or returned
+ * as a vector indexed by row (or column) that is identical in every lane.
+ *
+ * Built-in ops live in the rocwmma::reduction namespace:
+ * - sum / max / min
+ *
+ * Sub-dword types are reduced in 32b precision. The argmax variants return the
+ * column (or row) index of the maximum of each row (or column), with ties
+ * resolved to the lowest index.
+ */
+
+namespace rocwmma
+{
+    //! Reduces each row of an accumulator fragment and broadcasts the result to every
+    //! element of the row.
+    /*!
+      \param frag Accumulator fragment
+      \param op Reduction functor, invoked as op(lhs, rhs)
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+      \tparam ReduceOp reduction functor type
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE void
+        reduce_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                    ReduceOp const&                                                  op);
+
+    //! Reduces each column of an accumulator fragment and broadcasts the result to every
+    //! element of the column.
+    /*!
+      \param frag Accumulator fragment
+      \param op Reduction functor, invoked as op(lhs, rhs)
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+      \tparam ReduceOp reduction functor type
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE void
+        reduce_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                    ReduceOp const&                                                  op);
+
+    //! Reduces each row of an accumulator fragment.
+    /*!
+      \returns Vector of row reductions, indexed by row and identical in every lane
+      \param frag Accumulator fragment
+      \param op Reduction functor, invoked as op(lhs, rhs)
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+      \tparam ReduceOp reduction functor type
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE VecT<DataT, BlockM> reduce_rows_vector(
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        ReduceOp const&                                                         op);
+
+    //! Reduces each column of an accumulator fragment.
+    /*!
+      \returns Vector of column reductions, indexed by column and identical in every lane
+      \param frag Accumulator fragment
+      \param op Reduction functor, invoked as op(lhs, rhs)
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+      \tparam ReduceOp reduction functor type
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE VecT<DataT, BlockN> reduce_cols_vector(
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        ReduceOp const&                                                         op);
+
+    //! Finds the column index of the maximum of each row of an accumulator fragment.
+    /*!
+      \returns Vector of column indices, indexed by row and identical in every lane
+      \param frag Accumulator fragment
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE VecT<uint32_t, BlockM>
+        argmax_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag);
+
+    //! Finds the row index of the maximum of each column of an accumulator fragment.
+    /*!
+      \returns Vector of row indices, indexed by column and identical in every lane
+      \param frag Accumulator fragment
+      \tparam BlockM/N/K block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout as col_major or row_major, or void
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE VecT<uint32_t, BlockN>
+        argmax_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag);
+
+} // namespace rocwmma
+
+#include "rocwmma_reduce_impl.hpp"
+
+#endif // ROCWMMA_REDUCE_API_HPP
@@ -0,0 +1,405 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_REDUCE_API_IMPL_HPP
+#define ROCWMMA_REDUCE_API_IMPL_HPP
+
+#include "internal/reduce.hpp"
+
+#include "rocwmma_reduce.hpp"
+
+namespace rocwmma
+{
+    namespace detail
+    {
+        // Reductions of the accumulator registers, following the matrix layout.
+        // Lanes hold the same columns in all of their registers: lane % LaneCols, plus
+        // a multiple of the wave size for each column segment when BlockN exceeds the
+        // wave. Each aligned group of LaneCols lanes holds the same rows in the same
+        // registers. Rows are therefore reduced over column segments in-register, then
+        // across the lanes of each group. Columns are reduced over the rows held
+        // in-register, then across lane groups.
+        template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename DataT>
+        struct ReduceFragment
+        {
+            using FragRowMajor = fragment<accumulator, BlockM, BlockN, BlockK, DataT, row_major>;
+            using IOLayout     = typename GetIOConfig_t<FragRowMajor>::IOLayout;
+            using MatrixLayout = typename IOLayout::MatrixLayout;
+            using PartialT     = ReduceT<DataT>;
+
+            enum : uint32_t
+            {
+                WaveSize   = Constants::AMDGCN_WAVE_SIZE,
+                RegCount   = FragRowMajor::num_elements,
+                LaneCols   = BlockN < WaveSize ? BlockN : WaveSize,
+                LaneGroups = WaveSize / LaneCols,
+
+                // Column segments are the outermost register stride of the layout
+                ColSegs = BlockN / LaneCols,
+                RowRegs = RegCount / ColSegs,
+            };
+
+            static_assert(IOLayout::VW == 1u, "Expected one element per IO");
+            static_assert(RowRegs * LaneGroups == BlockM, "Unexpected accumulator layout");
+
+            template <size_t Depth = 0, typename StrideCounts, typename Strides2d>
+            ROCWMMA_DEVICE static inline void unroll_right(Coord2d (&coords)[RegCount],
+                                                           uint32_t&      index,
+                                                           Coord2d        coord,
+                                                           StrideCounts&& strideCounts,
+                                                           Strides2d&&    strides2d)
+            {
+                auto stride2d    = get<Depth>(strides2d);
+                auto strideCount = get<Depth>(strideCounts);
+
+                // Last depth layer will record the coord
+                if constexpr(Depth == (VecTraits<decay_t<StrideCounts>>::size() - 1u))
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        coords[index] = coord;
+                        coord += stride2d;
+                        index++;
+                    }
+                }
+                // Recurse to the next nested layer
+                else
+                {
+#pragma unroll
+                    for(int i = 0; i < strideCount; i++)
+                    {
+                        unroll_right<Depth + 1>(coords, index, coord, strideCounts, strides2d);
+                        coord += stride2d;
+                    }
+                }
+            }
+
+            // Matrix coordinate of each register, as held by the given lane
+            ROCWMMA_DEVICE static inline void registerCoords(Coord2d (&coords)[RegCount],
+                                                             uint32_t laneId)
+            {
+                uint32_t index = 0u;
+                unroll_right(coords,
+                             index,
+                             MatrixLayout::baseOffset(laneId),
+                             MatrixLayout::strideCounts(),
+                             MatrixLayout::strides());
+            }
+
+            ROCWMMA_DEVICE static inline DataT extract(PartialT const& partial)
+            {
+                return static_cast<DataT>(partial);
+            }
+
+            ROCWMMA_DEVICE static inline uint32_t extract(ArgMax<PartialT> const& partial)
+            {
+                return partial.index;
+            }
+
+            // Combines the partials of each row, given the partial of each register
+            template <typename PartialsT, typename CombineOp>
+            ROCWMMA_DEVICE static inline void reduceRows(PartialsT (&rowPartials)[RowRegs],
+                                                         PartialsT const (&partials)[RegCount],
+                                                         CombineOp const& op)
+            {
+#pragma unroll
+                for(uint32_t i = 0; i < RowRegs; i++)
+                {
+                    rowPartials[i] = partials[i];
+#pragma unroll
+                    for(uint32_t j = 1; j < ColSegs; j++)
+                    {
+                        rowPartials[i] = op(rowPartials[i], partials[j * RowRegs + i]);
+                    }
+                    rowPartials[i] = butterflyReduce<1u, LaneCols>(rowPartials[i], op);
+                }
+            }
+
+            // Combines the partials of each column, given the partial of each register
+            template <typename PartialsT, typename CombineOp>
+            ROCWMMA_DEVICE static inline void reduceCols(PartialsT (&colPartials)[ColSegs],
+                                                         PartialsT const (&partials)[RegCount],
+                                                         CombineOp const& op)
+            {
+#pragma unroll
+                for(uint32_t j = 0; j < ColSegs; j++)
+                {
+                    colPartials[j] = partials[j * RowRegs];
+#pragma unroll
+                    for(uint32_t i = 1; i < RowRegs; i++)
+                    {
+                        colPartials[j] = op(colPartials[j], partials[j * RowRegs + i]);
+                    }
+                    colPartials[j] = butterflyReduce<LaneCols, WaveSize>(colPartials[j], op);
+                }
+            }
+
+            // Collects row results from each lane group in turn, indexed by row
+            template <uint32_t Group = 0u, typename ResultT, typename PartialsT>
+            ROCWMMA_DEVICE static inline void gatherRows(ResultT&         result,
+                                                         PartialsT const (&rowPartials)[RowRegs])
+            {
+                if constexpr(Group < LaneGroups)
+                {
+                    using BCastOp
+                        = Permute::Driver<PermuteImpl::OpsBase::BlockBCast<Group, LaneCols>>;
+
+                    Coord2d coords[RegCount];
+                    registerCoords(coords, Group * LaneCols);
+
+#pragma unroll
+                    for(uint32_t i = 0; i < RowRegs; i++)
+                    {
+                        if constexpr(LaneGroups == 1u)
+                        {
+                            result.data[get<0>(coords[i])] = extract(rowPartials[i]);
+                        }
+                        else
+                        {
+                            result.data[get<0>(coords[i])]
+                                = extract(crossLaneExec<BCastOp>(rowPartials[i]));
+                        }
+                    }
+
+                    gatherRows<Group + 1u>(result, rowPartials);
+                }
+            }
+
+            // Collects column results from the first LaneCols lanes, indexed by column.
+            // Swizzle broadcasts within 32 lanes, and permute beyond.
+            template <uint32_t Col = 0u, typename ResultT, typename PartialsT>
+            ROCWMMA_DEVICE static inline void gatherCols(ResultT&         result,
+                                                         PartialsT const (&colPartials)[ColSegs])
+            {
+                if constexpr(Col < LaneCols)
+                {
+                    using BCastOp
+                        = conditional_t<(LaneCols <= 32u),
+                                        Swizzle::BCast32<Col % 32u>,
+                                        Permute::Driver<PermuteImpl::OpsBase::BlockBCast<Col, 1u>>>;
+
+#pragma unroll
+                    for(uint32_t j = 0; j < ColSegs; j++)
+                    {
+                        result.data[j * LaneCols + Col]
+                            = extract(crossLaneExec<BCastOp>(colPartials[j]));
+                    }
+
+                    gatherCols<Col + 1u>(result, colPartials);
+                }
+            }
+
+            template <typename AccessT>
+            ROCWMMA_DEVICE static inline void widen(PartialT (&partials)[RegCount],
+                                                    AccessT const& data)
+            {
+#pragma unroll
+                for(uint32_t i = 0; i < RegCount; i++)
+                {
+                    partials[i] = static_cast<PartialT>(data.data[i]);
+                }
+            }
+
+            // Pairs each register with its column (or row) index for argmax
+            template <typename AccessT>
+            ROCWMMA_DEVICE static inline void widenIndexed(ArgMax<PartialT> (&partials)[RegCount],
+                                                           AccessT const& data,
+                                                           bool           colIndex)
+            {
+                Coord2d coords[RegCount];
+                registerCoords(coords, WaveSpace<>::localLaneId());
+
+#pragma unroll
+                for(uint32_t i = 0; i < RegCount; i++)
+                {
+                    partials[i].value = static_cast<PartialT>(data.data[i]);
+                    partials[i].index = colIndex ? get<1>(coords[i]) : get<0>(coords[i]);
+                }
+            }
+
+            template <typename AccessT, typename ReduceOp>
+            ROCWMMA_DEVICE static inline void rows(AccessT& data, ReduceOp const& op)
+            {
+                PartialT partials[RegCount];
+                PartialT rowPartials[RowRegs];
+                widen(partials, data);
+                reduceRows(rowPartials, partials, op);
+
+#pragma unroll
+                for(uint32_t i = 0; i < RegCount; i++)
+                {
+                    data.data[i] = extract(rowPartials[i % RowRegs]);
+                }
+            }
+
+            template <typename AccessT, typename ReduceOp>
+            ROCWMMA_DEVICE static inline void cols(AccessT& data, ReduceOp const& op)
+            {
+                PartialT partials[RegCount];
+                PartialT colPartials[ColSegs];
+                widen(partials, data);
+                reduceCols(colPartials, partials, op);
+
+#pragma unroll
+                for(uint32_t i = 0; i < RegCount; i++)
+                {
+                    data.data[i] = extract(colPartials[i / RowRegs]);
+                }
+            }
+
+            template <typename AccessT, typename ReduceOp>
+            ROCWMMA_DEVICE static inline auto rowsVector(AccessT const& data, ReduceOp const& op)
+            {
+                PartialT partials[RegCount];
+                PartialT rowPartials[RowRegs];
+                widen(partials, data);
+                reduceRows(rowPartials, partials, op);
+
+                VecT<DataT, BlockM> result;
+                gatherRows(result, rowPartials);
+                return result;
+            }
+
+            template <typename AccessT, typename ReduceOp>
+            ROCWMMA_DEVICE static inline auto colsVector(AccessT const& data, ReduceOp const& op)
+            {
+                PartialT partials[RegCount];
+                PartialT colPartials[ColSegs];
+                widen(partials, data);
+                reduceCols(colPartials, partials, op);
+
+                VecT<DataT, BlockN> result;
+                gatherCols(result, colPartials);
+                return result;
+            }
+
+            template <typename AccessT>
+            ROCWMMA_DEVICE static inline auto argmaxRows(AccessT const& data)
+            {
+                ArgMax<PartialT> partials[RegCount];
+                ArgMax<PartialT> rowPartials[RowRegs];
+                widenIndexed(partials, data, true);
+                reduceRows(rowPartials, partials, ArgMaxOp{});
+
+                VecT<uint32_t, BlockM> result;
+                gatherRows(result, rowPartials);
+                return result;
+            }
+
+            template <typename AccessT>
+            ROCWMMA_DEVICE static inline auto argmaxCols(AccessT const& data)
+            {
+                ArgMax<PartialT> partials[RegCount];
+                ArgMax<PartialT> colPartials[ColSegs];
+                widenIndexed(partials, data, false);
+                reduceCols(colPartials, partials, ArgMaxOp{});
+
+                VecT<uint32_t, BlockN> result;
+                gatherCols(result, colPartials);
+                return result;
+            }
+        };
+
+    } // namespace detail
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE void
+        reduce_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                    ReduceOp const&                                                  op)
+    {
+        // Register order of accumulator elements does not depend on the data layout
+        detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::rows(frag.mAccess, op);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE void
+        reduce_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                    ReduceOp const&                                                  op)
+    {
+        detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::cols(frag.mAccess, op);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE VecT<DataT, BlockM> reduce_rows_vector(
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        ReduceOp const&                                                         op)
+    {
+        return detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::rowsVector(frag.mAccess, op);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout,
+              typename ReduceOp>
+    ROCWMMA_DEVICE VecT<DataT, BlockN> reduce_cols_vector(
+        fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag,
+        ReduceOp const&                                                         op)
+    {
+        return detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::colsVector(frag.mAccess, op);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE VecT<uint32_t, BlockM>
+        argmax_rows(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag)
+    {
+        return detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::argmaxRows(frag.mAccess);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE VecT<uint32_t, BlockN>
+        argmax_cols(fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayout> const& frag)
+    {
+        return detail::ReduceFragment<BlockM, BlockN, BlockK, DataT>::argmaxCols(frag.mAccess);
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_REDUCE_API_IMPL_HPP
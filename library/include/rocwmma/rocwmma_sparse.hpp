@@ -0,0 +1,272 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_API_HPP
+#define ROCWMMA_SPARSE_API_HPP
+
+#include "rocwmma.hpp"
+
+#include "internal/smfmac.hpp"
+#include "internal/sparse.hpp"
+
+/**
+ * ROCWMMASparse complements the ROCWMMA API with 2:4 structured sparse matrix_a
+ * inputs, as produced by pruning each group of 4 consecutive K elements of A down
+ * to at most 2 non-zeros.
+ *
+ * \n
+ * **Compressed format**
+ *
+ * A sparse M x K matrix A is stored as:
+ * - values: the M x (K / 2) kept elements, in row_major or col_major layout
+ * - metadata: a row_major M x (K / 8) array of bytes. Byte c of row m holds the
+ *   2-bit positions within their dense group of the values in columns 4c to 4c + 3,
+ *   at bits [2j + 1 : 2j] for column 4c + j.
+ *
+ * Positions of the two values of a group are distinct and ascending.
+ * The host utilities prune_2to4 / compress_2to4 / decompress_2to4 produce and
+ * consume this format.
+ *
+ * \n
+ * **sparse_fragment**
+ *
+ * A matrix_a fragment of BlockM x BlockK dense elements, holding the compressed
+ * values and their packed indices. Lanes hold the values of the same K as in the
+ * dense matrix_a and matrix_b fragments.
+ *
+ * \n
+ * **mma_sync**
+ *
+ * Multiplies a sparse_fragment with a dense matrix_b fragment. On gfx94x, supported
+ * types and block sizes issue sparse MFMA instructions (smfmac), which perform the
+ * dense block K in half the instructions. Elsewhere, A is decompressed in-register
+ * and multiplied with the dense mma_sync.
+ *
+ * Sparse MFMA blocks:
+ * - f16 / bf16 -> f32: 16 x 16 x 32n and 32 x 32 x 16n
+ * - i8 -> i32: 16 x 16 x 64n and 32 x 32 x 32n
+ *
+ * The dense matrix_a MaxVW of the block must be a multiple of 8, which for 16 bit
+ * types requires BlockK >= 32 (16 x 16) or BlockK >= 16 (32 x 32).
+ */
+
+namespace rocwmma
+{
+    /*! \class sparse_fragment
+ *  \brief 2:4 structured sparse matrix_a fragment
+ *
+ * @tparam BlockM/N/K - dense block dimensions
+ * @tparam DataT - data type
+ * @tparam DataLayout - in-memory layout of the compressed values as col_major or row_major
+ *
+ * AccessT - Unpacked compressed values
+ * StorageT - Packed compressed values, as consumed by sparse MFMA
+ * IndexT - Packed 2-bit indices of the compressed values, 16 per register
+ *
+ * @note Values are stored in packed registers, however elements have no guaranteed order.
+ */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    class __align__(4) sparse_fragment
+    {
+    public:
+        using IOConfig = SparseIOConfig<BlockM, BlockN, BlockK, DataT, DataLayout>;
+        using IOTraits = typename IOConfig::IOTraits;
+
+        struct Traits
+        {
+        private:
+            using PackedElementT   = typename PackTraits<DataT>::PackedT;
+            using UnpackedElementT = typename PackTraits<DataT>::UnpackedT;
+
+        public:
+            using AccessT  = VecT<UnpackedElementT, IOTraits::UnpackedSize>;
+            using StorageT = VecT<PackedElementT, IOTraits::PackedSize>;
+            using IndexT   = typename IOConfig::IndexT;
+
+            constexpr static uint32_t Size = IOTraits::UnpackedSize;
+
+            static_assert(IOTraits::UnpackedSize % IOTraits::PackedSize == 0,
+                          "Unable to pack fragment elements");
+            static_assert(!is_same<DataLayout, void>::value,
+                          "Sparse fragments require a static data layout");
+        };
+
+        ROCWMMA_DEVICE                  sparse_fragment() = default;
+        ROCWMMA_DEVICE                  sparse_fragment(const sparse_fragment& other);
+        ROCWMMA_DEVICE sparse_fragment& operator=(const sparse_fragment& other);
+
+        // Accessors of the compressed values
+        ROCWMMA_DEVICE inline DataT&                           operator[](uint32_t index);
+        ROCWMMA_DEVICE inline DataT const&                     operator[](uint32_t index) const;
+        ROCWMMA_DEVICE inline typename Traits::StorageT&       operator*();
+        ROCWMMA_DEVICE inline typename Traits::StorageT const& operator*() const;
+
+        // Traits of the dense block
+        ROCWMMA_DEVICE constexpr static inline uint32_t height();
+        ROCWMMA_DEVICE constexpr static inline uint32_t width();
+        ROCWMMA_DEVICE constexpr static inline uint32_t size();
+
+        union
+        {
+            typename Traits::StorageT             mStorage; // Packed
+            typename Traits::AccessT              mAccess; // Unpacked
+            typename Traits::AccessT::Native_vec_ x; // Nuanced access
+            static_assert(sizeof(typename Traits::AccessT) == sizeof(typename Traits::StorageT),
+                          "Storage type and access type should be views into the same raw data");
+        };
+        typename Traits::IndexT   mIndex; // Packed 2-bit indices
+        constexpr static uint32_t num_elements = Traits::Size;
+        using element_type                     = DataT;
+    };
+
+    //! Loads the compressed values and metadata of a sparse block into a sparse fragment.
+    /*!
+      \param frag Sparse fragment of type DataT, with its layout determined statically.
+      \param values Pointer to the compressed values of the block.
+      \param ldv Leading dimension of the compressed values matrix (M x K / 2)
+      \param meta Pointer to the metadata bytes of the block.
+      \param ldmeta Leading dimension in bytes of the row_major metadata (M x K / 8)
+      \tparam CachePolicy cache policy tag for the memory accesses, defaults to cache_default
+      \tparam BlockM/N/K dense block dimensions
+      \tparam DataT data type
+      \tparam DataLayout in-memory layout of the values as col_major or row_major
+      \note For the block at dense coordinate (row, col), values point to the compressed
+      coordinate (row, col / 2) and meta to the metadata byte (row, col / 8).
+    */
+    template <typename CachePolicy = cache_default,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         const DataT*                                                values,
+                         uint32_t                                                    ldv,
+                         const uint8_t*                                              meta,
+                         uint32_t                                                    ldmeta);
+
+    //! Performs the multiply-accumulate of a sparse A with a dense B: D = A * B + C.
+    /*!
+      \param d Accumulator output D
+      \param a Sparse input fragment A
+      \param b Input fragment B
+      \param c Input accumulator fragment C
+      \tparam BlockM/N/K dense block dimensions
+      \tparam InputT data type of input frags A and B
+      \tparam ComputeT data type of accumulator fragment C / D
+      \tparam LayoutA in-memory layout of frag A values as col_major or row_major
+      \tparam LayoutB in-memory layout of frag B as col_major or row_major
+      \note Frag c = d is valid
+    */
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 sparse_fragment<BlockM, BlockN, BlockK, InputT, LayoutA> const&         a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c);
+
+#if !defined(__HIPCC_RTC__)
+
+    //! Prunes a dense M x K matrix to 2:4 structured sparsity in place.
+    /*!
+      \param data Dense matrix
+      \param m Row count
+      \param k Column count, a multiple of 8
+      \param ld Leading dimension of the matrix
+      \tparam DataLayout in-memory layout of the matrix as col_major or row_major
+      \tparam DataT data type
+      \note The 2 elements of largest magnitude of each group of 4 columns are kept, and
+      the first of equal magnitudes is preferred.
+    */
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void prune_2to4(DataT* data, uint32_t m, uint32_t k, uint32_t ld);
+
+    //! Compresses a dense M x K matrix into 2:4 values and metadata.
+    /*!
+      \param values Output compressed M x (K / 2) values
+      \param meta Output row_major M x (K / 8) metadata bytes
+      \param dense Dense matrix
+      \param m Row count
+      \param k Column count, a multiple of 8
+      \param ld Leading dimension of the dense matrix
+      \param ldv Leading dimension of the values
+      \param ldmeta Leading dimension in bytes of the metadata
+      \tparam DataLayout in-memory layout of the dense matrix and values
+      \tparam DataT data type
+      \note Groups of more than 2 non-zeros are pruned as in prune_2to4.
+    */
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void compress_2to4(DataT*       values,
+                                    uint8_t*     meta,
+                                    DataT const* dense,
+                                    uint32_t     m,
+                                    uint32_t     k,
+                                    uint32_t     ld,
+                                    uint32_t     ldv,
+                                    uint32_t     ldmeta);
+
+    //! Expands 2:4 values and metadata into a dense M x K matrix.
+    /*!
+      \param dense Output dense matrix
+      \param values Compressed M x (K / 2) values
+      \param meta Row_major M x (K / 8) metadata bytes
+      \param m Row count
+      \param k Column count, a multiple of 8
+      \param ld Leading dimension of the dense matrix
+      \param ldv Leading dimension of the values
+      \param ldmeta Leading dimension in bytes of the metadata
+      \tparam DataLayout in-memory layout of the dense matrix and values
+      \tparam DataT data type
+    */
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void decompress_2to4(DataT*         dense,
+                                      DataT const*   values,
+                                      uint8_t const* meta,
+                                      uint32_t       m,
+                                      uint32_t       k,
+                                      uint32_t       ld,
+                                      uint32_t       ldv,
+                                      uint32_t       ldmeta);
+
+#endif // !defined(__HIPCC_RTC__)
+
+} // namespace rocwmma
+
+#include "rocwmma_sparse_impl.hpp"
+
+#endif // ROCWMMA_SPARSE_API_HPP
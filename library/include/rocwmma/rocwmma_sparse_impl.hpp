@@ -0,0 +1,360 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_SPARSE_API_IMPL_HPP
+#define ROCWMMA_SPARSE_API_IMPL_HPP
+
+#include "internal/smfmac.hpp"
+#include "internal/sparse.hpp"
+
+#include "rocwmma_sparse.hpp"
+
+namespace rocwmma
+{
+    // sparse_fragment implementations
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::sparse_fragment(
+        const sparse_fragment& other)
+        : mStorage(other.mStorage)
+        , mIndex(other.mIndex)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>&
+                   sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::operator=(
+            const sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>& other)
+    {
+        mStorage = other.mStorage;
+        mIndex   = other.mIndex;
+        return *this;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE inline DataT&
+        sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::operator[](uint32_t index)
+    {
+        return mAccess.data[index];
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE inline DataT const&
+        sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::operator[](
+            uint32_t index) const
+    {
+        return mAccess.data[index];
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE inline auto sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::
+                               operator*() -> typename Traits::StorageT&
+    {
+        return mStorage;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE inline auto sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::
+                               operator*() const -> typename Traits::StorageT const&
+    {
+        return mStorage;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::height()
+    {
+        return BlockM;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::width()
+    {
+        return BlockK;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE constexpr inline uint32_t
+        sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>::size()
+    {
+        return num_elements;
+    }
+
+    // API implementations
+    template <typename CachePolicy,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayout>
+    ROCWMMA_DEVICE void
+        load_matrix_sync(sparse_fragment<BlockM, BlockN, BlockK, DataT, DataLayout>& frag,
+                         const DataT*                                                values,
+                         uint32_t                                                    ldv,
+                         const uint8_t*                                              meta,
+                         uint32_t                                                    ldmeta)
+    {
+        using FragT       = decay_t<decltype(frag)>;
+        using IOConfig    = typename FragT::IOConfig;
+        using Loader      = typename IOConfig::template PolicyLoader<CachePolicy>;
+        using IndexLoader = SparseIndexLoad<IOConfig>;
+
+        static_assert(
+            is_same<typename FragT::Traits::AccessT, typename Loader::Traits::OutputT>::value,
+            "Fragment access and load output types do not match");
+
+        // Load values then implicit pack, and gather their indices
+        Loader::exec(frag.mAccess, values, ldv);
+        IndexLoader::exec(frag.mIndex, meta, ldmeta);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    ROCWMMA_DEVICE void
+        mma_sync(fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>&       d,
+                 sparse_fragment<BlockM, BlockN, BlockK, InputT, LayoutA> const&         a,
+                 fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB> const&      b,
+                 fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutC> const& c)
+    {
+        using FragA    = decay_t<decltype(a)>;
+        using FragB    = decay_t<decltype(b)>;
+        using IOConfig = typename FragA::IOConfig;
+        using SMFMAC   = Smfmac<InputT, ComputeT, BlockM, BlockN, BlockK>;
+
+        if constexpr(SMFMAC::Supported)
+        {
+            // Each smfmac consumes one MaxVW vector of values per lane, next to the
+            // B vector of the same K.
+            static_assert(IOConfig::MaxVW == SMFMAC::Traits::AElementsPerSmfmac,
+                          "Sparse fragment layout does not match the sparse MFMA");
+            static_assert(GetIOConfig_t<FragB>::IOLayout::MaxVW == 2u * IOConfig::MaxVW,
+                          "Sparse fragment and matrix_b layouts do not match");
+
+            (*d) = SMFMAC::exec(*a, *b, *c, a.mIndex);
+        }
+        else
+        {
+            // Fall back to the dense path
+            using FragDenseA = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+
+            FragDenseA denseA;
+            SparseDecompress<IOConfig>::exec(denseA.mAccess, a.mAccess, a.mIndex);
+            mma_sync(d, denseA, b, c);
+        }
+    }
+
+#if !defined(__HIPCC_RTC__)
+
+    namespace detail
+    {
+        template <typename DataLayout>
+        ROCWMMA_HOST inline uint64_t sparseOffset(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return is_same<DataLayout, row_major>::value
+                       ? static_cast<uint64_t>(row) * ld + col
+                       : static_cast<uint64_t>(col) * ld + row;
+        }
+
+        // Positions of the 2 largest magnitudes of a group of 4, in ascending order.
+        // The first of equal magnitudes is preferred.
+        template <typename DataT>
+        ROCWMMA_HOST inline void
+            selectGroup2to4(DataT const (&group)[4], uint32_t& first, uint32_t& second)
+        {
+            float32_t magnitudes[4];
+            for(uint32_t i = 0u; i < 4u; i++)
+            {
+                auto value    = static_cast<float32_t>(group[i]);
+                magnitudes[i] = value < 0.0f ? -value : value;
+            }
+
+            first = 0u;
+            for(uint32_t i = 1u; i < 4u; i++)
+            {
+                first = magnitudes[i] > magnitudes[first] ? i : first;
+            }
+
+            second = (first == 0u) ? 1u : 0u;
+            for(uint32_t i = second + 1u; i < 4u; i++)
+            {
+                second = (i != first && magnitudes[i] > magnitudes[second]) ? i : second;
+            }
+
+            if(second < first)
+            {
+                auto tmp = first;
+                first    = second;
+                second   = tmp;
+            }
+        }
+
+    } // namespace detail
+
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void prune_2to4(DataT* data, uint32_t m, uint32_t k, uint32_t ld)
+    {
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t col = 0u; col < k; col += 4u)
+            {
+                DataT group[4];
+                for(uint32_t i = 0u; i < 4u; i++)
+                {
+                    group[i] = data[detail::sparseOffset<DataLayout>(row, col + i, ld)];
+                }
+
+                uint32_t first, second;
+                detail::selectGroup2to4(group, first, second);
+
+                for(uint32_t i = 0u; i < 4u; i++)
+                {
+                    if(i != first && i != second)
+                    {
+                        data[detail::sparseOffset<DataLayout>(row, col + i, ld)]
+                            = static_cast<DataT>(0.0f);
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void compress_2to4(DataT*       values,
+                                    uint8_t*     meta,
+                                    DataT const* dense,
+                                    uint32_t     m,
+                                    uint32_t     k,
+                                    uint32_t     ld,
+                                    uint32_t     ldv,
+                                    uint32_t     ldmeta)
+    {
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t byte = 0u; byte < k / 8u; byte++)
+            {
+                meta[static_cast<uint64_t>(row) * ldmeta + byte] = 0u;
+            }
+
+            for(uint32_t group = 0u; group < k / 4u; group++)
+            {
+                DataT values4[4];
+                for(uint32_t i = 0u; i < 4u; i++)
+                {
+                    values4[i] = dense[detail::sparseOffset<DataLayout>(row, 4u * group + i, ld)];
+                }
+
+                uint32_t first, second;
+                detail::selectGroup2to4(values4, first, second);
+
+                values[detail::sparseOffset<DataLayout>(row, 2u * group, ldv)] = values4[first];
+                values[detail::sparseOffset<DataLayout>(row, 2u * group + 1u, ldv)]
+                    = values4[second];
+
+                // Two groups per byte, the first in the low nibble
+                meta[static_cast<uint64_t>(row) * ldmeta + group / 2u]
+                    |= static_cast<uint8_t>((first | (second << 2u)) << (4u * (group % 2u)));
+            }
+        }
+    }
+
+    template <typename DataLayout, typename DataT>
+    ROCWMMA_HOST void decompress_2to4(DataT*         dense,
+                                      DataT const*   values,
+                                      uint8_t const* meta,
+                                      uint32_t       m,
+                                      uint32_t       k,
+                                      uint32_t       ld,
+                                      uint32_t       ldv,
+                                      uint32_t       ldmeta)
+    {
+        for(uint32_t row = 0u; row < m; row++)
+        {
+            for(uint32_t group = 0u; group < k / 4u; group++)
+            {
+                uint32_t nibble = meta[static_cast<uint64_t>(row) * ldmeta + group / 2u]
+                                  >> (4u * (group % 2u));
+
+                for(uint32_t i = 0u; i < 4u; i++)
+                {
+                    dense[detail::sparseOffset<DataLayout>(row, 4u * group + i, ld)]
+                        = static_cast<DataT>(0.0f);
+                }
+
+                dense[detail::sparseOffset<DataLayout>(row, 4u * group + (nibble & 3u), ld)]
+                    = values[detail::sparseOffset<DataLayout>(row, 2u * group, ldv)];
+                dense[detail::sparseOffset<DataLayout>(row, 4u * group + ((nibble >> 2u) & 3u), ld)]
+                    = values[detail::sparseOffset<DataLayout>(row, 2u * group + 1u, ldv)];
+            }
+        }
+    }
+
+#endif // !defined(__HIPCC_RTC__)
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_SPARSE_API_IMPL_HPP
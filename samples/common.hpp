@@ -27,8 +27,10 @@
 #ifndef ROCWMMA_SAMPLES_COMMON_HPP
 #define ROCWMMA_SAMPLES_COMMON_HPP
 
+#include <algorithm>
 #include <iostream>
 #include <mutex>
+#include <vector>
 
 // Helper macro for HIP errors
 #ifndef CHECK_HIP_ERROR
@@ -59,6 +61,8 @@
     }
 #endif
 
+#include <rocwmma/internal/host_gemm.hpp>
+#include <rocwmma/internal/philox.hpp>
 #include <rocwmma/internal/type_traits.hpp>
 
 // HIP Host functions to determine the gfx architecture
@@ -184,32 +188,26 @@ __host__ static inline void
     }
 }
 
-// Host matrix data random initialization
+// Host matrix data random initialization.
+// Uses the counter-based generator shared with the tests, so the result
+// does not depend on thread count or visiting order.
 template <typename DataT>
-__host__ static inline void fillRand(DataT* mat, uint32_t m, uint32_t n)
+__host__ static inline void
+    fillRand(DataT* mat, uint32_t m, uint32_t n, uint64_t seed = rocwmma::PhiloxDefaultSeed)
 {
-    auto randInit = []() {
-        srand(time(0));
-        return 0u;
-    };
-    static auto init = randInit();
 #pragma omp parallel for
     for(int i = 0; i < m; ++i)
     {
-        auto rando = rand() % 5u;
-        for(int j = 0; j < n; j++)
+#pragma omp simd
+        for(uint32_t j = 0; j < n; j++)
         {
-            // Assign random integer values within 0-64, alternating
-            // sign if the value is a multiple of 3
-            auto value     = (rando + j) % 5u;
-            mat[i * n + j] = ((value % 3u == 0u) && std::is_signed<DataT>::value)
-                                 ? -static_cast<DataT>(value)
-                                 : static_cast<DataT>(value);
+            mat[i * n + j] = rocwmma::Philox4x32::template value<DataT>(seed, 0u, i, j);
         }
     }
 }
 
 // Host GEMM validation
+// Uses the cache-blocked reference gemm shared with the tests.
 template <typename InputT,
           typename OutputT,
           typename ComputeT,
@@ -231,30 +229,8 @@ __host__ void gemm_cpu_h(uint32_t       m,
                          ComputeT       alpha,
                          ComputeT       beta)
 {
-    auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
-    auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
-
-    auto aIndex = std::is_same<LayoutA, rocwmma::row_major>::value ? rowMjr : colMjr;
-    auto bIndex = std::is_same<LayoutB, rocwmma::row_major>::value ? rowMjr : colMjr;
-    auto cIndex = std::is_same<LayoutC, rocwmma::row_major>::value ? rowMjr : colMjr;
-    auto dIndex = std::is_same<LayoutD, rocwmma::row_major>::value ? rowMjr : colMjr;
-
-#pragma omp parallel for
-    for(int i = 0; i < m; ++i)
-    {
-#pragma omp parallel for
-        for(int j = 0; j < n; ++j)
-        {
-            ComputeT accum = static_cast<ComputeT>(0);
-            for(int h = 0; h < k; ++h)
-            {
-                accum += static_cast<ComputeT>(a[aIndex(i, h, lda)])
-                         * static_cast<ComputeT>(b[bIndex(h, j, ldb)]);
-            }
-            d[dIndex(i, j, ldd)] = static_cast<OutputT>(
-                alpha * accum + beta * static_cast<ComputeT>(c[cIndex(i, j, ldc)]));
-        }
-    }
+    rocwmma::gemm_blocked_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+        m, n, k, a, b, c, d, lda, ldb, ldc, ldd, alpha, beta);
 }
 
 // Element-wise comparison
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include <hip/hip_ext.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
+#include <rocwmma/rocwmma_reduce.hpp>
+
+#include "common.hpp"
+
+using rocwmma::accumulator;
+using rocwmma::col_major;
+using rocwmma::float16_t;
+using rocwmma::float32_t;
+using rocwmma::matrix_a;
+using rocwmma::matrix_b;
+using rocwmma::row_major;
+
+// Host attention validation: softmax(Q K^T / sqrt(d)) V per head
+void attentionFwdCPU(float16_t const* q,
+                     float16_t const* k,
+                     float16_t const* v,
+                     float16_t*       o,
+                     uint32_t         seqLen,
+                     uint32_t         headDim,
+                     uint32_t         batchHeads,
+                     bool             causal)
+{
+    auto scale = 1.0f / std::sqrt(static_cast<float>(headDim));
+
+#pragma omp parallel for collapse(2)
+    for(int bh = 0; bh < batchHeads; bh++)
+    {
+        for(int i = 0; i < seqLen; i++)
+        {
+            auto headOffset = bh * seqLen * headDim;
+            auto keyCount   = causal ? static_cast<uint32_t>(i) + 1u : seqLen;
+
+            std::vector<float> scores(keyCount);
+            float              rowMax = -std::numeric_limits<float>::infinity();
+            for(int j = 0; j < keyCount; j++)
+            {
+                float accum = 0.0f;
+                for(int h = 0; h < headDim; h++)
+                {
+                    accum += static_cast<float>(q[headOffset + i * headDim + h])
+                             * static_cast<float>(k[headOffset + j * headDim + h]);
+                }
+                scores[j] = accum * scale;
+                rowMax    = std::max(rowMax, scores[j]);
+            }
+
+            float rowSum = 0.0f;
+            for(int j = 0; j < keyCount; j++)
+            {
+                scores[j] = std::exp(scores[j] - rowMax);
+                rowSum += scores[j];
+            }
+
+            for(int h = 0; h < headDim; h++)
+            {
+                float accum = 0.0f;
+                for(int j = 0; j < keyCount; j++)
+                {
+                    accum += scores[j] * static_cast<float>(v[headOffset + j * headDim + h]);
+                }
+                o[headOffset + i * headDim + h] = static_cast<float16_t>(accum / rowSum);
+            }
+        }
+    }
+}
+
+// Supports ROCWMMA fragment sizes (TILE_DIM) of
+// : 16 x 16
+// : 32 x 32 ( only MI )
+constexpr static const int TILE_DIM = 16;
+
+// Head dimension, must be a multiple of TILE_DIM
+constexpr static const int HEAD_DIM = 64;
+
+// Fragment K dimension used for both products
+constexpr static const int BLOCK_K = 16;
+
+// Device warp size
+const uint32_t WAVE_SIZE = getWarpSize();
+
+// Thread block
+// : T_BLOCK_X must be multiple of AMDGCN_WAVE_SIZE.
+// Note: Each wave will compute TILE_DIM query rows of one head
+// Note: Workgroup will compute
+//  T_BLOCK_X / AMDGCN_WAVE_SIZE query tiles
+constexpr static const int T_BLOCK_X = 128;
+
+// Finite stand-in for -inf, so that masked scores do not produce NaNs
+constexpr static const float MASK_VALUE = -1.0e30f;
+
+// Masks scores of keys past the query row
+struct CausalMask
+{
+    template <typename DataT>
+    __device__ inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+    {
+        return col > row ? static_cast<DataT>(MASK_VALUE) : value;
+    }
+};
+
+// The following device kernel is a flash attention style implementation
+// of the attention forward pass, generalized as:
+// O[b] = softmax(Q[b] x transpose(K[b]) / sqrt(HEAD_DIM)) x V[b] for B heads
+//
+// In this simplified example, we assume:
+// : Q, K, V and O are in row-major format (S x HEAD_DIM x B)
+// : S is a multiple of the workgroup query rows
+//
+// Each wave keeps its TILE_DIM rows of Q in registers, while the workgroup
+// streams K and V through LDS one TILE_DIM x HEAD_DIM tile at a time.
+// Softmax is computed online: the running row max and row sum live in
+// accumulator fragments, and the output accumulators are rescaled whenever
+// the row max grows. The scores are never written to global memory, and the
+// output is normalized and written once at the end.
+__global__ void flashAttentionFwd(const float16_t* __restrict q,
+                                  const float16_t* __restrict k,
+                                  const float16_t* __restrict v,
+                                  float16_t* __restrict o,
+                                  uint  seqLen,
+                                  float scaleLog2,
+                                  bool  causal)
+{
+    using FragQ   = rocwmma::fragment<matrix_a, TILE_DIM, TILE_DIM, BLOCK_K, float16_t, row_major>;
+    using FragK   = rocwmma::fragment<matrix_b, TILE_DIM, TILE_DIM, BLOCK_K, float16_t, col_major>;
+    using FragP   = rocwmma::fragment<matrix_a, TILE_DIM, TILE_DIM, BLOCK_K, float16_t, row_major>;
+    using FragV   = rocwmma::fragment<matrix_b, TILE_DIM, TILE_DIM, BLOCK_K, float16_t, row_major>;
+    using FragAcc = rocwmma::fragment<accumulator, TILE_DIM, TILE_DIM, BLOCK_K, float>;
+
+    constexpr uint dimBlocks = HEAD_DIM / BLOCK_K;
+    constexpr uint dimTiles  = HEAD_DIM / TILE_DIM;
+    constexpr uint keyBlocks = TILE_DIM / BLOCK_K;
+    constexpr uint tileElems = TILE_DIM * HEAD_DIM;
+
+    auto waveCount = blockDim.x / rocwmma::Constants::AMDGCN_WAVE_SIZE;
+    auto waveIndex = threadIdx.x / rocwmma::Constants::AMDGCN_WAVE_SIZE;
+
+    // Query rows of the workgroup and of this wave
+    auto workgroupRow = blockIdx.x * waveCount * TILE_DIM;
+    auto waveRow      = workgroupRow + waveIndex * TILE_DIM;
+    auto headOffset   = blockIdx.y * seqLen * HEAD_DIM;
+
+    // LDS: shared K and V tiles, followed by one P tile per wave
+    HIP_DYNAMIC_SHARED(void*, localMemPtr);
+    auto* ldsK = reinterpret_cast<float16_t*>(localMemPtr);
+    auto* ldsV = ldsK + tileElems;
+    auto* ldsP = ldsV + tileElems + waveIndex * TILE_DIM * TILE_DIM;
+
+    // Q stays in registers for the whole pass
+    FragQ fragQ[dimBlocks];
+    for(int d = 0; d < dimBlocks; d++)
+    {
+        rocwmma::load_matrix_sync(
+            fragQ[d], q + headOffset + waveRow * HEAD_DIM + d * BLOCK_K, HEAD_DIM);
+    }
+
+    FragAcc fragMax, fragSum, fragOut[dimTiles];
+    rocwmma::fill_fragment(fragMax, MASK_VALUE);
+    rocwmma::fill_fragment(fragSum, 0.0f);
+    for(int c = 0; c < dimTiles; c++)
+    {
+        rocwmma::fill_fragment(fragOut[c], 0.0f);
+    }
+
+    // With causal masking, keys past the last query row of the workgroup are skipped
+    auto kvEnd = causal ? workgroupRow + waveCount * TILE_DIM : seqLen;
+    for(uint kvRow = 0; kvRow < kvEnd; kvRow += TILE_DIM)
+    {
+        // Cooperatively copy the next K and V tiles to LDS
+        rocwmma::synchronize_workgroup();
+        for(uint i = threadIdx.x; i < tileElems; i += blockDim.x)
+        {
+            ldsK[i] = k[headOffset + kvRow * HEAD_DIM + i];
+            ldsV[i] = v[headOffset + kvRow * HEAD_DIM + i];
+        }
+        rocwmma::synchronize_workgroup();
+
+        // S = Q x transpose(K), scaled into log2 units
+        auto fragS = FragAcc();
+        rocwmma::fill_fragment(fragS, 0.0f);
+        for(int d = 0; d < dimBlocks; d++)
+        {
+            auto fragK = FragK();
+            rocwmma::load_matrix_sync(fragK, ldsK + d * BLOCK_K, HEAD_DIM);
+            rocwmma::mma_sync(fragS, fragQ[d], fragK, fragS);
+        }
+
+        rocwmma::apply_epilogue(fragS, rocwmma::epilogue::scale<float>(scaleLog2), 0u, 0u);
+        if(causal)
+        {
+            rocwmma::apply_epilogue(fragS, CausalMask(), waveRow, kvRow);
+        }
+
+        // Online softmax: rescale the running stats and output to the new row max
+        auto fragTileMax = fragS;
+        rocwmma::reduce_rows(fragTileMax, rocwmma::reduction::max());
+
+        auto fragRescale = FragAcc();
+        for(int i = 0; i < fragS.num_elements; i++)
+        {
+            auto rowMax = fmaxf(fragMax.x[i], fragTileMax.x[i]);
+
+            fragRescale.x[i] = exp2f(fragMax.x[i] - rowMax);
+            fragS.x[i]       = exp2f(fragS.x[i] - rowMax);
+            fragMax.x[i]     = rowMax;
+        }
+
+        auto fragTileSum = fragS;
+        rocwmma::reduce_rows(fragTileSum, rocwmma::reduction::sum());
+        for(int i = 0; i < fragS.num_elements; i++)
+        {
+            fragSum.x[i] = fragSum.x[i] * fragRescale.x[i] + fragTileSum.x[i];
+            for(int c = 0; c < dimTiles; c++)
+            {
+                fragOut[c].x[i] *= fragRescale.x[i];
+            }
+        }
+
+        // Stage P through LDS to reload it as matrix_a
+        rocwmma::store_matrix_epilogue_sync(
+            ldsP, fragS, TILE_DIM, rocwmma::mem_row_major, rocwmma::epilogue::identity(), 0u, 0u);
+        rocwmma::synchronize_workgroup();
+
+        // O += P x V
+        for(int kk = 0; kk < keyBlocks; kk++)
+        {
+            auto fragP = FragP();
+            rocwmma::load_matrix_sync(fragP, ldsP + kk * BLOCK_K, TILE_DIM);
+            for(int c = 0; c < dimTiles; c++)
+            {
+                auto fragV = FragV();
+                rocwmma::load_matrix_sync(
+                    fragV, ldsV + kk * BLOCK_K * HEAD_DIM + c * TILE_DIM, HEAD_DIM);
+                rocwmma::mma_sync(fragOut[c], fragP, fragV, fragOut[c]);
+            }
+        }
+    }
+
+    // Normalize and write the output once
+    for(int c = 0; c < dimTiles; c++)
+    {
+        for(int i = 0; i < fragOut[c].num_elements; i++)
+        {
+            fragOut[c].x[i] /= fragSum.x[i];
+        }
+
+        rocwmma::store_matrix_epilogue_sync(o + headOffset + waveRow * HEAD_DIM + c * TILE_DIM,
+                                            fragOut[c],
+                                            HEAD_DIM,
+                                            rocwmma::mem_row_major,
+                                            rocwmma::epilogue::saturate<float16_t>(),
+                                            0u,
+                                            0u);
+    }
+}
+
+__host__ void attention_test(uint32_t seqLen, uint32_t batchHeads, bool causal)
+{
+    // Problem size check
+    auto waveCount = T_BLOCK_X / WAVE_SIZE;
+    if(seqLen % (TILE_DIM * waveCount) != 0)
+    {
+        std::cout << "Unsupported sequence length. Skipping." << std::endl;
+        return;
+    }
+
+    // Allocate and initialize host matrices
+    auto elementCount = seqLen * HEAD_DIM * batchHeads;
+
+    std::vector<float16_t> h_q(elementCount), h_k(elementCount), h_v(elementCount),
+        h_o(elementCount);
+
+    fill<float16_t>(h_q.data(), seqLen, HEAD_DIM, batchHeads);
+    fill<float16_t>(h_k.data(), seqLen, HEAD_DIM, batchHeads);
+    fill<float16_t>(h_v.data(), seqLen, HEAD_DIM, batchHeads);
+
+    // Allocate and copy device memory
+    float16_t *d_q, *d_k, *d_v, *d_o;
+
+    const size_t bytes = elementCount * sizeof(float16_t);
+
+    CHECK_HIP_ERROR(hipMalloc(&d_q, bytes));
+    CHECK_HIP_ERROR(hipMalloc(&d_k, bytes));
+    CHECK_HIP_ERROR(hipMalloc(&d_v, bytes));
+    CHECK_HIP_ERROR(hipMalloc(&d_o, bytes));
+
+    CHECK_HIP_ERROR(hipMemcpy(d_q, h_q.data(), bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_k, h_k.data(), bytes, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_v, h_v.data(), bytes, hipMemcpyHostToDevice));
+
+    auto gridDim  = dim3(seqLen / (TILE_DIM * waveCount), batchHeads);
+    auto blockDim = dim3(T_BLOCK_X);
+
+    // Shared K and V tiles, plus one P tile per wave
+    uint32_t ldsBytes
+        = (2 * TILE_DIM * HEAD_DIM + waveCount * TILE_DIM * TILE_DIM) * sizeof(float16_t);
+
+    // Fold log2(e) into the softmax scale so the kernel can use exp2
+    float scaleLog2 = 1.4426950408889634f / std::sqrt(static_cast<float>(HEAD_DIM));
+
+    std::cout << "Launching " << (causal ? "causal" : "non-causal") << " flash attention kernel..."
+              << std::endl;
+
+    hipEvent_t startEvent, stopEvent;
+    CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+    CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+    hipExtLaunchKernelGGL((flashAttentionFwd),
+                          gridDim,
+                          blockDim,
+                          ldsBytes,
+                          0, // stream
+                          startEvent, // Event start
+                          stopEvent, // event stop
+                          0, // flags
+                          d_q,
+                          d_k,
+                          d_v,
+                          d_o,
+                          seqLen,
+                          scaleLog2,
+                          causal);
+
+    auto timeMs = 0.0f;
+    CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+    CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+    CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+    CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+    // Q x transpose(K) and P x V per head. Causal masking halves the useful work.
+    auto gFlops
+        = 2.0 * calculateGFlops(seqLen, seqLen, HEAD_DIM) * batchHeads * (causal ? 0.5 : 1.0);
+    auto tFlopsPerSec = gFlops / static_cast<double>(timeMs);
+
+    // Echo performance
+    std::cout << "TileSize, "
+              << "HeadDim, SeqLen, BatchHeads, Causal, "
+              << "elapsedMs, Problem Size(GFlops), TFlops/s" << std::endl;
+
+    std::cout << TILE_DIM << ", " << HEAD_DIM << ", " << seqLen << ", " << batchHeads << ", "
+              << causal << ", " << timeMs << ", " << gFlops << ", " << tFlopsPerSec << std::endl;
+
+#if !NDEBUG
+
+    std::cout << "Validating result with reference..." << std::endl;
+
+    CHECK_HIP_ERROR(hipMemcpy(h_o.data(), d_o, bytes, hipMemcpyDeviceToHost));
+
+    std::vector<float16_t> h_oRef(elementCount);
+    attentionFwdCPU(
+        h_q.data(), h_k.data(), h_v.data(), h_oRef.data(), seqLen, HEAD_DIM, batchHeads, causal);
+
+    auto res = compareEqual<float16_t>(h_o.data(), h_oRef.data(), elementCount);
+
+    if(std::get<0>(res) == false)
+    {
+        std::cout << "FAILED!\n";
+    }
+    else
+    {
+        std::cout << "PASSED!\n";
+    }
+
+    std::cout << "Max relative error: " << std::get<1>(res) << std::endl;
+
+#endif // !NDEBUG
+
+    // Release device memory
+    CHECK_HIP_ERROR(hipFree(d_q));
+    CHECK_HIP_ERROR(hipFree(d_k));
+    CHECK_HIP_ERROR(hipFree(d_v));
+    CHECK_HIP_ERROR(hipFree(d_o));
+
+    std::cout << "Finished!" << std::endl;
+}
+
+int main()
+{
+    attention_test(1024, 16, false);
+    attention_test(1024, 16, true);
+    return 0;
+}
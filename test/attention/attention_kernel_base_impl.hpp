@@ -0,0 +1,370 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ATTENTION_KERNEL_BASE_IMPL_HPP
+#define ATTENTION_KERNEL_BASE_IMPL_HPP
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <tuple>
+
+#include <hip/hip_ext.h>
+#include <hip/hip_runtime.h>
+#include <hip/hip_runtime_api.h>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/internal/constants.hpp>
+#include <rocwmma/internal/utils.hpp>
+
+#include "../common.hpp"
+#include "attention_kernel_base.hpp"
+#include "performance.hpp"
+
+// Library includes
+
+#ifdef ROCWMMA_VALIDATION_TESTS
+#include "reference.hpp" // Vanilla CPU kernel
+#endif // ROCWMMA_VALIDATION_TESTS
+
+namespace rocwmma
+{
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    AttentionKernelBase<TileSize, HeadDim, DataT>::AttentionKernelBase()
+    {
+        reset();
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    AttentionKernelBase<TileSize, HeadDim, DataT>::~AttentionKernelBase()
+    {
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    uint32_t AttentionKernelBase<TileSize, HeadDim, DataT>::ldsUsage() const
+    {
+        return 0;
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    dim3 AttentionKernelBase<TileSize, HeadDim, DataT>::gridDim() const
+    {
+        auto& device = DeviceInfo::instance();
+
+        // Each wave owns TileSize query rows of one head
+        return dim3(ceilDiv(mSeqLen, TileSize * mTBlockX / device->warpSize()), mBatchHeads);
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    dim3 AttentionKernelBase<TileSize, HeadDim, DataT>::blockDim() const
+    {
+        return dim3(mTBlockX);
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    bool AttentionKernelBase<TileSize, HeadDim, DataT>::checkDevice() const
+    {
+        auto& deviceInfo = DeviceInfo::instance();
+        auto  deviceArch = deviceInfo->getGcnArch();
+
+        // Arch
+        auto isGfx11 = (deviceArch == DeviceInfo::GFX1100) || (deviceArch == DeviceInfo::GFX1101)
+                       || (deviceArch == DeviceInfo::GFX1102);
+
+        // Block size
+        auto is16x16 = (TileSize == 16);
+
+        // No unsupported devices
+        bool unsupportedDeviceCheck = !(deviceArch == DeviceInfo::UNSUPPORTED_ARCH);
+
+        // gfx11 only supports block size 16
+        bool gfx11Check = !(isGfx11 && !is16x16);
+
+        return unsupportedDeviceCheck && gfx11Check;
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    bool AttentionKernelBase<TileSize, HeadDim, DataT>::checkSizes() const
+    {
+        auto warpSize = DeviceInfo::instance()->warpSize();
+
+        // Whole workgroup query tiles only
+        return (mTBlockX % warpSize == 0) && (mTBlockY == 1)
+               && (mSeqLen % (TileSize * mTBlockX / warpSize) == 0);
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    bool AttentionKernelBase<TileSize, HeadDim, DataT>::checkLds() const
+    {
+        return ldsUsage() <= DeviceInfo::instance()->sharedMemSize();
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::reset()
+    {
+        mTBlockX = mTBlockY = 0;
+        mSeqLen = mBatchHeads = 0;
+        mRepeats =
+#ifdef ROCWMMA_VALIDATION_TESTS
+            1;
+#else
+            5;
+#endif
+
+        mRunFlag = true;
+
+        mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
+        mElapsedTimeMs                       = 0.0;
+        mEfficiency                          = -1;
+
+        mMask = AttentionMask_t::None;
+
+        mValidationResult = false;
+        mMaxRelativeError = 0.0;
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    HipResource* AttentionKernelBase<TileSize, HeadDim, DataT>::getResource()
+    {
+        return DataStorage::instance().get();
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    std::ostream& AttentionKernelBase<TileSize, HeadDim, DataT>::printHeader(
+        std::ostream& stream) const
+    {
+        return stream << "TileSize, "
+                      << "HeadDim, "
+                      << "DataT, "
+                      << "Mask, "
+                      << "SeqLen, BatchHeads, "
+#if defined(ROCWMMA_VALIDATION_TESTS)
+                      << "maxRelativeDiff, "
+#endif
+                      << "elapsedMs, "
+                      << "Problem Size(GFlops), "
+                      << "TFlops/s, "
+                      << "Efficiency(%)" << std::endl;
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    std::ostream& AttentionKernelBase<TileSize, HeadDim, DataT>::printKernel(
+        std::ostream& stream) const
+    {
+        stream << TileSize << ", " << HeadDim << ", " << dataTypeToString<DataT>() << ", "
+               << (mMask == AttentionMask_t::Causal ? "Causal" : "None") << ", " << mSeqLen
+               << ", " << mBatchHeads << ", ";
+
+        if(!mRunFlag)
+        {
+            return stream
+#if defined(ROCWMMA_VALIDATION_TESTS)
+                   << "n/a, "
+#endif
+                   << "n/a, n/a, n/a, n/a, SKIPPED" << std::endl;
+        }
+        else
+        {
+            return stream
+#if defined(ROCWMMA_VALIDATION_TESTS)
+                   << mMaxRelativeError << ", "
+#endif
+                   << mElapsedTimeMs << ", " << mTotalGFlops << ", " << mMeasuredTFlopsPerSec
+                   << ", " << mEfficiency << ", "
+#if defined(ROCWMMA_VALIDATION_TESTS)
+                   << (mValidationResult ? "PASSED" : "FAILED")
+#else
+                   << "BENCH"
+#endif // ROCWMMA_VALIDATION_TESTS
+                   << std::endl;
+        }
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::setup(ProblemParams const& problem)
+    {
+        // Reset the flags in case of multiple runs
+        mRunFlag = true;
+
+        // Format incoming problem parameters
+        std::tie(mTBlockX, mTBlockY)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.threadBlockSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.threadBlockSize)));
+        std::tie(mSeqLen, mBatchHeads)
+            = std::tie(static_cast<uint32_t const&>(std::get<0>(problem.problemSize)),
+                       static_cast<uint32_t const&>(std::get<1>(problem.problemSize)));
+
+        mMask = problem.mask;
+
+        mRunFlag &= checkDevice();
+        mRunFlag &= checkSizes();
+        mRunFlag &= checkLds();
+
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+
+            // Initialize matrix storage
+            dataInstance->resizeStorage(typename DataStorage::ProblemSize(
+                static_cast<int64_t>(mSeqLen), HeadDim, static_cast<int64_t>(mBatchHeads)));
+
+            // Initialize Q, K and V on device as (batchHeads * seqLen) x HeadDim
+            // and transfer to host for validation
+            auto rows = mBatchHeads * mSeqLen;
+            MatrixUtil<row_major>::fillRandLaunchKernel(
+                dataInstance->deviceQ().get(), rows, HeadDim, PhiloxDefaultSeed, 0u);
+            MatrixUtil<row_major>::fillRandLaunchKernel(
+                dataInstance->deviceK().get(), rows, HeadDim, PhiloxDefaultSeed, 1u);
+            MatrixUtil<row_major>::fillRandLaunchKernel(
+                dataInstance->deviceV().get(), rows, HeadDim, PhiloxDefaultSeed, 2u);
+#if defined(ROCWMMA_VALIDATION_TESTS)
+            dataInstance->copyDeviceToHostInput();
+#endif // ROCWMMA_VALIDATION_TESTS
+        }
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::exec()
+    {
+        if(mRunFlag)
+        {
+            // Fold log2(e) into the softmax scale so the kernel can use exp2
+            auto scaleLog2 = static_cast<float32_t>(1.4426950408889634 / std::sqrt(HeadDim));
+            auto causal    = (mMask == AttentionMask_t::Causal);
+
+            auto attentionKernel = [this, scaleLog2, causal]() {
+                auto& dataInstance = DataStorage::instance();
+                hipExtLaunchKernelGGL((this->kernelFwdImpl()),
+                                      (this->gridDim()),
+                                      (this->blockDim()),
+                                      (this->ldsUsage()),
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      0,
+                                      dataInstance->deviceQ().get(),
+                                      dataInstance->deviceK().get(),
+                                      dataInstance->deviceV().get(),
+                                      dataInstance->deviceOutput().get(),
+                                      mSeqLen,
+                                      scaleLog2,
+                                      causal);
+            };
+
+            hipEvent_t startEvent, stopEvent;
+            CHECK_HIP_ERROR(hipEventCreate(&startEvent));
+            CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+
+            CHECK_HIP_ERROR(hipEventRecord(startEvent));
+            for(uint32_t i = 0; i < mRepeats; ++i)
+            {
+                attentionKernel();
+            }
+            CHECK_HIP_ERROR(hipEventRecord(stopEvent));
+            CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
+
+            auto timeMs = 0.0f;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
+
+            // Calculate efficiency
+            auto& deviceInfo = DeviceInfo::instance();
+
+            auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<DataT>();
+
+            // Q K^T and P V per head. Causal masking halves the useful work.
+            mElapsedTimeMs = float64_t(timeMs);
+            mTotalGFlops   = 2.0 * calculateGFlops(mSeqLen, mSeqLen, HeadDim) * mBatchHeads
+                           * (causal ? 0.5 : 1.0);
+            mMeasuredTFlopsPerSec
+                = mTotalGFlops / mElapsedTimeMs * static_cast<float64_t>(mRepeats);
+
+            mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
+
+            CHECK_HIP_ERROR(hipEventDestroy(startEvent));
+            CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+
+#if defined(ROCWMMA_VALIDATION_TESTS)
+
+            // Run reference CPU kernel
+            auto& dataInstance = DataStorage::instance();
+            attention_fwd_CPU<DataT>(dataInstance->hostQ().get(),
+                                     dataInstance->hostK().get(),
+                                     dataInstance->hostV().get(),
+                                     dataInstance->hostOutputRef().get(),
+                                     mSeqLen,
+                                     HeadDim,
+                                     mBatchHeads,
+                                     causal);
+#endif
+        }
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::validateResults()
+    {
+#ifdef ROCWMMA_VALIDATION_TESTS
+        if(mRunFlag)
+        {
+            auto& dataInstance = DataStorage::instance();
+
+            auto elementCount = mSeqLen * HeadDim * mBatchHeads;
+            auto reference    = dataInstance->template allocDevice<DataT>(elementCount);
+            dataInstance->copyData(reference, dataInstance->hostOutputRef(), elementCount);
+
+            std::tie(mValidationResult, mMaxRelativeError)
+                = compareEqualLaunchKernel<DataT, DataT>(dataInstance->deviceOutput().get(),
+                                                         reference.get(),
+                                                         mSeqLen,
+                                                         HeadDim,
+                                                         mBatchHeads,
+                                                         10.0);
+
+            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+        }
+#endif
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::reportResults()
+    {
+        if(!KernelI::sHeaderPrinted)
+        {
+            printHeader();
+            KernelI::sHeaderPrinted = true;
+        }
+        printKernel();
+    }
+
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    void AttentionKernelBase<TileSize, HeadDim, DataT>::tearDown()
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ATTENTION_KERNEL_BASE_IMPL_HPP
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ATTENTION_RESOURCE_HPP
+#define ATTENTION_RESOURCE_HPP
+
+#include <memory>
+#include <tuple>
+
+#include "hip_resource.hpp"
+#include "singleton.hpp"
+
+namespace rocwmma
+{
+
+    // AttentionResource class is intended to manage a shared pool of resources for
+    // testing attention kernels on the GPU.
+    //
+    // It minimizes the memory handling overhead for launching thousands of GPU
+    // kernels by allowing re-use of existing memory allocations. Memory is only
+    // re-allocated as necessary to satisfy minimum size requirements.
+    //
+    // The interface indicates memory ownership by this class and shall only be
+    // used to access for read/write purposes.
+    //
+    // Currently uses HIP as the backend for device allocation.
+    template <typename DataT>
+    struct AttentionResource : public HipResource,
+                               public LazySingleton<AttentionResource<DataT>>
+    {
+        // For static initialization
+        friend std::unique_ptr<AttentionResource<DataT>>
+            std::make_unique<AttentionResource<DataT>>();
+
+        using Base = HipResource;
+
+        template <typename T>
+        using DevicePtrT = Base::template DevicePtrT<T>;
+
+        template <typename T>
+        using HostPtrT = Base::template HostPtrT<T>;
+
+        // SeqLen, HeadDim, BatchHeads
+        using ProblemSize = std::tuple<int64_t, int64_t, int64_t>;
+
+        // Q, K, V and O share the same size
+        using ElementCount = int64_t;
+
+        enum : uint32_t
+        {
+            // Problem size indices
+            SeqLen     = 0,
+            HeadDim    = 1,
+            BatchHeads = 2
+        };
+
+    protected: // No public instantiation except make_unique.
+               // No copy
+        AttentionResource();
+        AttentionResource(AttentionResource const&)            = delete;
+        AttentionResource& operator=(AttentionResource const&) = delete;
+
+    public:
+        AttentionResource(AttentionResource&&);
+        ~AttentionResource() = default;
+
+        void copyHostToDeviceAll();
+        void copyDeviceToHostInput();
+        void copyDeviceToHostOutput();
+        void resizeStorage(ProblemSize const& size);
+        void resizeStorage(ElementCount const& size);
+
+        HostPtrT<DataT>& hostQ();
+        HostPtrT<DataT>& hostK();
+        HostPtrT<DataT>& hostV();
+        HostPtrT<DataT>& hostOutput();
+        HostPtrT<DataT>& hostOutputRef();
+
+        DevicePtrT<DataT>& deviceQ();
+        DevicePtrT<DataT>& deviceK();
+        DevicePtrT<DataT>& deviceV();
+        DevicePtrT<DataT>& deviceOutput();
+
+        // Data sizes
+        ElementCount currentElementCount() const;
+        ElementCount maxCapacity() const;
+
+        // Reset sizes
+        void reset() final;
+
+    protected:
+        DevicePtrT<DataT> mDeviceQ, mDeviceK, mDeviceV, mDeviceOutput;
+        HostPtrT<DataT>   mHostQ, mHostK, mHostV, mHostOutput, mHostOutputRef;
+
+        ElementCount mCurrentElementCount;
+        ElementCount mMaxCapacity;
+    };
+
+} // namespace rocwmma
+
+#include "attention_resource_impl.hpp"
+
+#endif // ATTENTION_RESOURCE_HPP
@@ -0,0 +1,193 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ATTENTION_RESOURCE_IMPL_HPP
+#define ATTENTION_RESOURCE_IMPL_HPP
+
+#include "attention_resource.hpp"
+
+namespace rocwmma
+{
+
+    template <typename DataT>
+    AttentionResource<DataT>::AttentionResource()
+        : mDeviceQ(Base::template allocDevice<DataT>(0))
+        , mDeviceK(Base::template allocDevice<DataT>(0))
+        , mDeviceV(Base::template allocDevice<DataT>(0))
+        , mDeviceOutput(Base::template allocDevice<DataT>(0))
+        , mHostQ(Base::template allocHost<DataT>(0))
+        , mHostK(Base::template allocHost<DataT>(0))
+        , mHostV(Base::template allocHost<DataT>(0))
+        , mHostOutput(Base::template allocHost<DataT>(0))
+        , mHostOutputRef(Base::template allocHost<DataT>(0))
+        , mCurrentElementCount(0)
+        , mMaxCapacity(0)
+    {
+    }
+
+    template <typename DataT>
+    AttentionResource<DataT>::AttentionResource(AttentionResource<DataT>&& rhs)
+        : HipResource()
+        , mDeviceQ(std::move(rhs.mDeviceQ))
+        , mDeviceK(std::move(rhs.mDeviceK))
+        , mDeviceV(std::move(rhs.mDeviceV))
+        , mDeviceOutput(std::move(rhs.mDeviceOutput))
+        , mHostQ(std::move(rhs.mHostQ))
+        , mHostK(std::move(rhs.mHostK))
+        , mHostV(std::move(rhs.mHostV))
+        , mHostOutput(std::move(rhs.mHostOutput))
+        , mHostOutputRef(std::move(rhs.mHostOutputRef))
+        , mCurrentElementCount(rhs.mCurrentElementCount)
+        , mMaxCapacity(rhs.mMaxCapacity)
+    {
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::copyHostToDeviceAll()
+    {
+        Base::copyData(mDeviceQ, mHostQ, mCurrentElementCount);
+        Base::copyData(mDeviceK, mHostK, mCurrentElementCount);
+        Base::copyData(mDeviceV, mHostV, mCurrentElementCount);
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::copyDeviceToHostInput()
+    {
+        Base::copyData(mHostQ, mDeviceQ, mCurrentElementCount);
+        Base::copyData(mHostK, mDeviceK, mCurrentElementCount);
+        Base::copyData(mHostV, mDeviceV, mCurrentElementCount);
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::copyDeviceToHostOutput()
+    {
+        Base::copyData(mHostOutput, mDeviceOutput, mCurrentElementCount);
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::resizeStorage(ProblemSize const& size)
+    {
+        resizeStorage(std::get<SeqLen>(size) * std::get<HeadDim>(size)
+                      * std::get<BatchHeads>(size));
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::resizeStorage(ElementCount const& newElementCount)
+    {
+        if(mMaxCapacity < newElementCount)
+        {
+            Base::reallocDeviceHostPair(mDeviceQ, mHostQ, newElementCount);
+            Base::reallocDeviceHostPair(mDeviceK, mHostK, newElementCount);
+            Base::reallocDeviceHostPair(mDeviceV, mHostV, newElementCount);
+            Base::reallocDeviceHostPair(mDeviceOutput, mHostOutput, newElementCount);
+            mMaxCapacity = newElementCount;
+        }
+
+        Base::reallocHost(mHostOutputRef, newElementCount);
+
+        mCurrentElementCount = newElementCount;
+    }
+
+    template <typename DataT>
+    void AttentionResource<DataT>::reset()
+    {
+        Base::reallocDeviceHostPair(mDeviceQ, mHostQ, 0);
+        Base::reallocDeviceHostPair(mDeviceK, mHostK, 0);
+        Base::reallocDeviceHostPair(mDeviceV, mHostV, 0);
+        Base::reallocDeviceHostPair(mDeviceOutput, mHostOutput, 0);
+        mCurrentElementCount = 0;
+        mMaxCapacity         = 0;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::hostQ() -> HostPtrT<DataT>&
+    {
+        return mHostQ;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::hostK() -> HostPtrT<DataT>&
+    {
+        return mHostK;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::hostV() -> HostPtrT<DataT>&
+    {
+        return mHostV;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::hostOutput() -> HostPtrT<DataT>&
+    {
+        return mHostOutput;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::hostOutputRef() -> HostPtrT<DataT>&
+    {
+        return mHostOutputRef;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::deviceQ() -> DevicePtrT<DataT>&
+    {
+        return mDeviceQ;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::deviceK() -> DevicePtrT<DataT>&
+    {
+        return mDeviceK;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::deviceV() -> DevicePtrT<DataT>&
+    {
+        return mDeviceV;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::deviceOutput() -> DevicePtrT<DataT>&
+    {
+        return mDeviceOutput;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::currentElementCount() const -> ElementCount
+    {
+        return mCurrentElementCount;
+    }
+
+    template <typename DataT>
+    auto AttentionResource<DataT>::maxCapacity() const -> ElementCount
+    {
+        return mMaxCapacity;
+    }
+
+} // namespace rocwmma
+
+#endif // ATTENTION_RESOURCE_IMPL_HPP
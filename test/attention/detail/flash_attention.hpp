@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef FLASH_ATTENTION_DETAIL_HPP
+#define FLASH_ATTENTION_DETAIL_HPP
+
+#include "attention_kernel_base.hpp"
+#include "device/flash_attention_fwd.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t TileSize, uint32_t HeadDim, typename DataT>
+    struct FlashAttentionKernel final : public AttentionKernelBase<TileSize, HeadDim, DataT>
+    {
+    private:
+        using Base = AttentionKernelBase<TileSize, HeadDim, DataT>;
+
+    public:
+        FlashAttentionKernel() {}
+        ~FlashAttentionKernel() final {}
+
+        // Shared K and V tiles, plus one P tile per wave
+        uint32_t ldsUsage() const final
+        {
+            auto waveCount = this->blockDim().x / Base::DeviceInfo::instance()->warpSize();
+            return sizeof(DataT) * (2u * TileSize * HeadDim + waveCount * TileSize * TileSize);
+        }
+
+        typename Base::KernelFwdFunc kernelFwdImpl() const final
+        {
+            return typename Base::KernelFwdFunc(flashAttentionFwd<DataT, TileSize, HeadDim>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct FlashAttentionGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            DataT    = 0,
+            TileSize = 1,
+            HeadDim  = 2
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT = FlashAttentionKernel<std::tuple_element_t<TileSize, TestParamsT>::value,
+                                                 std::tuple_element_t<HeadDim, TestParamsT>::value,
+                                                 std::tuple_element_t<DataT, TestParamsT>>;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // FLASH_ATTENTION_DETAIL_HPP
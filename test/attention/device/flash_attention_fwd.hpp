@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef FLASH_ATTENTION_FWD_HPP
+#define FLASH_ATTENTION_FWD_HPP
+
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
+#include <rocwmma/rocwmma_reduce.hpp>
+
+namespace rocwmma
+{
+
+    // Replaces scores of keys past the query row with a large negative
+    // value. The value is finite so that fully masked rows stay NaN-free.
+    struct CausalMask
+    {
+        static constexpr float32_t MaskValue = -1.0e30f;
+
+        template <typename DataT>
+        __device__ inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+        {
+            return col > row ? static_cast<DataT>(MaskValue) : value;
+        }
+    };
+
+    // Cooperative copy of a contiguous tile, in 16 byte chunks
+    template <typename DataT, uint32_t ElementCount>
+    __device__ inline void copyTile(DataT* __restrict dst, DataT const* __restrict src)
+    {
+        using CopyT = VecT<uint32_t, 4u>;
+
+        constexpr uint32_t CopyCount = ElementCount * sizeof(DataT) / sizeof(CopyT);
+        static_assert(ElementCount * sizeof(DataT) % sizeof(CopyT) == 0u,
+                      "Tile must be a multiple of the copy width");
+
+        auto*       dstCopy = reinterpret_cast<CopyT*>(dst);
+        auto const* srcCopy = reinterpret_cast<CopyT const*>(src);
+        for(uint32_t i = threadIdx.x; i < CopyCount; i += blockDim.x)
+        {
+            dstCopy[i] = srcCopy[i];
+        }
+    }
+
+    // Flash attention forward pass: O = softmax(Q K^T / sqrt(d)) V.
+    //
+    // Q, K, V and O hold batchHeads contiguous [seqLen x HeadDim] row_major heads.
+    // Each wave owns TileSize query rows of one head (blockIdx.y), and keeps its Q
+    // fragments in registers for the whole pass. The workgroup streams K / V
+    // through LDS one TileSize x HeadDim tile at a time. Scores never leave the
+    // chip: the running row max and row sum are tracked in accumulator fragments
+    // and the output accumulators are rescaled by exp2(mOld - mNew) as the max
+    // grows (online softmax). P is staged through per-wave LDS to reload it in
+    // matrix_a layout for the P V product. O is normalized and written once.
+    //
+    // scaleLog2 folds log2(e) into 1 / sqrt(d), so that exp2 can be used.
+    // With causal masking, key tiles past the last query row of the
+    // workgroup are skipped entirely.
+    template <typename DataT, uint32_t TileSize, uint32_t HeadDim>
+    __global__ void __launch_bounds__(256) flashAttentionFwd(DataT const* __restrict q,
+                                                             DataT const* __restrict k,
+                                                             DataT const* __restrict v,
+                                                             DataT* __restrict o,
+                                                             uint32_t  seqLen,
+                                                             float32_t scaleLog2,
+                                                             bool      causal)
+    {
+        constexpr uint32_t BlockK    = 16u;
+        constexpr uint32_t DimBlocks = HeadDim / BlockK;
+        constexpr uint32_t DimTiles  = HeadDim / TileSize;
+        constexpr uint32_t KeyBlocks = TileSize / BlockK;
+        constexpr uint32_t TileElems = TileSize * HeadDim;
+
+        static_assert(HeadDim % TileSize == 0u, "HeadDim must be a multiple of TileSize");
+        static_assert(TileSize % BlockK == 0u, "TileSize must be a multiple of BlockK");
+
+        using FragQ   = fragment<matrix_a, TileSize, TileSize, BlockK, DataT, row_major>;
+        using FragK   = fragment<matrix_b, TileSize, TileSize, BlockK, DataT, col_major>;
+        using FragP   = fragment<matrix_a, TileSize, TileSize, BlockK, DataT, row_major>;
+        using FragV   = fragment<matrix_b, TileSize, TileSize, BlockK, DataT, row_major>;
+        using FragAcc = fragment<accumulator, TileSize, TileSize, BlockK, float32_t>;
+
+        auto waveCount = blockDim.x / Constants::AMDGCN_WAVE_SIZE;
+        auto waveIndex = threadIdx.x / Constants::AMDGCN_WAVE_SIZE;
+
+        // Query rows of the workgroup and of this wave
+        auto workgroupRow = blockIdx.x * waveCount * TileSize;
+        auto waveRow      = workgroupRow + waveIndex * TileSize;
+        auto headOffset   = static_cast<uint64_t>(blockIdx.y) * seqLen * HeadDim;
+
+        // LDS: shared K and V tiles, followed by one P tile per wave
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* ldsK = reinterpret_cast<DataT*>(localMemPtr);
+        auto* ldsV = ldsK + TileElems;
+        auto* ldsP = ldsV + TileElems + waveIndex * TileSize * TileSize;
+
+        // Q is loaded once and stays in registers
+        FragQ fragQ[DimBlocks];
+#pragma unroll
+        for(uint32_t d = 0; d < DimBlocks; d++)
+        {
+            load_matrix_sync(fragQ[d], q + headOffset + waveRow * HeadDim + d * BlockK, HeadDim);
+        }
+
+        // Running row max and row sum, broadcast along each row
+        FragAcc fragMax, fragSum, fragOut[DimTiles];
+        fill_fragment(fragMax, CausalMask::MaskValue);
+        fill_fragment(fragSum, 0.0f);
+#pragma unroll
+        for(uint32_t c = 0; c < DimTiles; c++)
+        {
+            fill_fragment(fragOut[c], 0.0f);
+        }
+
+        auto kvEnd = causal ? workgroupRow + waveCount * TileSize : seqLen;
+        for(uint32_t kvRow = 0; kvRow < kvEnd; kvRow += TileSize)
+        {
+            // Wait for all waves to finish with the previous K / V tiles
+            synchronize_workgroup();
+            copyTile<DataT, TileElems>(ldsK, k + headOffset + kvRow * HeadDim);
+            copyTile<DataT, TileElems>(ldsV, v + headOffset + kvRow * HeadDim);
+            synchronize_workgroup();
+
+            // S = Q K^T
+            FragAcc fragS;
+            fill_fragment(fragS, 0.0f);
+#pragma unroll
+            for(uint32_t d = 0; d < DimBlocks; d++)
+            {
+                FragK fragK;
+                load_matrix_sync(fragK, ldsK + d * BlockK, HeadDim);
+                mma_sync(fragS, fragQ[d], fragK, fragS);
+            }
+
+            // Scale into log2 units. Only tiles crossing the diagonal need masking.
+            if(causal && kvRow + TileSize > waveRow + 1u)
+            {
+                apply_epilogue(fragS,
+                               epilogue::make_chain(epilogue::scale<float32_t>(scaleLog2),
+                                                    CausalMask()),
+                               waveRow,
+                               kvRow);
+            }
+            else
+            {
+                apply_epilogue(fragS, epilogue::scale<float32_t>(scaleLog2), waveRow, kvRow);
+            }
+
+            // Online softmax: move the running stats and output to the new row max
+            auto fragTileMax = fragS;
+            reduce_rows(fragTileMax, reduction::max());
+
+            FragAcc fragRescale;
+#pragma unroll
+            for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+            {
+                auto rowMax = fragMax.x[i] > fragTileMax.x[i] ? fragMax.x[i] : fragTileMax.x[i];
+                fragRescale.x[i] = exp2f(fragMax.x[i] - rowMax);
+                fragS.x[i]       = exp2f(fragS.x[i] - rowMax);
+                fragMax.x[i]     = rowMax;
+            }
+
+            auto fragTileSum = fragS;
+            reduce_rows(fragTileSum, reduction::sum());
+
+#pragma unroll
+            for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+            {
+                fragSum.x[i] = fragSum.x[i] * fragRescale.x[i] + fragTileSum.x[i];
+            }
+
+#pragma unroll
+            for(uint32_t c = 0; c < DimTiles; c++)
+            {
+#pragma unroll
+                for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+                {
+                    fragOut[c].x[i] *= fragRescale.x[i];
+                }
+            }
+
+            // Stage P through LDS to reload it as matrix_a
+            store_matrix_epilogue_sync(
+                ldsP, fragS, TileSize, mem_row_major, epilogue::identity(), 0u, 0u);
+            synchronize_workgroup();
+
+            // O += P V
+#pragma unroll
+            for(uint32_t kk = 0; kk < KeyBlocks; kk++)
+            {
+                FragP fragP;
+                load_matrix_sync(fragP, ldsP + kk * BlockK, TileSize);
+
+#pragma unroll
+                for(uint32_t c = 0; c < DimTiles; c++)
+                {
+                    FragV fragV;
+                    load_matrix_sync(fragV, ldsV + kk * BlockK * HeadDim + c * TileSize, HeadDim);
+                    mma_sync(fragOut[c], fragP, fragV, fragOut[c]);
+                }
+            }
+        }
+
+        // Normalize and write the output once
+#pragma unroll
+        for(uint32_t c = 0; c < DimTiles; c++)
+        {
+#pragma unroll
+            for(uint32_t i = 0; i < FragAcc::num_elements; i++)
+            {
+                fragOut[c].x[i] /= fragSum.x[i];
+            }
+
+            store_matrix_epilogue_sync(o + headOffset + waveRow * HeadDim + c * TileSize,
+                                       fragOut[c],
+                                       HeadDim,
+                                       mem_row_major,
+                                       epilogue::saturate<DataT>(),
+                                       waveRow,
+                                       c * TileSize);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // FLASH_ATTENTION_FWD_HPP
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ATTENTION_TEST_PARAMS_HPP
+#define ATTENTION_TEST_PARAMS_HPP
+
+#include <tuple>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+#include "../common.hpp"
+#include "attention_kernel_base.hpp"
+#include "kernel_generator.hpp"
+
+namespace rocwmma
+{
+    struct AttentionTestParams
+    {
+        // Types of parameters
+        using KernelT      = std::shared_ptr<KernelI>;
+        using ThreadBlockT = std::pair<int64_t, int64_t>;
+        using ProblemSizeT = std::pair<int64_t, int64_t>;
+        using MaskT        = AttentionMask_t;
+
+        using DataTypes = std::tuple<std::tuple<float16_t>, std::tuple<bfloat16_t>>;
+        using TileSizes = std::tuple<std::tuple<I<16>>, std::tuple<I<32>>>;
+        using HeadDims  = std::tuple<std::tuple<I<64>>, std::tuple<I<128>>>;
+
+        // SeqLen, BatchHeads
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {{128, 16}, {512, 16}, {1024, 32}, {2048, 32}};
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            return {{warpSize * 4, 1}};
+        }
+
+        static inline std::vector<MaskT> masks()
+        {
+            return {AttentionMask_t::None, AttentionMask_t::Causal};
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ATTENTION_TEST_PARAMS_HPP
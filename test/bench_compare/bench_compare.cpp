@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+// rocwmma_bench_compare: store and compare gemm benchmark results.
+//
+// Host-only; needs no GPU. Exit status is 0 on success, 1 if diff found a
+// regression and 2 on usage or I/O errors.
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_compare.hpp"
+#include "bench_store.hpp"
+
+namespace
+{
+    enum ExitStatus : int
+    {
+        ExitOk         = 0,
+        ExitRegression = 1,
+        ExitError      = 2
+    };
+
+    void printUsage(char const* exe)
+    {
+        std::cerr
+            << "Usage:\n"
+            << "  " << exe << " ingest <store> <label> <output_file>... [--no-source]\n"
+            << "  " << exe << " list <store>\n"
+            << "  " << exe << " diff <baseline> <candidate> [--store <store>]\n"
+            << "        [--threshold <float>] [--alpha <float>] [--all] [--csv <file>]"
+               " [--no-source]\n\n"
+            << "Output files are gemm benchmark CSV (--output_stream) or JSON lines\n"
+            << "(--bench_json). Kernels are keyed by the output file name, types, layouts,\n"
+            << "block sizes, thread block and problem size; --no-source drops the file name.\n"
+            << "Ingesting an existing label replaces that run.\n\n"
+            << "diff operands are run labels in --store, or output files (comma separated\n"
+            << "for several). A kernel regresses when its median time grows by more than\n"
+            << "--threshold (default 0.05) with a Mann-Whitney p-value below --alpha\n"
+            << "(default 0.01).\n";
+    }
+
+    // File name without directory or extension
+    std::string sourceName(std::string const& path)
+    {
+        auto begin = path.find_last_of('/');
+        begin      = (begin == std::string::npos) ? 0u : begin + 1u;
+        auto end   = path.find_last_of('.');
+        end        = (end == std::string::npos || end < begin) ? path.size() : end;
+        return path.substr(begin, end - begin);
+    }
+
+    bool ingestFiles(std::vector<std::string> const& paths, bool useSource, rocwmma::BenchRun& run)
+    {
+        for(auto& path : paths)
+        {
+            std::ifstream file(path);
+            if(!file.is_open())
+            {
+                std::cerr << path << ": unable to open" << std::endl;
+                return false;
+            }
+
+            auto count = rocwmma::parseBenchOutput(file, run, useSource ? sourceName(path) : "");
+            if(count == 0u)
+            {
+                std::cerr << path << ": warning: no benchmark results found" << std::endl;
+            }
+        }
+        return true;
+    }
+
+    // Run label in the store, or comma separated output files
+    bool resolveRun(std::string const&           operand,
+                    rocwmma::BenchStore const&   store,
+                    bool                         useSource,
+                    rocwmma::BenchRun&           run)
+    {
+        if(auto stored = store.findRun(operand))
+        {
+            run = *stored;
+            return true;
+        }
+
+        std::vector<std::string> paths;
+        std::string              path;
+        std::stringstream        ss(operand);
+        while(std::getline(ss, path, ','))
+        {
+            paths.push_back(path);
+        }
+
+        run.label = operand;
+        return ingestFiles(paths, useSource, run);
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    if(args.empty() || args[0] == "-h" || args[0] == "--help")
+    {
+        printUsage(argv[0]);
+        return args.empty() ? ExitError : ExitOk;
+    }
+
+    // Split options from positional arguments
+    rocwmma::BenchCompareConfig config;
+    std::vector<std::string>    positional;
+    std::string                 storePath, csvPath;
+    bool                        useSource = true;
+    bool                        showAll   = false;
+
+    for(size_t i = 1; i < args.size(); i++)
+    {
+        auto hasValue = (i + 1u < args.size());
+        if(args[i] == "--no-source")
+        {
+            useSource = false;
+        }
+        else if(args[i] == "--all")
+        {
+            showAll = true;
+        }
+        else if(args[i] == "--store" && hasValue)
+        {
+            storePath = args[++i];
+        }
+        else if(args[i] == "--csv" && hasValue)
+        {
+            csvPath = args[++i];
+        }
+        else if(args[i] == "--threshold" && hasValue)
+        {
+            config.threshold = std::atof(args[++i].c_str());
+        }
+        else if(args[i] == "--alpha" && hasValue)
+        {
+            config.alpha = std::atof(args[++i].c_str());
+        }
+        else if(args[i].compare(0, 2, "--") == 0)
+        {
+            std::cerr << "Unknown or incomplete option: " << args[i] << std::endl;
+            printUsage(argv[0]);
+            return ExitError;
+        }
+        else
+        {
+            positional.push_back(args[i]);
+        }
+    }
+
+    auto const& command = args[0];
+    std::string error;
+
+    if(command == "ingest" && positional.size() >= 3u)
+    {
+        rocwmma::BenchStore store;
+        rocwmma::BenchRun   run;
+        run.label = positional[1];
+
+        if(!store.load(positional[0], error)
+           || !ingestFiles({positional.begin() + 2, positional.end()}, useSource, run))
+        {
+            std::cerr << error << std::endl;
+            return ExitError;
+        }
+
+        auto records = run.records.size();
+        store.addRun(std::move(run));
+        if(!store.save(positional[0], error))
+        {
+            std::cerr << error << std::endl;
+            return ExitError;
+        }
+
+        std::cout << "Ingested " << records << " kernels as run '" << positional[1] << "'"
+                  << std::endl;
+        return ExitOk;
+    }
+    else if(command == "list" && positional.size() == 1u)
+    {
+        rocwmma::BenchStore store;
+        if(!store.load(positional[0], error))
+        {
+            std::cerr << error << std::endl;
+            return ExitError;
+        }
+
+        for(auto& run : store.runs())
+        {
+            size_t samples = 0u;
+            for(auto& record : run.records)
+            {
+                samples += record.samples.size();
+            }
+            std::cout << run.label << ": " << run.records.size() << " kernels, " << samples
+                      << " samples" << std::endl;
+        }
+        return ExitOk;
+    }
+    else if(command == "diff" && positional.size() == 2u)
+    {
+        rocwmma::BenchStore store;
+        if(!storePath.empty() && !store.load(storePath, error))
+        {
+            std::cerr << error << std::endl;
+            return ExitError;
+        }
+
+        rocwmma::BenchRun baseline, candidate;
+        if(!resolveRun(positional[0], store, useSource, baseline)
+           || !resolveRun(positional[1], store, useSource, candidate))
+        {
+            return ExitError;
+        }
+
+        auto diffs   = rocwmma::compareRuns(baseline, candidate, config);
+        auto summary = rocwmma::summarize(diffs);
+
+        std::cout << "Baseline:  " << baseline.label << "\nCandidate: " << candidate.label
+                  << "\nThreshold: " << config.threshold * 100.0 << "%, alpha: " << config.alpha
+                  << "\n\n";
+        rocwmma::printDiffTable(std::cout, diffs, showAll) << std::endl;
+        rocwmma::printSummaryTable(std::cout, diffs);
+
+        if(!csvPath.empty())
+        {
+            std::ofstream csv(csvPath);
+            if(!csv.is_open())
+            {
+                std::cerr << csvPath << ": unable to open" << std::endl;
+                return ExitError;
+            }
+            rocwmma::writeDiffCsv(csv, diffs);
+        }
+
+        return summary.regressions > 0u ? ExitRegression : ExitOk;
+    }
+
+    printUsage(argv[0]);
+    return ExitError;
+}
@@ -0,0 +1,386 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_BENCH_COMPARE_HPP
+#define ROCWMMA_TEST_BENCH_COMPARE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "bench_store.hpp"
+
+// Run-to-run comparison of benchmark results.
+// Kernels are matched by signature and compared on median time. A change
+// counts when it exceeds the threshold and the two timing distributions
+// differ significantly under a two-sided Mann-Whitney U test. Kernels with
+// fewer than two samples on either side cannot be tested, so the threshold
+// alone decides.
+
+namespace rocwmma
+{
+    struct BenchCompareConfig
+    {
+        float64_t threshold = 0.05; // Relative change in median time
+        float64_t alpha     = 0.01; // Significance level
+    };
+
+    enum class BenchDelta : uint32_t
+    {
+        Unchanged = 0u,
+        Regression,
+        Improvement,
+        Added, // Candidate only
+        Removed // Baseline only
+    };
+
+    inline char const* toString(BenchDelta delta)
+    {
+        switch(delta)
+        {
+        case BenchDelta::Regression:
+            return "REGRESSION";
+        case BenchDelta::Improvement:
+            return "improved";
+        case BenchDelta::Added:
+            return "added";
+        case BenchDelta::Removed:
+            return "removed";
+        default:
+            return "same";
+        }
+    }
+
+    struct BenchDiff
+    {
+        std::string signature;
+        BenchStats  baseline, candidate;
+        float64_t   baselineTFlopsPerSec  = 0.0;
+        float64_t   candidateTFlopsPerSec = 0.0;
+        float64_t   ratio                 = 1.0; // Candidate / baseline median time
+        float64_t   pValue                = -1.0; // < 0 if untestable
+        BenchDelta  delta                 = BenchDelta::Unchanged;
+    };
+
+    struct BenchSummary
+    {
+        uint32_t  compared     = 0u;
+        uint32_t  regressions  = 0u;
+        uint32_t  improvements = 0u;
+        uint32_t  added        = 0u;
+        uint32_t  removed      = 0u;
+        float64_t geomeanSpeedup = 1.0; // Baseline / candidate time, compared kernels
+        float64_t worstRatio     = 1.0;
+    };
+
+    // Two-sided p-value of the Mann-Whitney U test, normal approximation
+    // with tie and continuity correction. Returns -1 with fewer than two
+    // samples on either side.
+    inline float64_t mannWhitneyPValue(std::vector<float64_t> const& a,
+                                       std::vector<float64_t> const& b)
+    {
+        auto n1 = a.size();
+        auto n2 = b.size();
+        if(n1 < 2u || n2 < 2u)
+        {
+            return -1.0;
+        }
+
+        // Pool with group tags, then rank with ties averaged
+        std::vector<std::pair<float64_t, bool>> pooled;
+        pooled.reserve(n1 + n2);
+        for(auto v : a)
+        {
+            pooled.emplace_back(v, true);
+        }
+        for(auto v : b)
+        {
+            pooled.emplace_back(v, false);
+        }
+        std::sort(pooled.begin(), pooled.end());
+
+        auto n       = static_cast<float64_t>(n1 + n2);
+        auto rankSum = 0.0;
+        auto tieSum  = 0.0;
+        for(size_t i = 0; i < pooled.size();)
+        {
+            auto j = i;
+            while(j < pooled.size() && pooled[j].first == pooled[i].first)
+            {
+                j++;
+            }
+
+            auto ties = static_cast<float64_t>(j - i);
+            auto rank = 0.5 * static_cast<float64_t>(i + 1u + j); // Mean of ranks i+1 .. j
+            for(auto k = i; k < j; k++)
+            {
+                rankSum += pooled[k].second ? rank : 0.0;
+            }
+            tieSum += ties * ties * ties - ties;
+            i = j;
+        }
+
+        auto f1    = static_cast<float64_t>(n1);
+        auto f2    = static_cast<float64_t>(n2);
+        auto u     = rankSum - f1 * (f1 + 1.0) * 0.5;
+        auto mean  = f1 * f2 * 0.5;
+        auto var   = f1 * f2 / 12.0 * ((n + 1.0) - tieSum / (n * (n - 1.0)));
+        if(var <= 0.0)
+        {
+            // All samples identical
+            return 1.0;
+        }
+
+        auto z = std::max(std::abs(u - mean) - 0.5, 0.0) / std::sqrt(var);
+        return std::erfc(z / std::sqrt(2.0));
+    }
+
+    inline std::vector<BenchDiff> compareRuns(BenchRun const&           baseline,
+                                              BenchRun const&           candidate,
+                                              BenchCompareConfig const& config)
+    {
+        std::vector<BenchDiff> diffs;
+
+        auto makeDiff = [](BenchRecord const* base, BenchRecord const* cand) {
+            BenchDiff diff;
+            diff.signature = base ? base->signature : cand->signature;
+            if(base)
+            {
+                diff.baseline             = computeBenchStats(base->samples);
+                diff.baselineTFlopsPerSec = base->tflopsPerSec;
+            }
+            if(cand)
+            {
+                diff.candidate             = computeBenchStats(cand->samples);
+                diff.candidateTFlopsPerSec = cand->tflopsPerSec;
+            }
+            return diff;
+        };
+
+        // Both record lists are sorted by signature
+        auto base = baseline.records.begin();
+        auto cand = candidate.records.begin();
+        while(base != baseline.records.end() || cand != candidate.records.end())
+        {
+            if(cand == candidate.records.end()
+               || (base != baseline.records.end() && base->signature < cand->signature))
+            {
+                diffs.push_back(makeDiff(&(*base++), nullptr));
+                diffs.back().delta = BenchDelta::Removed;
+            }
+            else if(base == baseline.records.end() || cand->signature < base->signature)
+            {
+                diffs.push_back(makeDiff(nullptr, &(*cand++)));
+                diffs.back().delta = BenchDelta::Added;
+            }
+            else
+            {
+                auto diff = makeDiff(&(*base), &(*cand));
+                if(diff.baseline.median > 0.0)
+                {
+                    diff.ratio = diff.candidate.median / diff.baseline.median;
+                }
+                diff.pValue = mannWhitneyPValue(base->samples, cand->samples);
+
+                auto significant = diff.pValue < 0.0 || diff.pValue < config.alpha;
+                if(significant && diff.ratio > 1.0 + config.threshold)
+                {
+                    diff.delta = BenchDelta::Regression;
+                }
+                else if(significant && diff.ratio < 1.0 / (1.0 + config.threshold))
+                {
+                    diff.delta = BenchDelta::Improvement;
+                }
+
+                diffs.push_back(diff);
+                base++;
+                cand++;
+            }
+        }
+
+        return diffs;
+    }
+
+    inline BenchSummary summarize(std::vector<BenchDiff> const& diffs)
+    {
+        BenchSummary summary;
+        auto         logSum = 0.0;
+
+        for(auto& diff : diffs)
+        {
+            switch(diff.delta)
+            {
+            case BenchDelta::Added:
+                summary.added++;
+                continue;
+            case BenchDelta::Removed:
+                summary.removed++;
+                continue;
+            case BenchDelta::Regression:
+                summary.regressions++;
+                break;
+            case BenchDelta::Improvement:
+                summary.improvements++;
+                break;
+            default:
+                break;
+            }
+
+            summary.compared++;
+            if(diff.ratio > 0.0)
+            {
+                logSum -= std::log(diff.ratio);
+            }
+            summary.worstRatio = std::max(summary.worstRatio, diff.ratio);
+        }
+
+        if(summary.compared > 0u)
+        {
+            summary.geomeanSpeedup = std::exp(logSum / static_cast<float64_t>(summary.compared));
+        }
+        return summary;
+    }
+
+    // Kernel table. Unchanged kernels are listed only with showAll.
+    inline std::ostream& printDiffTable(std::ostream&                 stream,
+                                        std::vector<BenchDiff> const& diffs,
+                                        bool                          showAll)
+    {
+        size_t width = 9u;
+        for(auto& diff : diffs)
+        {
+            width = std::max(width, diff.signature.size());
+        }
+
+        auto flags = stream.flags();
+        stream << std::left << std::setw(width) << "Signature" << std::right << std::setw(12)
+               << "BaseMs" << std::setw(12) << "CandMs" << std::setw(9) << "Delta(%)"
+               << std::setw(10) << "p-value" << std::setw(11) << "BaseTF/s" << std::setw(11)
+               << "CandTF/s"
+               << "  Status" << std::endl;
+
+        stream << std::fixed;
+        for(auto& diff : diffs)
+        {
+            if(!showAll && diff.delta == BenchDelta::Unchanged)
+            {
+                continue;
+            }
+
+            stream << std::left << std::setw(width) << diff.signature << std::right
+                   << std::setprecision(4) << std::setw(12) << diff.baseline.median
+                   << std::setw(12) << diff.candidate.median << std::setprecision(1)
+                   << std::setw(9);
+
+            if(diff.delta == BenchDelta::Added || diff.delta == BenchDelta::Removed)
+            {
+                stream << "n/a";
+            }
+            else
+            {
+                stream << (diff.ratio - 1.0) * 100.0;
+            }
+
+            stream << std::setw(10);
+            if(diff.pValue < 0.0)
+            {
+                stream << "n/a";
+            }
+            else
+            {
+                stream << std::setprecision(4) << diff.pValue;
+            }
+
+            stream << std::setprecision(2) << std::setw(11) << diff.baselineTFlopsPerSec
+                   << std::setw(11) << diff.candidateTFlopsPerSec << "  " << toString(diff.delta)
+                   << std::endl;
+        }
+
+        stream.flags(flags);
+        return stream;
+    }
+
+    // Per data type summary, keyed by the Ti_To_Tc field of the signature
+    inline std::ostream& printSummaryTable(std::ostream&                 stream,
+                                           std::vector<BenchDiff> const& diffs)
+    {
+        std::map<std::string, std::vector<BenchDiff>> groups;
+        for(auto& diff : diffs)
+        {
+            auto begin = diff.signature.find('/') + 1u; // npos + 1 = 0
+            auto end   = diff.signature.find('|', begin);
+            groups[diff.signature.substr(begin, end - begin)].push_back(diff);
+        }
+        groups["all"] = diffs;
+
+        auto flags = stream.flags();
+        stream << std::left << std::setw(16) << "Types" << std::right << std::setw(10)
+               << "Compared" << std::setw(13) << "Regressions" << std::setw(14)
+               << "Improvements" << std::setw(8) << "Added" << std::setw(10) << "Removed"
+               << std::setw(16) << "GeomeanSpeedup" << std::setw(12) << "Worst(%)"
+               << std::endl;
+
+        stream << std::fixed << std::setprecision(3);
+        for(auto& group : groups)
+        {
+            auto summary = summarize(group.second);
+            stream << std::left << std::setw(16) << group.first << std::right << std::setw(10)
+                   << summary.compared << std::setw(13) << summary.regressions << std::setw(14)
+                   << summary.improvements << std::setw(8) << summary.added << std::setw(10)
+                   << summary.removed << std::setw(16) << summary.geomeanSpeedup
+                   << std::setprecision(1) << std::setw(12)
+                   << (summary.worstRatio - 1.0) * 100.0 << std::setprecision(3) << std::endl;
+        }
+
+        stream.flags(flags);
+        return stream;
+    }
+
+    // Machine readable diff, one row per kernel
+    inline std::ostream& writeDiffCsv(std::ostream& stream, std::vector<BenchDiff> const& diffs)
+    {
+        stream << "Signature, BaseMedianMs, CandMedianMs, BaseCV, CandCV, BaseSamples, "
+                  "CandSamples, Ratio, pValue, BaseTFlops/s, CandTFlops/s, Status"
+               << std::endl;
+        for(auto& diff : diffs)
+        {
+            stream << diff.signature << ", " << diff.baseline.median << ", "
+                   << diff.candidate.median << ", " << diff.baseline.cv << ", "
+                   << diff.candidate.cv << ", " << diff.baseline.samples << ", "
+                   << diff.candidate.samples << ", " << diff.ratio << ", " << diff.pValue << ", "
+                   << diff.baselineTFlopsPerSec << ", " << diff.candidateTFlopsPerSec << ", "
+                   << toString(diff.delta) << std::endl;
+        }
+        return stream;
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_BENCH_COMPARE_HPP
@@ -0,0 +1,615 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_BENCH_STORE_HPP
+#define ROCWMMA_TEST_BENCH_STORE_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench_stats.hpp"
+
+// Benchmark result store for GEMM benchmark outputs.
+// Runs are ingested from the gemm test CSV output (--output_stream) or the
+// JSON lines output (--bench_json) and keyed by kernel signature. Each record
+// holds the per-iteration timing distribution; outputs without a
+// distribution contribute their elapsed time as a single sample, so the same
+// kernel ingested from several runs accumulates a distribution of its own.
+//
+// On disk, the store is columnar: signatures and run labels are dictionary
+// encoded and every record field is a contiguous array, followed by one
+// pool of all samples.
+
+namespace rocwmma
+{
+    struct BenchRecord
+    {
+        // [source/]Ti_To_Tc|LytA_LytB_LytC_LytD|BlkMxBlkNxBlkK|TBlkXxTBlkY|MxNxK[|config]
+        // where config holds kernel specific parameters, e.g. GemmConfig and BlocksX/Y
+        std::string            signature;
+        float64_t              tflopsPerSec = 0.0;
+        std::vector<float64_t> samples; // ms
+    };
+
+    struct BenchRun
+    {
+        std::string              label;
+        std::vector<BenchRecord> records; // Sorted by signature
+
+        BenchRecord const* find(std::string const& signature) const
+        {
+            auto it = std::lower_bound(
+                records.begin(),
+                records.end(),
+                signature,
+                [](BenchRecord const& r, std::string const& s) { return r.signature < s; });
+            return (it != records.end() && it->signature == signature) ? &(*it) : nullptr;
+        }
+
+        // Repeated signatures merge: samples are pooled and throughput averaged
+        void add(BenchRecord&& record)
+        {
+            auto it = std::lower_bound(records.begin(),
+                                       records.end(),
+                                       record.signature,
+                                       [](BenchRecord const& r, std::string const& s) {
+                                           return r.signature < s;
+                                       });
+            if(it != records.end() && it->signature == record.signature)
+            {
+                auto n = static_cast<float64_t>(it->samples.size());
+                auto m = static_cast<float64_t>(record.samples.size());
+                if(n + m > 0.0)
+                {
+                    it->tflopsPerSec = (it->tflopsPerSec * n + record.tflopsPerSec * m) / (n + m);
+                }
+                it->samples.insert(it->samples.end(), record.samples.begin(), record.samples.end());
+            }
+            else
+            {
+                records.insert(it, std::move(record));
+            }
+        }
+    };
+
+    namespace detail
+    {
+        inline std::string trim(std::string const& s)
+        {
+            auto first = s.find_first_not_of(" \t\r\n");
+            if(first == std::string::npos)
+            {
+                return std::string();
+            }
+            auto last = s.find_last_not_of(" \t\r\n");
+            return s.substr(first, last - first + 1u);
+        }
+
+        inline std::vector<std::string> split(std::string const& s, char delim)
+        {
+            std::vector<std::string> fields;
+            std::stringstream        ss(s);
+            std::string              field;
+            while(std::getline(ss, field, delim))
+            {
+                fields.push_back(trim(field));
+            }
+            // Trailing delimiter yields a final empty field
+            if(!s.empty() && s.back() == delim)
+            {
+                fields.emplace_back();
+            }
+            return fields;
+        }
+
+        inline bool toFloat(std::string const& s, float64_t& value)
+        {
+            char* end = nullptr;
+            value     = std::strtod(s.c_str(), &end);
+            return !s.empty() && end == s.c_str() + s.size();
+        }
+
+        inline std::string makeSignature(std::string const& source,
+                                         std::string const& types,
+                                         std::string const& layouts,
+                                         std::string const& blkM,
+                                         std::string const& blkN,
+                                         std::string const& blkK,
+                                         std::string const& tBlkX,
+                                         std::string const& tBlkY,
+                                         std::string const& m,
+                                         std::string const& n,
+                                         std::string const& k,
+                                         std::string const& batch,
+                                         std::string const& config)
+        {
+            // Single gemms (no or unit batch) keep the plain MxNxK problem key
+            auto batched = !batch.empty() && batch != "1";
+            return (source.empty() ? std::string() : source + "/") + types + "|" + layouts + "|"
+                   + blkM + "x" + blkN + "x" + blkK + "|" + tBlkX + "x" + tBlkY + "|" + m + "x"
+                   + n + "x" + k + (batched ? "*" + batch : std::string())
+                   + (config.empty() ? std::string() : "|" + config);
+        }
+
+        // Flat JSON object as written by the gemm benchmark: string, number
+        // and number array members only.
+        inline bool parseJsonLine(std::string const&                  line,
+                                  std::map<std::string, std::string>& members,
+                                  std::vector<float64_t>&             distribution)
+        {
+            size_t pos  = line.find('{');
+            auto   skip = [&]() {
+                while(pos < line.size() && std::isspace(static_cast<unsigned char>(line[pos])))
+                {
+                    pos++;
+                }
+            };
+            auto readString = [&](std::string& out) {
+                if(pos >= line.size() || line[pos] != '"')
+                {
+                    return false;
+                }
+                auto end = line.find('"', pos + 1u);
+                if(end == std::string::npos)
+                {
+                    return false;
+                }
+                out = line.substr(pos + 1u, end - pos - 1u);
+                pos = end + 1u;
+                return true;
+            };
+
+            if(pos == std::string::npos)
+            {
+                return false;
+            }
+            pos++;
+
+            while(true)
+            {
+                skip();
+                if(pos < line.size() && line[pos] == '}')
+                {
+                    return true;
+                }
+
+                std::string key;
+                if(!readString(key))
+                {
+                    return false;
+                }
+                skip();
+                if(pos >= line.size() || line[pos++] != ':')
+                {
+                    return false;
+                }
+                skip();
+
+                if(pos < line.size() && line[pos] == '"')
+                {
+                    if(!readString(members[key]))
+                    {
+                        return false;
+                    }
+                }
+                else if(pos < line.size() && line[pos] == '[')
+                {
+                    auto end = line.find(']', pos);
+                    if(end == std::string::npos)
+                    {
+                        return false;
+                    }
+                    for(auto& field : split(line.substr(pos + 1u, end - pos - 1u), ','))
+                    {
+                        float64_t value;
+                        if(toFloat(field, value))
+                        {
+                            distribution.push_back(value);
+                        }
+                    }
+                    pos = end + 1u;
+                }
+                else
+                {
+                    auto end     = line.find_first_of(",}", pos);
+                    members[key] = trim(line.substr(pos, end - pos));
+                    pos          = end;
+                }
+
+                skip();
+                if(pos < line.size() && line[pos] == ',')
+                {
+                    pos++;
+                }
+            }
+        }
+
+    } // namespace detail
+
+    // Ingests gemm benchmark output into run. CSV header lines may repeat
+    // (one per test fixture) and non-CSV lines, such as gtest logging, are
+    // skipped. Skipped kernels are ignored. Returns the number of records read.
+    inline size_t parseBenchOutput(std::istream& stream, BenchRun& run, std::string const& source)
+    {
+        size_t                        count = 0u;
+        std::map<std::string, size_t> columns;
+        size_t                        configColumns = 0u;
+        std::string                   line;
+
+        while(std::getline(stream, line))
+        {
+            line = detail::trim(line);
+            if(line.empty())
+            {
+                continue;
+            }
+
+            BenchRecord record;
+
+            // JSON lines (--bench_json)
+            if(line.front() == '{')
+            {
+                std::map<std::string, std::string> members;
+                if(!detail::parseJsonLine(line, members, record.samples)
+                   || members.count("MatK") == 0u || members.count("Types") == 0u)
+                {
+                    continue;
+                }
+
+                record.signature = detail::makeSignature(source,
+                                                         members["Types"],
+                                                         members["Layouts"],
+                                                         members["BlkM"],
+                                                         members["BlkN"],
+                                                         members["BlkK"],
+                                                         members["TBlkX"],
+                                                         members["TBlkY"],
+                                                         members["MatM"],
+                                                         members["MatN"],
+                                                         members["MatK"],
+                                                         members["Batch"],
+                                                         members["Config"]);
+                detail::toFloat(members["TFlops/s"], record.tflopsPerSec);
+
+                float64_t median;
+                if(record.samples.empty() && detail::toFloat(members["median"], median))
+                {
+                    record.samples.push_back(median);
+                }
+            }
+            // CSV (--output_stream)
+            else
+            {
+                // Kernel specific columns, if any, precede TBlkX in the header
+                auto fields = detail::split(line, ',');
+                auto tBlkX  = std::find(fields.begin(), fields.end(), "TBlkX");
+                if(tBlkX != fields.end() && fields.back() == "Result")
+                {
+                    columns.clear();
+                    for(size_t i = 0; i < fields.size(); i++)
+                    {
+                        columns[fields[i]] = i;
+                    }
+                    configColumns = static_cast<size_t>(tBlkX - fields.begin());
+                    continue;
+                }
+
+                if(columns.empty() || fields.size() != columns.size()
+                   || fields.back() == "SKIPPED")
+                {
+                    continue;
+                }
+
+                auto field = [&](char const* name) {
+                    auto it = columns.find(name);
+                    return it != columns.end() ? fields[it->second] : std::string();
+                };
+
+                std::string config;
+                for(size_t i = 0; i < configColumns; i++)
+                {
+                    config += (i ? "_" : "") + fields[i];
+                }
+
+                record.signature = detail::makeSignature(source,
+                                                         field("Ti_To_Tc"),
+                                                         field("LytA_LytB_LytC_LytD"),
+                                                         field("BlkM"),
+                                                         field("BlkN"),
+                                                         field("BlkK"),
+                                                         field("TBlkX"),
+                                                         field("TBlkY"),
+                                                         field("MatM"),
+                                                         field("MatN"),
+                                                         field("MatK"),
+                                                         field("Batch"),
+                                                         config);
+                detail::toFloat(field("TFlops/s"), record.tflopsPerSec);
+
+                for(auto& sample : detail::split(field("SamplesMs"), ';'))
+                {
+                    float64_t value;
+                    if(detail::toFloat(sample, value))
+                    {
+                        record.samples.push_back(value);
+                    }
+                }
+
+                float64_t elapsedMs;
+                if(record.samples.empty() && detail::toFloat(field("elapsedMs"), elapsedMs))
+                {
+                    record.samples.push_back(elapsedMs);
+                }
+            }
+
+            if(!record.samples.empty())
+            {
+                run.add(std::move(record));
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    class BenchStore
+    {
+    public:
+        std::vector<BenchRun> const& runs() const
+        {
+            return mRuns;
+        }
+
+        BenchRun const* findRun(std::string const& label) const
+        {
+            for(auto& run : mRuns)
+            {
+                if(run.label == label)
+                {
+                    return &run;
+                }
+            }
+            return nullptr;
+        }
+
+        // Re-ingesting a label replaces the run
+        void addRun(BenchRun run)
+        {
+            for(auto& existing : mRuns)
+            {
+                if(existing.label == run.label)
+                {
+                    existing = std::move(run);
+                    return;
+                }
+            }
+            mRuns.push_back(std::move(run));
+        }
+
+        // A missing file is an empty store
+        bool load(std::string const& path, std::string& error)
+        {
+            mRuns.clear();
+
+            std::ifstream file(path, std::ios::binary);
+            if(!file.is_open())
+            {
+                return true;
+            }
+
+            Header header;
+            if(!readPod(file, header) || std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+               || header.version != Version)
+            {
+                error = path + ": not a rocWMMA benchmark store";
+                return false;
+            }
+
+            std::vector<std::string> labels(header.runs), signatures(header.signatures);
+            std::vector<uint32_t>    runIds(header.records), sigIds(header.records);
+            std::vector<float64_t>   tflops(header.records), pool(header.samples);
+            std::vector<uint64_t>    offsets(header.records + 1u);
+
+            bool ok = readStrings(file, labels) && readStrings(file, signatures)
+                      && readArray(file, runIds) && readArray(file, sigIds)
+                      && readArray(file, tflops) && readArray(file, offsets)
+                      && readArray(file, pool);
+            if(!ok)
+            {
+                error = path + ": truncated benchmark store";
+                return false;
+            }
+
+            mRuns.resize(header.runs);
+            for(uint32_t i = 0; i < header.runs; i++)
+            {
+                mRuns[i].label = labels[i];
+            }
+
+            for(uint64_t i = 0; i < header.records; i++)
+            {
+                if(runIds[i] >= header.runs || sigIds[i] >= header.signatures
+                   || offsets[i] > offsets[i + 1u] || offsets[i + 1u] > header.samples)
+                {
+                    error = path + ": corrupt benchmark store";
+                    mRuns.clear();
+                    return false;
+                }
+
+                BenchRecord record;
+                record.signature    = signatures[sigIds[i]];
+                record.tflopsPerSec = tflops[i];
+                record.samples.assign(pool.begin() + offsets[i], pool.begin() + offsets[i + 1u]);
+                mRuns[runIds[i]].add(std::move(record));
+            }
+
+            return true;
+        }
+
+        // Written to a temporary then renamed, so readers never see a
+        // partial store
+        bool save(std::string const& path, std::string& error) const
+        {
+            std::map<std::string, uint32_t> sigIndex;
+            std::vector<std::string>         labels, signatures;
+            std::vector<uint32_t>            runIds, sigIds;
+            std::vector<float64_t>           tflops, pool;
+            std::vector<uint64_t>            offsets(1u, 0u);
+
+            for(uint32_t r = 0; r < mRuns.size(); r++)
+            {
+                labels.push_back(mRuns[r].label);
+                for(auto& record : mRuns[r].records)
+                {
+                    auto it = sigIndex.emplace(record.signature, uint32_t(signatures.size()));
+                    if(it.second)
+                    {
+                        signatures.push_back(record.signature);
+                    }
+
+                    runIds.push_back(r);
+                    sigIds.push_back(it.first->second);
+                    tflops.push_back(record.tflopsPerSec);
+                    pool.insert(pool.end(), record.samples.begin(), record.samples.end());
+                    offsets.push_back(pool.size());
+                }
+            }
+
+            Header header;
+            std::memcpy(header.magic, Magic, sizeof(Magic));
+            header.version    = Version;
+            header.runs       = static_cast<uint32_t>(labels.size());
+            header.signatures = static_cast<uint32_t>(signatures.size());
+            header.records    = runIds.size();
+            header.samples    = pool.size();
+
+            auto          tmpPath = path + ".tmp";
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            bool          ok = file.is_open();
+            ok = ok && file.write(reinterpret_cast<char const*>(&header), sizeof(header)).good();
+            ok = ok && writeStrings(file, labels) && writeStrings(file, signatures)
+                 && writeArray(file, runIds) && writeArray(file, sigIds)
+                 && writeArray(file, tflops) && writeArray(file, offsets)
+                 && writeArray(file, pool);
+            file.close();
+
+            if(!ok || std::rename(tmpPath.c_str(), path.c_str()) != 0)
+            {
+                std::remove(tmpPath.c_str());
+                error = path + ": unable to write benchmark store";
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        static constexpr char     Magic[8] = {'R', 'W', 'M', 'M', 'A', 'B', 'S', '\0'};
+        static constexpr uint32_t Version  = 1u;
+
+        struct Header
+        {
+            char     magic[8];
+            uint32_t version;
+            uint32_t runs;
+            uint32_t signatures;
+            uint32_t reserved = 0u;
+            uint64_t records;
+            uint64_t samples;
+        };
+
+        template <typename T>
+        static bool readPod(std::istream& stream, T& value)
+        {
+            return stream.read(reinterpret_cast<char*>(&value), sizeof(T)).good();
+        }
+
+        template <typename T>
+        static bool readArray(std::istream& stream, std::vector<T>& values)
+        {
+            return values.empty()
+                   || stream.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T))
+                          .good();
+        }
+
+        template <typename T>
+        static bool writeArray(std::ostream& stream, std::vector<T> const& values)
+        {
+            return values.empty()
+                   || stream
+                          .write(reinterpret_cast<char const*>(values.data()),
+                                 values.size() * sizeof(T))
+                          .good();
+        }
+
+        // Length prefixed
+        static bool readStrings(std::istream& stream, std::vector<std::string>& values)
+        {
+            for(auto& value : values)
+            {
+                uint32_t length;
+                if(!readPod(stream, length))
+                {
+                    return false;
+                }
+                value.resize(length);
+                if(length > 0u && !stream.read(&value[0], length).good())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool writeStrings(std::ostream& stream, std::vector<std::string> const& values)
+        {
+            for(auto& value : values)
+            {
+                auto length = static_cast<uint32_t>(value.size());
+                if(!stream.write(reinterpret_cast<char const*>(&length), sizeof(length))
+                        .write(value.data(), length)
+                        .good())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::vector<BenchRun> mRuns;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_BENCH_STORE_HPP
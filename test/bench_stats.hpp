@@ -0,0 +1,205 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_BENCH_STATS_HPP
+#define ROCWMMA_TEST_BENCH_STATS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+// Host-only timing statistics for benchmark runs.
+// Samples are per-iteration times, in any consistent unit (ms in the harness).
+// Nothing here touches the device, so the engine can be tested with synthetic
+// samples.
+
+namespace rocwmma
+{
+    struct BenchConfig
+    {
+        // Untimed launches before sampling, to absorb clock ramp-up and
+        // first-launch effects.
+        uint32_t warmup = 3u;
+
+        // Samples collected per round
+        uint32_t iterations = 10u;
+
+        // Rounds repeat until the coefficient of variation drops to
+        // targetCv or maxIterations samples are collected. 0 = one round.
+        float64_t targetCv      = 0.02;
+        uint32_t  maxIterations = 200u;
+
+        // Reject samples outside the Tukey fences [Q1 - k * IQR, Q3 + k * IQR]
+        bool      rejectOutliers = true;
+        float64_t outlierFence   = 1.5;
+    };
+
+    struct BenchStats
+    {
+        uint32_t  samples  = 0u; // Samples collected
+        uint32_t  outliers = 0u; // Samples rejected
+        float64_t min      = 0.0;
+        float64_t max      = 0.0;
+        float64_t mean     = 0.0;
+        float64_t median   = 0.0;
+        float64_t p95      = 0.0;
+        float64_t stddev   = 0.0;
+        float64_t cv       = 0.0; // stddev / mean
+    };
+
+    // Linearly interpolated percentile of sorted samples, p in [0, 1]
+    inline float64_t percentile(std::vector<float64_t> const& sorted, float64_t p)
+    {
+        if(sorted.empty())
+        {
+            return 0.0;
+        }
+
+        auto rank = p * static_cast<float64_t>(sorted.size() - 1u);
+        auto lo   = static_cast<size_t>(std::floor(rank));
+        auto hi   = std::min(lo + 1u, sorted.size() - 1u);
+        return sorted[lo] + (sorted[hi] - sorted[lo]) * (rank - static_cast<float64_t>(lo));
+    }
+
+    inline BenchStats computeBenchStats(std::vector<float64_t> const& samples,
+                                        bool                          rejectOutliers = true,
+                                        float64_t                     outlierFence   = 1.5)
+    {
+        BenchStats stats;
+        stats.samples = static_cast<uint32_t>(samples.size());
+        if(samples.empty())
+        {
+            return stats;
+        }
+
+        auto sorted = samples;
+        std::sort(sorted.begin(), sorted.end());
+
+        // Need enough samples for meaningful quartiles
+        if(rejectOutliers && sorted.size() >= 4u)
+        {
+            auto q1  = percentile(sorted, 0.25);
+            auto q3  = percentile(sorted, 0.75);
+            auto iqr = q3 - q1;
+            auto lo  = q1 - outlierFence * iqr;
+            auto hi  = q3 + outlierFence * iqr;
+
+            auto first = std::lower_bound(sorted.begin(), sorted.end(), lo);
+            auto last  = std::upper_bound(first, sorted.end(), hi);
+
+            stats.outliers = static_cast<uint32_t>(sorted.size() - (last - first));
+            sorted         = std::vector<float64_t>(first, last);
+        }
+
+        auto count = static_cast<float64_t>(sorted.size());
+        auto sum   = 0.0;
+        for(auto s : sorted)
+        {
+            sum += s;
+        }
+        stats.mean = sum / count;
+
+        auto sqDiff = 0.0;
+        for(auto s : sorted)
+        {
+            sqDiff += (s - stats.mean) * (s - stats.mean);
+        }
+
+        // Sample standard deviation
+        stats.stddev = sorted.size() > 1u ? std::sqrt(sqDiff / (count - 1.0)) : 0.0;
+        stats.cv     = stats.mean > 0.0 ? stats.stddev / stats.mean : 0.0;
+        stats.min    = sorted.front();
+        stats.max    = sorted.back();
+        stats.median = percentile(sorted, 0.5);
+        stats.p95    = percentile(sorted, 0.95);
+
+        return stats;
+    }
+
+    // Runs warmup, then timed rounds until the CV target is met.
+    // timeRound(count, samples) must run count iterations and append one
+    // time per iteration to samples. All collected samples are returned in
+    // samples, including outliers.
+    template <typename RoundFunc>
+    inline BenchStats runBenchmark(BenchConfig const&      config,
+                                   RoundFunc&&             timeRound,
+                                   std::vector<float64_t>& samples)
+    {
+        samples.clear();
+
+        if(config.warmup > 0u)
+        {
+            std::vector<float64_t> discard;
+            timeRound(config.warmup, discard);
+        }
+
+        auto maxIterations = std::max(config.maxIterations, 1u);
+        auto stats         = BenchStats();
+        do
+        {
+            auto remaining = maxIterations - static_cast<uint32_t>(samples.size());
+            timeRound(std::max(std::min(config.iterations, remaining), 1u), samples);
+            stats = computeBenchStats(samples, config.rejectOutliers, config.outlierFence);
+        } while(config.targetCv > 0.0 && stats.cv > config.targetCv
+                && samples.size() < maxIterations);
+
+        return stats;
+    }
+
+    // Samples as a single CSV field: "s0;s1;..."
+    inline std::ostream& writeSamplesCsv(std::ostream&                 stream,
+                                         std::vector<float64_t> const& samples)
+    {
+        for(size_t i = 0; i < samples.size(); i++)
+        {
+            stream << (i ? ";" : "") << samples[i];
+        }
+        return stream;
+    }
+
+    // Stats and samples as JSON object members, without enclosing braces
+    inline std::ostream& writeStatsJson(std::ostream&                 stream,
+                                        BenchStats const&             stats,
+                                        std::vector<float64_t> const& samples)
+    {
+        stream << "\"samples\": " << stats.samples << ", \"outliers\": " << stats.outliers
+               << ", \"min\": " << stats.min << ", \"max\": " << stats.max
+               << ", \"mean\": " << stats.mean << ", \"median\": " << stats.median
+               << ", \"p95\": " << stats.p95 << ", \"stddev\": " << stats.stddev
+               << ", \"cv\": " << stats.cv << ", \"distribution\": [";
+        for(size_t i = 0; i < samples.size(); i++)
+        {
+            stream << (i ? ", " : "") << samples[i];
+        }
+        return stream << "]";
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_BENCH_STATS_HPP
@@ -31,6 +31,7 @@
 #warning("Building tests with hfloat16_t requires !HIP_NO_HALF && !__HIP_NO_HALF_CONVERSIONS__. Proceeding without hfloat16_t")
 #endif // !ROCWMMA_NO_HALF && __HIP_NO_HALF_CONVERSIONS__
 
+#include <atomic>
 #include <iostream>
 #include <mutex>
 #include <tuple>
@@ -273,6 +274,49 @@ namespace rocwmma
             fill(mat.data(), m, n);
         }
 
+        // Counter-based random fill. Generates the same matrix as
+        // fillRandLaunchKernel for the same (seed, matrixId), so host and
+        // device inputs can be produced in place without copies.
+        template <typename DataT>
+        __host__ static inline void fillRand(DataT*   mat,
+                                             uint32_t m,
+                                             uint32_t n,
+                                             uint64_t seed     = PhiloxDefaultSeed,
+                                             uint32_t matrixId = 0u)
+        {
+            constexpr bool IsRowMajor = std::is_same<Layout, row_major>::value;
+
+            // Walk in storage order: parallel over the major dim,
+            // vectorized over the contiguous minor dim.
+            auto majorDim = IsRowMajor ? m : n;
+            auto minorDim = IsRowMajor ? n : m;
+
+#pragma omp parallel for
+            for(int major = 0; major < majorDim; ++major)
+            {
+                auto* line = mat + static_cast<int64_t>(major) * minorDim;
+
+#pragma omp simd
+                for(uint32_t minor = 0; minor < minorDim; ++minor)
+                {
+                    auto row    = IsRowMajor ? major : minor;
+                    auto col    = IsRowMajor ? minor : major;
+                    line[minor] = Philox4x32::template value<DataT>(seed, matrixId, row, col);
+                }
+            }
+        }
+
+        template <typename DataT>
+        __host__ static inline void fillRand(std::vector<DataT>& mat,
+                                             uint32_t            m,
+                                             uint32_t            n,
+                                             uint64_t            seed     = PhiloxDefaultSeed,
+                                             uint32_t            matrixId = 0u)
+        {
+            assert(mat.size() == n * m);
+            fillRand(mat.data(), m, n, seed, matrixId);
+        }
+
         template <typename DataT>
         __host__ static inline void fillVal(DataT* mat, uint32_t m, uint32_t n, DataT value)
         {
@@ -311,6 +355,28 @@ namespace rocwmma
                 (fillKernel<DataT, Layout>), gridDim, blockDim, 0, 0, d_mat, m, k, b);
         }
 
+        // fill kernel wrapper for M x N matrix with counter-based random values
+        template <typename DataT>
+        __host__ static inline void fillRandLaunchKernel(DataT*   d_mat,
+                                                         uint32_t m,
+                                                         uint32_t n,
+                                                         uint64_t seed     = PhiloxDefaultSeed,
+                                                         uint32_t matrixId = 0u)
+        {
+            auto blockDim = dim3(1024, 1, 1);
+            auto gridDim  = dim3(ceilDiv(m * n, blockDim.x), 1, 1);
+            hipLaunchKernelGGL((fillRandKernel<DataT, Layout>),
+                               gridDim,
+                               blockDim,
+                               0,
+                               0,
+                               d_mat,
+                               m,
+                               n,
+                               seed,
+                               matrixId);
+        }
+
         // fill kernel wrapper for M x N matrix for a specific value
         template <typename DataT>
         __host__ static inline void
@@ -333,22 +399,23 @@ namespace rocwmma
         }
     };
 
-    // compareEqual on two different layouts: must calculate index offsets
-    template <typename TypeA,
-              typename TypeB,
-              typename LayoutA,
-              typename LayoutB,
-              typename std::enable_if_t<!std::is_same<LayoutA, LayoutB>::value, int> = 0>
-    std::pair<bool, double> compareEqual(TypeA const* matrixA,
-                                         TypeB const* matrixB,
-                                         uint32_t     m,
-                                         uint32_t     n,
-                                         uint32_t     lda,
-                                         uint32_t     ldb,
-                                         double       tolerance = 10.0)
+    // Single pass comparison engine. Each thread reduces into private stats
+    // which are merged once at the end, so there is no contention on shared
+    // error state. Elements are visited in the storage order of A.
+    // With earlyExit, remaining work is skipped once any mismatch is found
+    // and the stats only cover the elements visited.
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
+    CompareStats compareEqualStats(TypeA const* matrixA,
+                                   TypeB const* matrixB,
+                                   uint32_t     m,
+                                   uint32_t     n,
+                                   uint32_t     lda,
+                                   uint32_t     ldb,
+                                   double       tolerance = 10.0,
+                                   bool         earlyExit = false)
     {
-        bool   retval             = true;
-        double max_relative_error = 0.0;
+        constexpr bool RowMajorA = std::is_same<LayoutA, row_major>::value;
+        constexpr bool RowMajorB = std::is_same<LayoutB, row_major>::value;
 
         // Some types don't have direct conversion to double.
         // Convert to float first then to double.
@@ -357,86 +424,64 @@ namespace rocwmma
         auto toDoubleB
             = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
 
-        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
-        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
+        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) {
+            return static_cast<int64_t>(row) * ld + col;
+        };
+        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) {
+            return static_cast<int64_t>(col) * ld + row;
+        };
 
-        auto indexA = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
-        auto indexB = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
+        auto indexA = RowMajorA ? rowMjr : colMjr;
+        auto indexB = RowMajorB ? rowMjr : colMjr;
 
-        bool       isInf = false;
-        bool       isNaN = false;
-        std::mutex writeMutex;
+        auto const params   = CompareParams::template make<TypeA>(tolerance);
+        auto const majorDim = RowMajorA ? m : n;
+        auto const minorDim = RowMajorA ? n : m;
 
-#pragma omp parallel for
-        for(int i = 0; i < m; ++i) // Row
-        {
-#pragma omp parallel for
-            for(int j = 0; j < n; ++j) // Col
-            {
-                auto valA = matrixA[indexA(i, j, lda)];
-                auto valB = matrixB[indexB(i, j, ldb)];
+        CompareStats      result;
+        std::atomic<bool> stop(false);
+        result.reset();
 
-                auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-                auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
+#pragma omp parallel
+        {
+            CompareStats local;
+            local.reset();
 
-                if(std::isinf(numerator) || std::isinf(divisor))
+#pragma omp for schedule(static) nowait
+            for(int major = 0; major < majorDim; ++major)
+            {
+                if(earlyExit && stop.load(std::memory_order_relaxed))
                 {
-#pragma omp atomic
-                    isInf |= true;
+                    continue;
                 }
-                else
+
+                uint32_t lineMismatches = 0u;
+                for(uint32_t minor = 0; minor < minorDim; ++minor)
                 {
-                    auto relative_error = numerator / divisor;
-                    if(std::isnan(relative_error))
-                    {
-#pragma omp atomic
-                        isNaN |= true;
-                    }
-                    else if(relative_error > max_relative_error)
-                    {
-                        const std::lock_guard<std::mutex> guard(writeMutex);
-                        // Double check in case of stall
-                        if(relative_error > max_relative_error)
-                        {
-                            max_relative_error = relative_error;
-                        }
-                    }
+                    uint32_t row = RowMajorA ? major : minor;
+                    uint32_t col = RowMajorA ? minor : major;
+
+                    lineMismatches += local.compare(toDoubleA(matrixA[indexA(row, col, lda)]),
+                                                    toDoubleB(matrixB[indexB(row, col, ldb)]),
+                                                    params,
+                                                    row,
+                                                    col);
                 }
 
-                if(isInf || isNaN)
+                if(earlyExit && lineMismatches)
                 {
-                    i = m;
-                    j = n;
+                    stop.store(true, std::memory_order_relaxed);
                 }
             }
-        }
 
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isInf)
-        {
-            retval             = false;
-            max_relative_error = std::numeric_limits<TypeA>::infinity();
-        }
-        else if(isNaN)
-        {
-            retval             = false;
-            max_relative_error = double(std::numeric_limits<TypeA>::signaling_NaN());
-        }
-        else if(max_relative_error > (eps * tolerance))
-        {
-            retval = false;
+#pragma omp critical
+            result.merge(local);
         }
 
-        return std::make_pair(retval, max_relative_error);
+        return result;
     }
 
-    // compareEqual on two equal layouts: index offsets are identical
-    // can use slightly faster 1D compare
-    template <typename TypeA,
-              typename TypeB,
-              typename LayoutA,
-              typename LayoutB,
-              typename std::enable_if_t<std::is_same<LayoutA, LayoutB>::value, int> = 0>
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
     std::pair<bool, double> compareEqual(TypeA const* matrixA,
                                          TypeB const* matrixB,
                                          uint32_t     m,
@@ -445,78 +490,9 @@ namespace rocwmma
                                          uint32_t     ldb,
                                          double       tolerance = 10.0)
     {
-        assert(lda == ldb && "Leading dims must match");
-
-        bool   retval             = true;
-        double max_relative_error = 0.0;
-
-        // Some types don't have direct conversion to double.
-        // Convert to float first then to double.
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-        auto toDoubleB
-            = [](TypeB const& val) { return static_cast<double>(static_cast<float>(val)); };
-
-        bool       isInf = false;
-        bool       isNaN = false;
-        std::mutex writeMutex;
-
-#pragma omp parallel for
-        for(int i = 0; i < m * n; ++i) // Row
-        {
-            auto valA = matrixA[i];
-            auto valB = matrixB[i];
-
-            auto numerator = fabs(toDoubleA(valA) - toDoubleB(valB));
-            auto divisor   = fabs(toDoubleA(valA)) + fabs(toDoubleB(valB)) + 1.0;
-
-            if(std::isinf(numerator) || std::isinf(divisor))
-            {
-#pragma omp atomic
-                isInf |= true;
-            }
-            else
-            {
-                auto relative_error = numerator / divisor;
-                if(std::isnan(relative_error))
-                {
-#pragma omp atomic
-                    isNaN |= true;
-                }
-                else if(relative_error > max_relative_error)
-                {
-                    const std::lock_guard<std::mutex> guard(writeMutex);
-                    // Double check in case of stall
-                    if(relative_error > max_relative_error)
-                    {
-                        max_relative_error = relative_error;
-                    }
-                }
-            }
-
-            if(isInf || isNaN)
-            {
-                i = m * n;
-            }
-        }
-
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isInf)
-        {
-            retval             = false;
-            max_relative_error = std::numeric_limits<TypeA>::infinity();
-        }
-        else if(isNaN)
-        {
-            retval             = false;
-            max_relative_error = double(std::numeric_limits<TypeA>::signaling_NaN());
-        }
-        else if(max_relative_error > (eps * tolerance))
-        {
-            retval = false;
-        }
-
-        return std::make_pair(retval, max_relative_error);
+        auto stats = compareEqualStats<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, lda, ldb, tolerance);
+        return std::make_pair(stats.passed(), stats.template relativeError<TypeA>());
     }
 
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
@@ -557,25 +533,37 @@ namespace rocwmma
             a.data(), b.data(), m, n, lda, ldb, tolerance);
     }
 
-    // compareEqual kernel wrapper for gemm tests
+    // Device variant of compareEqualStats, backed by the same element-wise
+    // comparison. The result is reduced on device; only the stats are copied back.
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
-    std::pair<bool, double> compareEqualLaunchKernel(
-        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
+    CompareStats compareEqualStatsLaunchKernel(TypeA const* matrixA,
+                                               TypeB const* matrixB,
+                                               uint32_t     m,
+                                               uint32_t     n,
+                                               uint32_t     lda,
+                                               uint32_t     ldb,
+                                               double       tolerance = 10.0,
+                                               bool         earlyExit = false)
     {
-        uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
-        uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
-
-        auto blockDim = dim3(1024, 1, 1);
-        auto gridDim  = dim3(ceilDiv(m * n, blockDim.x), 1, 1);
+        CompareStats result;
+        result.reset();
 
-        double* d_relativeError;
-        double  maxRelativeError;
-        CHECK_HIP_ERROR(hipMalloc(&d_relativeError, m * n * sizeof(double)));
+        CompareStats* d_result;
+        uint32_t*     d_exitFlag = nullptr;
+        CHECK_HIP_ERROR(hipMalloc(&d_result, sizeof(CompareStats)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_result, &result, sizeof(CompareStats), hipMemcpyHostToDevice));
+        if(earlyExit)
+        {
+            CHECK_HIP_ERROR(hipMalloc(&d_exitFlag, sizeof(uint32_t)));
+            CHECK_HIP_ERROR(hipMemset(d_exitFlag, 0, sizeof(uint32_t)));
+        }
 
-        hipEvent_t syncEvent;
-        CHECK_HIP_ERROR(hipEventCreate(&syncEvent));
+        // Grid-stride: enough threads to saturate the device, each
+        // covering several elements to amortize the final merge.
+        auto blockDim = dim3(256, 1, 1);
+        auto gridDim  = dim3(std::min(ceilDiv(m * n, blockDim.x), 2048u), 1, 1);
 
-        // Calculate the relative error for each element of matrix A/B
         hipLaunchKernelGGL((compareEqualKernel<TypeA, TypeB, LayoutA, LayoutB>),
                            gridDim,
                            blockDim,
@@ -583,144 +571,92 @@ namespace rocwmma
                            0,
                            matrixA,
                            matrixB,
-                           d_relativeError,
+                           d_result,
+                           d_exitFlag,
+                           CompareParams::template make<TypeA>(tolerance),
                            m,
                            n,
                            lda,
                            ldb);
-        CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-        CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-
-        // Determine the maximum relative error
-        blockDim             = dim3(512, 1, 1);
-        uint32_t maxElements = 1024;
-        uint32_t offset      = 1;
-
-        for(uint32_t i = m * n; i > 1; i = ceilDiv(i, maxElements))
-        {
-            gridDim       = dim3(ceilDiv(i, maxElements), 1, 1);
-            auto elements = i > maxElements ? maxElements : i;
-
-            hipLaunchKernelGGL((maxReduceKernel),
-                               gridDim,
-                               blockDim,
-                               0,
-                               0,
-                               d_relativeError,
-                               elements,
-                               offset,
-                               m * n);
-
-            CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-            CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-            offset = offset * maxElements;
-        }
 
         CHECK_HIP_ERROR(
-            hipMemcpy(&maxRelativeError, d_relativeError, sizeof(double), hipMemcpyDeviceToHost));
+            hipMemcpy(&result, d_result, sizeof(CompareStats), hipMemcpyDeviceToHost));
 
         // Free allocated device memory
-        CHECK_HIP_ERROR(hipFree(d_relativeError));
-
-        bool retval = true;
-        bool isNaN  = std::isnan(maxRelativeError);
-
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isNaN)
-        {
-            retval           = false;
-            maxRelativeError = double(std::numeric_limits<TypeA>::signaling_NaN());
-        }
-        else if(maxRelativeError > (eps * tolerance))
+        CHECK_HIP_ERROR(hipFree(d_result));
+        if(d_exitFlag)
         {
-            retval = false;
+            CHECK_HIP_ERROR(hipFree(d_exitFlag));
         }
 
-        return std::make_pair(retval, maxRelativeError);
+        return result;
     }
 
-    // compareEqual kernel wrapper for batched matrices
-    template <typename TypeA, typename TypeB>
+    // compareEqual kernel wrapper for gemm tests
+    template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
     std::pair<bool, double> compareEqualLaunchKernel(
-        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t k, uint32_t b, double tolerance = 10.0)
+        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t n, double tolerance = 10.0)
     {
-        auto blockDim = dim3(1024, 1, 1);
-        auto gridDim  = dim3(ceilDiv(m * k, blockDim.x), 1, b);
-
-        double* d_relativeError;
-        double  maxRelativeError;
-        CHECK_HIP_ERROR(hipMalloc(&d_relativeError, m * k * b * sizeof(double)));
-
-        hipEvent_t syncEvent;
-        CHECK_HIP_ERROR(hipEventCreate(&syncEvent));
+        uint32_t lda = std::is_same<LayoutA, row_major>::value ? n : m;
+        uint32_t ldb = std::is_same<LayoutB, row_major>::value ? n : m;
 
-        // Calculate the relative error for each element of matrix A/B
-        hipLaunchKernelGGL((compareEqualKernel<TypeA, TypeB>),
-                           gridDim,
-                           blockDim,
-                           0,
-                           0,
-                           matrixA,
-                           matrixB,
-                           d_relativeError,
-                           m,
-                           k,
-                           b);
-        CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-        CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
+        auto stats = compareEqualStatsLaunchKernel<TypeA, TypeB, LayoutA, LayoutB>(
+            matrixA, matrixB, m, n, lda, ldb, tolerance);
+        return std::make_pair(stats.passed(), stats.template relativeError<TypeA>());
+    }
 
-        // Determine the maximum relative error
-        blockDim             = dim3(512, 1, 1);
-        uint32_t maxElements = 1024;
-        uint32_t offset      = 1;
+    // compareEqual kernel wrapper for batched matrices.
+    // Contiguous batches of row_major M x K matrices form one (B * M) x K matrix.
+    template <typename TypeA, typename TypeB>
+    std::pair<bool, double> compareEqualLaunchKernel(
+        TypeA* matrixA, TypeB* matrixB, uint32_t m, uint32_t k, uint32_t b, double tolerance = 10.0)
+    {
+        auto stats = compareEqualStatsLaunchKernel<TypeA, TypeB, row_major, row_major>(
+            matrixA, matrixB, m * b, k, k, k, tolerance);
+        return std::make_pair(stats.passed(), stats.template relativeError<TypeA>());
+    }
 
-        for(uint32_t i = m * k * b; i > 1; i = ceilDiv(i, maxElements))
+    inline std::ostream& operator<<(std::ostream& stream, CompareStats const& stats)
+    {
+        stream << "Max abs error: " << stats.maxAbsError
+               << ", max relative error: " << stats.maxRelError
+               << ", mismatches: " << stats.mismatchCount << " / " << stats.elementCount;
+        if(stats.hasInf || stats.hasNaN)
         {
-            gridDim       = dim3(ceilDiv(i, maxElements), 1, 1);
-            auto elements = i > maxElements ? maxElements : i;
-
-            hipLaunchKernelGGL((maxReduceKernel),
-                               gridDim,
-                               blockDim,
-                               0,
-                               0,
-                               d_relativeError,
-                               elements,
-                               offset,
-                               m * k * b);
-
-            CHECK_HIP_ERROR(hipEventRecord(syncEvent));
-            CHECK_HIP_ERROR(hipEventSynchronize(syncEvent));
-            offset = offset * maxElements;
+            stream << (stats.hasInf ? ", inf" : "") << (stats.hasNaN ? ", NaN" : "");
         }
 
-        CHECK_HIP_ERROR(
-            hipMemcpy(&maxRelativeError, d_relativeError, sizeof(double), hipMemcpyDeviceToHost));
-
-        // Free allocated device memory
-        CHECK_HIP_ERROR(hipFree(d_relativeError));
-
-        bool retval = true;
-        bool isNaN  = std::isnan(maxRelativeError);
-
-        auto toDoubleA
-            = [](TypeA const& val) { return static_cast<double>(static_cast<float>(val)); };
-
-        auto eps = toDoubleA(std::numeric_limits<TypeA>::epsilon());
-        if(isNaN)
+        // Bin i > 0 covers [2^(i - 1), 2^i), the last bin is open ended
+        stream << "\nULP histogram: [0]: " << stats.ulpHistogram[0];
+        for(uint32_t i = 1u; i < CompareStats::UlpBins; i++)
         {
-            retval           = false;
-            maxRelativeError = double(std::numeric_limits<TypeA>::signaling_NaN());
+            auto lo = 1ull << (i - 1u);
+            stream << ", [" << lo;
+            if(i + 1u == CompareStats::UlpBins)
+            {
+                stream << "+";
+            }
+            else if(i > 1u)
+            {
+                stream << ", " << (lo << 1u) << ")";
+            }
+            stream << (i > 1u && i + 1u < CompareStats::UlpBins ? ": " : "]: ")
+                   << stats.ulpHistogram[i];
         }
-        else if(maxRelativeError > (eps * tolerance))
+
+        if(stats.mismatchCount)
         {
-            retval = false;
+            stream << "\nFirst mismatches (row, col):";
+            for(uint32_t i = 0u; i < CompareStats::MaxMismatches; i++)
+            {
+                if(stats.mismatches[i] != ~0ull)
+                {
+                    stream << " (" << CompareStats::row(stats.mismatches[i]) << ", "
+                           << CompareStats::col(stats.mismatches[i]) << ")";
+                }
+            }
         }
-
-        return std::make_pair(retval, maxRelativeError);
+        return stream;
     }
 
     // Count occurrences of val in the input array
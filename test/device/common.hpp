@@ -27,9 +27,12 @@
 #ifndef ROCWMMA_TEST_DEVICE_COMMON_HPP
 #define ROCWMMA_TEST_DEVICE_COMMON_HPP
 
+#include <rocwmma/internal/philox.hpp>
 #include <rocwmma/internal/types.hpp>
 #include <rocwmma/rocwmma.hpp>
 
+#include "compare.hpp"
+
 namespace rocwmma
 {
     template <typename T>
@@ -48,120 +51,52 @@ namespace rocwmma
         return col * ld + row;
     }
 
-    __device__ inline float64_t maxDouble(float64_t a, float64_t b)
-    {
-        if(std::isinf(a) || std::isinf(b))
-        {
-            return std::numeric_limits<float64_t>::infinity();
-        }
-        // Check for NaN
-        else if(std::isnan(a) || std::isnan(b))
-        {
-            return std::numeric_limits<float64_t>::signaling_NaN();
-        }
-        return a > b ? a : b;
-    }
-
-    __global__ static void maxReduceKernel(float64_t* relativeError,
-                                           uint32_t   elements,
-                                           uint32_t   offset,
-                                           uint32_t   maxIdx)
-    {
-        float64_t* localRelativeError = relativeError + (offset * elements * blockIdx.x);
-
-        for(int i = elements >> 1; i > 0; i = i >> 1)
-        {
-            if(threadIdx.x < i && offset * (elements * blockIdx.x + threadIdx.x + i) < maxIdx)
-            {
-                localRelativeError[offset * threadIdx.x]
-                    = maxDouble(localRelativeError[offset * threadIdx.x],
-                                localRelativeError[offset * (threadIdx.x + i)]);
-            }
-            synchronize_workgroup();
-        }
-    }
-
-    // Comparitive kernel for batched matrix outputs as used in gemm tests
-    // Compares all values of two M x N matrices
+    // Single pass comparison of two M x N matrices. Each thread accumulates
+    // stats over a grid-stride range in the storage order of A, then merges
+    // once into the global result. With exitFlag set, all threads stop
+    // after the first mismatch is seen.
     template <typename TypeA, typename TypeB, typename LayoutA, typename LayoutB>
-    __global__ void compareEqualKernel(TypeA*     matrixA,
-                                       TypeB*     matrixB,
-                                       float64_t* relativeError,
-                                       uint32_t   m,
-                                       uint32_t   n,
-                                       uint32_t   lda,
-                                       uint32_t   ldb)
+    __global__ void compareEqualKernel(TypeA const*  matrixA,
+                                       TypeB const*  matrixB,
+                                       CompareStats* result,
+                                       uint32_t*     exitFlag,
+                                       CompareParams params,
+                                       uint32_t      m,
+                                       uint32_t      n,
+                                       uint32_t      lda,
+                                       uint32_t      ldb)
     {
-        uint32_t errorIdx = blockIdx.x * blockDim.x + threadIdx.x;
-        uint32_t colIdx   = errorIdx % n;
-        uint32_t rowIdx   = errorIdx / n;
+        constexpr bool RowMajorA = std::is_same<LayoutA, row_major>::value;
+        constexpr bool RowMajorB = std::is_same<LayoutB, row_major>::value;
 
-        uint32_t indexA = std::is_same<LayoutA, row_major>::value ? rowMjr(rowIdx, colIdx, lda)
-                                                                  : colMjr(rowIdx, colIdx, lda);
-        uint32_t indexB = std::is_same<LayoutB, row_major>::value ? rowMjr(rowIdx, colIdx, ldb)
-                                                                  : colMjr(rowIdx, colIdx, ldb);
+        CompareStats local;
+        local.reset();
 
-        if(rowIdx < m && colIdx < n)
-        {
-            TypeA valA = matrixA[indexA];
-            TypeB valB = matrixB[indexB];
+        auto const total  = static_cast<uint64_t>(m) * static_cast<uint64_t>(n);
+        auto const stride = static_cast<uint64_t>(gridDim.x) * blockDim.x;
 
-            // Determine relative error for each element of matrix A/B
-            auto numerator = fabs(toDouble(valA) - toDouble(valB));
-            auto divisor   = fabs(toDouble(valA)) + fabs(toDouble(valB)) + 1.0;
-            if(std::isinf(numerator) || std::isinf(divisor))
-            {
-                relativeError[errorIdx] = std::numeric_limits<float64_t>::infinity();
-            }
-            else if(std::isnan(numerator) || std::isnan(divisor))
-            {
-                relativeError[errorIdx] = std::numeric_limits<float64_t>::signaling_NaN();
-            }
-            else
+        for(uint64_t idx = blockIdx.x * blockDim.x + threadIdx.x; idx < total; idx += stride)
+        {
+            if(exitFlag && *(volatile uint32_t*)exitFlag)
             {
-                relativeError[errorIdx] = numerator / divisor;
+                break;
             }
-        }
-    }
 
-    // Comparitive kernel for batched matrix outputs as used in DLRM tests
-    // Compares all values of two M x N matrices over B batches
-    template <typename TypeA, typename TypeB>
-    __global__ void compareEqualKernel(TypeA*     matrixA,
-                                       TypeB*     matrixB,
-                                       float64_t* relativeError,
-                                       uint32_t   m,
-                                       uint32_t   n,
-                                       uint32_t   b)
-    {
-        uint32_t errorIdx    = blockIdx.x * blockDim.x + threadIdx.x;
-        uint32_t colIdx      = errorIdx % n;
-        uint32_t rowIdx      = errorIdx / n;
-        uint32_t matrixIdx   = rowMjr(rowIdx, colIdx, n);
-        uint32_t batchOffset = blockIdx.z * m * n;
+            uint32_t rowIdx = RowMajorA ? idx / n : idx % m;
+            uint32_t colIdx = RowMajorA ? idx % n : idx / m;
 
-        if(rowIdx < m && colIdx < n && blockIdx.z < b)
-        {
-            TypeA valA = matrixA[batchOffset + matrixIdx];
-            TypeB valB = matrixB[batchOffset + matrixIdx];
+            uint32_t indexA = RowMajorA ? rowMjr(rowIdx, colIdx, lda) : colMjr(rowIdx, colIdx, lda);
+            uint32_t indexB = RowMajorB ? rowMjr(rowIdx, colIdx, ldb) : colMjr(rowIdx, colIdx, ldb);
 
-            // Determine relative error for each element of matrix A/B
-            auto numerator = fabs(toDouble(valA) - toDouble(valB));
-            auto divisor   = fabs(toDouble(valA)) + fabs(toDouble(valB)) + 1.0;
-            if(std::isinf(numerator) || std::isinf(divisor))
-            {
-                relativeError[batchOffset + errorIdx] = std::numeric_limits<float64_t>::infinity();
-            }
-            else if(std::isnan(numerator) || std::isnan(divisor))
-            {
-                relativeError[batchOffset + errorIdx]
-                    = std::numeric_limits<float64_t>::signaling_NaN();
-            }
-            else
+            if(local.compare(
+                   toDouble(matrixA[indexA]), toDouble(matrixB[indexB]), params, rowIdx, colIdx)
+               && exitFlag)
             {
-                relativeError[batchOffset + errorIdx] = numerator / divisor;
+                atomicOr(exitFlag, 1u);
             }
         }
+
+        atomicMergeStats(result, local);
     }
 
     // fill kernel for M x N matrix with padding
@@ -238,6 +173,25 @@ namespace rocwmma
         }
     }
 
+    // fill kernel for M x N matrix with counter-based random values.
+    // Each thread writes one element in storage order; values are keyed by
+    // (seed, matrixId, row, col) and match MatrixUtil::fillRand on host.
+    template <typename DataT, typename Layout>
+    __global__ void
+        fillRandKernel(DataT* mat, uint32_t m, uint32_t n, uint64_t seed, uint32_t matrixId)
+    {
+        constexpr bool IsRowMajor = std::is_same<Layout, row_major>::value;
+
+        uint32_t idx    = blockIdx.x * blockDim.x + threadIdx.x;
+        uint32_t rowIdx = IsRowMajor ? idx / n : idx % m;
+        uint32_t colIdx = IsRowMajor ? idx % n : idx / m;
+
+        if(rowIdx < m && colIdx < n)
+        {
+            mat[idx] = Philox4x32::template value<DataT>(seed, matrixId, rowIdx, colIdx);
+        }
+    }
+
     // fill kernel for batched M x K matrices for a specific value
     template <typename DataT, typename Layout>
     __global__ void fillKernel(DataT* mat, uint32_t m, uint32_t k, uint32_t b, DataT value)
@@ -0,0 +1,301 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_DEVICE_COMPARE_HPP
+#define ROCWMMA_TEST_DEVICE_COMPARE_HPP
+
+#include <cmath>
+
+#include <rocwmma/internal/types.hpp>
+
+namespace rocwmma
+{
+    // Default comparison tolerance in units of epsilon, per compute type.
+    // Narrow compute types accumulate larger rounding errors: e.g. the MFMA
+    // output is always fp32 and downcasting it to fp16 differs from a native
+    // fp16 MAC, so they are given more headroom.
+    template <typename ComputeT>
+    struct CompareTolerance
+    {
+        static constexpr double value = sizeof(ComputeT) < sizeof(float32_t) ? 100.0 : 10.0;
+    };
+
+    // Element-wise comparison parameters, derived from the compared type.
+    struct CompareParams
+    {
+        float64_t epsilon; // Machine epsilon (0 for integers)
+        float64_t minNormal; // Smallest normal value (1 for integers)
+        float64_t threshold; // Max allowed relative error
+        bool      isInteger;
+
+        template <typename DataT>
+        static inline CompareParams make(float64_t tolerance)
+        {
+            auto toDouble = [](DataT const& val) {
+                return static_cast<float64_t>(static_cast<float32_t>(val));
+            };
+
+            CompareParams params;
+            params.isInteger = std::numeric_limits<DataT>::is_integer;
+            params.epsilon
+                = params.isInteger ? 0.0 : toDouble(std::numeric_limits<DataT>::epsilon());
+            params.minNormal
+                = params.isInteger ? 1.0 : toDouble(std::numeric_limits<DataT>::min());
+            params.threshold = params.epsilon * tolerance;
+            return params;
+        }
+    };
+
+    // Single pass comparison result. Accumulated per thread, then merged.
+    struct CompareStats
+    {
+        // ULP distance histogram bins:
+        // [0], [1], [2, 4), [4, 8), ..., [2^(UlpBins - 2), inf)
+        static constexpr uint32_t UlpBins       = 12u;
+        static constexpr uint32_t MaxMismatches = 8u;
+
+        float64_t maxAbsError;
+        float64_t maxRelError;
+        uint64_t  elementCount;
+        uint64_t  mismatchCount;
+        uint64_t  ulpHistogram[UlpBins];
+
+        // First mismatch coordinates, packed as (row << 32 | col) in ascending order.
+        uint64_t mismatches[MaxMismatches];
+
+        uint32_t hasInf;
+        uint32_t hasNaN;
+
+        __host__ __device__ inline void reset()
+        {
+            maxAbsError   = 0.0;
+            maxRelError   = 0.0;
+            elementCount  = 0u;
+            mismatchCount = 0u;
+            hasInf        = 0u;
+            hasNaN        = 0u;
+            for(uint32_t i = 0u; i < UlpBins; i++)
+            {
+                ulpHistogram[i] = 0u;
+            }
+            for(uint32_t i = 0u; i < MaxMismatches; i++)
+            {
+                mismatches[i] = ~0ull;
+            }
+        }
+
+        __host__ __device__ static inline uint64_t pack(uint32_t row, uint32_t col)
+        {
+            return (static_cast<uint64_t>(row) << 32u) | static_cast<uint64_t>(col);
+        }
+
+        __host__ __device__ static inline uint32_t row(uint64_t packed)
+        {
+            return static_cast<uint32_t>(packed >> 32u);
+        }
+
+        __host__ __device__ static inline uint32_t col(uint64_t packed)
+        {
+            return static_cast<uint32_t>(packed);
+        }
+
+        __host__ __device__ static inline uint32_t ulpBin(float64_t ulps)
+        {
+            if(ulps < 1.0)
+            {
+                return 0u;
+            }
+
+            // Bin b >= 1 covers [2^(b - 1), 2^b)
+            int exponent;
+            std::frexp(ulps, &exponent);
+            return exponent < static_cast<int>(UlpBins) ? static_cast<uint32_t>(exponent)
+                                                        : UlpBins - 1u;
+        }
+
+        // Keeps the lowest coordinates in ascending order
+        __host__ __device__ inline void recordMismatch(uint64_t packed)
+        {
+            mismatchCount++;
+            for(uint32_t i = 0u; i < MaxMismatches; i++)
+            {
+                if(packed < mismatches[i])
+                {
+                    auto tmp      = mismatches[i];
+                    mismatches[i] = packed;
+                    packed        = tmp;
+                }
+            }
+        }
+
+        // Compares a single element. Returns true on mismatch.
+        __host__ __device__ inline bool compare(float64_t            valA,
+                                                float64_t            valB,
+                                                CompareParams const& params,
+                                                uint32_t             rowIdx,
+                                                uint32_t             colIdx)
+        {
+            elementCount++;
+
+            auto absError = fabs(valA - valB);
+            auto divisor  = fabs(valA) + fabs(valB) + 1.0;
+
+            bool mismatch = false;
+            if(std::isinf(absError) || std::isinf(divisor))
+            {
+                hasInf   = 1u;
+                mismatch = true;
+            }
+            else if(std::isnan(absError) || std::isnan(divisor))
+            {
+                hasNaN   = 1u;
+                mismatch = true;
+            }
+            else
+            {
+                auto relError = absError / divisor;
+                maxAbsError   = absError > maxAbsError ? absError : maxAbsError;
+                maxRelError   = relError > maxRelError ? relError : maxRelError;
+                mismatch      = relError > params.threshold;
+
+                // Spacing of the reference value's representation
+                float64_t spacing = 1.0;
+                if(!params.isInteger)
+                {
+                    auto mag = fabs(valB) > params.minNormal ? fabs(valB) : params.minNormal;
+                    int  exponent;
+                    std::frexp(mag, &exponent);
+                    spacing = std::ldexp(params.epsilon, exponent - 1);
+                }
+                ulpHistogram[ulpBin(absError / spacing)]++;
+            }
+
+            if(mismatch)
+            {
+                recordMismatch(pack(rowIdx, colIdx));
+            }
+            return mismatch;
+        }
+
+        __host__ inline void merge(CompareStats const& other)
+        {
+            maxAbsError = other.maxAbsError > maxAbsError ? other.maxAbsError : maxAbsError;
+            maxRelError = other.maxRelError > maxRelError ? other.maxRelError : maxRelError;
+            elementCount += other.elementCount;
+            hasInf |= other.hasInf;
+            hasNaN |= other.hasNaN;
+            for(uint32_t i = 0u; i < UlpBins; i++)
+            {
+                ulpHistogram[i] += other.ulpHistogram[i];
+            }
+
+            auto count = mismatchCount + other.mismatchCount;
+            for(uint32_t i = 0u; i < MaxMismatches && other.mismatches[i] != ~0ull; i++)
+            {
+                recordMismatch(other.mismatches[i]);
+            }
+            mismatchCount = count;
+        }
+
+        __host__ inline bool passed() const
+        {
+            return mismatchCount == 0u && !hasInf && !hasNaN;
+        }
+
+        // Max relative error in the legacy compareEqual convention:
+        // inf or NaN when any were encountered.
+        template <typename DataT>
+        __host__ inline float64_t relativeError() const
+        {
+            if(hasInf)
+            {
+                return std::numeric_limits<DataT>::infinity();
+            }
+            else if(hasNaN)
+            {
+                return float64_t(std::numeric_limits<DataT>::signaling_NaN());
+            }
+            return maxRelError;
+        }
+    };
+
+    // Device accumulation of per-thread stats into a global result.
+    // Non-negative doubles order the same as their bit patterns, so max
+    // errors reduce with integer atomics.
+    __device__ inline void atomicMergeStats(CompareStats* result, CompareStats const& local)
+    {
+        auto maxBits = [](float64_t val) {
+            return static_cast<unsigned long long>(__double_as_longlong(val));
+        };
+
+        atomicMax(reinterpret_cast<unsigned long long*>(&result->maxAbsError),
+                  maxBits(local.maxAbsError));
+        atomicMax(reinterpret_cast<unsigned long long*>(&result->maxRelError),
+                  maxBits(local.maxRelError));
+        atomicAdd(reinterpret_cast<unsigned long long*>(&result->elementCount),
+                  static_cast<unsigned long long>(local.elementCount));
+        for(uint32_t i = 0u; i < CompareStats::UlpBins; i++)
+        {
+            if(local.ulpHistogram[i])
+            {
+                atomicAdd(reinterpret_cast<unsigned long long*>(&result->ulpHistogram[i]),
+                          static_cast<unsigned long long>(local.ulpHistogram[i]));
+            }
+        }
+
+        if(local.mismatchCount)
+        {
+            atomicAdd(reinterpret_cast<unsigned long long*>(&result->mismatchCount),
+                      static_cast<unsigned long long>(local.mismatchCount));
+
+            // Insert into the global ascending list: each slot keeps the min
+            // and passes the larger value on, so the first slots converge
+            // to the lowest coordinates regardless of thread order.
+            for(uint32_t i = 0u; i < CompareStats::MaxMismatches; i++)
+            {
+                auto carry = static_cast<unsigned long long>(local.mismatches[i]);
+                for(uint32_t j = 0u; j < CompareStats::MaxMismatches && carry != ~0ull; j++)
+                {
+                    auto old = atomicMin(
+                        reinterpret_cast<unsigned long long*>(&result->mismatches[j]), carry);
+                    carry = old > carry ? old : carry;
+                }
+            }
+        }
+
+        if(local.hasInf)
+        {
+            atomicOr(&result->hasInf, 1u);
+        }
+        if(local.hasNaN)
+        {
+            atomicOr(&result->hasNaN, 1u);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_DEVICE_COMPARE_HPP
@@ -125,14 +125,33 @@ namespace rocwmma
             return dim3(ceilDiv(Base::mM,
                                 BlockM * BlocksX * Base::mTBlockX
                                     / Base::DeviceInfo::instance()->warpSize()),
-                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
+                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY),
+                        Base::mBatchCount);
+        }
+
+        // Whether a rows x cols matrix fits the 32-bit range of a buffer resource
+        template <typename DataT, typename DataLayout>
+        static bool fitsBufferResource(uint32_t rows, uint32_t cols, uint32_t ld)
+        {
+            auto elements = std::is_same<DataLayout, row_major>::value
+                                ? static_cast<uint64_t>(rows - 1u) * ld + cols
+                                : static_cast<uint64_t>(cols - 1u) * ld + rows;
+            return elements * sizeof(DataT) <= buffer_resource<DataT>::max_bytes;
         }
 
         bool checkSizes() const final
         {
+            // Each matrix is addressed through one buffer resource.
+            auto fitsBuffers
+                = fitsBufferResource<InputT, LayoutA>(Base::mM, Base::mK, Base::mLda)
+                  && fitsBufferResource<InputT, LayoutB>(Base::mK, Base::mN, Base::mLdb)
+                  && fitsBufferResource<OutputT, LayoutC>(Base::mM, Base::mN, Base::mLdc)
+                  && fitsBufferResource<OutputT, LayoutD>(Base::mM, Base::mN, Base::mLdd);
+
             return ((BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize())
                     <= Base::mM)
-                   && ((BlockN * BlocksY * Base::mTBlockY) <= Base::mN) && (BlockK <= Base::mK);
+                   && ((BlockN * BlocksY * Base::mTBlockY) <= Base::mN) && (BlockK <= Base::mK)
+                   && fitsBuffers;
         }
 
         bool checkQuirks() const final
@@ -145,6 +164,15 @@ namespace rocwmma
             return Base::template dispatchKernelFunc<TestKernelFunc>();
         }
 
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config    = Base::tuningConfig();
+            config.kernel  = "PGR0_LB0_MP0_MB_NC";
+            config.blocksX = BlocksX;
+            config.blocksY = BlocksY;
+            return config;
+        }
+
         std::ostream& printHeader(std::ostream& stream = std::cout) const final
         {
             return Base::printHeader(stream << "BlocksX, BlocksY, ");
@@ -50,6 +50,10 @@ namespace rocwmma
     /// MB = Multi-block, BlocksX * BlocksY > 1
     /// NC = Non-cooperative
     ///
+    /// Global reads and writes go through buffer resources: each matrix
+    /// is described once by a wave-uniform descriptor and blocks are
+    /// addressed with 32-bit element offsets instead of 64-bit pointers.
+    ///
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -77,6 +81,10 @@ namespace rocwmma
                                                                    uint32_t       ldb,
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
+                                                                   uint64_t       strideA,
+                                                                   uint64_t       strideB,
+                                                                   uint64_t       strideC,
+                                                                   uint64_t       strideD,
                                                                    ComputeT       alpha,
                                                                    ComputeT       beta)
     {
@@ -93,6 +101,13 @@ namespace rocwmma
                                                    WaveSize,
                                                    ArchId>::enableBuild())
         {
+            // Strided batch: grid z selects the batch member
+            auto batch = static_cast<uint64_t>(blockIdx.z);
+            a += batch * strideA;
+            b += batch * strideB;
+            c += batch * strideC;
+            d += batch * strideD;
+
             // Setup global mapping
             using MappingA = MappingUtil<BlockM, BlockK, InputT, LayoutA>;
             using MappingB = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
@@ -140,27 +155,37 @@ namespace rocwmma
                 }
             }
 
-            /// Setup global read addresses
-            InputT const* globalAddrsA[BlocksX];
-            InputT const* globalAddrsB[BlocksY];
+            /// Setup buffer resources spanning each matrix
+            auto bufferA = buffer_resource<InputT>(
+                a, MappingA::dataOffset(make_coord2d(m - 1u, k - 1u), lda) + 1u);
+            auto bufferB = buffer_resource<InputT>(
+                b, MappingB::dataOffset(make_coord2d(k - 1u, n - 1u), ldb) + 1u);
+            auto bufferC = buffer_resource<OutputT>(
+                c, MappingC::dataOffset(make_coord2d(m - 1u, n - 1u), ldc) + 1u);
+            auto bufferD = buffer_resource<OutputT>(
+                d, MappingD::dataOffset(make_coord2d(m - 1u, n - 1u), ldd) + 1u);
+
+            /// Setup global read offsets
+            uint32_t globalOffsetsA[BlocksX];
+            uint32_t globalOffsetsB[BlocksY];
 
-            // Blocks in the same row share the same starting address for A
+            // Blocks in the same row share the same starting offset for A
 #pragma unroll
             for(int i = 0; i < BlocksX; i++)
             {
-                globalAddrsA[i]
-                    = MappingA::dataCoord(a, make_coord2d(get<0>(subMatrixCoordsC[i][0]), 0), lda);
+                globalOffsetsA[i]
+                    = MappingA::dataOffset(make_coord2d(get<0>(subMatrixCoordsC[i][0]), 0u), lda);
             }
 
-            // Blocks in the same col share the same starting address for B
+            // Blocks in the same col share the same starting offset for B
 #pragma unroll
             for(int i = 0; i < BlocksY; i++)
             {
-                globalAddrsB[i]
-                    = MappingB::dataCoord(b, make_coord2d(0u, get<1>(subMatrixCoordsC[0][i])), ldb);
+                globalOffsetsB[i]
+                    = MappingB::dataOffset(make_coord2d(0u, get<1>(subMatrixCoordsC[0][i])), ldb);
             }
 
-            /// Setup address increments.
+            /// Setup offset increments.
             // A steps BlockK through m x k
             // B steps BlockK through k x n
             auto incrA  = MappingA::dataOffset(make_coord2d(0u, BlockK), lda);
@@ -180,16 +205,16 @@ namespace rocwmma
 #pragma unroll
                 for(int j = 0; j < BlocksY; j++)
                 {
-                    load_matrix_sync(cachedFragsB[j], globalAddrsB[j], ldb);
-                    globalAddrsB[j] += incrB;
+                    load_matrix_sync(cachedFragsB[j], bufferB, globalOffsetsB[j], ldb);
+                    globalOffsetsB[j] += incrB;
                 }
 
                 //#pragma unroll
                 for(int i = 0; i < BlocksX; i++)
                 {
                     // A fragment will be re-used for each B
-                    load_matrix_sync(fragA, globalAddrsA[i], lda);
-                    globalAddrsA[i] += incrA;
+                    load_matrix_sync(fragA, bufferA, globalOffsetsA[i], lda);
+                    globalOffsetsA[i] += incrA;
 
                     //#pragma unroll
                     for(int j = 0; j < BlocksY; j++)
@@ -208,8 +233,8 @@ namespace rocwmma
 #pragma unroll
                 for(int j = 0; j < BlocksY; j++)
                 {
-                    auto* addrC = MappingC::dataCoord(c, subMatrixCoordsC[i][j], ldc);
-                    load_matrix_sync(fragsC[i][j], addrC, ldc);
+                    auto offsetC = MappingC::dataOffset(subMatrixCoordsC[i][j], ldc);
+                    load_matrix_sync(fragsC[i][j], bufferC, offsetC, ldc);
                 }
             }
 
@@ -230,11 +255,11 @@ namespace rocwmma
                             = OutputT(alpha * ComputeT(fragAcc.x[e]) + beta * ComputeT(fragC.x[e]));
                     }
 
-                    // Output addresss
-                    auto* addrD = MappingD::dataCoord(d, subMatrixCoordsC[i][j], ldd);
+                    // Output offset
+                    auto offsetD = MappingD::dataOffset(subMatrixCoordsC[i][j], ldd);
 
                     // Store the output
-                    store_matrix_sync(addrD, fragC, ldd);
+                    store_matrix_sync(bufferD, fragC, offsetD, ldd);
                 }
             }
         }
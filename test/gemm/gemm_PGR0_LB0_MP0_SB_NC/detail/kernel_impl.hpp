@@ -114,6 +114,12 @@ namespace rocwmma
         Kernel_PGR0_LB0_MP0_SB_NC() {}
         ~Kernel_PGR0_LB0_MP0_SB_NC() final {}
 
+        // Edge blocks are bounds-checked, so uneven sizes need no padding
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
         bool checkQuirks() const final
         {
             return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
@@ -123,6 +129,13 @@ namespace rocwmma
         {
             return Base::template dispatchKernelFunc<TestKernelFunc>();
         }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config   = Base::tuningConfig();
+            config.kernel = "PGR0_LB0_MP0_SB_NC";
+            return config;
+        }
     };
 
 } // namespace rocwmma
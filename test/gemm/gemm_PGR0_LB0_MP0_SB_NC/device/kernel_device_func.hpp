@@ -76,6 +76,10 @@ namespace rocwmma
                                                                    uint32_t       ldb,
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
+                                                                   uint64_t       strideA,
+                                                                   uint64_t       strideB,
+                                                                   uint64_t       strideC,
+                                                                   uint64_t       strideD,
                                                                    ComputeT       alpha,
                                                                    ComputeT       beta)
     {
@@ -90,6 +94,13 @@ namespace rocwmma
                                                    WaveSize,
                                                    ArchId>::enableBuild())
         {
+            // Strided batch: grid z selects the batch member
+            auto batch = static_cast<uint64_t>(blockIdx.z);
+            a += batch * strideA;
+            b += batch * strideB;
+            c += batch * strideC;
+            d += batch * strideD;
+
             using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
             using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
             using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
@@ -103,15 +114,16 @@ namespace rocwmma
             // Target C / D block on 2D grid
             auto matrixCoordC = MappingC::matrixCoord();
 
-            if(get<0>(matrixCoordC) + BlockM > m || get<1>(matrixCoordC) + BlockN > n)
+            if(get<0>(matrixCoordC) >= m || get<1>(matrixCoordC) >= n)
             {
                 return;
             }
 
-            if(BlockK > k)
-            {
-                return;
-            }
+            // Edge blocks of uneven sizes are partially covered.
+            // Their loads are zero-filled and stores are masked
+            // beyond the remaining extent of the matrix.
+            auto validM = m - get<0>(matrixCoordC);
+            auto validN = n - get<1>(matrixCoordC);
 
             // Initialize accumulator
             auto fragAcc = FragAcc();
@@ -128,7 +140,7 @@ namespace rocwmma
             // B steps BlockK through k x n
             auto incrA = MappingA::dataOffset(make_coord2d(0u, BlockK), lda);
             auto incrB = MappingB::dataOffset(make_coord2d(BlockK, 0u), ldb);
-            auto count = k / BlockK;
+            auto count = ceilDiv(k, BlockK);
 
             // Accumulate A * B
             for(int i = 0; i < count; i++)
@@ -141,9 +153,10 @@ namespace rocwmma
                 auto fragA = FragA();
                 auto fragB = FragB();
 
-                // Load and multiply
-                load_matrix_sync(fragA, addrA, lda);
-                load_matrix_sync(fragB, addrB, ldb);
+                // Load and multiply. The K tail is zero-filled.
+                auto validK = k - i * BlockK;
+                load_matrix_sync(fragA, addrA, lda, validM, validK);
+                load_matrix_sync(fragB, addrB, ldb, validK, validN);
                 mma_sync(fragAcc, fragA, fragB, fragAcc);
 
                 addrA += incrA;
@@ -154,7 +167,7 @@ namespace rocwmma
 
             // Setup address and load C
             auto* addrC = MappingC::dataCoord(c, matrixCoordC, ldc);
-            load_matrix_sync(fragC, addrC, ldc);
+            load_matrix_sync(fragC, addrC, ldc, validM, validN);
 
             // D = alpha * accumAB + beta * C
 #pragma unroll
@@ -167,7 +180,7 @@ namespace rocwmma
             auto* addrD = MappingD::dataCoord(d, matrixCoordC, ldd);
 
             // Store the output
-            store_matrix_sync(addrD, fragC, ldd);
+            store_matrix_sync(addrD, fragC, ldd, validM, validN);
         }
     }
 } // namespace rocwmma
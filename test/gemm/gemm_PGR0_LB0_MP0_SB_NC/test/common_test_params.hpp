@@ -46,6 +46,21 @@ namespace rocwmma
         /// Kernel generator impl objects
         ///
         using KernelGeneratorImpl = KernelGenerator_PGR0_LB0_MP0_SB_NC;
+
+        // Add sizes that are not block multiples to exercise edge blocks
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            auto sizes = GemmCommonTestParams::problemSizes();
+            sizes.insert(sizes.end(),
+                         {
+                             // clang-format off
+                             {100, 100, 100},
+                             {65, 129, 40},
+                             {1000, 3007, 100},
+                             // clang-format on
+                         });
+            return sizes;
+        }
     };
 
 } // namespace rocwmma
@@ -0,0 +1,333 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "common.hpp"
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+#if defined(ROCWMMA_VALIDATE_WITH_ROCBLAS)
+#include "rocblas_reference.hpp" // rocBLAS GPU kernel
+#endif // ROCWMMA_VALIDATE_WITH_ROCBLAS
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD     = LayoutC,
+              typename ActivationT = epilogue::relu>
+    struct Kernel_PGR0_LB0_MP0_SB_NC_EP final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        static_assert(std::is_same<ActivationT, epilogue::relu>::value
+                          || std::is_same<ActivationT, epilogue::silu>::value,
+                      "Host reference epilogue supports relu and silu only");
+
+        // Kernels of this family take the bias vector after D.
+        // The generator below produces them with this signature, launched by launchKernel().
+        using EpilogueFunc = void (*)(uint32_t, // M
+                                      uint32_t, // N
+                                      uint32_t, // K
+                                      InputT const*, // A
+                                      InputT const*, // B
+                                      OutputT const*, // C
+                                      OutputT*, // D
+                                      OutputT const*, // Bias
+                                      uint32_t, // lda
+                                      uint32_t, // ldb
+                                      uint32_t, // ldc
+                                      uint32_t, // ldd
+                                      uint64_t, // strideA
+                                      uint64_t, // strideB
+                                      uint64_t, // strideC
+                                      uint64_t, // strideD
+                                      ComputeT, // Alpha
+                                      ComputeT); // Beta
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR0_LB0_MP0_SB_NC_EP_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return EpilogueFunc(gemm_PGR0_LB0_MP0_SB_NC_EP<BlockM,
+                                                                   BlockN,
+                                                                   BlockK,
+                                                                   InputT,
+                                                                   OutputT,
+                                                                   ComputeT,
+                                                                   LayoutA,
+                                                                   LayoutB,
+                                                                   LayoutC,
+                                                                   LayoutD,
+                                                                   ActivationT,
+                                                                   TBlockX,
+                                                                   TBlockY,
+                                                                   WaveSize,
+                                                                   ArchId>);
+                }
+                else
+                {
+                    return EpilogueFunc(nullptr);
+                }
+            }
+        };
+
+        // Small integers keep the biased reference exact in narrow output types
+        static OutputT biasValue(uint32_t col)
+        {
+            return static_cast<OutputT>(static_cast<int32_t>(col % 7u) - 3);
+        }
+
+        // Host mirror of the epilogue ops past alpha * AB + beta * C.
+        // Evaluated in fp32 (fp64 for fp64 compute), like the device activations.
+        OutputT epilogueValue(OutputT value, uint32_t col) const
+        {
+            using MathT = std::
+                conditional_t<std::is_same<ComputeT, float64_t>::value, float64_t, float32_t>;
+
+            auto x = static_cast<MathT>(value) + static_cast<MathT>(mHostBias[col]);
+
+            if constexpr(std::is_same<ActivationT, epilogue::relu>::value)
+            {
+                x = x > static_cast<MathT>(0) ? x : static_cast<MathT>(0);
+            }
+            else
+            {
+                x = x / (static_cast<MathT>(1) + std::exp(-x));
+            }
+
+            auto const upper = static_cast<MathT>(std::numeric_limits<OutputT>::max());
+            auto const lower = static_cast<MathT>(std::numeric_limits<OutputT>::lowest());
+            return static_cast<OutputT>(x > upper ? upper : (x < lower ? lower : x));
+        }
+
+        // Applies the epilogue in place to the plain gemm reference of all batch members
+        template <typename LayoutRef>
+        void applyEpilogue(OutputT* reference) const
+        {
+            auto ld = std::is_same<LayoutRef, row_major>::value ? Base::mN : Base::mM;
+
+            for(uint32_t batch = 0u; batch < Base::mBatchCount; ++batch)
+            {
+                auto* member = reference + batch * Base::mStrideD;
+#pragma omp parallel for
+                for(uint32_t row = 0u; row < Base::mM; ++row)
+                {
+                    for(uint32_t col = 0u; col < Base::mN; ++col)
+                    {
+                        auto offset = std::is_same<LayoutRef, row_major>::value
+                                          ? static_cast<uint64_t>(row) * ld + col
+                                          : static_cast<uint64_t>(col) * ld + row;
+                        member[offset] = epilogueValue(member[offset], col);
+                    }
+                }
+            }
+        }
+
+    public:
+        Kernel_PGR0_LB0_MP0_SB_NC_EP()
+            : mBias(HipResource::allocDevice<OutputT>(0))
+            , mHostBias(HipResource::allocHost<OutputT>(0))
+            , mBiasElements(0)
+        {
+        }
+        ~Kernel_PGR0_LB0_MP0_SB_NC_EP() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                // Only realloc if the current allocation won't fit
+                if(Base::mN > mBiasElements)
+                {
+                    HipResource::reallocDeviceHostPair(mBias, mHostBias, Base::mN);
+                    mBiasElements = Base::mN;
+                }
+
+                for(uint32_t col = 0u; col < Base::mN; ++col)
+                {
+                    mHostBias[col] = biasValue(col);
+                }
+
+                HipResource::copyData(mBias, mHostBias, Base::mN);
+            }
+        }
+
+        void launchKernel() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            hipExtLaunchKernelGGL(epilogueImpl(), // Kernel
+                                  (this->gridDim()), // Wg grid size
+                                  (this->blockDim()), // Thread block size
+                                  (this->ldsUsage()), // sharedMemBytes
+                                  0, // stream
+                                  nullptr, // Event start
+                                  nullptr, // event stop
+                                  0, // flags
+                                  this->mM, // M
+                                  this->mN, // N
+                                  this->mK, // K
+                                  dataInstance->deviceA().get(), // A*
+                                  dataInstance->deviceB().get(), // B*
+                                  dataInstance->deviceC().get(), // C*
+                                  dataInstance->deviceD().get(), // D*
+                                  mBias.get(), // Bias*
+                                  this->mLda, // lda
+                                  this->mLdb, // ldb
+                                  this->mLdc, // ldc
+                                  this->mLdd, // ldd
+                                  this->mStrideA, // strideA
+                                  this->mStrideB, // strideB
+                                  this->mStrideC, // strideC
+                                  this->mStrideD, // strideD
+                                  this->mAlpha, // alpha
+                                  this->mBeta); // beta
+        }
+
+        // The reference holds the plain gemm, which is what the reference cache
+        // keeps. Apply the epilogue to it before comparing.
+        void validateResults() final
+        {
+#if defined(ROCWMMA_VALIDATION_TESTS)
+            if(Base::mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+                auto  sizeD = std::get<Base::DataStorage::MatrixD>(Base::batchElements());
+
+#if defined(ROCWMMA_VALIDATE_WITH_ROCBLAS)
+                // The rocBLAS reference is col_major on device, see GemmKernelBase::exec()
+                if constexpr(quirks::rocblas_supported<InputT, OutputT, ComputeT>::value)
+                {
+                    auto reference = dataInstance->template allocHost<OutputT>(sizeD);
+                    dataInstance->copyData(reference, dataInstance->deviceD(), sizeD);
+                    applyEpilogue<col_major>(reference.get());
+                    dataInstance->copyData(dataInstance->deviceD(), reference, sizeD);
+                }
+                else
+#endif // ROCWMMA_VALIDATE_WITH_ROCBLAS
+                {
+                    applyEpilogue<LayoutD>(dataInstance->hostD().get());
+                }
+            }
+#endif // ROCWMMA_VALIDATION_TESTS
+
+            Base::validateResults();
+        }
+
+        // Full blocks only: the residual op reads C per element, unmasked
+        bool checkSizes() const final
+        {
+            return (Base::mM % BlockM == 0u) && (Base::mN % BlockN == 0u)
+                   && (Base::mK % BlockK == 0u);
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        EpilogueFunc epilogueImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR0_LB0_MP0_SB_NC_EP";
+            config.gemmConfig = dataTypeToString<ActivationT>();
+            return config;
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "Activation, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<ActivationT>() << ", ");
+        }
+
+    private:
+        HipResource::DevicePtrT<OutputT> mBias;
+        HipResource::HostPtrT<OutputT>   mHostBias;
+        int64_t                          mBiasElements;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
@@ -0,0 +1,297 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "common.hpp"
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD = LayoutC,
+              typename QuantT  = int4_t>
+    struct Kernel_PGR0_LB0_MP0_SB_NC_Q4 final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        // Kernels of this family take the packed B, zero point and scale in place of B.
+        // The generator below produces them with this signature, launched by launchKernel().
+        using QuantFunc = void (*)(uint32_t, // M
+                                   uint32_t, // N
+                                   uint32_t, // K
+                                   InputT const*, // A
+                                   uint8_t const*, // Packed B
+                                   OutputT const*, // C
+                                   OutputT*, // D
+                                   uint32_t, // lda
+                                   uint32_t, // ldp
+                                   uint32_t, // ldc
+                                   uint32_t, // ldd
+                                   ComputeT, // Alpha
+                                   ComputeT, // Beta
+                                   int32_t, // Zero point
+                                   InputT); // Scale
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR0_LB0_MP0_SB_NC_Q4_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return QuantFunc(gemm_PGR0_LB0_MP0_SB_NC_Q4<BlockM,
+                                                                BlockN,
+                                                                BlockK,
+                                                                InputT,
+                                                                OutputT,
+                                                                ComputeT,
+                                                                LayoutA,
+                                                                LayoutB,
+                                                                LayoutC,
+                                                                LayoutD,
+                                                                QuantT,
+                                                                TBlockX,
+                                                                TBlockY,
+                                                                WaveSize,
+                                                                ArchId>);
+                }
+                else
+                {
+                    return QuantFunc(nullptr);
+                }
+            }
+        };
+
+        // Packed B is K / 2 x N bytes in the layout of B
+        uint32_t ldp() const
+        {
+            return std::is_same<LayoutB, row_major>::value ? Base::mN : Base::mK / 2u;
+        }
+
+        // uint4 values are centered on their midpoint
+        int32_t zeroPoint() const
+        {
+            return std::is_same<QuantT, uint4_t>::value ? 8 : 0;
+        }
+
+        // int8 results are not scaled
+        float32_t scale() const
+        {
+            return std::is_same<InputT, int8_t>::value ? 1.0f : 0.5f;
+        }
+
+    public:
+        Kernel_PGR0_LB0_MP0_SB_NC_Q4()
+            : mPacked(HipResource::allocDevice<uint8_t>(0))
+            , mPackedElements(0)
+        {
+        }
+        ~Kernel_PGR0_LB0_MP0_SB_NC_Q4() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+                auto  sizeB        = static_cast<int64_t>(Base::mK) * Base::mN;
+                auto  rowMajorB    = std::is_same<LayoutB, row_major>::value;
+
+                // 4-bit values of B from the same random stream as the dense data
+                auto values = HipResource::allocHost<int8_t>(sizeB);
+                for(uint32_t row = 0u; row < Base::mK; row++)
+                {
+                    for(uint32_t col = 0u; col < Base::mN; col++)
+                    {
+                        auto nibble = Philox4x32::element(
+                                          PhiloxDefaultSeed, Base::DataStorage::MatrixB, row, col)
+                                      & 0xFu;
+                        auto offset = rowMajorB ? static_cast<uint64_t>(row) * Base::mLdb + col
+                                                : static_cast<uint64_t>(col) * Base::mLdb + row;
+                        values.get()[offset]
+                            = static_cast<int8_t>(PackedUnpack<QuantT>::value(nibble));
+                    }
+                }
+
+                auto packed = HipResource::allocHost<uint8_t>(sizeB / 2);
+                pack_int4<matrix_b, LayoutB>(
+                    packed.get(), values.get(), Base::mK, Base::mN, Base::mLdb, ldp());
+
+                // Only realloc if the current allocation won't fit
+                if(sizeB / 2 > mPackedElements)
+                {
+                    HipResource::reallocDevice(mPacked, sizeB / 2);
+                    mPackedElements = sizeB / 2;
+                }
+
+                HipResource::copyData(mPacked, packed, sizeB / 2);
+
+                // Dequantize B in place, so that the reference gemm sees the same values
+                dequantize_int4<QuantT, matrix_b, LayoutB>(dataInstance->hostB().get(),
+                                                           packed.get(),
+                                                           Base::mK,
+                                                           Base::mN,
+                                                           Base::mLdb,
+                                                           ldp(),
+                                                           zeroPoint(),
+                                                           scale());
+                dataInstance->copyData(dataInstance->deviceB(), dataInstance->hostB(), sizeB);
+            }
+        }
+
+        void launchKernel() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            hipExtLaunchKernelGGL(quantImpl(), // Kernel
+                                  (this->gridDim()), // Wg grid size
+                                  (this->blockDim()), // Thread block size
+                                  (this->ldsUsage()), // sharedMemBytes
+                                  0, // stream
+                                  nullptr, // Event start
+                                  nullptr, // event stop
+                                  0, // flags
+                                  this->mM, // M
+                                  this->mN, // N
+                                  this->mK, // K
+                                  dataInstance->deviceA().get(), // A*
+                                  mPacked.get(), // Packed B*
+                                  dataInstance->deviceC().get(), // C*
+                                  dataInstance->deviceD().get(), // D*
+                                  this->mLda, // lda
+                                  ldp(), // ldp
+                                  this->mLdc, // ldc
+                                  this->mLdd, // ldd
+                                  this->mAlpha, // alpha
+                                  this->mBeta, // beta
+                                  zeroPoint(), // zero point
+                                  static_cast<InputT>(scale())); // scale
+        }
+
+        // Full blocks only
+        bool checkSizes() const final
+        {
+            return (Base::mM % BlockM == 0u) && (Base::mN % BlockN == 0u)
+                   && (Base::mK % BlockK == 0u);
+        }
+
+        // Single gemm only: the packed B is not batched.
+        bool checkBatch() const final
+        {
+            return Base::mBatchCount == 1u;
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        QuantFunc quantImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR0_LB0_MP0_SB_NC_Q4";
+            config.gemmConfig = dataTypeToString<QuantT>();
+            return config;
+        }
+
+        std::string inputTag() const final
+        {
+            std::ostringstream tag;
+            tag << "quant:" << dataTypeToString<QuantT>() << ":" << zeroPoint() << ","
+                << scale();
+            return tag.str();
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "QuantT, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<QuantT>() << ", ");
+        }
+
+    private:
+        HipResource::DevicePtrT<uint8_t> mPacked;
+        int64_t                          mPackedElements;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
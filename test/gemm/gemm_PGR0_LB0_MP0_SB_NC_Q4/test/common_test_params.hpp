@@ -0,0 +1,66 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_PGR0_LB0_MP0_SB_NC_Q4;
+
+    ///
+    /// Generalized kernel params for packed 4-bit B tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_PGR0_LB0_MP0_SB_NC_Q4;
+
+        // Packed B unpacks into the int8 or f16 MFMA path
+        using TestTypesQuant = typename Concat<TestTypesI8, TestTypesF16>::Result;
+
+        // Packed types of B
+        using TestQuantTypes = std::tuple<std::tuple<int4_t>, std::tuple<uint4_t>>;
+
+        // Packed fragments unpack into at least 8 elements per lane,
+        // so BlockK starts at 32 for 16 x 16 blocks.
+        using TestBlockSizesQuant16x16 = std::tuple<std::tuple<I<16>, I<16>, I<32>>,
+                                                    std::tuple<I<16>, I<16>, I<64>>>;
+        using TestBlockSizesQuant32x32 = std::tuple<std::tuple<I<32>, I<32>, I<16>>,
+                                                    std::tuple<I<32>, I<32>, I<32>>>;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
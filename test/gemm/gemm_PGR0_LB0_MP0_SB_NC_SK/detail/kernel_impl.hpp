@@ -0,0 +1,348 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD    = LayoutC,
+              typename KPartition = PartitionK::SplitK4Ordered>
+    struct Kernel_PGR0_LB0_MP0_SB_NC_SK final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        // Kernels of this family take the workspace and flags after the usual arguments.
+        // The generators below produce them with this signature, launched by launchKernel().
+        using PartialKFunc = void (*)(uint32_t, // M
+                                      uint32_t, // N
+                                      uint32_t, // K
+                                      InputT const*, // A
+                                      InputT const*, // B
+                                      OutputT const*, // C
+                                      OutputT*, // D
+                                      uint32_t, // lda
+                                      uint32_t, // ldb
+                                      uint32_t, // ldc
+                                      uint32_t, // ldd
+                                      ComputeT, // Alpha
+                                      ComputeT, // Beta
+                                      ComputeT*, // Workspace
+                                      uint32_t*); // Flags
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR0_LB0_MP0_SB_NC_SK_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           KPartition,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return PartialKFunc(gemm_PGR0_LB0_MP0_SB_NC_SK<BlockM,
+                                                                   BlockN,
+                                                                   BlockK,
+                                                                   InputT,
+                                                                   OutputT,
+                                                                   ComputeT,
+                                                                   LayoutA,
+                                                                   LayoutB,
+                                                                   LayoutC,
+                                                                   LayoutD,
+                                                                   KPartition,
+                                                                   TBlockX,
+                                                                   TBlockY,
+                                                                   WaveSize,
+                                                                   ArchId>);
+                }
+                else
+                {
+                    return PartialKFunc(nullptr);
+                }
+            }
+        };
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestReduceFunc
+        {
+            static auto generate()
+            {
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return PartialKFunc(gemm_PGR0_LB0_MP0_SB_NC_SK_reduce<BlockM,
+                                                                          BlockN,
+                                                                          BlockK,
+                                                                          InputT,
+                                                                          OutputT,
+                                                                          ComputeT,
+                                                                          LayoutA,
+                                                                          LayoutB,
+                                                                          LayoutC,
+                                                                          LayoutD,
+                                                                          KPartition,
+                                                                          TBlockX,
+                                                                          TBlockY,
+                                                                          WaveSize,
+                                                                          ArchId>);
+                }
+                else
+                {
+                    return PartialKFunc(nullptr);
+                }
+            }
+        };
+
+        uint32_t wavesPerBlock() const
+        {
+            return Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * Base::mTBlockY;
+        }
+
+        uint32_t itersPerTile() const
+        {
+            return ceilDiv(Base::mK, BlockK);
+        }
+
+        // Split-K adds the partition to grid z, Stream-K runs
+        // one persistent workgroup per CU over the flattened iterations.
+        dim3 partialKGridDim() const
+        {
+            auto tileGrid = Base::gridDim();
+            if constexpr(KPartition::IsStreamK)
+            {
+                auto tiles      = static_cast<uint64_t>(tileGrid.x) * tileGrid.y;
+                auto totalIters = tiles * itersPerTile();
+                auto cuCount    = static_cast<uint64_t>(Base::DeviceInfo::instance()->cuCount());
+                return dim3(static_cast<uint32_t>(std::min(cuCount, totalIters)));
+            }
+            else
+            {
+                return dim3(tileGrid.x, tileGrid.y, KPartition::Splits);
+            }
+        }
+
+        // Workspace slots of BlockM x BlockN partials, see kernel_device_func.hpp
+        uint64_t workspaceSlots() const
+        {
+            auto tileGrid = Base::gridDim();
+            auto tiles    = static_cast<uint64_t>(tileGrid.x) * tileGrid.y;
+            auto ordered  = (KPartition::Mode == PartitionK::Reduce::Ordered);
+
+            if constexpr(KPartition::IsStreamK)
+            {
+                // One per wave of each workgroup if ordered, per block if atomic
+                return (ordered ? partialKGridDim().x : tiles) * wavesPerBlock();
+            }
+            else
+            {
+                // One per block, per partition if ordered
+                return tiles * wavesPerBlock() * (ordered ? KPartition::Splits : 1u);
+            }
+        }
+
+        // Stream-K flags or arrival counters, one per workspace slot
+        uint64_t flagCount() const
+        {
+            return KPartition::IsStreamK ? workspaceSlots() : 0u;
+        }
+
+    public:
+        Kernel_PGR0_LB0_MP0_SB_NC_SK()
+            : mWorkspace(HipResource::allocDevice<ComputeT>(0))
+            , mFlags(HipResource::allocDevice<uint32_t>(0))
+            , mWorkspaceElements(0)
+            , mFlagElements(0)
+        {
+        }
+        ~Kernel_PGR0_LB0_MP0_SB_NC_SK() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                // Only realloc if the current allocation won't fit
+                auto workspaceElements = workspaceSlots() * BlockM * BlockN;
+                if(workspaceElements > mWorkspaceElements)
+                {
+                    HipResource::reallocDevice(mWorkspace, workspaceElements);
+                    mWorkspaceElements = workspaceElements;
+                }
+
+                if(flagCount() > mFlagElements)
+                {
+                    HipResource::reallocDevice(mFlags, flagCount());
+                    mFlagElements = flagCount();
+                }
+            }
+        }
+
+        void launchKernel() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Atomic partials accumulate into zeroed slots
+            if constexpr(KPartition::Mode == PartitionK::Reduce::Atomic)
+            {
+                CHECK_HIP_ERROR(hipMemsetAsync(
+                    mWorkspace.get(), 0, workspaceSlots() * BlockM * BlockN * sizeof(ComputeT)));
+            }
+
+            if(flagCount() > 0u)
+            {
+                CHECK_HIP_ERROR(hipMemsetAsync(mFlags.get(), 0, flagCount() * sizeof(uint32_t)));
+            }
+
+            auto launch = [&](PartialKFunc kernelFunc, dim3 gridDim) {
+                hipExtLaunchKernelGGL(kernelFunc, // Kernel to launch
+                                      gridDim, // Wg grid size
+                                      (this->blockDim()), // Thread block size
+                                      (this->ldsUsage()), // sharedMemBytes
+                                      0, // stream
+                                      nullptr, // Event start
+                                      nullptr, // event stop
+                                      0, // flags
+                                      this->mM, // M
+                                      this->mN, // N
+                                      this->mK, // K
+                                      dataInstance->deviceA().get(), // A*
+                                      dataInstance->deviceB().get(), // B*
+                                      dataInstance->deviceC().get(), // C*
+                                      dataInstance->deviceD().get(), // D*
+                                      this->mLda, // lda
+                                      this->mLdb, // ldb
+                                      this->mLdc, // ldc
+                                      this->mLdd, // ldd
+                                      this->mAlpha, // alpha
+                                      this->mBeta, // beta
+                                      mWorkspace.get(), // workspace
+                                      mFlags.get()); // flags
+            };
+
+            launch(partialKImpl(), partialKGridDim());
+
+            // Stream-K completes its tiles in place
+            if constexpr(!KPartition::IsStreamK)
+            {
+                launch(Base::template dispatchKernelFunc<TestReduceFunc>(), Base::gridDim());
+            }
+        }
+
+        // Edge blocks are bounds-checked, so uneven sizes need no padding
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        // Single gemm only: grid z indexes the K splits instead.
+        bool checkBatch() const final
+        {
+            return Base::mBatchCount == 1u;
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        PartialKFunc partialKImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR0_LB0_MP0_SB_NC_SK";
+            config.gemmConfig = dataTypeToString<KPartition>();
+            return config;
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "KPartition, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<KPartition>() << ", ");
+        }
+
+    private:
+        HipResource::DevicePtrT<ComputeT> mWorkspace;
+        HipResource::DevicePtrT<uint32_t> mFlags;
+        uint64_t                          mWorkspaceElements, mFlagElements;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
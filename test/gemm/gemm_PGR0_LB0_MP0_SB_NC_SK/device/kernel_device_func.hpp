@@ -0,0 +1,531 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "kernel_partition.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// This class of kernel partitions the K loop of each output block
+    /// across workgroups, for problems with too few output blocks to
+    /// occupy the device (e.g. M = N = 256, K = 65536). Each wave is
+    /// responsible for a single block: BlockM x BlockN, for a part of K.
+    ///
+    /// Kernel behaviour is described by:
+    /// PGR0 = Prefetch Global Read = 0, no prefetch
+    /// LB0 = Lds Blocks = 0, no Lds usage
+    /// MP0 = Mfma Priority = 0, no setprio
+    /// SB = Single-block
+    /// NC = Non-cooperative
+    /// SK = K partitioned across workgroups, see KPartition
+    ///
+    /// Partial sums are kept in a ComputeT workspace, one BlockM x BlockN
+    /// slot per block in fragment register order. Each lane owns a strided
+    /// column of the slot, so transfers are coalesced and need no layout.
+    ///
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              uint32_t WaveSize>
+    struct GemmPartialK
+    {
+        using FragA   = fragment<matrix_a, BlockM, BlockN, BlockK, InputT, LayoutA>;
+        using FragB   = fragment<matrix_b, BlockM, BlockN, BlockK, InputT, LayoutB>;
+        using FragC   = fragment<accumulator, BlockM, BlockN, BlockK, OutputT, LayoutC>;
+        using FragAcc = fragment<accumulator, BlockM, BlockN, BlockK, ComputeT, LayoutD>;
+
+        using MappingA = MappingUtil<BlockM, BlockK, InputT, LayoutA>;
+        using MappingB = MappingUtil<BlockK, BlockN, InputT, LayoutB>;
+        using MappingC = MappingUtil<BlockM, BlockN, OutputT, LayoutC>;
+        using MappingD = MappingUtil<BlockM, BlockN, OutputT, LayoutD>;
+
+        using MatrixCoordT = typename MappingC::MatrixCoordT;
+
+        enum : uint32_t
+        {
+            // Workspace elements per output block
+            SlotSize = BlockM * BlockN
+        };
+
+        ROCWMMA_DEVICE static inline uint32_t laneId()
+        {
+            return threadIdx.x % WaveSize;
+        }
+
+        // Accumulates A * B over the K iterations [iterBegin, iterEnd) of the block
+        ROCWMMA_DEVICE static inline void mac(FragAcc&            fragAcc,
+                                              MatrixCoordT const& matrixCoordC,
+                                              uint32_t            iterBegin,
+                                              uint32_t            iterEnd,
+                                              uint32_t            m,
+                                              uint32_t            n,
+                                              uint32_t            k,
+                                              InputT const*       a,
+                                              InputT const*       b,
+                                              uint32_t            lda,
+                                              uint32_t            ldb)
+        {
+            // Edge blocks of uneven sizes are zero-filled beyond
+            // the remaining extent of the matrix.
+            auto validM = m - get<0>(matrixCoordC);
+            auto validN = n - get<1>(matrixCoordC);
+
+            auto  kBegin = iterBegin * BlockK;
+            auto* addrA = MappingA::dataCoord(a, make_coord2d(get<0>(matrixCoordC), kBegin), lda);
+            auto* addrB = MappingB::dataCoord(b, make_coord2d(kBegin, get<1>(matrixCoordC)), ldb);
+
+            auto incrA = MappingA::dataOffset(make_coord2d(0u, BlockK), lda);
+            auto incrB = MappingB::dataOffset(make_coord2d(BlockK, 0u), ldb);
+
+            for(auto i = iterBegin; i < iterEnd; i++)
+            {
+                auto fragA = FragA();
+                auto fragB = FragB();
+
+                // Load and multiply. The K tail is zero-filled.
+                auto validK = k - i * BlockK;
+                load_matrix_sync(fragA, addrA, lda, validM, validK);
+                load_matrix_sync(fragB, addrB, ldb, validK, validN);
+                mma_sync(fragAcc, fragA, fragB, fragAcc);
+
+                addrA += incrA;
+                addrB += incrB;
+            }
+        }
+
+        // D = alpha * accumAB + beta * C
+        ROCWMMA_DEVICE static inline void epilogue(FragAcc const&      fragAcc,
+                                                   MatrixCoordT const& matrixCoordC,
+                                                   uint32_t            m,
+                                                   uint32_t            n,
+                                                   OutputT const*      c,
+                                                   OutputT*            d,
+                                                   uint32_t            ldc,
+                                                   uint32_t            ldd,
+                                                   ComputeT            alpha,
+                                                   ComputeT            beta)
+        {
+            auto validM = m - get<0>(matrixCoordC);
+            auto validN = n - get<1>(matrixCoordC);
+
+            auto fragC = FragC();
+            load_matrix_sync(fragC, MappingC::dataCoord(c, matrixCoordC, ldc), ldc, validM, validN);
+
+#pragma unroll
+            for(int i = 0; i < fragC.num_elements; ++i)
+            {
+                fragC.x[i]
+                    = OutputT(alpha * ComputeT(fragAcc.x[i]) + beta * ComputeT(fragC.x[i]));
+            }
+
+            store_matrix_sync(
+                MappingD::dataCoord(d, matrixCoordC, ldd), fragC, ldd, validM, validN);
+        }
+
+        ROCWMMA_DEVICE static inline void storePartial(ComputeT* slot, FragAcc const& fragAcc)
+        {
+#pragma unroll
+            for(int i = 0; i < fragAcc.num_elements; ++i)
+            {
+                slot[i * WaveSize + laneId()] = fragAcc.x[i];
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void loadPartial(FragAcc& fragAcc, ComputeT const* slot)
+        {
+#pragma unroll
+            for(int i = 0; i < fragAcc.num_elements; ++i)
+            {
+                fragAcc.x[i] = slot[i * WaveSize + laneId()];
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void accumPartial(FragAcc& fragAcc, ComputeT const* slot)
+        {
+#pragma unroll
+            for(int i = 0; i < fragAcc.num_elements; ++i)
+            {
+                fragAcc.x[i] += slot[i * WaveSize + laneId()];
+            }
+        }
+
+        ROCWMMA_DEVICE static inline void atomicAddPartial(ComputeT* slot, FragAcc const& fragAcc)
+        {
+#pragma unroll
+            for(int i = 0; i < fragAcc.num_elements; ++i)
+            {
+                atomicAdd(slot + i * WaveSize + laneId(), fragAcc.x[i]);
+            }
+        }
+
+        // Publishes the partial sums stored before the flag
+        ROCWMMA_DEVICE static inline void signal(uint32_t* flag)
+        {
+            __hip_atomic_store(flag, 1u, __ATOMIC_RELEASE, __HIP_MEMORY_SCOPE_AGENT);
+        }
+
+        // Partial sums stored before the flag are visible on return
+        ROCWMMA_DEVICE static inline void wait(uint32_t* flag)
+        {
+            while(__hip_atomic_load(flag, __ATOMIC_ACQUIRE, __HIP_MEMORY_SCOPE_AGENT) == 0u)
+            {
+                __builtin_amdgcn_s_sleep(1);
+            }
+        }
+
+        // Adds iterations to the completion count of a block, returns the total
+        // including them. Partial sums added before are visible on return.
+        ROCWMMA_DEVICE static inline uint32_t arrive(uint32_t* counter, uint32_t iterations)
+        {
+            __threadfence();
+
+            uint32_t count = 0u;
+            if(laneId() == 0u)
+            {
+                count = atomicAdd(counter, iterations) + iterations;
+            }
+            count = __shfl(count, 0, WaveSize);
+
+            __threadfence();
+            return count;
+        }
+    };
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename KPartition,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256) gemm_PGR0_LB0_MP0_SB_NC_SK(uint32_t       m,
+                                                                      uint32_t       n,
+                                                                      uint32_t       k,
+                                                                      InputT const*  a,
+                                                                      InputT const*  b,
+                                                                      OutputT const* c,
+                                                                      OutputT*       d,
+                                                                      uint32_t       lda,
+                                                                      uint32_t       ldb,
+                                                                      uint32_t       ldc,
+                                                                      uint32_t       ldd,
+                                                                      ComputeT       alpha,
+                                                                      ComputeT       beta,
+                                                                      ComputeT*      workspace,
+                                                                      uint32_t*      flags)
+    {
+        if constexpr(gemm_PGR0_LB0_MP0_SB_NC_SK_guard<BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      OutputT,
+                                                      ComputeT,
+                                                      KPartition,
+                                                      TBlockX,
+                                                      TBlockY,
+                                                      WaveSize,
+                                                      ArchId>::enableBuild())
+        {
+            using Gemm = GemmPartialK<BlockM,
+                                      BlockN,
+                                      BlockK,
+                                      InputT,
+                                      OutputT,
+                                      ComputeT,
+                                      LayoutA,
+                                      LayoutB,
+                                      LayoutC,
+                                      LayoutD,
+                                      WaveSize>;
+
+            using MappingC = typename Gemm::MappingC;
+
+            constexpr auto IsOrdered = (KPartition::Mode == PartitionK::Reduce::Ordered);
+            constexpr auto WavesX    = TBlockX / WaveSize;
+            constexpr auto WavesY    = TBlockY;
+
+            auto itersPerTile = ceilDiv(k, BlockK);
+
+            if constexpr(!KPartition::IsStreamK)
+            {
+                // Target C / D block on 2D grid, K partition in grid z
+                auto matrixCoordC = MappingC::matrixCoord();
+
+                if(get<0>(matrixCoordC) >= m || get<1>(matrixCoordC) >= n)
+                {
+                    return;
+                }
+
+                auto itersPerSplit = ceilDiv(itersPerTile, KPartition::Splits);
+                auto iterBegin     = min(blockIdx.z * itersPerSplit, itersPerTile);
+                auto iterEnd       = min(iterBegin + itersPerSplit, itersPerTile);
+
+                auto fragAcc = typename Gemm::FragAcc();
+                fill_fragment(fragAcc, static_cast<ComputeT>(0));
+                Gemm::mac(fragAcc, matrixCoordC, iterBegin, iterEnd, m, n, k, a, b, lda, ldb);
+
+                // One workspace slot per grid block, per partition if ordered
+                auto blocksN = gridDim.y * WavesY;
+                auto blocks  = gridDim.x * WavesX * blocksN;
+                auto slot
+                    = get<0>(matrixCoordC) / BlockM * blocksN + get<1>(matrixCoordC) / BlockN;
+
+                if constexpr(IsOrdered)
+                {
+                    Gemm::storePartial(workspace + (blockIdx.z * blocks + slot) * Gemm::SlotSize,
+                                       fragAcc);
+                }
+                else
+                {
+                    Gemm::atomicAddPartial(workspace + slot * Gemm::SlotSize, fragAcc);
+                }
+            }
+            else
+            {
+                // Macro tiles of WavesX x WavesY blocks are linearized in row-major order
+                auto tilesN     = ceilDiv(n, BlockN * WavesY);
+                auto tiles      = ceilDiv(m, BlockM * WavesX) * tilesN;
+                auto totalIters = static_cast<uint64_t>(tiles) * itersPerTile;
+
+                // Even split of the iteration space, a non-empty range per workgroup
+                auto iterStart = [totalIters](uint32_t workgroup) {
+                    return static_cast<uint32_t>(totalIters * workgroup / gridDim.x);
+                };
+
+                auto waveX     = threadIdx.x / WaveSize;
+                auto waveY     = threadIdx.y;
+                auto waveIndex = waveX * WavesY + waveY;
+
+                auto iter    = iterStart(blockIdx.x);
+                auto iterEnd = iterStart(blockIdx.x + 1u);
+
+                while(iter < iterEnd)
+                {
+                    auto tile        = iter / itersPerTile;
+                    auto tileIter    = tile * itersPerTile;
+                    auto tileIterEnd = tileIter + itersPerTile;
+                    auto localEnd    = min(iterEnd, tileIterEnd);
+
+                    auto tileStarted = (iter == tileIter);
+                    auto tileEnded   = (iterEnd >= tileIterEnd);
+
+                    auto matrixCoordC = make_coord2d((tile / tilesN * WavesX + waveX) * BlockM,
+                                                     (tile % tilesN * WavesY + waveY) * BlockN);
+
+                    // Waves beyond the matrix have no counterpart in other workgroups
+                    if(get<0>(matrixCoordC) < m && get<1>(matrixCoordC) < n)
+                    {
+                        auto fragAcc = typename Gemm::FragAcc();
+                        fill_fragment(fragAcc, static_cast<ComputeT>(0));
+                        Gemm::mac(fragAcc,
+                                  matrixCoordC,
+                                  iter - tileIter,
+                                  localEnd - tileIter,
+                                  m,
+                                  n,
+                                  k,
+                                  a,
+                                  b,
+                                  lda,
+                                  ldb);
+
+                        if constexpr(IsOrdered)
+                        {
+                            // A workgroup stores partials at most once: for its first
+                            // tile, if it did not start it. Later tiles are all started.
+                            auto waveSlot = blockIdx.x * WavesX * WavesY + waveIndex;
+
+                            if(!tileStarted)
+                            {
+                                Gemm::storePartial(workspace + waveSlot * Gemm::SlotSize, fragAcc);
+                                Gemm::signal(flags + waveSlot);
+                            }
+                            else
+                            {
+                                // Sum the partials of the following workgroups in K order
+                                for(auto next = blockIdx.x + 1u;
+                                    !tileEnded && iterStart(next) < tileIterEnd;
+                                    next++)
+                                {
+                                    auto nextSlot = next * WavesX * WavesY + waveIndex;
+                                    Gemm::wait(flags + nextSlot);
+                                    Gemm::accumPartial(fragAcc,
+                                                       workspace + nextSlot * Gemm::SlotSize);
+                                }
+
+                                Gemm::epilogue(
+                                    fragAcc, matrixCoordC, m, n, c, d, ldc, ldd, alpha, beta);
+                            }
+                        }
+                        else
+                        {
+                            if(tileStarted && tileEnded)
+                            {
+                                Gemm::epilogue(
+                                    fragAcc, matrixCoordC, m, n, c, d, ldc, ldd, alpha, beta);
+                            }
+                            else
+                            {
+                                // The last workgroup to arrive completes the block
+                                auto blockSlot = tile * WavesX * WavesY + waveIndex;
+                                auto slot      = workspace + blockSlot * Gemm::SlotSize;
+
+                                Gemm::atomicAddPartial(slot, fragAcc);
+                                if(Gemm::arrive(flags + blockSlot, localEnd - iter)
+                                   == itersPerTile)
+                                {
+                                    Gemm::loadPartial(fragAcc, slot);
+                                    Gemm::epilogue(
+                                        fragAcc, matrixCoordC, m, n, c, d, ldc, ldd, alpha, beta);
+                                }
+                            }
+                        }
+                    }
+
+                    iter = tileIterEnd;
+                }
+            }
+        }
+    }
+
+    // Split-K reduction: sums the workspace partials of each block
+    // and applies D = alpha * accumAB + beta * C.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename KPartition,
+              uint32_t TBlockX,
+              uint32_t TBlockY,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256)
+        gemm_PGR0_LB0_MP0_SB_NC_SK_reduce(uint32_t       m,
+                                          uint32_t       n,
+                                          uint32_t       k,
+                                          InputT const*  a,
+                                          InputT const*  b,
+                                          OutputT const* c,
+                                          OutputT*       d,
+                                          uint32_t       lda,
+                                          uint32_t       ldb,
+                                          uint32_t       ldc,
+                                          uint32_t       ldd,
+                                          ComputeT       alpha,
+                                          ComputeT       beta,
+                                          ComputeT*      workspace,
+                                          uint32_t*      flags)
+    {
+        if constexpr(gemm_PGR0_LB0_MP0_SB_NC_SK_guard<BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      OutputT,
+                                                      ComputeT,
+                                                      KPartition,
+                                                      TBlockX,
+                                                      TBlockY,
+                                                      WaveSize,
+                                                      ArchId>::enableBuild())
+        {
+            using Gemm = GemmPartialK<BlockM,
+                                      BlockN,
+                                      BlockK,
+                                      InputT,
+                                      OutputT,
+                                      ComputeT,
+                                      LayoutA,
+                                      LayoutB,
+                                      LayoutC,
+                                      LayoutD,
+                                      WaveSize>;
+
+            using MappingC = typename Gemm::MappingC;
+
+            constexpr auto Slices = (KPartition::Mode == PartitionK::Reduce::Ordered)
+                                        ? KPartition::Splits
+                                        : 1u;
+
+            // Same grid as the partial K kernel, without grid z
+            auto matrixCoordC = MappingC::matrixCoord();
+
+            if(get<0>(matrixCoordC) >= m || get<1>(matrixCoordC) >= n)
+            {
+                return;
+            }
+
+            auto blocksN = gridDim.y * TBlockY;
+            auto blocks  = gridDim.x * TBlockX / WaveSize * blocksN;
+            auto slot    = get<0>(matrixCoordC) / BlockM * blocksN + get<1>(matrixCoordC) / BlockN;
+
+            auto fragAcc = typename Gemm::FragAcc();
+            fill_fragment(fragAcc, static_cast<ComputeT>(0));
+
+            for(uint32_t i = 0; i < Slices; i++)
+            {
+                Gemm::accumPartial(fragAcc, workspace + (i * blocks + slot) * Gemm::SlotSize);
+            }
+
+            Gemm::epilogue(fragAcc, matrixCoordC, m, n, c, d, ldc, ldd, alpha, beta);
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC
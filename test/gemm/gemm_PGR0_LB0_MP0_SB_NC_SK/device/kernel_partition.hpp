@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_PARTITION
+#define ROCWMMA_GEMM_TEST_DEVICE_PARTITION
+
+#include <rocwmma/internal/utils.hpp>
+
+namespace rocwmma
+{
+    ///
+    /// K partitioning strategies, assigning parts of the K loop of
+    /// the same output block to different workgroups.
+    ///
+    namespace PartitionK
+    {
+        // How the partial sums of an output block are combined
+        enum struct Reduce : uint32_t
+        {
+            // Atomic adds into a compute type workspace.
+            // Summation order, hence rounding, varies from run to run.
+            Atomic,
+
+            // Partial sums are kept apart and summed in K order.
+            // Results are bitwise reproducible.
+            Ordered
+        };
+
+        // Classic split-K: K iterations are split evenly into SplitCount
+        // partitions, one per workgroup in grid z. Partial sums are combined
+        // in a workspace, then a reduction kernel applies alpha / beta.
+        template <uint32_t SplitCount, Reduce ReduceMode>
+        struct SplitK
+        {
+            constexpr static bool     IsStreamK = false;
+            constexpr static uint32_t Splits    = SplitCount;
+            constexpr static Reduce   Mode      = ReduceMode;
+
+            static_assert(SplitCount > 0u, "SplitCount must be positive");
+        };
+
+        // Stream-K: a grid of one workgroup per CU evenly splits the flattened
+        // space of (macro tile, K iteration). Workgroups may share a macro tile,
+        // which is then completed by a fix-up:
+        // - Atomic: the last workgroup to add its partial sums applies alpha / beta.
+        // - Ordered: the workgroup holding the first K iteration waits for, and
+        //   sums the partials of the others. This relies on all workgroups of the
+        //   grid being co-resident.
+        template <Reduce ReduceMode>
+        struct StreamK
+        {
+            constexpr static bool     IsStreamK = true;
+            constexpr static uint32_t Splits    = 1u;
+            constexpr static Reduce   Mode      = ReduceMode;
+        };
+
+        using SplitK4Atomic   = SplitK<4u, Reduce::Atomic>;
+        using SplitK4Ordered  = SplitK<4u, Reduce::Ordered>;
+        using SplitK16Atomic  = SplitK<16u, Reduce::Atomic>;
+        using SplitK16Ordered = SplitK<16u, Reduce::Ordered>;
+        using StreamKAtomic   = StreamK<Reduce::Atomic>;
+        using StreamKOrdered  = StreamK<Reduce::Ordered>;
+
+    } // namespace PartitionK
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::SplitK4Atomic>()
+    {
+        return "SplitK4_Atomic";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::SplitK4Ordered>()
+    {
+        return "SplitK4_Ordered";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::SplitK16Atomic>()
+    {
+        return "SplitK16_Atomic";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::SplitK16Ordered>()
+    {
+        return "SplitK16_Ordered";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::StreamKAtomic>()
+    {
+        return "StreamK_Atomic";
+    }
+
+    template <>
+    constexpr const char* dataTypeToString<PartitionK::StreamKOrdered>()
+    {
+        return "StreamK_Ordered";
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_PARTITION
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_COMMON_TEST_PARAMS
+#define ROCWMMA_GEMM_COMMON_TEST_PARAMS
+
+#include "device/kernel_partition.hpp"
+#include "gemm_common_test_params.hpp"
+
+namespace rocwmma
+{
+    ///
+    /// FWD declarations
+    ///
+
+    class KernelGenerator_PGR0_LB0_MP0_SB_NC_SK;
+
+    ///
+    /// Generalized kernel params for most K partition tests
+    ///
+    struct CommonTestParams : public GemmCommonTestParams
+    {
+        ///
+        /// Kernel generator impl objects
+        ///
+        using KernelGeneratorImpl = KernelGenerator_PGR0_LB0_MP0_SB_NC_SK;
+
+        // K partitions in both reduction modes
+        using TestPartitions = std::tuple<std::tuple<PartitionK::SplitK4Atomic>,
+                                          std::tuple<PartitionK::SplitK4Ordered>,
+#if defined(ROCWMMA_EXTENDED_TESTS)
+                                          std::tuple<PartitionK::SplitK16Atomic>,
+                                          std::tuple<PartitionK::SplitK16Ordered>,
+#endif // ROCWMMA_EXTENDED_TESTS
+                                          std::tuple<PartitionK::StreamKAtomic>,
+                                          std::tuple<PartitionK::StreamKOrdered>>;
+
+        // K partitioning targets few output blocks over a long K,
+        // including uneven sizes that leave partial K partitions.
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            auto sizes = GemmCommonTestParams::problemSizes();
+            sizes.insert(sizes.end(),
+                         {
+                             // clang-format off
+                             {128, 128, 8192},
+                             {64, 256, 16384},
+                             {65, 129, 1000},
+                             {100, 100, 3000},
+#if !defined(ROCWMMA_VALIDATION_TESTS)
+                             {256, 256, 65536},
+                             {512, 512, 32768},
+#endif // !ROCWMMA_VALIDATION_TESTS
+                             // clang-format on
+                         });
+            return sizes;
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_COMMON_TEST_PARAMS
@@ -0,0 +1,268 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD = LayoutC>
+    struct Kernel_PGR0_LB0_MP0_SB_NC_SP final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        // Kernels of this family take the compressed A values and metadata in place of A.
+        // The generator below produces them with this signature, launched by launchKernel().
+        using SparseFunc = void (*)(uint32_t, // M
+                                    uint32_t, // N
+                                    uint32_t, // K
+                                    InputT const*, // A values
+                                    uint8_t const*, // A metadata
+                                    InputT const*, // B
+                                    OutputT const*, // C
+                                    OutputT*, // D
+                                    uint32_t, // ldv
+                                    uint32_t, // ldmeta
+                                    uint32_t, // ldb
+                                    uint32_t, // ldc
+                                    uint32_t, // ldd
+                                    ComputeT, // Alpha
+                                    ComputeT); // Beta
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR0_LB0_MP0_SB_NC_SP_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return SparseFunc(gemm_PGR0_LB0_MP0_SB_NC_SP<BlockM,
+                                                                 BlockN,
+                                                                 BlockK,
+                                                                 InputT,
+                                                                 OutputT,
+                                                                 ComputeT,
+                                                                 LayoutA,
+                                                                 LayoutB,
+                                                                 LayoutC,
+                                                                 LayoutD,
+                                                                 TBlockX,
+                                                                 TBlockY,
+                                                                 WaveSize,
+                                                                 ArchId>);
+                }
+                else
+                {
+                    return SparseFunc(nullptr);
+                }
+            }
+        };
+
+        // Compressed values are M x K / 2 in the layout of A
+        uint32_t ldv() const
+        {
+            return std::is_same<LayoutA, row_major>::value ? Base::mK / 2u : Base::mM;
+        }
+
+        // Metadata is row major M x K / 8 bytes
+        uint32_t ldMeta() const
+        {
+            return Base::mK / 8u;
+        }
+
+    public:
+        Kernel_PGR0_LB0_MP0_SB_NC_SP()
+            : mValues(HipResource::allocDevice<InputT>(0))
+            , mMeta(HipResource::allocDevice<uint8_t>(0))
+            , mValueElements(0)
+            , mMetaElements(0)
+        {
+        }
+        ~Kernel_PGR0_LB0_MP0_SB_NC_SP() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                auto& dataInstance = Base::DataStorage::instance();
+                auto  sizeA        = static_cast<int64_t>(Base::mM) * Base::mK;
+
+                // Prune A in place, so that the reference gemm sees the same sparse matrix
+                dataInstance->copyData(dataInstance->hostA(), dataInstance->deviceA(), sizeA);
+                prune_2to4<LayoutA>(dataInstance->hostA().get(), Base::mM, Base::mK, Base::mLda);
+                dataInstance->copyData(dataInstance->deviceA(), dataInstance->hostA(), sizeA);
+
+                auto values = HipResource::allocHost<InputT>(sizeA / 2);
+                auto meta   = HipResource::allocHost<uint8_t>(sizeA / 8);
+                compress_2to4<LayoutA>(values.get(),
+                                       meta.get(),
+                                       dataInstance->hostA().get(),
+                                       Base::mM,
+                                       Base::mK,
+                                       Base::mLda,
+                                       ldv(),
+                                       ldMeta());
+
+                // Only realloc if the current allocation won't fit
+                if(sizeA / 2 > mValueElements)
+                {
+                    HipResource::reallocDevice(mValues, sizeA / 2);
+                    mValueElements = sizeA / 2;
+                }
+
+                if(sizeA / 8 > mMetaElements)
+                {
+                    HipResource::reallocDevice(mMeta, sizeA / 8);
+                    mMetaElements = sizeA / 8;
+                }
+
+                HipResource::copyData(mValues, values, sizeA / 2);
+                HipResource::copyData(mMeta, meta, sizeA / 8);
+            }
+        }
+
+        void launchKernel() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            hipExtLaunchKernelGGL(sparseImpl(), // Kernel
+                                  (this->gridDim()), // Wg grid size
+                                  (this->blockDim()), // Thread block size
+                                  (this->ldsUsage()), // sharedMemBytes
+                                  0, // stream
+                                  nullptr, // Event start
+                                  nullptr, // event stop
+                                  0, // flags
+                                  this->mM, // M
+                                  this->mN, // N
+                                  this->mK, // K
+                                  mValues.get(), // A values*
+                                  mMeta.get(), // A metadata*
+                                  dataInstance->deviceB().get(), // B*
+                                  dataInstance->deviceC().get(), // C*
+                                  dataInstance->deviceD().get(), // D*
+                                  ldv(), // ldv
+                                  ldMeta(), // ldmeta
+                                  this->mLdb, // ldb
+                                  this->mLdc, // ldc
+                                  this->mLdd, // ldd
+                                  this->mAlpha, // alpha
+                                  this->mBeta); // beta
+        }
+
+        // Full blocks only, over whole metadata bytes of K
+        bool checkSizes() const final
+        {
+            return (Base::mM % BlockM == 0u) && (Base::mN % BlockN == 0u)
+                   && (Base::mK % BlockK == 0u) && (Base::mK % 8u == 0u);
+        }
+
+        // Single gemm only: the compressed A is not batched.
+        bool checkBatch() const final
+        {
+            return Base::mBatchCount == 1u;
+        }
+
+        bool checkQuirks() const final
+        {
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>();
+        }
+
+        SparseFunc sparseImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config   = Base::tuningConfig();
+            config.kernel = "PGR0_LB0_MP0_SB_NC_SP";
+            return config;
+        }
+
+        std::string inputTag() const final
+        {
+            return "prune:2:4";
+        }
+
+    private:
+        HipResource::DevicePtrT<InputT>  mValues;
+        HipResource::DevicePtrT<uint8_t> mMeta;
+        int64_t                          mValueElements, mMetaElements;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
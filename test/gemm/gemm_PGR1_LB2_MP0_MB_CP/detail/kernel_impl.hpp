@@ -136,7 +136,8 @@ namespace rocwmma
             return dim3(ceilDiv(Base::mM,
                                 BlockM * BlocksX * Base::mTBlockX
                                     / Base::DeviceInfo::instance()->warpSize()),
-                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
+                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY),
+                        Base::mBatchCount);
         }
 
         bool checkSizes() const final
@@ -156,8 +157,8 @@ namespace rocwmma
 
             // Cooperative workgroup kernels quirks
             auto wgQuirksCheck = true;
-            if(std::is_same<GemmConfig, CooperativeGemm::WorkgroupLevel::LdsNT>::value
-               || std::is_same<GemmConfig, CooperativeGemm::WorkgroupLevel::LdsTN>::value)
+            if(std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsTN, GemmConfig>::value)
             {
                 // TODO: Fp64 fails validation for BlockK > 16 for 16 x 16.
                 wgQuirksCheck &= !(std::is_same<InputT, float64_t>::value && (BlockM == 16)
@@ -166,8 +167,8 @@ namespace rocwmma
 
             // Cooperative wave kernels quirks
             auto waveQuirksCheck = true;
-            if(std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsNT>::value
-               || std::is_same<GemmConfig, CooperativeGemm::WaveLevel::LdsTN>::value)
+            if(std::is_base_of<CooperativeGemm::WaveLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WaveLevel::LdsTN, GemmConfig>::value)
             {
                 // TODO: On gfx90a, TN config with 4x4 blocks of 32 x 32 x 8
                 // Produces compile time issues
@@ -186,8 +187,8 @@ namespace rocwmma
         // Lds memory usage in bytes
         uint32_t ldsUsage() const final
         {
-            // Uses 2 lds blocks for prefetch loop
-            return 2 * sizeof(InputT)
+            // Uses one lds block per pipeline stage for prefetch loop
+            return GemmConfig::Pipeline::LdsStages * sizeof(InputT)
                    * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
                       + Base::mTBlockY * BlocksY * BlockN)
                    * BlockK;
@@ -198,6 +199,17 @@ namespace rocwmma
             return Base::template dispatchKernelFunc<TestKernelFunc>();
         }
 
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR1_LB2_MP0_MB_CP";
+            config.gemmConfig = dataTypeToString<GemmConfig>();
+            config.layoutLds  = dataTypeToString<LayoutLds>();
+            config.blocksX    = BlocksX;
+            config.blocksY    = BlocksY;
+            return config;
+        }
+
         std::ostream& printHeader(std::ostream& stream = std::cout) const final
         {
             return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, ");
@@ -49,6 +49,9 @@ namespace rocwmma
     /// MB = Multi-block output
     /// CP = Cooperative wave-wise global read
     ///
+    /// PGR / LB depths default to 1 / 2 and may be deepened
+    /// through the GemmConfig::Pipeline.
+    ///
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -78,6 +81,10 @@ namespace rocwmma
                                                                    uint32_t       ldb,
                                                                    uint32_t       ldc,
                                                                    uint32_t       ldd,
+                                                                   uint64_t       strideA,
+                                                                   uint64_t       strideB,
+                                                                   uint64_t       strideC,
+                                                                   uint64_t       strideD,
                                                                    ComputeT       alpha,
                                                                    ComputeT       beta)
     {
@@ -100,6 +107,13 @@ namespace rocwmma
                                                    WaveSize,
                                                    ArchId>::enableBuild())
         {
+            // Strided batch: grid z selects the batch member
+            auto batch = static_cast<uint64_t>(blockIdx.z);
+            a += batch * strideA;
+            b += batch * strideB;
+            c += batch * strideC;
+            d += batch * strideD;
+
             ///
             /// Assemble the gemm driver from the incoming gemm configuration
             ///
@@ -124,9 +138,8 @@ namespace rocwmma
             using GemmDriver     = typename GemmConfig::
                 template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
 
-            // Global fragments used in pre-fetching
-            using GRFragA = typename GlobalMapping::GRFragA;
-            using GRFragB = typename GlobalMapping::GRFragB;
+            using Pipeline = typename GemmConfig::Pipeline::
+                template Mainloop<GlobalMapping, LdsMapping, GemmDriver>;
 
             // Fragments for mfma
             using MfmaFragA   = typename GlobalMapping::MfmaFragA;
@@ -136,11 +149,10 @@ namespace rocwmma
             using MfmaFragAcc = typename GlobalMapping::MfmaFragAcc;
 
             // Mapping utils for each fragment type
-            using DataMappingA   = GetDataLayout_t<MfmaFragA>;
-            using DataMappingB   = GetDataLayout_t<MfmaFragB>;
-            using DataMappingC   = GetDataLayout_t<MfmaFragC>;
-            using DataMappingD   = GetDataLayout_t<MfmaFragD>;
-            using DataMappingLds = typename LdsMapping::DataLayout;
+            using DataMappingA = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD = GetDataLayout_t<MfmaFragD>;
 
             ///
             /// Target starting C / D macro tile matrix coordinate on 2D grid
@@ -172,42 +184,18 @@ namespace rocwmma
             auto globalWriteOffsetD
                 = DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(), ldd);
 
-            auto kStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
-            auto kStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
-
-            ///
-            /// Start global prefetch
-            ///
-            typename GlobalMapping::GRBuffA grBuffA;
-            typename GlobalMapping::GRBuffB grBuffB;
-            GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
-            GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
-            globalReadOffsetA += kStepOffsetA;
-            globalReadOffsetB += kStepOffsetB;
-
             ///
-            /// Setup LDS addressing
-            /// This kernel will use 2 separate LDS blocks
-            /// for pipelining in the accumulation loop
+            /// Setup the accumulation pipeline
+            /// This kernel will use Pipeline::LdsStages separate LDS blocks
+            /// and Pipeline::PrefetchStages global prefetch buffers
             ///
             HIP_DYNAMIC_SHARED(void*, localMemPtr);
-            auto  sizeLds  = LdsMapping::sizeLds();
-            auto* ldsPtrLo = reinterpret_cast<InputT*>(localMemPtr);
-            auto* ldsPtrHi = ldsPtrLo + get<0>(sizeLds) * get<1>(sizeLds);
-
-            auto ldlds = LdsMapping::ldLds();
-            auto ldsWriteOffsetA
-                = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
-            auto ldsWriteOffsetB
-                = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
-            auto ldsReadOffsetA = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
-            auto ldsReadOffsetB = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
-
-            ///
-            /// Write prefetch to local
-            ///
-            GemmDriver::localWriteCoopA(ldsPtrLo + ldsWriteOffsetA, grBuffA, ldlds);
-            GemmDriver::localWriteCoopB(ldsPtrLo + ldsWriteOffsetB, grBuffB, ldlds);
+            Pipeline pipeline(reinterpret_cast<InputT*>(localMemPtr),
+                              a + globalReadOffsetA,
+                              lda,
+                              b + globalReadOffsetB,
+                              ldb,
+                              k / BlockK);
 
             ///
             /// Initialize accumulation frags
@@ -216,44 +204,14 @@ namespace rocwmma
             GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
 
             ///
-            /// Synchronize waves and memory
+            /// Start global prefetch and write to local
             ///
-            GemmDriver::syncWorkgroup();
+            pipeline.prologue();
 
             ///
             /// Accumulate A * B
             ///
-            for(auto currentK = BlockK; currentK < k; currentK += BlockK)
-            {
-                typename GlobalMapping::MfmaBuffA fragsA;
-                typename GlobalMapping::MfmaBuffB fragsB;
-
-                // Local read mfma frags
-                GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
-                GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
-
-                // Start fetching next round of frags
-                GemmDriver::globalReadCoopA(grBuffA, a + globalReadOffsetA, lda);
-                GemmDriver::globalReadCoopB(grBuffB, b + globalReadOffsetB, ldb);
-
-                // Advance offsets to next k step
-                globalReadOffsetA += kStepOffsetA;
-                globalReadOffsetB += kStepOffsetB;
-
-                // accum(A * B)
-                GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
-
-                GemmDriver::localWriteCoopA(ldsPtrHi + ldsWriteOffsetA, grBuffA, ldlds);
-                GemmDriver::localWriteCoopB(ldsPtrHi + ldsWriteOffsetB, grBuffB, ldlds);
-
-                // Make sure that all waves have finished reading / writing to lds.
-                GemmDriver::syncWorkgroup();
-
-                // Swap Lds buffers
-                auto* tmp = ldsPtrLo;
-                ldsPtrLo  = ldsPtrHi;
-                ldsPtrHi  = tmp;
-            }
+            pipeline.accumulate(fragsAcc);
 
             ///
             /// Start loading C
@@ -265,13 +223,7 @@ namespace rocwmma
             ///
             /// Clean up tail A * B
             ///
-
-            typename GlobalMapping::MfmaBuffA fragsA;
-            typename GlobalMapping::MfmaBuffB fragsB;
-
-            GemmDriver::localReadA(fragsA, ldsPtrLo + ldsReadOffsetA, ldlds);
-            GemmDriver::localReadB(fragsB, ldsPtrLo + ldsReadOffsetB, ldlds);
-            GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+            pipeline.tail(fragsAcc);
 
             ///
             /// D = alpha * accum + beta * C
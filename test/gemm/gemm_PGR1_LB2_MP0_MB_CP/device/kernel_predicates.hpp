@@ -90,8 +90,10 @@ namespace rocwmma
             LdsRFTest = !(std::is_same_v<GemmConfig, typename CooperativeGemm::BlockLevel::LdsRF>)
                         || (((TBlockX / WaveSize) * TBlockY) == 1),
 
+            // Mfma frags for A / B plus each global prefetch stage
             CostABTest
-            = ((2u * ((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB))
+            = (((1u + (uint32_t)GemmConfig::Pipeline::PrefetchStages)
+                * ((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB))
                <= 256u),
             CostAccTest  = ((uint32_t)TestTraits::Cost::TileC <= 256u),
             CostTailTest = (((uint32_t)TestTraits::Cost::TileA + (uint32_t)TestTraits::Cost::TileB
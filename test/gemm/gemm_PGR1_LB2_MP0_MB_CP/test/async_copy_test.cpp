@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "test/test_includes.hpp"
+
+///
+/// Async copy test: stages the PGR1 / LB2 global reads with cooperative
+/// async copies straight into LDS, at block and workgroup levels.
+/// Async copies keep the global layout in LDS, so LdsNT requires
+/// LayoutLds == LayoutA == transposed LayoutB.
+/// Short K problems validate the pipeline prologue and drain.
+///
+
+// Instantiate referenced kernels for
+// async copy test only
+#include "gemm_kernel_base_impl.hpp"
+#include "gemm_resource_impl.hpp"
+namespace rocwmma
+{
+    bool KernelI::sHeaderPrinted = false;
+}
+
+namespace rocwmma
+{
+
+    struct TestParams : public CommonTestParams
+    {
+        using Base = CommonTestParams;
+
+        // Types: f16 and f32 inputs, f32 outputs
+        // Block Sizes: 16 x 16 x 32
+        // Layouts: NT
+        using Types      = std::tuple<std::tuple<float16_t, float32_t, float32_t>,
+                                      std::tuple<float32_t, float32_t, float32_t>>;
+        using BlockSizes = std::tuple<std::tuple<I<16>, I<16>, I<32>>>;
+        using Layouts    = std::tuple<std::tuple<col_major, row_major, row_major>>;
+        using LayoutsLds = std::tuple<col_major>;
+        using GemmConfigs
+            = std::tuple<typename CooperativeGemm::BlockLevel::LdsNT_AsyncCopy,
+                         typename CooperativeGemm::WorkgroupLevel::LdsNT_AsyncCopy>;
+        using BlocksXY = std::tuple<std::tuple<I<1>, I<1>>, std::tuple<I<2>, I<2>>>;
+        using KernelParams =
+            typename CombineLists<Types, BlockSizes, Layouts, LayoutsLds, GemmConfigs, BlocksXY>::
+                Result;
+
+        // Assemble the kernel generator
+        using GeneratorImpl   = KernelGeneratorImpl;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+
+            return {{warpSize, 1}, {warpSize * 2, 2}, {warpSize * 4, 1}};
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            return {
+                // Short K: prologue and drain only
+                {256, 256, 32},
+                {256, 256, 64},
+                {256, 256, 96},
+
+                // Long K
+                {512, 512, 512},
+                {1024, 1024, 1024},
+            };
+        }
+    };
+
+} // namespace rocwmma
+
+ROCWMMA_INSTANTIATE_GEMM_GTEST_SUITE(Gemm_PGR1_LB2_MP0_MB_CP,
+                                     AsyncCopyTest,
+                                     rocwmma::TestParams);
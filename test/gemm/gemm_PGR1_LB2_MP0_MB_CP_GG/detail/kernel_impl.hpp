@@ -0,0 +1,394 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_grouped.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1>
+    struct Kernel_PGR1_LB2_MP0_MB_CP_GG final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR1_LB2_MP0_MB_CP_GG_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           LayoutA,
+                                                           LayoutB,
+                                                           LayoutC,
+                                                           LayoutD,
+                                                           LayoutLds,
+                                                           GemmConfig,
+                                                           BlocksX,
+                                                           BlocksY,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        using ProblemT = GroupedGemm::Problem<InputT, OutputT>;
+
+        // The kernel takes the group descriptors instead of the usual arguments.
+        // The generator produces it with this signature, launched by launchKernel().
+        using GroupedFunc = void (*)(ProblemT const*, // Group descriptors
+                                     uint32_t const*, // Tile table
+                                     uint32_t, // Group count
+                                     ComputeT, // Alpha
+                                     ComputeT); // Beta
+
+        // The harness problem is cut into a grid of row slices x col bands.
+        // Each group is one cell, so that group M and N differ. Each row slice
+        // also takes its own K, see planGroups().
+        constexpr static uint32_t RowSlices  = 8u;
+        constexpr static uint32_t ColBands   = 3u;
+        constexpr static uint32_t GroupCount = RowSlices * ColBands;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return GroupedFunc(gemm_PGR1_LB2_MP0_MB_CP_GG<BlockM,
+                                                                  BlockN,
+                                                                  BlockK,
+                                                                  InputT,
+                                                                  OutputT,
+                                                                  ComputeT,
+                                                                  LayoutA,
+                                                                  LayoutB,
+                                                                  LayoutC,
+                                                                  LayoutD,
+                                                                  LayoutLds,
+                                                                  GemmConfig,
+                                                                  BlocksX,
+                                                                  BlocksY,
+                                                                  TBlockX,
+                                                                  TBlockY,
+                                                                  WaveSize,
+                                                                  ArchId>);
+                }
+                else
+                {
+                    return GroupedFunc(nullptr);
+                }
+            }
+        };
+
+        uint32_t macroTileM() const
+        {
+            return BlockM * BlocksX * Base::mTBlockX / Base::DeviceInfo::instance()->warpSize();
+        }
+
+        uint32_t macroTileN() const
+        {
+            return BlockN * BlocksY * Base::mTBlockY;
+        }
+
+        // Cuts the harness problem into groups over the cells of a grid of uneven
+        // row slices and col bands, none of them aligned to the macro tile.
+        // Row slice s only runs the first depths[s] steps of K: the rest of its rows
+        // of A are zeroed in setup(), so that together the groups still compute the
+        // reference result.
+        void planGroups()
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            using DataSpaceA = detail::DataSpace<LayoutA>;
+            using DataSpaceB = detail::DataSpace<LayoutB>;
+            using DataSpaceC = detail::DataSpace<LayoutC>;
+            using DataSpaceD = detail::DataSpace<LayoutD>;
+
+            auto a = dataInstance->deviceA().get();
+            auto b = dataInstance->deviceB().get();
+            auto c = dataInstance->deviceC().get();
+            auto d = dataInstance->deviceD().get();
+
+            auto heights = GroupedGemm::splitExtent(Base::mM, RowSlices);
+            auto widths  = GroupedGemm::splitExtent(Base::mN, ColBands);
+            auto depths  = GroupedGemm::splitDepths(Base::mK, RowSlices);
+
+            std::vector<ProblemT> problems;
+            uint32_t              row = 0u;
+            for(uint32_t s = 0u; s < RowSlices; s++)
+            {
+                uint32_t col = 0u;
+                for(uint32_t band = 0u; band < ColBands; band++)
+                {
+                    auto coordC = make_coord2d(row, col);
+                    problems.push_back(
+                        {heights[s],
+                         widths[band],
+                         depths[s],
+                         a + DataSpaceA::fromMatrixCoord(make_coord2d(row, 0u), Base::mLda),
+                         b + DataSpaceB::fromMatrixCoord(make_coord2d(0u, col), Base::mLdb),
+                         c + DataSpaceC::fromMatrixCoord(coordC, Base::mLdc),
+                         d + DataSpaceD::fromMatrixCoord(coordC, Base::mLdd),
+                         Base::mLda,
+                         Base::mLdb,
+                         Base::mLdc,
+                         Base::mLdd});
+                    col += widths[band];
+                }
+                row += heights[s];
+            }
+
+            auto tileTable = GroupedGemm::buildTileTable(problems, macroTileM(), macroTileN());
+            mTileCount     = tileTable.back();
+
+            CHECK_HIP_ERROR(hipMemcpy(mProblems.get(),
+                                      problems.data(),
+                                      sizeof(ProblemT) * problems.size(),
+                                      hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(mTileTable.get(),
+                                      tileTable.data(),
+                                      sizeof(uint32_t) * tileTable.size(),
+                                      hipMemcpyHostToDevice));
+        }
+
+        // Zeroes the K tail of A past each row slice's depth, in place,
+        // so that the reference gemm sees the same products as the groups.
+        void truncateSliceDepths()
+        {
+            using DataSpaceA = detail::DataSpace<LayoutA>;
+
+            auto& dataInstance = Base::DataStorage::instance();
+            auto  sizeA        = static_cast<int64_t>(Base::mM) * Base::mK;
+            auto  hostA        = dataInstance->hostA().get();
+
+            auto heights = GroupedGemm::splitExtent(Base::mM, RowSlices);
+            auto depths  = GroupedGemm::splitDepths(Base::mK, RowSlices);
+
+            dataInstance->copyData(dataInstance->hostA(), dataInstance->deviceA(), sizeA);
+
+            uint32_t row = 0u;
+            for(uint32_t s = 0u; s < RowSlices; s++)
+            {
+                for(auto r = row; r < row + heights[s]; r++)
+                {
+                    for(auto col = depths[s]; col < Base::mK; col++)
+                    {
+                        hostA[DataSpaceA::fromMatrixCoord(make_coord2d(r, col), Base::mLda)]
+                            = static_cast<InputT>(0);
+                    }
+                }
+                row += heights[s];
+            }
+
+            dataInstance->copyData(dataInstance->deviceA(), dataInstance->hostA(), sizeA);
+        }
+
+    public:
+        Kernel_PGR1_LB2_MP0_MB_CP_GG()
+            : mProblems(HipResource::allocDevice<ProblemT>(GroupCount))
+            , mTileTable(HipResource::allocDevice<uint32_t>(GroupCount + 1u))
+            , mTileCount(0)
+        {
+        }
+        ~Kernel_PGR1_LB2_MP0_MB_CP_GG() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                truncateSliceDepths();
+                planGroups();
+            }
+        }
+
+        void launchKernel() final
+        {
+            hipExtLaunchKernelGGL(groupedImpl(), // Kernel
+                                  dim3(mTileCount), // Wg grid size
+                                  (this->blockDim()), // Thread block size
+                                  (this->ldsUsage()), // sharedMemBytes
+                                  0, // stream
+                                  nullptr, // Event start
+                                  nullptr, // event stop
+                                  0, // flags
+                                  mProblems.get(), // Group descriptors
+                                  mTileTable.get(), // Tile table
+                                  GroupCount, // Group count
+                                  this->mAlpha, // alpha
+                                  this->mBeta); // beta
+        }
+
+        // Macro tile grid of the whole problem, as covered by all groups
+        dim3 gridDim() const final
+        {
+            return dim3(ceilDiv(Base::mM, macroTileM()), ceilDiv(Base::mN, macroTileN()));
+        }
+
+        // Edge tiles are bounds-checked, so uneven sizes need no padding
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        // Single gemm only: the grid walks the grouped tile table instead.
+        bool checkBatch() const final
+        {
+            return Base::mBatchCount == 1u;
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Don't run the kernel if the threadblock size is not supported
+            auto kernelImplCheck = (groupedImpl() != nullptr);
+
+            // Cooperative workgroup kernels quirks
+            auto wgQuirksCheck = true;
+            if(std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsTN, GemmConfig>::value)
+            {
+                // TODO: Fp64 fails validation for BlockK > 16 for 16 x 16.
+                wgQuirksCheck &= !(std::is_same<InputT, float64_t>::value && (BlockM == 16)
+                                   && (BlockN == 16) && (BlockK > 16) && (BlocksX * BlocksY >= 16));
+            }
+
+            // Cooperative wave kernels quirks
+            auto waveQuirksCheck = true;
+            if(std::is_base_of<CooperativeGemm::WaveLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WaveLevel::LdsTN, GemmConfig>::value)
+            {
+                // TODO: On gfx90a, TN config with 4x4 blocks of 32 x 32 x 8
+                // Produces compile time issues
+                waveQuirksCheck &= !((deviceArch == Base::DeviceInfo::GFX90A) && // GFX90A
+                                     (std::is_same<LayoutA, row_major>::value
+                                      && std::is_same<LayoutB, col_major>::value)
+                                     && // TN config
+                                     ((BlockM == BlockN == 32) && BlockK == 8) && // 32 x 32 x 8
+                                     (BlocksX == BlocksY == 4)); // BlocksX = 4, BlocksY = 4
+            }
+
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>()
+                   && kernelImplCheck && wgQuirksCheck && waveQuirksCheck;
+        }
+
+        // Lds memory usage in bytes
+        uint32_t ldsUsage() const final
+        {
+            // Uses one lds block per pipeline stage for prefetch loop
+            return GemmConfig::Pipeline::LdsStages * sizeof(InputT)
+                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
+                      + Base::mTBlockY * BlocksY * BlockN)
+                   * BlockK;
+        }
+
+        GroupedFunc groupedImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        std::string inputTag() const final
+        {
+            return "grouped_depths:" + std::to_string(RowSlices);
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR1_LB2_MP0_MB_CP_GG";
+            config.gemmConfig = dataTypeToString<GemmConfig>();
+            config.layoutLds  = dataTypeToString<LayoutLds>();
+            config.blocksX    = BlocksX;
+            config.blocksY    = BlocksY;
+            return config;
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, Groups, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
+                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
+                                            << ", " << BlocksY << ", " << GroupCount << ", ");
+        }
+
+    private:
+        HipResource::DevicePtrT<ProblemT> mProblems;
+        HipResource::DevicePtrT<uint32_t> mTileTable;
+        uint32_t                          mTileCount;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
@@ -0,0 +1,329 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "gemm_config.hpp"
+#include "gemm_grouped.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// Device function GEMM kernel:
+    ///
+    /// PGR1 = Prefetch Global Read, x1 step prefetch
+    /// LB2 = Lds Buffer, x2 buffers
+    /// MP0 = Mfma Priority, 0
+    /// MB = Multi-block output
+    /// CP = Cooperative wave-wise global read
+    /// GG = Grouped GEMM over an array of problem descriptors
+    ///
+    /// The flat grid covers the macro tiles of all groups. Each workgroup
+    /// looks up its group in the tile table (see GroupedGemm::findGroup),
+    /// then computes one macro tile of that group's D = alpha * A x B + beta * C.
+    /// Group sizes are arbitrary. Full macro tiles run the LDS pipeline with all
+    /// waves of the workgroup. Edge tiles, and all tiles of groups whose K is not
+    /// a multiple of BlockK, have each wave compute its own blocks straight from
+    /// global memory with bounds-checked loads and stores.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256)
+        gemm_PGR1_LB2_MP0_MB_CP_GG(GroupedGemm::Problem<InputT, OutputT> const* problems,
+                                   uint32_t const*                              tileTable,
+                                   uint32_t                                     groupCount,
+                                   ComputeT                                     alpha,
+                                   ComputeT                                     beta)
+    {
+        if constexpr(gemm_PGR1_LB2_MP0_MB_CP_GG_guard<BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      OutputT,
+                                                      ComputeT,
+                                                      LayoutA,
+                                                      LayoutB,
+                                                      LayoutC,
+                                                      LayoutD,
+                                                      LayoutLds,
+                                                      GemmConfig,
+                                                      BlocksX,
+                                                      BlocksY,
+                                                      TBlockX,
+                                                      TBlockY,
+                                                      WaveSize,
+                                                      ArchId>::enableBuild())
+        {
+            ///
+            /// Assemble the gemm driver from the incoming gemm configuration
+            ///
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY>;
+
+            using LdsMapping = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+            using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+            using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+            using GemmDriver     = typename GemmConfig::
+                template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+            using Pipeline = typename GemmConfig::Pipeline::
+                template Mainloop<GlobalMapping, LdsMapping, GemmDriver>;
+
+            // Macro tile order within each group
+            using RasterOrder = rocwmma::GlobalMapping::Rasterization::ColMajor;
+
+            // Fragments for mfma
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using MfmaFragC = typename GlobalMapping::MfmaFragC;
+            using MfmaFragD = typename GlobalMapping::MfmaFragD;
+
+            // Mapping utils for each fragment type
+            using DataMappingA = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD = GetDataLayout_t<MfmaFragD>;
+
+            ///
+            /// Locate this workgroup's group and macro tile within it
+            ///
+            auto tile = static_cast<uint32_t>(blockIdx.x);
+            if(tile >= tileTable[groupCount])
+            {
+                return;
+            }
+
+            auto        group   = GroupedGemm::findGroup(tileTable, groupCount, tile);
+            auto const& problem = problems[group];
+
+            auto m   = problem.m;
+            auto n   = problem.n;
+            auto k   = problem.k;
+            auto a   = problem.a;
+            auto b   = problem.b;
+            auto c   = problem.c;
+            auto d   = problem.d;
+            auto lda = problem.lda;
+            auto ldb = problem.ldb;
+            auto ldc = problem.ldc;
+            auto ldd = problem.ldd;
+
+            auto macroTileSize = GlobalMapping::macroTileSizeC();
+            auto tilesX        = GroupedGemm::tileDim(m, get<0>(macroTileSize));
+            auto tilesY        = GroupedGemm::tileDim(n, get<1>(macroTileSize));
+            auto wgCoord       = RasterOrder::tileCoord(tile - tileTable[group], tilesX, tilesY);
+
+            ///
+            /// Edge tile: the whole workgroup takes this branch, so that the
+            /// pipeline's workgroup barriers are never split.
+            ///
+            auto macroTileCoord = GlobalMapping::macroTileCoordC(wgCoord);
+            if(!GroupedGemm::isFullTile(m,
+                                        n,
+                                        k,
+                                        get<0>(macroTileCoord),
+                                        get<1>(macroTileCoord),
+                                        get<0>(macroTileSize),
+                                        get<1>(macroTileSize),
+                                        BlockK))
+            {
+                auto waveTileCoord = GlobalMapping::waveTileCoordC(wgCoord);
+
+                // Valid extent from coord within size. Zero past the edge,
+                // which zero-fills loads and drops stores.
+                auto valid = [](uint32_t coord, uint32_t size) {
+                    return coord < size ? size - coord : 0u;
+                };
+
+                typename GlobalMapping::MfmaBuffAcc fragsAcc;
+                GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+                for(uint32_t kStep = 0u; kStep < k; kStep += BlockK)
+                {
+                    typename GlobalMapping::MfmaBuffA fragsA;
+                    typename GlobalMapping::MfmaBuffB fragsB;
+
+#pragma unroll
+                    for(int i = 0; i < BlocksX; i++)
+                    {
+                        auto row = get<0>(waveTileCoord) + i * BlockM;
+                        load_matrix_sync(
+                            fragsA[i],
+                            a + DataMappingA::fromMatrixCoord(make_coord2d(row, kStep), lda),
+                            lda,
+                            valid(row, m),
+                            k - kStep);
+                    }
+
+#pragma unroll
+                    for(int j = 0; j < BlocksY; j++)
+                    {
+                        auto col = get<1>(waveTileCoord) + j * BlockN;
+                        load_matrix_sync(
+                            fragsB[j],
+                            b + DataMappingB::fromMatrixCoord(make_coord2d(kStep, col), ldb),
+                            ldb,
+                            k - kStep,
+                            valid(col, n));
+                    }
+
+                    GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+                }
+
+                typename GlobalMapping::MfmaBuffC fragsC;
+                typename GlobalMapping::MfmaBuffD fragsD;
+
+#pragma unroll
+                for(int i = 0; i < BlocksX; i++)
+                {
+#pragma unroll
+                    for(int j = 0; j < BlocksY; j++)
+                    {
+                        auto blockCoord = waveTileCoord + make_coord2d(i * BlockM, j * BlockN);
+                        load_matrix_sync(
+                            fragsC[i][j],
+                            c + DataMappingC::fromMatrixCoord(blockCoord, ldc),
+                            ldc,
+                            valid(get<0>(blockCoord), m),
+                            valid(get<1>(blockCoord), n));
+                    }
+                }
+
+                GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+
+#pragma unroll
+                for(int i = 0; i < BlocksX; i++)
+                {
+#pragma unroll
+                    for(int j = 0; j < BlocksY; j++)
+                    {
+                        auto blockCoord = waveTileCoord + make_coord2d(i * BlockM, j * BlockN);
+                        store_matrix_sync(d + DataMappingD::fromMatrixCoord(blockCoord, ldd),
+                                          fragsD[i][j],
+                                          ldd,
+                                          valid(get<0>(blockCoord), m),
+                                          valid(get<1>(blockCoord), n));
+                    }
+                }
+                return;
+            }
+
+            ///
+            /// Setup the accumulation pipeline on the group's matrices.
+            /// This kernel will use Pipeline::LdsStages separate LDS blocks
+            /// and Pipeline::PrefetchStages global prefetch buffers.
+            ///
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            Pipeline pipeline(
+                reinterpret_cast<InputT*>(localMemPtr),
+                a + DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(wgCoord), lda),
+                lda,
+                b + DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(wgCoord), ldb),
+                ldb,
+                k / BlockK);
+
+            ///
+            /// Initialize accumulation frags
+            ///
+            typename GlobalMapping::MfmaBuffAcc fragsAcc;
+            GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+            ///
+            /// Start global prefetch and write to local
+            ///
+            pipeline.prologue();
+
+            ///
+            /// Accumulate A * B
+            ///
+            pipeline.accumulate(fragsAcc);
+
+            ///
+            /// Start loading C
+            ///
+            typename GlobalMapping::MfmaBuffC fragsC;
+            GemmDriver::globalReadC(
+                fragsC,
+                c + DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(wgCoord), ldc),
+                ldc);
+
+            ///
+            /// Clean up tail A * B
+            ///
+            pipeline.tail(fragsAcc);
+
+            ///
+            /// D = alpha * accum + beta * C
+            ///
+            typename GlobalMapping::MfmaBuffD fragsD;
+            GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+            GemmDriver::globalWriteD(
+                d + DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(wgCoord), ldd),
+                fragsD,
+                ldd);
+        }
+    }
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC
@@ -0,0 +1,324 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+#define ROCWMMA_GEMM_TEST_DETAIL_KERNEL
+
+#include "device/kernel_device_func.hpp"
+#include "gemm_kernel_base.hpp"
+#include "helper_macros.hpp"
+
+namespace rocwmma
+{
+
+    // Wrapper into the actual device function
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t GroupM  = 1>
+    struct Kernel_PGR1_LB2_MP0_MB_CP_PT final : public GemmKernelBase<BlockM,
+                                                                      BlockN,
+                                                                      BlockK,
+                                                                      InputT,
+                                                                      OutputT,
+                                                                      ComputeT,
+                                                                      LayoutA,
+                                                                      LayoutB,
+                                                                      LayoutC,
+                                                                      LayoutD>
+    {
+    private:
+        using Base = GemmKernelBase<BlockM,
+                                    BlockN,
+                                    BlockK,
+                                    InputT,
+                                    OutputT,
+                                    ComputeT,
+                                    LayoutA,
+                                    LayoutB,
+                                    LayoutC,
+                                    LayoutD>;
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        using TestGuard = gemm_PGR1_LB2_MP0_MB_CP_PT_guard<BlockM,
+                                                           BlockN,
+                                                           BlockK,
+                                                           InputT,
+                                                           OutputT,
+                                                           ComputeT,
+                                                           LayoutA,
+                                                           LayoutB,
+                                                           LayoutC,
+                                                           LayoutD,
+                                                           LayoutLds,
+                                                           GemmConfig,
+                                                           BlocksX,
+                                                           BlocksY,
+                                                           TBlockX,
+                                                           TBlockY,
+                                                           WaveSize,
+                                                           ArchId>;
+
+        // The kernel takes the tile counter after the usual arguments. The generator
+        // produces it with this signature, launched by launchKernel().
+        using PersistentFunc = void (*)(uint32_t, // M
+                                        uint32_t, // N
+                                        uint32_t, // K
+                                        InputT const*, // A
+                                        InputT const*, // B
+                                        OutputT const*, // C
+                                        OutputT*, // D
+                                        uint32_t, // lda
+                                        uint32_t, // ldb
+                                        uint32_t, // ldc
+                                        uint32_t, // ldd
+                                        ComputeT, // Alpha
+                                        ComputeT, // Beta
+                                        uint32_t*); // Tile counter
+
+        template <uint32_t TBlockX, uint32_t TBlockY, uint32_t WaveSize, uint32_t ArchId>
+        struct TestKernelFunc
+        {
+            static auto generate()
+            {
+                // Avoid attempting to reference kernel functions that haven't passed
+                // predicate tests, as they won't be built!
+                if constexpr(TestGuard<TBlockX, TBlockY, WaveSize, ArchId>::enableRun())
+                {
+                    return PersistentFunc(gemm_PGR1_LB2_MP0_MB_CP_PT<BlockM,
+                                                                     BlockN,
+                                                                     BlockK,
+                                                                     InputT,
+                                                                     OutputT,
+                                                                     ComputeT,
+                                                                     LayoutA,
+                                                                     LayoutB,
+                                                                     LayoutC,
+                                                                     LayoutD,
+                                                                     LayoutLds,
+                                                                     GemmConfig,
+                                                                     BlocksX,
+                                                                     BlocksY,
+                                                                     GroupM,
+                                                                     TBlockX,
+                                                                     TBlockY,
+                                                                     WaveSize,
+                                                                     ArchId>);
+                }
+                else
+                {
+                    return PersistentFunc(nullptr);
+                }
+            }
+        };
+
+        // One wave of workgroups fills the device: as many as are resident per CU,
+        // but no more than there are macro tiles.
+        uint32_t persistentGridSize() const
+        {
+            auto tileGrid = gridDim();
+            auto tiles    = tileGrid.x * tileGrid.y;
+
+            int residentBlocks = 0;
+            CHECK_HIP_ERROR(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+                &residentBlocks,
+                reinterpret_cast<void const*>(persistentImpl()),
+                Base::mTBlockX * Base::mTBlockY,
+                ldsUsage()));
+
+            auto cuCount = static_cast<uint32_t>(Base::DeviceInfo::instance()->cuCount());
+            return std::min(cuCount * static_cast<uint32_t>(std::max(residentBlocks, 1)), tiles);
+        }
+
+    public:
+        Kernel_PGR1_LB2_MP0_MB_CP_PT()
+            : mTileCounter(HipResource::allocDevice<uint32_t>(1))
+            , mPersistentGridSize(0)
+        {
+        }
+        ~Kernel_PGR1_LB2_MP0_MB_CP_PT() final {}
+
+        void setup(ProblemParams const& problem) final
+        {
+            Base::setup(problem);
+
+            if(Base::mRunFlag)
+            {
+                mPersistentGridSize = persistentGridSize();
+            }
+        }
+
+        void launchKernel() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Restart the tile queue
+            CHECK_HIP_ERROR(hipMemsetAsync(mTileCounter.get(), 0, sizeof(uint32_t)));
+
+            hipExtLaunchKernelGGL(persistentImpl(), // Kernel
+                                  dim3(mPersistentGridSize), // Wg grid size
+                                  (this->blockDim()), // Thread block size
+                                  (this->ldsUsage()), // sharedMemBytes
+                                  0, // stream
+                                  nullptr, // Event start
+                                  nullptr, // event stop
+                                  0, // flags
+                                  this->mM, // M
+                                  this->mN, // N
+                                  this->mK, // K
+                                  dataInstance->deviceA().get(), // A*
+                                  dataInstance->deviceB().get(), // B*
+                                  dataInstance->deviceC().get(), // C*
+                                  dataInstance->deviceD().get(), // D*
+                                  this->mLda, // lda
+                                  this->mLdb, // ldb
+                                  this->mLdc, // ldc
+                                  this->mLdd, // ldd
+                                  this->mAlpha, // alpha
+                                  this->mBeta, // beta
+                                  mTileCounter.get()); // tile counter
+        }
+
+        // Macro tile grid, as processed by the persistent grid
+        dim3 gridDim() const final
+        {
+            return dim3(ceilDiv(Base::mM,
+                                BlockM * BlocksX * Base::mTBlockX
+                                    / Base::DeviceInfo::instance()->warpSize()),
+                        ceilDiv(Base::mN, BlockN * BlocksY * Base::mTBlockY));
+        }
+
+        // Waves of a workgroup take part in every tile, so there are no partial tiles
+        bool checkSizes() const final
+        {
+            return (Base::mM % (BlockM * BlocksX * Base::mTBlockX
+                                / Base::DeviceInfo::instance()->warpSize())
+                    == 0u)
+                   && (Base::mN % (BlockN * BlocksY * Base::mTBlockY) == 0u)
+                   && (Base::mK % BlockK == 0u);
+        }
+
+        // Single gemm only: persistent workgroups walk the tile queue of one problem.
+        bool checkBatch() const final
+        {
+            return Base::mBatchCount == 1u;
+        }
+
+        bool checkQuirks() const final
+        {
+            auto waveSize   = Base::DeviceInfo::instance()->warpSize();
+            auto deviceArch = Base::DeviceInfo::instance()->getGcnArch();
+
+            // Don't run the kernel if the threadblock size is not supported
+            auto kernelImplCheck = (persistentImpl() != nullptr);
+
+            // Cooperative workgroup kernels quirks
+            auto wgQuirksCheck = true;
+            if(std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WorkgroupLevel::LdsTN, GemmConfig>::value)
+            {
+                // TODO: Fp64 fails validation for BlockK > 16 for 16 x 16.
+                wgQuirksCheck &= !(std::is_same<InputT, float64_t>::value && (BlockM == 16)
+                                   && (BlockN == 16) && (BlockK > 16) && (BlocksX * BlocksY >= 16));
+            }
+
+            // Cooperative wave kernels quirks
+            auto waveQuirksCheck = true;
+            if(std::is_base_of<CooperativeGemm::WaveLevel::LdsNT, GemmConfig>::value
+               || std::is_base_of<CooperativeGemm::WaveLevel::LdsTN, GemmConfig>::value)
+            {
+                // TODO: On gfx90a, TN config with 4x4 blocks of 32 x 32 x 8
+                // Produces compile time issues
+                waveQuirksCheck &= !((deviceArch == Base::DeviceInfo::GFX90A) && // GFX90A
+                                     (std::is_same<LayoutA, row_major>::value
+                                      && std::is_same<LayoutB, col_major>::value)
+                                     && // TN config
+                                     ((BlockM == BlockN == 32) && BlockK == 8) && // 32 x 32 x 8
+                                     (BlocksX == BlocksY == 4)); // BlocksX = 4, BlocksY = 4
+            }
+
+            return Base::checkQuirks() && Base::template dispatchGuard<TestGuard>()
+                   && kernelImplCheck && wgQuirksCheck && waveQuirksCheck;
+        }
+
+        // Lds memory usage in bytes
+        uint32_t ldsUsage() const final
+        {
+            // Uses one lds block per pipeline stage for prefetch loop
+            return GemmConfig::Pipeline::LdsStages * sizeof(InputT)
+                   * (Base::mTBlockX / Base::DeviceInfo::instance()->warpSize() * BlocksX * BlockM
+                      + Base::mTBlockY * BlocksY * BlockN)
+                   * BlockK;
+        }
+
+        PersistentFunc persistentImpl() const
+        {
+            return Base::template dispatchKernelFunc<TestKernelFunc>();
+        }
+
+        GemmTuningConfig tuningConfig() const final
+        {
+            auto config       = Base::tuningConfig();
+            config.kernel     = "PGR1_LB2_MP0_MB_CP_PT";
+            config.gemmConfig = std::string(dataTypeToString<GemmConfig>()) + "_GroupM"
+                                + std::to_string(GroupM);
+            config.layoutLds  = dataTypeToString<LayoutLds>();
+            config.blocksX    = BlocksX;
+            config.blocksY    = BlocksY;
+            return config;
+        }
+
+        std::ostream& printHeader(std::ostream& stream = std::cout) const final
+        {
+            return Base::printHeader(stream << "GemmConfig, LytLds, BlocksX, BlocksY, GroupM, ");
+        }
+
+        std::ostream& printKernel(std::ostream& stream = std::cout) const final
+        {
+            return Base::printKernel(stream << dataTypeToString<GemmConfig>() << ", "
+                                            << dataTypeToString<LayoutLds>() << ", " << BlocksX
+                                            << ", " << BlocksY << ", " << GroupM << ", ");
+        }
+
+    private:
+        HipResource::DevicePtrT<uint32_t> mTileCounter;
+        uint32_t                          mPersistentGridSize;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DETAIL_KERNEL
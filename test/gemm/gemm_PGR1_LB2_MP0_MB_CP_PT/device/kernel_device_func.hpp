@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TEST_DEVICE_FUNC
+#define ROCWMMA_GEMM_TEST_DEVICE_FUNC
+
+// Silence warnings for calls on unsupported architectures.
+// Unsupported architectures will generate no-ops and test
+// will be avoided at runtime anyway.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "gemm_config.hpp"
+#include "kernel_predicates.hpp"
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+    ///
+    /// Work queue of macro tiles for persistent workgroups.
+    ///
+    /// Each workgroup starts on the tile of its own index, then pulls the
+    /// next tile from a global atomic counter that must be zeroed before launch.
+    /// Tiles are handed out in bands of GroupM macro tile rows, column by column
+    /// within a band, so that concurrent tiles share panels of A and B in L2.
+    /// GroupM = 1 is plain row-major order. See GlobalMapping::Rasterization::GroupedM.
+    ///
+    template <uint32_t GroupM>
+    struct PersistentTileQueue
+    {
+        // Workgroup coordinate of the macro tile at queue position tile
+        __device__ static inline auto tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+        {
+            return GlobalMapping::Rasterization::GroupedM<GroupM>::tileCoord(tile, tilesX, tilesY);
+        }
+
+        // Tiles below gridDim.x are taken by the first pass
+        __device__ static inline uint32_t next(uint32_t* counter)
+        {
+            return atomicAdd(counter, 1u) + gridDim.x;
+        }
+    };
+
+    ///
+    /// Device function GEMM kernel:
+    ///
+    /// PGR1 = Prefetch Global Read, x1 step prefetch
+    /// LB2 = Lds Buffer, x2 buffers
+    /// MP0 = Mfma Priority, 0
+    /// MB = Multi-block output
+    /// CP = Cooperative wave-wise global read
+    /// PT = Persistent workgroups pulling macro tiles from a queue
+    ///
+    /// The grid fills the device once. Each workgroup loops over macro tiles
+    /// from the PersistentTileQueue, reusing its LDS ring and pipeline state.
+    /// M and N must be multiples of the macro tile, and K of BlockK, so that
+    /// all waves take part in every tile.
+    ///
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD,
+              typename LayoutLds,
+              typename GemmConfig,
+              uint32_t BlocksX = 1,
+              uint32_t BlocksY = 1,
+              uint32_t GroupM  = 1,
+              uint32_t TBlockX = 0,
+              uint32_t TBlockY = 0,
+              uint32_t WaveSize,
+              uint32_t ArchId>
+    __global__ void __launch_bounds__(256) gemm_PGR1_LB2_MP0_MB_CP_PT(uint32_t       m,
+                                                                      uint32_t       n,
+                                                                      uint32_t       k,
+                                                                      InputT const*  a,
+                                                                      InputT const*  b,
+                                                                      OutputT const* c,
+                                                                      OutputT*       d,
+                                                                      uint32_t       lda,
+                                                                      uint32_t       ldb,
+                                                                      uint32_t       ldc,
+                                                                      uint32_t       ldd,
+                                                                      ComputeT       alpha,
+                                                                      ComputeT       beta,
+                                                                      uint32_t*      tileCounter)
+    {
+        if constexpr(gemm_PGR1_LB2_MP0_MB_CP_PT_guard<BlockM,
+                                                      BlockN,
+                                                      BlockK,
+                                                      InputT,
+                                                      OutputT,
+                                                      ComputeT,
+                                                      LayoutA,
+                                                      LayoutB,
+                                                      LayoutC,
+                                                      LayoutD,
+                                                      LayoutLds,
+                                                      GemmConfig,
+                                                      BlocksX,
+                                                      BlocksY,
+                                                      TBlockX,
+                                                      TBlockY,
+                                                      WaveSize,
+                                                      ArchId>::enableBuild())
+        {
+            ///
+            /// Assemble the gemm driver from the incoming gemm configuration
+            ///
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY>;
+
+            using LdsMapping = typename GemmConfig::template LdsMapping<GlobalMapping, LayoutLds>;
+            using CoopSchedulerA = typename GemmConfig::template CoopSchedulerA<TBlockX, TBlockY>;
+            using CoopSchedulerB = typename GemmConfig::template CoopSchedulerB<TBlockX, TBlockY>;
+            using GemmDriver     = typename GemmConfig::
+                template GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+            using Pipeline = typename GemmConfig::Pipeline::
+                template Mainloop<GlobalMapping, LdsMapping, GemmDriver>;
+
+            using TileQueue = PersistentTileQueue<GroupM>;
+
+            // Fragments for mfma
+            using MfmaFragA = typename GlobalMapping::MfmaFragA;
+            using MfmaFragB = typename GlobalMapping::MfmaFragB;
+            using MfmaFragC = typename GlobalMapping::MfmaFragC;
+            using MfmaFragD = typename GlobalMapping::MfmaFragD;
+
+            // Mapping utils for each fragment type
+            using DataMappingA = GetDataLayout_t<MfmaFragA>;
+            using DataMappingB = GetDataLayout_t<MfmaFragB>;
+            using DataMappingC = GetDataLayout_t<MfmaFragC>;
+            using DataMappingD = GetDataLayout_t<MfmaFragD>;
+
+            ///
+            /// Macro tile grid, sizes are macro tile multiples
+            ///
+            auto macroTileSize = GlobalMapping::macroTileSizeC();
+            auto tilesX        = m / get<0>(macroTileSize);
+            auto tilesY        = n / get<1>(macroTileSize);
+            auto tiles         = tilesX * tilesY;
+
+            auto tile = static_cast<uint32_t>(blockIdx.x);
+            if(tile >= tiles || BlockK > k)
+            {
+                return;
+            }
+
+            ///
+            /// Setup the accumulation pipeline once, on the first tile.
+            /// This kernel will use Pipeline::LdsStages separate LDS blocks
+            /// and Pipeline::PrefetchStages global prefetch buffers.
+            ///
+            auto wgCoord = TileQueue::tileCoord(tile, tilesX, tilesY);
+
+            HIP_DYNAMIC_SHARED(void*, localMemPtr);
+            Pipeline pipeline(
+                reinterpret_cast<InputT*>(localMemPtr),
+                a + DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(wgCoord), lda),
+                lda,
+                b + DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(wgCoord), ldb),
+                ldb,
+                k / BlockK);
+
+            // Next tile index, shared by all waves
+            __shared__ uint32_t nextTile;
+
+            while(true)
+            {
+                ///
+                /// Initialize accumulation frags
+                ///
+                typename GlobalMapping::MfmaBuffAcc fragsAcc;
+                GemmDriver::fill(fragsAcc, static_cast<ComputeT>(0));
+
+                ///
+                /// Start global prefetch and write to local
+                ///
+                pipeline.prologue();
+
+                // Claim the next tile early. The prologue barrier orders
+                // this write after every wave read the previous value.
+                if(threadIdx.x == 0 && threadIdx.y == 0)
+                {
+                    nextTile = TileQueue::next(tileCounter);
+                }
+
+                ///
+                /// Accumulate A * B
+                ///
+                pipeline.accumulate(fragsAcc);
+
+                ///
+                /// Start loading C
+                ///
+                typename GlobalMapping::MfmaBuffC fragsC;
+                GemmDriver::globalReadC(
+                    fragsC,
+                    c + DataMappingC::fromMatrixCoord(GlobalMapping::readCoordC(wgCoord), ldc),
+                    ldc);
+
+                ///
+                /// Clean up tail A * B
+                ///
+                pipeline.tail(fragsAcc);
+
+                ///
+                /// D = alpha * accum + beta * C
+                ///
+                typename GlobalMapping::MfmaBuffD fragsD;
+                GemmDriver::uniformFma(fragsD, alpha, fragsAcc, beta, fragsC);
+                GemmDriver::globalWriteD(
+                    d + DataMappingD::fromMatrixCoord(GlobalMapping::writeCoordD(wgCoord), ldd),
+                    fragsD,
+                    ldd);
+
+                ///
+                /// All waves are done reading LDS, and see the next tile
+                ///
+                GemmDriver::syncWorkgroup();
+
+                tile = nextTile;
+                if(tile >= tiles)
+                {
+                    break;
+                }
+
+                wgCoord = TileQueue::tileCoord(tile, tilesX, tilesY);
+                pipeline.retarget(
+                    a + DataMappingA::fromMatrixCoord(GlobalMapping::readCoordA(wgCoord), lda),
+                    b + DataMappingB::fromMatrixCoord(GlobalMapping::readCoordB(wgCoord), ldb));
+            }
+        }
+    }
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TEST_DEVICE_FUNC
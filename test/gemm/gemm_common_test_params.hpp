@@ -35,6 +35,7 @@
 #include "common.hpp"
 #include "gemm_kernel_base.hpp"
 #include "kernel_generator.hpp"
+#include "rocwmma_logging.hpp"
 
 namespace rocwmma
 {
@@ -289,6 +290,7 @@ namespace rocwmma
         using ProblemSizeT = std::tuple<int64_t, int64_t, int64_t>;
         using AlphaT       = float64_t;
         using BetaT        = float64_t;
+        using BatchCountT  = int64_t;
 
         static inline std::vector<ThreadBlockT> threadBlocks()
         {
@@ -341,6 +343,15 @@ namespace rocwmma
             };
         }
 
+        // Sizes given with --problem_sizes replace the defaults, e.g. to
+        // sweep specific shapes when tuning
+        static inline std::vector<ProblemSizeT>
+            resolveProblemSizes(std::vector<ProblemSizeT> const& defaults)
+        {
+            auto const& sizes = RocwmmaLogging::instance()->problemSizes();
+            return sizes.empty() ? defaults : std::vector<ProblemSizeT>(sizes.begin(), sizes.end());
+        }
+
         static inline std::vector<AlphaT> alphas()
         {
             return {static_cast<AlphaT>(2)};
@@ -350,6 +361,56 @@ namespace rocwmma
         {
             return {static_cast<BetaT>(2)};
         }
+
+        // Single gemm by default. Batched suites select the lists below
+        // through GemmBatchedTestParams.
+        static inline std::vector<BatchCountT> batchCounts()
+        {
+            return {static_cast<BatchCountT>(1)};
+        }
+
+        // Strided-batched workloads: many small problems in one launch,
+        // where a single gemm cannot fill the device.
+        static inline std::vector<ProblemSizeT> batchedProblemSizes()
+        {
+            return {
+                // clang-format off
+                {64, 64, 64},
+                {128, 128, 128},
+                {256, 128, 64},
+                // clang-format on
+            };
+        }
+
+        static inline std::vector<BatchCountT> batchedCounts()
+        {
+            return
+            {
+                // clang-format off
+                3, 128,
+#if !defined(ROCWMMA_VALIDATION_TESTS)
+                1024, 4096,
+#endif // !ROCWMMA_VALIDATION_TESTS
+                // clang-format on
+            };
+        }
+    };
+
+    ///
+    /// Re-targets a family's test params at the strided-batched problem lists
+    ///
+    template <typename TestParams>
+    struct GemmBatchedTestParams : public TestParams
+    {
+        static inline std::vector<typename TestParams::ProblemSizeT> problemSizes()
+        {
+            return TestParams::batchedProblemSizes();
+        }
+
+        static inline std::vector<typename TestParams::BatchCountT> batchCounts()
+        {
+            return TestParams::batchedCounts();
+        }
     };
 
 } // namespace rocwmma
@@ -37,6 +37,7 @@
 #include "gemm_driver.hpp"
 #include "gemm_global_mapping.hpp"
 #include "gemm_local_mapping.hpp"
+#include "gemm_pipeline.hpp"
 
 #define __ROCWMMA_GEMM_LAUNCH_BOUNDS__ __launch_bounds__(Constants::AMDGCN_WAVE_SIZE * 4u)
 
@@ -76,7 +77,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX = 0,
-                          uint32_t TBlockY = 0>
+                          uint32_t TBlockY = 0,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::BlockLevelMapping<BlockM,
                                                                        BlockN,
                                                                        BlockK,
@@ -90,7 +92,8 @@ namespace rocwmma
                                                                        BlocksX,
                                                                        BlocksY,
                                                                        TBlockX,
-                                                                       TBlockY>;
+                                                                       TBlockY,
+                                                                       RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
@@ -107,6 +110,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
             struct LdsTN
@@ -124,7 +129,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX = 0,
-                          uint32_t TBlockY = 0>
+                          uint32_t TBlockY = 0,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::BlockLevelMapping<BlockM,
                                                                        BlockN,
                                                                        BlockK,
@@ -138,7 +144,8 @@ namespace rocwmma
                                                                        BlocksX,
                                                                        BlocksY,
                                                                        TBlockX,
-                                                                       TBlockY>;
+                                                                       TBlockY,
+                                                                       RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
@@ -155,6 +162,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
             struct LdsRF
@@ -172,7 +181,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX = 0,
-                          uint32_t TBlockY = 0>
+                          uint32_t TBlockY = 0,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::BlockLevelMapping<BlockM,
                                                                        BlockN,
                                                                        BlockK,
@@ -186,7 +196,8 @@ namespace rocwmma
                                                                        BlocksX,
                                                                        BlocksY,
                                                                        TBlockX,
-                                                                       TBlockY>;
+                                                                       TBlockY,
+                                                                       RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingRF<GlobalMapping, LayoutLds>;
@@ -203,6 +214,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
         } // BlockLevel
@@ -235,7 +248,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX = 0,
-                          uint32_t TBlockY = 0>
+                          uint32_t TBlockY = 0,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::WaveLevelMapping<BlockM,
                                                                       BlockN,
                                                                       BlockK,
@@ -249,7 +263,8 @@ namespace rocwmma
                                                                       BlocksX,
                                                                       BlocksY,
                                                                       TBlockX,
-                                                                      TBlockY>;
+                                                                      TBlockY,
+                                                                      RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
@@ -266,6 +281,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
             struct LdsTN
@@ -283,7 +300,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX = 0,
-                          uint32_t TBlockY = 0>
+                          uint32_t TBlockY = 0,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::WaveLevelMapping<BlockM,
                                                                       BlockN,
                                                                       BlockK,
@@ -297,7 +315,8 @@ namespace rocwmma
                                                                       BlocksX,
                                                                       BlocksY,
                                                                       TBlockX,
-                                                                      TBlockY>;
+                                                                      TBlockY,
+                                                                      RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
@@ -314,6 +333,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
         } // namespace WaveLevel
@@ -347,7 +368,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX,
-                          uint32_t TBlockY>
+                          uint32_t TBlockY,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::WorkgroupLevelMapping<BlockM,
                                                                            BlockN,
                                                                            BlockK,
@@ -361,7 +383,8 @@ namespace rocwmma
                                                                            BlocksX,
                                                                            BlocksY,
                                                                            TBlockX,
-                                                                           TBlockY>;
+                                                                           TBlockY,
+                                                                           RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingNT<GlobalMapping, LayoutLds>;
@@ -378,6 +401,8 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
             struct LdsTN
@@ -395,7 +420,8 @@ namespace rocwmma
                           uint32_t BlocksX,
                           uint32_t BlocksY,
                           uint32_t TBlockX,
-                          uint32_t TBlockY>
+                          uint32_t TBlockY,
+                          typename RasterOrder = GlobalMapping::Rasterization::ColMajor>
                 using GlobalMapping = GlobalMapping::WorkgroupLevelMapping<BlockM,
                                                                            BlockN,
                                                                            BlockK,
@@ -409,7 +435,8 @@ namespace rocwmma
                                                                            BlocksX,
                                                                            BlocksY,
                                                                            TBlockX,
-                                                                           TBlockY>;
+                                                                           TBlockY,
+                                                                           RasterOrder>;
 
                 template <typename GlobalMapping, typename LayoutLds>
                 using LdsMapping = LocalMapping::LdsMappingTN<GlobalMapping, LayoutLds>;
@@ -426,10 +453,166 @@ namespace rocwmma
                           typename CoopSchedulerB>
                 using GemmDriver
                     = GemmDriver<GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB>;
+
+                using Pipeline = CooperativeGemm::Pipeline::LdsRing<1u, 2u>;
             };
 
         } // namespace WorkgroupLevel
 
+        /* Cache policy GEMMs:
+        *  Wraps any of the above GEMM configurations and overrides the cache
+        *  policies of the global reads of A, B and C and the global writes of D.
+        *  Data movement through LDS is unaffected.
+        */
+        template <typename GemmConfig,
+                  typename CachePolicyA,
+                  typename CachePolicyB,
+                  typename CachePolicyC,
+                  typename CachePolicyD>
+        struct CachePolicyConfig : public GemmConfig
+        {
+            template <typename GlobalMapping,
+                      typename LdsMapping,
+                      typename CoopSchedulerA,
+                      typename CoopSchedulerB>
+            using GemmDriver = CooperativeGemm::GemmDriver<GlobalMapping,
+                                                           LdsMapping,
+                                                           CoopSchedulerA,
+                                                           CoopSchedulerB,
+                                                           CachePolicyA,
+                                                           CachePolicyB,
+                                                           CachePolicyC,
+                                                           CachePolicyD>;
+        };
+
+        namespace WorkgroupLevel
+        {
+            // Pointer IO only applies the non-temporal policy: the coherent bits
+            // of cache_streaming need buffer loads / stores.
+
+            // D is written exactly once: keep it from evicting A / B tiles in L2
+            using LdsNT_NtD = CachePolicyConfig<LdsNT,
+                                                cache_default,
+                                                cache_default,
+                                                cache_default,
+                                                cache_nontemporal>;
+
+            // C and D are each touched exactly once
+            using LdsNT_NtCD = CachePolicyConfig<LdsNT,
+                                                 cache_default,
+                                                 cache_default,
+                                                 cache_nontemporal,
+                                                 cache_nontemporal>;
+
+            // Tall-skinny problems: A has little reuse across workgroups
+            using LdsNT_NtA_NtCD = CachePolicyConfig<LdsNT,
+                                                     cache_nontemporal,
+                                                     cache_default,
+                                                     cache_nontemporal,
+                                                     cache_nontemporal>;
+
+        } // namespace WorkgroupLevel
+
+        /* Pipeline GEMMs:
+        *  Wraps any of the above GEMM configurations and overrides the depth of
+        *  the accumulation pipeline: the count of global prefetch stages held in
+        *  registers and the count of LDS buffers. Deeper pipelines hide more
+        *  global read latency for large K at the cost of registers and LDS.
+        *
+        *  AsyncCopy stages global reads with cooperative async copies straight
+        *  into LDS. LDS layouts must then match the global layouts of A and B.
+        */
+        template <typename GemmConfig,
+                  uint32_t PrefetchStages,
+                  uint32_t LdsStages,
+                  bool     AsyncCopy = false>
+        struct PipelineConfig : public GemmConfig
+        {
+            using Pipeline
+                = CooperativeGemm::Pipeline::LdsRing<PrefetchStages, LdsStages, AsyncCopy>;
+        };
+
+        namespace BlockLevel
+        {
+            // PGR1 / LB2 with global reads copied straight into LDS
+            using LdsNT_AsyncCopy = PipelineConfig<LdsNT, 1u, 2u, true>;
+
+        } // namespace BlockLevel
+
+        namespace WorkgroupLevel
+        {
+            // PGR1 / LB2 with global reads copied straight into LDS
+            using LdsNT_AsyncCopy = PipelineConfig<LdsNT, 1u, 2u, true>;
+
+            // Two tiles in flight, buffered in registers
+            using LdsNT_PGR2_LB2 = PipelineConfig<LdsNT, 2u, 2u>;
+
+            // Two tiles in flight, buffered in LDS
+            using LdsNT_PGR1_LB3 = PipelineConfig<LdsNT, 1u, 3u>;
+
+            // Three tiles in flight
+            using LdsNT_PGR2_LB3 = PipelineConfig<LdsNT, 2u, 3u>;
+
+        } // namespace WorkgroupLevel
+
+        /* Rasterization GEMMs:
+        *  Wraps any of the above GEMM configurations and overrides the order in
+        *  which macro tiles are assigned to workgroups (GlobalMapping::Rasterization).
+        *  Orders that keep concurrent workgroups on few macro tile rows and cols
+        *  improve L2 reuse of A and B on large problems.
+        */
+        template <typename GemmConfig, typename RasterOrder>
+        struct RasterizationConfig : public GemmConfig
+        {
+            template <uint32_t BlockM,
+                      uint32_t BlockN,
+                      uint32_t BlockK,
+                      typename InputT,
+                      typename OutputT,
+                      typename ComputeT,
+                      typename LayoutA,
+                      typename LayoutB,
+                      typename LayoutC,
+                      typename LayoutD,
+                      uint32_t BlocksX,
+                      uint32_t BlocksY,
+                      uint32_t TBlockX = 0,
+                      uint32_t TBlockY = 0>
+            using GlobalMapping = typename GemmConfig::template GlobalMapping<BlockM,
+                                                                              BlockN,
+                                                                              BlockK,
+                                                                              InputT,
+                                                                              OutputT,
+                                                                              ComputeT,
+                                                                              LayoutA,
+                                                                              LayoutB,
+                                                                              LayoutC,
+                                                                              LayoutD,
+                                                                              BlocksX,
+                                                                              BlocksY,
+                                                                              TBlockX,
+                                                                              TBlockY,
+                                                                              RasterOrder>;
+        };
+
+        namespace WorkgroupLevel
+        {
+            // Consecutive workgroups walk along a row of macro tiles
+            using LdsNT_RowMajor
+                = RasterizationConfig<LdsNT, GlobalMapping::Rasterization::RowMajor>;
+
+            // Bands of 8 macro tile rows
+            using LdsNT_GroupedM8
+                = RasterizationConfig<LdsNT, GlobalMapping::Rasterization::GroupedM<8u>>;
+
+            // 8 x 8 macro tile super tiles in Z-order / along a Hilbert curve
+            using LdsNT_Morton8
+                = RasterizationConfig<LdsNT, GlobalMapping::Rasterization::Morton<8u>>;
+            using LdsNT_Hilbert8
+                = RasterizationConfig<LdsNT, GlobalMapping::Rasterization::Hilbert<8u>>;
+
+        } // namespace WorkgroupLevel
+
     } // namespace CooperativeGemm
 
     template <>
@@ -474,6 +657,90 @@ namespace rocwmma
         return "Workgroup_LdsTN";
     }
 
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_NtD>()
+    {
+        return "Workgroup_LdsNT_NtD";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_NtCD>()
+    {
+        return "Workgroup_LdsNT_NtCD";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_NtA_NtCD>()
+    {
+        return "Workgroup_LdsNT_NtA_NtCD";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::BlockLevel::LdsNT_AsyncCopy>()
+    {
+        return "Block_LdsNT_AsyncCopy";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_AsyncCopy>()
+    {
+        return "Workgroup_LdsNT_AsyncCopy";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_PGR2_LB2>()
+    {
+        return "Workgroup_LdsNT_PGR2_LB2";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_PGR1_LB3>()
+    {
+        return "Workgroup_LdsNT_PGR1_LB3";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_PGR2_LB3>()
+    {
+        return "Workgroup_LdsNT_PGR2_LB3";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_RowMajor>()
+    {
+        return "Workgroup_LdsNT_RowMajor";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_GroupedM8>()
+    {
+        return "Workgroup_LdsNT_GroupedM8";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_Morton8>()
+    {
+        return "Workgroup_LdsNT_Morton8";
+    }
+
+    template <>
+    constexpr const char*
+        dataTypeToString<typename CooperativeGemm::WorkgroupLevel::LdsNT_Hilbert8>()
+    {
+        return "Workgroup_LdsNT_Hilbert8";
+    }
+
 } // namespace rocwmma
 
 #endif // GEMM_CONFIG_HPP
@@ -33,7 +33,8 @@ namespace rocwmma
     * device code. It implements workflow steps using meta-data information
     * from Global, Lds and Scheduler classes. It enables either Block-Level,
     * Wave-Level or Workgroup-Level kernel workflows based on ADL and input
-    * fragment types.
+    * fragment types. Cache policies for global reads of A, B and C and global
+    * writes of D may be set independently, e.g. to stream D past the L2 cache.
     */
 
     namespace CooperativeGemm
@@ -41,7 +42,11 @@ namespace rocwmma
         template <typename GlobalMapping,
                   typename LdsMapping,
                   typename CoopSchedulerA,
-                  typename CoopSchedulerB>
+                  typename CoopSchedulerB,
+                  typename CachePolicyA = cache_default,
+                  typename CachePolicyB = cache_default,
+                  typename CachePolicyC = cache_default,
+                  typename CachePolicyD = cache_default>
         struct GemmDriver
         {
             // Global fragment types
@@ -165,6 +170,49 @@ namespace rocwmma
                                                           GRFragB const&          grFragB,
                                                           uint32_t                ldlds);
 
+            // Global A/B to local copies in cooperative async mode.
+            // Each copy must be completed by the matching wait on the same GR frags,
+            // which stage the data in registers where LDS-direct loads are unavailable.
+            template <uint32_t BlocksX>
+            __device__ static inline void copyCoopAsyncA(GetDataType_t<GRFragA>* ldsAddr,
+                                                         GRFragA (&grFragsA)[BlocksX],
+                                                         GetDataType_t<GRFragA> const* gAddrA,
+                                                         uint32_t                      lda,
+                                                         uint32_t                      ldlds);
+            __device__ static inline void copyCoopAsyncA(GetDataType_t<GRFragA>*       ldsAddr,
+                                                         GRFragA&                      grFragA,
+                                                         GetDataType_t<GRFragA> const* gAddrA,
+                                                         uint32_t                      lda,
+                                                         uint32_t                      ldlds);
+
+            template <uint32_t BlocksY>
+            __device__ static inline void copyCoopAsyncB(GetDataType_t<GRFragB>* ldsAddr,
+                                                         GRFragB (&grFragsB)[BlocksY],
+                                                         GetDataType_t<GRFragB> const* gAddrB,
+                                                         uint32_t                      ldb,
+                                                         uint32_t                      ldlds);
+            __device__ static inline void copyCoopAsyncB(GetDataType_t<GRFragB>*       ldsAddr,
+                                                         GRFragB&                      grFragB,
+                                                         GetDataType_t<GRFragB> const* gAddrB,
+                                                         uint32_t                      ldb,
+                                                         uint32_t                      ldlds);
+
+            template <uint32_t BlocksX>
+            __device__ static inline void waitCoopAsyncA(GetDataType_t<GRFragA>* ldsAddr,
+                                                         GRFragA const (&grFragsA)[BlocksX],
+                                                         uint32_t ldlds);
+            __device__ static inline void waitCoopAsyncA(GetDataType_t<GRFragA>* ldsAddr,
+                                                         GRFragA const&          grFragA,
+                                                         uint32_t                ldlds);
+
+            template <uint32_t BlocksY>
+            __device__ static inline void waitCoopAsyncB(GetDataType_t<GRFragB>* ldsAddr,
+                                                         GRFragB const (&grFragsB)[BlocksY],
+                                                         uint32_t ldlds);
+            __device__ static inline void waitCoopAsyncB(GetDataType_t<GRFragB>* ldsAddr,
+                                                         GRFragB const&          grFragB,
+                                                         uint32_t                ldlds);
+
             // Local A read non-cooperative
             // Single or BlocksX frags
             template <uint32_t BlocksX>
@@ -45,6 +45,8 @@ namespace rocwmma
                       typename CoopSchedulerB,
                       uint32_t SplitCountA,
                       uint32_t SplitCountB,
+                      typename CachePolicyA,
+                      typename CachePolicyB,
                       bool     UseCompileTimeConstants
                       = Schedule::WaveCountIsConstexpr<CoopSchedulerA>::value&&
                           Schedule::WaveCountIsConstexpr<CoopSchedulerB>::value>
@@ -53,8 +55,16 @@ namespace rocwmma
             template <typename CoopSchedulerA,
                       typename CoopSchedulerB,
                       uint32_t SplitCountA,
-                      uint32_t SplitCountB>
-            struct CoopApiSelector<CoopSchedulerA, CoopSchedulerB, SplitCountA, SplitCountB, true>
+                      uint32_t SplitCountB,
+                      typename CachePolicyA,
+                      typename CachePolicyB>
+            struct CoopApiSelector<CoopSchedulerA,
+                                   CoopSchedulerB,
+                                   SplitCountA,
+                                   SplitCountB,
+                                   CachePolicyA,
+                                   CachePolicyB,
+                                   true>
             {
                 template <typename GRFragA>
                 __device__ static inline void globalReadCoopA(GRFragA&                      grFragA,
@@ -62,7 +72,8 @@ namespace rocwmma
                                                               uint32_t                      lda)
                 {
                     rocwmma::template load_matrix_coop_sync<CoopSchedulerA::waveCount(),
-                                                            SplitCountA>(
+                                                            SplitCountA,
+                                                            CachePolicyA>(
                         grFragA, gAddrA, lda, CoopSchedulerA::waveIndex());
                 }
 
@@ -72,7 +83,8 @@ namespace rocwmma
                                                               uint32_t                      ldb)
                 {
                     rocwmma::template load_matrix_coop_sync<CoopSchedulerB::waveCount(),
-                                                            SplitCountB>(
+                                                            SplitCountB,
+                                                            CachePolicyB>(
                         grFragB, gAddrB, ldb, CoopSchedulerB::waveIndex());
                 }
 
@@ -95,25 +107,75 @@ namespace rocwmma
                                                              SplitCountB>(
                         ldsAddr, lwFragB, ldlds, CoopSchedulerB::waveIndex());
                 }
+
+                template <typename LWFragA>
+                __device__ static inline void copyCoopAsyncA(GetDataType_t<LWFragA>*       ldsAddr,
+                                                             LWFragA&                      lwFragA,
+                                                             GetDataType_t<LWFragA> const* gAddrA,
+                                                             uint32_t                      lda,
+                                                             uint32_t                      ldlds)
+                {
+                    rocwmma::template copy_matrix_coop_async<CoopSchedulerA::waveCount(),
+                                                             CachePolicyA>(
+                        lwFragA, ldsAddr, ldlds, gAddrA, lda, CoopSchedulerA::waveIndex());
+                }
+
+                template <typename LWFragB>
+                __device__ static inline void copyCoopAsyncB(GetDataType_t<LWFragB>*       ldsAddr,
+                                                             LWFragB&                      lwFragB,
+                                                             GetDataType_t<LWFragB> const* gAddrB,
+                                                             uint32_t                      ldb,
+                                                             uint32_t                      ldlds)
+                {
+                    rocwmma::template copy_matrix_coop_async<CoopSchedulerB::waveCount(),
+                                                             CachePolicyB>(
+                        lwFragB, ldsAddr, ldlds, gAddrB, ldb, CoopSchedulerB::waveIndex());
+                }
+
+                template <typename LWFragA>
+                __device__ static inline void waitCoopAsyncA(GetDataType_t<LWFragA>* ldsAddr,
+                                                             LWFragA const&          lwFragA,
+                                                             uint32_t                ldlds)
+                {
+                    rocwmma::template wait_matrix_coop_async<CoopSchedulerA::waveCount()>(
+                        lwFragA, ldsAddr, ldlds, CoopSchedulerA::waveIndex());
+                }
+
+                template <typename LWFragB>
+                __device__ static inline void waitCoopAsyncB(GetDataType_t<LWFragB>* ldsAddr,
+                                                             LWFragB const&          lwFragB,
+                                                             uint32_t                ldlds)
+                {
+                    rocwmma::template wait_matrix_coop_async<CoopSchedulerB::waveCount()>(
+                        lwFragB, ldsAddr, ldlds, CoopSchedulerB::waveIndex());
+                }
             };
 
             template <typename CoopSchedulerA,
                       typename CoopSchedulerB,
                       uint32_t SplitCountA,
-                      uint32_t SplitCountB>
-            struct CoopApiSelector<CoopSchedulerA, CoopSchedulerB, SplitCountA, SplitCountB, false>
+                      uint32_t SplitCountB,
+                      typename CachePolicyA,
+                      typename CachePolicyB>
+            struct CoopApiSelector<CoopSchedulerA,
+                                   CoopSchedulerB,
+                                   SplitCountA,
+                                   SplitCountB,
+                                   CachePolicyA,
+                                   CachePolicyB,
+                                   false>
             {
                 template <typename GRFragA>
                 __device__ static inline void globalReadCoopA(GRFragA&                      grFragA,
                                                               GetDataType_t<GRFragA> const* gAddrA,
                                                               uint32_t                      lda)
                 {
-                    rocwmma::load_matrix_coop_sync(grFragA,
-                                                   gAddrA,
-                                                   lda,
-                                                   CoopSchedulerA::waveIndex(),
-                                                   CoopSchedulerA::waveCount(),
-                                                   SplitCountA);
+                    rocwmma::load_matrix_coop_sync<CachePolicyA>(grFragA,
+                                                                 gAddrA,
+                                                                 lda,
+                                                                 CoopSchedulerA::waveIndex(),
+                                                                 CoopSchedulerA::waveCount(),
+                                                                 SplitCountA);
                 }
 
                 template <typename GRFragB>
@@ -121,12 +183,12 @@ namespace rocwmma
                                                               GetDataType_t<GRFragB> const* gAddrB,
                                                               uint32_t                      ldb)
                 {
-                    rocwmma::load_matrix_coop_sync(grFragB,
-                                                   gAddrB,
-                                                   ldb,
-                                                   CoopSchedulerB::waveIndex(),
-                                                   CoopSchedulerB::waveCount(),
-                                                   SplitCountB);
+                    rocwmma::load_matrix_coop_sync<CachePolicyB>(grFragB,
+                                                                 gAddrB,
+                                                                 ldb,
+                                                                 CoopSchedulerB::waveIndex(),
+                                                                 CoopSchedulerB::waveCount(),
+                                                                 SplitCountB);
                 }
 
                 template <typename LWFragA>
@@ -155,12 +217,26 @@ namespace rocwmma
                                                     SplitCountB);
                 }
             };
+
+            // Async copies move blocks into LDS as laid out in global memory. The LW frag
+            // must therefore keep the memory layout of the GR frag, at most transposed.
+            template <typename GRFragT, typename LWFragT>
+            struct IsAsyncCopyable
+                : public std::integral_constant<
+                      bool,
+                      std::is_same<LWFragT, GRFragT>::value
+                          || std::is_same<LWFragT, ApplyTranspose_t<GRFragT>>::value>
+            {
+            };
         }
 
-#define GemmDriverT \
-    typename GlobalMapping, typename LdsMapping, typename CoopSchedulerA, typename CoopSchedulerB
+#define GemmDriverT                                                                              \
+    typename GlobalMapping, typename LdsMapping, typename CoopSchedulerA, typename CoopSchedulerB, \
+        typename CachePolicyA, typename CachePolicyB, typename CachePolicyC, typename CachePolicyD
 
-#define GemmDriverT_impl GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB
+#define GemmDriverT_impl                                                                     \
+    GlobalMapping, LdsMapping, CoopSchedulerA, CoopSchedulerB, CachePolicyA, CachePolicyB, \
+        CachePolicyC, CachePolicyD
 
         template <GemmDriverT>
         template <uint32_t BlocksX>
@@ -179,8 +255,12 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::globalReadCoopA(
             GRFragA& grFragA, GetDataType_t<GRFragA> const* gAddrA, uint32_t lda)
         {
-            using CoopApiSelector
-                = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
             CoopApiSelector::globalReadCoopA(grFragA, gAddrA, lda);
         }
 
@@ -201,8 +281,12 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::globalReadCoopB(
             GRFragB& grFragB, GetDataType_t<GRFragB> const* gAddrB, uint32_t ldb)
         {
-            using CoopApiSelector
-                = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
             CoopApiSelector::globalReadCoopB(grFragB, gAddrB, ldb);
         }
 
@@ -223,8 +307,12 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopA(
             GetDataType_t<GRFragA>* ldsAddr, GRFragA const& grFragA, uint32_t ldlds)
         {
-            using CoopApiSelector
-                = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
             CoopApiSelector::localWriteCoopA(
                 ldsAddr, reinterpret_cast<LWFragA const&>(grFragA), ldlds);
         }
@@ -246,12 +334,154 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::localWriteCoopB(
             GetDataType_t<GRFragB>* ldsAddr, GRFragB const& grFragB, uint32_t ldlds)
         {
-            using CoopApiSelector
-                = detail::CoopApiSelector<CoopSchedulerA, CoopSchedulerB, splitCountA, splitCountB>;
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
             CoopApiSelector::localWriteCoopB(
                 ldsAddr, reinterpret_cast<LWFragB const&>(grFragB), ldlds);
         }
 
+        template <GemmDriverT>
+        template <uint32_t BlocksX>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::copyCoopAsyncA(
+            GetDataType_t<GRFragA>*       ldsAddr,
+            GRFragA (&grFragsA)[BlocksX],
+            GetDataType_t<GRFragA> const* gAddrA,
+            uint32_t                      lda,
+            uint32_t                      ldlds)
+        {
+            auto blockOffset = MappingUtil<GRFragA>::dataOffset(GlobalMapping::blockOffsetA(), lda);
+            auto ldsOffset   = MappingUtil<LWFragA>::dataOffset(LdsMapping::blockOffsetA(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                copyCoopAsyncA(
+                    ldsAddr + i * ldsOffset, grFragsA[i], gAddrA + i * blockOffset, lda, ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::copyCoopAsyncA(
+            GetDataType_t<GRFragA>*       ldsAddr,
+            GRFragA&                      grFragA,
+            GetDataType_t<GRFragA> const* gAddrA,
+            uint32_t                      lda,
+            uint32_t                      ldlds)
+        {
+            static_assert(Schedule::WaveCountIsConstexpr<CoopSchedulerA>::value,
+                          "Async copies require a compile time wave count");
+            static_assert(detail::IsAsyncCopyable<GRFragA, LWFragA>::value,
+                          "LDS layout of A must match its global layout for async copies");
+
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
+            CoopApiSelector::copyCoopAsyncA(
+                ldsAddr, reinterpret_cast<LWFragA&>(grFragA), gAddrA, lda, ldlds);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::copyCoopAsyncB(
+            GetDataType_t<GRFragB>*       ldsAddr,
+            GRFragB (&grFragsB)[BlocksY],
+            GetDataType_t<GRFragB> const* gAddrB,
+            uint32_t                      ldb,
+            uint32_t                      ldlds)
+        {
+            auto blockOffset = MappingUtil<GRFragB>::dataOffset(GlobalMapping::blockOffsetB(), ldb);
+            auto ldsOffset   = MappingUtil<LWFragB>::dataOffset(LdsMapping::blockOffsetB(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksY; i++)
+            {
+                copyCoopAsyncB(
+                    ldsAddr + i * ldsOffset, grFragsB[i], gAddrB + i * blockOffset, ldb, ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::copyCoopAsyncB(
+            GetDataType_t<GRFragB>*       ldsAddr,
+            GRFragB&                      grFragB,
+            GetDataType_t<GRFragB> const* gAddrB,
+            uint32_t                      ldb,
+            uint32_t                      ldlds)
+        {
+            static_assert(Schedule::WaveCountIsConstexpr<CoopSchedulerB>::value,
+                          "Async copies require a compile time wave count");
+            static_assert(detail::IsAsyncCopyable<GRFragB, LWFragB>::value,
+                          "LDS layout of B must match its global layout for async copies");
+
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
+            CoopApiSelector::copyCoopAsyncB(
+                ldsAddr, reinterpret_cast<LWFragB&>(grFragB), gAddrB, ldb, ldlds);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksX>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitCoopAsyncA(
+            GetDataType_t<GRFragA>* ldsAddr, GRFragA const (&grFragsA)[BlocksX], uint32_t ldlds)
+        {
+            auto blockOffset = MappingUtil<LWFragA>::dataOffset(LdsMapping::blockOffsetA(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksX; i++)
+            {
+                waitCoopAsyncA(ldsAddr + i * blockOffset, grFragsA[i], ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitCoopAsyncA(
+            GetDataType_t<GRFragA>* ldsAddr, GRFragA const& grFragA, uint32_t ldlds)
+        {
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
+            CoopApiSelector::waitCoopAsyncA(
+                ldsAddr, reinterpret_cast<LWFragA const&>(grFragA), ldlds);
+        }
+
+        template <GemmDriverT>
+        template <uint32_t BlocksY>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitCoopAsyncB(
+            GetDataType_t<GRFragB>* ldsAddr, GRFragB const (&grFragsB)[BlocksY], uint32_t ldlds)
+        {
+            auto blockOffset = MappingUtil<LWFragB>::dataOffset(LdsMapping::blockOffsetB(), ldlds);
+#pragma unroll
+            for(int i = 0; i < BlocksY; i++)
+            {
+                waitCoopAsyncB(ldsAddr + i * blockOffset, grFragsB[i], ldlds);
+            }
+        }
+
+        template <GemmDriverT>
+        __device__ inline void GemmDriver<GemmDriverT_impl>::waitCoopAsyncB(
+            GetDataType_t<GRFragB>* ldsAddr, GRFragB const& grFragB, uint32_t ldlds)
+        {
+            using CoopApiSelector = detail::CoopApiSelector<CoopSchedulerA,
+                                                            CoopSchedulerB,
+                                                            splitCountA,
+                                                            splitCountB,
+                                                            CachePolicyA,
+                                                            CachePolicyB>;
+            CoopApiSelector::waitCoopAsyncB(
+                ldsAddr, reinterpret_cast<LWFragB const&>(grFragB), ldlds);
+        }
+
         template <GemmDriverT>
         __device__ inline void GemmDriver<GemmDriverT_impl>::localReadA(
             MfmaFragA& fragsA, GetDataType_t<MfmaFragA> const* ldsAddrA, uint32_t ldlds)
@@ -350,7 +580,7 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::globalReadC(
             MfmaFragC& fragC, GetDataType_t<MfmaFragC> const* gAddrC, uint32_t ldc)
         {
-            rocwmma::load_matrix_sync(fragC, gAddrC, ldc);
+            rocwmma::load_matrix_sync<CachePolicyC>(fragC, gAddrC, ldc);
         }
 
         template <GemmDriverT>
@@ -383,7 +613,7 @@ namespace rocwmma
         __device__ inline void GemmDriver<GemmDriverT_impl>::globalWriteD(
             GetDataType_t<MfmaFragD>* gAddrD, MfmaFragD const& fragD, uint32_t ldd)
         {
-            rocwmma::store_matrix_sync(gAddrD, fragD, ldd);
+            rocwmma::store_matrix_sync<CachePolicyD>(gAddrD, fragD, ldd);
         }
 
         template <GemmDriverT>
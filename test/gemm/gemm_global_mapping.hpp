@@ -37,6 +37,75 @@ namespace rocwmma
 {
     namespace GlobalMapping
     {
+        namespace Rasterization
+        {
+            /*
+            * Rasterization policies order the macro tiles of C across the
+            * workgroup grid. The workgroup at linear launch position
+            * tile = blockIdx.x + blockIdx.y * gridDim.x computes the macro tile
+            * at tileCoord(tile, tilesX, tilesY), where tilesX / tilesY are the
+            * macro tile counts in the M / N directions.
+            *
+            * Workgroups launched close together run concurrently. The fewer
+            * distinct macro tile rows and cols they cover, the more of their
+            * A and B reads hit in L2.
+            *
+            * All policies are bijections over the grid and may be evaluated
+            * on the host.
+            */
+
+            // Consecutive workgroups walk down a col of macro tiles.
+            // Matches the blockIdx.x / blockIdx.y grid, and is the default.
+            struct ColMajor
+            {
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY);
+            };
+
+            // Consecutive workgroups walk along a row of macro tiles
+            struct RowMajor
+            {
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY);
+            };
+
+            // Bands of GroupM macro tile rows, walked col by col within each band.
+            // GroupM = 1 is RowMajor.
+            template <uint32_t GroupM>
+            struct GroupedM
+            {
+                static_assert(GroupM > 0u, "GroupM must be positive");
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY);
+            };
+
+            // Square super tiles of SuperTile x SuperTile macro tiles, visited in
+            // row major order. Full super tiles are walked in Z-order (Morton) or
+            // along a Hilbert curve. Partial super tiles at the bottom and right
+            // edges of the grid fall back to row major order.
+            template <uint32_t SuperTile>
+            struct Morton
+            {
+                static_assert(SuperTile > 0u && (SuperTile & (SuperTile - 1u)) == 0u,
+                              "SuperTile must be a power of 2");
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY);
+            };
+
+            template <uint32_t SuperTile>
+            struct Hilbert
+            {
+                static_assert(SuperTile > 0u && (SuperTile & (SuperTile - 1u)) == 0u,
+                              "SuperTile must be a power of 2");
+
+                ROCWMMA_HOST_DEVICE constexpr static inline auto
+                    tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY);
+            };
+
+        } // namespace Rasterization
+
         namespace detail
         {
             template <uint32_t BlockM, // MFMA BlockM
@@ -52,7 +121,8 @@ namespace rocwmma
                       uint32_t BlocksX, // MFMA blocks per wave in X direction
                       uint32_t BlocksY, // MFMA blocks per wave in Y direction
                       uint32_t TBlockX = 0, // Thread block X dimension
-                      uint32_t TBlockY = 0> // Thread block Y dimension
+                      uint32_t TBlockY = 0, // Thread block Y dimension
+                      typename RasterOrder = Rasterization::ColMajor> // Macro tile order
             struct MappingBase
             {
                 /*
@@ -166,11 +236,21 @@ namespace rocwmma
                 /// Global matrix coords
                 ///
 
+                // Macro tile grid coordinate of the current workgroup, in RasterOrder
+                __device__ constexpr static inline auto workgroupTileCoord();
+
                 // Global matrix coordinate of macro tile for the current workgroup
                 __device__ constexpr static inline auto macroTileCoordC();
 
                 // Global matrix coordinate of wave tile for the current wave
                 __device__ constexpr static inline auto waveTileCoordC();
+
+                // As above, for the macro tile at the given workgroup coordinate.
+                // Persistent workgroups visit several macro tiles.
+                template <typename CoordT>
+                __device__ constexpr static inline auto macroTileCoordC(CoordT const& wgCoord);
+                template <typename CoordT>
+                __device__ constexpr static inline auto waveTileCoordC(CoordT const& wgCoord);
             };
 
         } // namespace detail
@@ -188,7 +268,8 @@ namespace rocwmma
                   uint32_t BlocksX,
                   uint32_t BlocksY,
                   uint32_t TBlockX = 0,
-                  uint32_t TBlockY = 0>
+                  uint32_t TBlockY = 0,
+                  typename RasterOrder = Rasterization::ColMajor>
         struct BlockLevelMapping : public detail::MappingBase<BlockM,
                                                               BlockN,
                                                               BlockK,
@@ -202,7 +283,8 @@ namespace rocwmma
                                                               BlocksX,
                                                               BlocksY,
                                                               TBlockX,
-                                                              TBlockY>
+                                                              TBlockY,
+                                                              RasterOrder>
         {
             /*
             * This flavour of Global Mapping targets A/B/C/D wave tiles iteratively
@@ -228,7 +310,8 @@ namespace rocwmma
                                              BlocksX,
                                              BlocksY,
                                              TBlockX,
-                                             TBlockY>;
+                                             TBlockY,
+                                             RasterOrder>;
 
             // Global wave tile R/W be in sections of MFMA sized fragments
             using GRFragA = typename Base::MfmaFragA;
@@ -260,6 +343,28 @@ namespace rocwmma
                 return Base::waveTileCoordC();
             }
 
+            // The same coordinates for the macro tile at the given workgroup coordinate
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordA(CoordT const& wgCoord)
+            {
+                return Base::projCoordA(readCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordB(CoordT const& wgCoord)
+            {
+                return Base::projCoordB(readCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordC(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto writeCoordD(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+
             // Indicate if global read for A and B are wave tiles
             __device__ constexpr static inline auto readABWaveTile()
             {
@@ -280,7 +385,8 @@ namespace rocwmma
                   uint32_t BlocksX,
                   uint32_t BlocksY,
                   uint32_t TBlockX = 0,
-                  uint32_t TBlockY = 0>
+                  uint32_t TBlockY = 0,
+                  typename RasterOrder = Rasterization::ColMajor>
         struct WaveLevelMapping : public detail::MappingBase<BlockM,
                                                              BlockN,
                                                              BlockK,
@@ -294,7 +400,8 @@ namespace rocwmma
                                                              BlocksX,
                                                              BlocksY,
                                                              TBlockX,
-                                                             TBlockY>
+                                                             TBlockY,
+                                                             RasterOrder>
         {
             /*
             * This flavour of Global Mapping targets A/B as a single wave tile sized fragment.
@@ -322,7 +429,8 @@ namespace rocwmma
                                              BlocksX,
                                              BlocksY,
                                              TBlockX,
-                                             TBlockY>;
+                                             TBlockY,
+                                             RasterOrder>;
 
             // Global reads for A/B are single fragment of wave tile size
             // Global R/W for C/D are MFMA sized fragments
@@ -359,6 +467,28 @@ namespace rocwmma
                 return Base::waveTileCoordC();
             }
 
+            // The same coordinates for the macro tile at the given workgroup coordinate
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordA(CoordT const& wgCoord)
+            {
+                return Base::projCoordA(readCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordB(CoordT const& wgCoord)
+            {
+                return Base::projCoordB(readCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordC(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto writeCoordD(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+
             // Indicate if global read for A and B are wave tiles
             __device__ constexpr static inline auto readABWaveTile()
             {
@@ -379,7 +509,8 @@ namespace rocwmma
                   uint32_t BlocksX,
                   uint32_t BlocksY,
                   uint32_t TBlockX,
-                  uint32_t TBlockY>
+                  uint32_t TBlockY,
+                  typename RasterOrder = Rasterization::ColMajor>
         struct WorkgroupLevelMapping : public detail::MappingBase<BlockM,
                                                                   BlockN,
                                                                   BlockK,
@@ -393,7 +524,8 @@ namespace rocwmma
                                                                   BlocksX,
                                                                   BlocksY,
                                                                   TBlockX,
-                                                                  TBlockY>
+                                                                  TBlockY,
+                                                                  RasterOrder>
         {
 
             // Must provide valid TBlockX/Y params at compile time.
@@ -425,7 +557,8 @@ namespace rocwmma
                                              BlocksX,
                                              BlocksY,
                                              TBlockX,
-                                             TBlockY>;
+                                             TBlockY,
+                                             RasterOrder>;
 
             // Global reads for A/B are single fragment of macro tile size
             // Global R/W for C/D are MFMA sized fragments
@@ -468,6 +601,28 @@ namespace rocwmma
                 return Base::waveTileCoordC();
             }
 
+            // The same coordinates for the macro tile at the given workgroup coordinate
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordA(CoordT const& wgCoord)
+            {
+                return Base::projCoordA(Base::macroTileCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordB(CoordT const& wgCoord)
+            {
+                return Base::projCoordB(Base::macroTileCoordC(wgCoord));
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto readCoordC(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+            template <typename CoordT>
+            __device__ constexpr static inline auto writeCoordD(CoordT const& wgCoord)
+            {
+                return Base::waveTileCoordC(wgCoord);
+            }
+
             // Indicate if global read for A and B are wave tiles
             __device__ constexpr static inline auto readABWaveTile()
             {
@@ -32,6 +32,126 @@ namespace rocwmma
 {
     namespace GlobalMapping
     {
+        namespace Rasterization
+        {
+            namespace detail
+            {
+                // Z-order: interleaved bits of the curve position, col bit first
+                template <uint32_t Size>
+                struct MortonCurve
+                {
+                    ROCWMMA_HOST_DEVICE constexpr static inline auto curveCoord(uint32_t d)
+                    {
+                        uint32_t x = 0u, y = 0u;
+                        for(uint32_t bit = 0u; (1u << bit) < Size; bit++)
+                        {
+                            x |= ((d >> (2u * bit + 1u)) & 1u) << bit;
+                            y |= ((d >> (2u * bit)) & 1u) << bit;
+                        }
+                        return make_coord2d(x, y);
+                    }
+                };
+
+                // Hilbert curve: each quadrant is a rotated / reflected copy of the curve
+                template <uint32_t Size>
+                struct HilbertCurve
+                {
+                    ROCWMMA_HOST_DEVICE constexpr static inline auto curveCoord(uint32_t d)
+                    {
+                        uint32_t x = 0u, y = 0u;
+                        for(uint32_t s = 1u; s < Size; s *= 2u, d /= 4u)
+                        {
+                            auto rx = 1u & (d / 2u);
+                            auto ry = 1u & (d ^ rx);
+                            if(ry == 0u)
+                            {
+                                if(rx == 1u)
+                                {
+                                    x = s - 1u - x;
+                                    y = s - 1u - y;
+                                }
+                                auto t = x;
+                                x      = y;
+                                y      = t;
+                            }
+                            x += s * rx;
+                            y += s * ry;
+                        }
+                        return make_coord2d(x, y);
+                    }
+                };
+
+                // Row major order of super tiles. Full super tiles are walked in
+                // Curve order, partial ones in row major order.
+                template <uint32_t SuperTile, typename Curve>
+                ROCWMMA_HOST_DEVICE constexpr inline auto
+                    superTileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+                {
+                    // Band of SuperTile macro tile rows
+                    auto bandTiles = SuperTile * tilesY;
+                    auto bandBegin = tile / bandTiles * SuperTile;
+                    auto rowsLeft  = tilesX - bandBegin;
+                    auto bandRows  = (rowsLeft < SuperTile) ? rowsLeft : SuperTile;
+                    auto bandTile  = tile % bandTiles;
+
+                    // Super tile within the band
+                    auto superTiles = bandRows * SuperTile;
+                    auto superBegin = bandTile / superTiles * SuperTile;
+                    auto colsLeft   = tilesY - superBegin;
+                    auto superCols  = (colsLeft < SuperTile) ? colsLeft : SuperTile;
+                    auto superTile  = bandTile % superTiles;
+
+                    auto local = (bandRows == SuperTile && superCols == SuperTile)
+                                     ? Curve::curveCoord(superTile)
+                                     : make_coord2d(superTile / superCols, superTile % superCols);
+
+                    return make_coord2d(bandBegin + get<0>(local), superBegin + get<1>(local));
+                }
+
+            } // namespace detail
+
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                ColMajor::tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+            {
+                return make_coord2d(tile % tilesX, tile / tilesX);
+            }
+
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                RowMajor::tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+            {
+                return make_coord2d(tile / tilesY, tile % tilesY);
+            }
+
+            template <uint32_t GroupM>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                GroupedM<GroupM>::tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+            {
+                auto bandTiles = GroupM * tilesY;
+                auto bandBegin = tile / bandTiles * GroupM;
+                auto bandRows  = (tilesX - bandBegin < GroupM) ? tilesX - bandBegin : GroupM;
+                auto bandTile  = tile % bandTiles;
+
+                return make_coord2d(bandBegin + bandTile % bandRows, bandTile / bandRows);
+            }
+
+            template <uint32_t SuperTile>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                Morton<SuperTile>::tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+            {
+                return detail::superTileCoord<SuperTile, detail::MortonCurve<SuperTile>>(
+                    tile, tilesX, tilesY);
+            }
+
+            template <uint32_t SuperTile>
+            ROCWMMA_HOST_DEVICE constexpr inline auto
+                Hilbert<SuperTile>::tileCoord(uint32_t tile, uint32_t tilesX, uint32_t tilesY)
+            {
+                return detail::superTileCoord<SuperTile, detail::HilbertCurve<SuperTile>>(
+                    tile, tilesX, tilesY);
+            }
+
+        } // namespace Rasterization
+
 
         namespace detail
         {
@@ -39,11 +159,11 @@ namespace rocwmma
 #define MappingBaseT                                                                               \
     uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename InputT, typename OutputT,          \
         typename ComputeT, typename LayoutA, typename LayoutB, typename LayoutC, typename LayoutD, \
-        uint32_t BlocksX, uint32_t BlocksY, uint32_t TBlockX, uint32_t TBlockY
+        uint32_t BlocksX, uint32_t BlocksY, uint32_t TBlockX, uint32_t TBlockY, typename RasterOrder
 
 #define MappingBaseT_impl                                                                  \
     BlockM, BlockN, BlockK, InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD, \
-        BlocksX, BlocksY, TBlockX, TBlockY
+        BlocksX, BlocksY, TBlockX, TBlockY, RasterOrder
 
             template <MappingBaseT>
             template <typename CoordC>
@@ -146,10 +266,26 @@ namespace rocwmma
             /// Global matrix coords
             ///
 
+            template <MappingBaseT>
+            __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::workgroupTileCoord()
+            {
+                // The default order is the launch grid itself
+                if constexpr(std::is_same<RasterOrder, Rasterization::ColMajor>::value)
+                {
+                    return WaveSpace::workgroupCoord();
+                }
+                else
+                {
+                    return RasterOrder::tileCoord(blockIdx.x + blockIdx.y * gridDim.x,
+                                                  gridDim.x,
+                                                  gridDim.y);
+                }
+            }
+
             template <MappingBaseT>
             __device__ constexpr inline auto MappingBase<MappingBaseT_impl>::macroTileCoordC()
             {
-                return WaveSpace::workgroupCoord() * macroTileSizeC();
+                return workgroupTileCoord() * macroTileSizeC();
             }
 
             template <MappingBaseT>
@@ -157,6 +293,22 @@ namespace rocwmma
             {
                 return macroTileCoordC() + waveOffsetC();
             }
+
+            template <MappingBaseT>
+            template <typename CoordT>
+            __device__ constexpr inline auto
+                MappingBase<MappingBaseT_impl>::macroTileCoordC(CoordT const& wgCoord)
+            {
+                return wgCoord * macroTileSizeC();
+            }
+
+            template <MappingBaseT>
+            template <typename CoordT>
+            __device__ constexpr inline auto
+                MappingBase<MappingBaseT_impl>::waveTileCoordC(CoordT const& wgCoord)
+            {
+                return macroTileCoordC(wgCoord) + waveOffsetC();
+            }
         }
 
 #undef MappingBaseT
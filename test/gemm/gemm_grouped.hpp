@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_GROUPED_HPP
+#define ROCWMMA_GEMM_GROUPED_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+// Grouped GEMM runs many independent GEMMs of different sizes in one launch.
+//
+// Each group is described by a Problem in device memory. The macro tiles of
+// all groups are numbered in one flat grid: group g owns tiles
+// [tileTable[g], tileTable[g + 1]), where tileTable is the exclusive prefix sum
+// of the per-group macro tile counts. A workgroup finds its group with a
+// binary search over the table, and its tile within the group from the
+// remainder.
+//
+// Group sizes are arbitrary. Tile counts round up, so the last row and col of
+// macro tiles of a group may be partial: see isFullTile.
+//
+// The planner below builds the table on the host, and is usable without a device.
+
+namespace rocwmma
+{
+    namespace GroupedGemm
+    {
+        template <typename InputT, typename OutputT>
+        struct Problem
+        {
+            uint32_t       m, n, k;
+            InputT const*  a;
+            InputT const*  b;
+            OutputT const* c;
+            OutputT*       d;
+            uint32_t       lda, ldb, ldc, ldd;
+        };
+
+        // Macro tiles covering extent, including a partial edge tile
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t tileDim(uint32_t extent, uint32_t macroTile)
+        {
+            return (extent + macroTile - 1u) / macroTile;
+        }
+
+        // Macro tiles covering an m x n output
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t
+            tileCount(uint32_t m, uint32_t n, uint32_t macroTileM, uint32_t macroTileN)
+        {
+            return tileDim(m, macroTileM) * tileDim(n, macroTileN);
+        }
+
+        // Whether the macro tile at matrix coordinate (row, col) lies within the
+        // m x n output, and k is a whole, non-zero count of blockK steps.
+        // Other tiles need bounds-checked loads and stores.
+        ROCWMMA_HOST_DEVICE constexpr inline bool isFullTile(uint32_t m,
+                                                             uint32_t n,
+                                                             uint32_t k,
+                                                             uint32_t row,
+                                                             uint32_t col,
+                                                             uint32_t macroTileM,
+                                                             uint32_t macroTileN,
+                                                             uint32_t blockK)
+        {
+            return (m >= row + macroTileM) && (n >= col + macroTileN) && (k > 0u)
+                   && (k % blockK == 0u);
+        }
+
+        // Group owning flat tile index, given groupCount + 1 prefix sums.
+        // Requires tile < tileTable[groupCount]. Empty groups share their
+        // start with the next group, and are never returned.
+        ROCWMMA_HOST_DEVICE constexpr inline uint32_t
+            findGroup(uint32_t const* tileTable, uint32_t groupCount, uint32_t tile)
+        {
+            // Invariant: tileTable[lo] <= tile < tileTable[hi]
+            uint32_t lo = 0u;
+            uint32_t hi = groupCount;
+            while(hi - lo > 1u)
+            {
+                auto mid = (lo + hi) / 2u;
+                if(tileTable[mid] <= tile)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            return lo;
+        }
+
+        ///
+        /// Host planner
+        ///
+
+        // Exclusive prefix sum of macro tile counts, with the total at the back
+        template <typename InputT, typename OutputT>
+        inline std::vector<uint32_t>
+            buildTileTable(std::vector<Problem<InputT, OutputT>> const& problems,
+                           uint32_t                                     macroTileM,
+                           uint32_t                                     macroTileN)
+        {
+            std::vector<uint32_t> tileTable(problems.size() + 1u, 0u);
+            for(size_t i = 0u; i < problems.size(); i++)
+            {
+                tileTable[i + 1u]
+                    = tileTable[i]
+                      + tileCount(problems[i].m, problems[i].n, macroTileM, macroTileN);
+            }
+            return tileTable;
+        }
+
+        // Splits extent into parts of uneven, deterministic sizes that sum to extent.
+        // Sizes are not aligned to any tile, and the first part is empty.
+        inline std::vector<uint32_t> splitExtent(uint32_t extent, uint32_t parts)
+        {
+            std::vector<uint32_t> weights(parts);
+            for(uint32_t g = 0u; g < parts; g++)
+            {
+                weights[g] = (g * 5u) % 7u;
+            }
+            auto totalWeight = std::accumulate(weights.begin(), weights.end(), 0u);
+
+            std::vector<uint32_t> sizes(parts, 0u);
+            uint32_t              assigned = 0u;
+            for(uint32_t g = 0u; g + 1u < parts; g++)
+            {
+                sizes[g] = totalWeight > 0u
+                               ? static_cast<uint32_t>(static_cast<uint64_t>(extent) * weights[g]
+                                                       / totalWeight)
+                               : 0u;
+                assigned += sizes[g];
+            }
+
+            // Remainder goes to the last part
+            if(parts > 0u)
+            {
+                sizes.back() = extent - assigned;
+            }
+            return sizes;
+        }
+
+        // Uneven, deterministic depths between k / 2 and k, one per part
+        inline std::vector<uint32_t> splitDepths(uint32_t k, uint32_t parts)
+        {
+            std::vector<uint32_t> depths(parts);
+            for(uint32_t g = 0u; g < parts; g++)
+            {
+                depths[g] = k - (k / 2u) * ((g * 3u) % 5u) / 4u;
+            }
+            return depths;
+        }
+
+    } // namespace GroupedGemm
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_GROUPED_HPP
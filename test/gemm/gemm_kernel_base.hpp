@@ -30,9 +30,13 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include "bench_stats.hpp"
 #include "gemm_resource.hpp"
+#include "gemm_tuning_table.hpp"
 #include "hip_device.hpp"
+#include "roofline.hpp"
 
 namespace rocwmma
 {
@@ -45,6 +49,11 @@ namespace rocwmma
         std::tuple<int64_t, int64_t, int64_t> problemSize;
         double                                alpha;
         double                                beta;
+
+        // Strided batch: batchCount independent problems of the same size,
+        // member b of each matrix starting at b * stride elements.
+        int64_t                                         batchCount   = 1;
+        std::tuple<int64_t, int64_t, int64_t, int64_t> batchStrides = {0, 0, 0, 0};
     };
 
     // Typeless Kernel interface to use with testing harness.
@@ -110,6 +119,10 @@ namespace rocwmma
                                     uint32_t, // ldb
                                     uint32_t, // ldc
                                     uint32_t, // ldd
+                                    uint64_t, // strideA
+                                    uint64_t, // strideB
+                                    uint64_t, // strideC
+                                    uint64_t, // strideD
                                     ComputeT, // Alpha
                                     ComputeT); // Beta
 
@@ -117,8 +130,14 @@ namespace rocwmma
         GemmKernelBase();
         virtual ~GemmKernelBase();
 
-        // Kernels MUST provide the device kernel function.
-        virtual KernelFunc kernelImpl() const = 0;
+        // Device kernel function of the dense gemm signature, launched by launchKernel().
+        // Families with their own kernel signature keep the default nullptr,
+        // dispatch a function of that signature and override launchKernel().
+        virtual KernelFunc kernelImpl() const;
+
+        // Enqueues one run of the kernel function.
+        // Kernels needing extra arguments or launches override this.
+        virtual void launchKernel();
 
         // Launch parameters.
         // Base calculations for grid and block dimensions
@@ -132,19 +151,43 @@ namespace rocwmma
         // False = skip test
         virtual bool checkDevice() const;
         virtual bool checkSizes() const;
+        virtual bool checkBatch() const;
         virtual bool checkLds() const;
         virtual bool checkQuirks() const;
 
         // Reset all members to default values
         virtual void reset();
 
+        // Launch configuration, as recorded by the autotuner.
+        // Kernels with extra parameters should extend the base config.
+        virtual GemmTuningConfig tuningConfig() const;
+
+        // Tags kernels that transform the generated inputs before running,
+        // keying their CPU reference apart from the plain gemm. Empty if none.
+        virtual std::string inputTag() const;
+
+        // Elements spanned by each of A, B, C and D over all batch members.
+        // For a single gemm these are the plain matrix sizes.
+        typename DataStorage::MatrixElements batchElements() const;
+
+        // Kernel specific fields of tuningConfig(), '_' separated:
+        // kernel, GemmConfig and LDS layout where set, then BlocksX x BlocksY.
+        std::string kernelConfigString() const;
+
         // Helper function to dispatch kernel guards
         // with runtime TBlockX, TBlockY, WaveSize and Device Arch
         template <template <uint32_t, uint32_t, uint32_t, uint32_t> class TestGuard>
         bool dispatchGuard() const;
 
+        // Function pointer type produced by the KernelClass generators
         template <template <uint32_t, uint32_t, uint32_t, uint32_t> class KernelClass>
-        KernelFunc dispatchKernelFunc() const;
+        using KernelClassFunc
+            = decltype(KernelClass<32u, 1u, HipDevice::Wave64, HipDevice::GFX908>::generate());
+
+        // Helper function to dispatch kernel functions of any signature
+        // with runtime TBlockX, TBlockY, WaveSize and Device Arch
+        template <template <uint32_t, uint32_t, uint32_t, uint32_t> class KernelClass>
+        KernelClassFunc<KernelClass> dispatchKernelFunc() const;
 
     public:
         // KernelI interface fulfillment
@@ -166,6 +209,8 @@ namespace rocwmma
         uint32_t mTBlockX, mTBlockY;
         uint32_t mM, mN, mK;
         uint32_t mLda, mLdb, mLdc, mLdd;
+        uint32_t mBatchCount;
+        uint64_t mStrideA, mStrideB, mStrideC, mStrideD;
         ComputeT mAlpha, mBeta;
 
         // Execution flow control
@@ -177,6 +222,13 @@ namespace rocwmma
         // Performance
         float64_t mElapsedTimeMs, mTotalGFlops, mMeasuredTFlopsPerSec;
         int32_t   mEfficiency, mReferenceEfficiency;
+
+        // Per-iteration timing distribution (ms) and its statistics
+        BenchStats             mBenchStats;
+        std::vector<float64_t> mBenchSamples;
+
+        // Attainable peak for this problem and tiling
+        RooflineResult mRoofline;
     };
 
 } // namespace rocwmma
@@ -127,7 +127,7 @@ namespace rocwmma
                         LayoutA,
                         LayoutB,
                         LayoutC,
-                        LayoutD>::dispatchKernelFunc() const -> KernelFunc
+                        LayoutD>::dispatchKernelFunc() const -> KernelClassFunc<KernelClass>
     {
         // The kernel function will be dispatched against 4 runtime params:
         // - TBlockX [32, 64, 128, 256]
@@ -139,7 +139,7 @@ namespace rocwmma
             auto deviceArch = DeviceInfo::instance()->getGcnArch();
 
             // Runtime dispatcher to assign compile time TBlock params.
-            auto result = typename std::decay_t<decltype(*this)>::KernelFunc(nullptr);
+            auto result = KernelClassFunc<KernelClass>(nullptr);
 
 #define CASE_IMPL_ASSIGN4(TBLOCK_X, TBLOCK_Y, WAVE_SIZE, ARCH_ID) \
     result = KernelClass<TBLOCK_X, TBLOCK_Y, WAVE_SIZE, ARCH_ID>::generate();
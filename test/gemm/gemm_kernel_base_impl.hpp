@@ -41,7 +41,10 @@
 
 #include "common.hpp"
 #include "gemm_kernel_base.hpp"
+#include "gemm_reference_cache.hpp"
+#include "gemm_tuner.hpp"
 #include "performance.hpp"
+#include "rocwmma_logging.hpp"
 
 #ifdef ROCWMMA_VALIDATION_TESTS
 #include "reference.hpp" // Vanilla CPU kernel
@@ -146,8 +149,10 @@ namespace rocwmma
                         LayoutC,
                         LayoutD>::gridDim() const
     {
+        // Grid z selects the strided batch member
         return dim3(ceilDiv(mM, BlockM * mTBlockX / DeviceInfo::instance()->warpSize()),
-                    ceilDiv(mN, BlockN * mTBlockY));
+                    ceilDiv(mN, BlockN * mTBlockY),
+                    mBatchCount);
     }
 
     template <uint32_t BlockM,
@@ -236,6 +241,32 @@ namespace rocwmma
                && (gridDims.y * std::get<1>(tileSize) == mN) && (mK % BlockK == 0) && BlockK <= mK;
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    bool GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::checkBatch() const
+    {
+        // Batch members of D must not overlap, or their writes would race.
+        return (mBatchCount == 1u)
+               || (mBatchCount > 1u && mStrideD >= static_cast<uint64_t>(mM) * mN);
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -288,6 +319,39 @@ namespace rocwmma
         return true;
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    auto GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::batchElements() const -> typename DataStorage::MatrixElements
+    {
+        // Last batch member starts at (batchCount - 1) * stride
+        auto span = [this](uint64_t stride, int64_t matrixElements) {
+            return static_cast<int64_t>(mBatchCount - 1u) * static_cast<int64_t>(stride)
+                   + matrixElements;
+        };
+
+        return std::make_tuple(span(mStrideA, static_cast<int64_t>(mM) * mK),
+                               span(mStrideB, static_cast<int64_t>(mK) * mN),
+                               span(mStrideC, static_cast<int64_t>(mM) * mN),
+                               span(mStrideD, static_cast<int64_t>(mM) * mN));
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -312,6 +376,8 @@ namespace rocwmma
         mTBlockX = mTBlockY = 0u;
         mM = mN = mK = 0u;
         mLda = mLdb = mLdc = mLdd = 0u;
+        mBatchCount = 1u;
+        mStrideA = mStrideB = mStrideC = mStrideD = 0u;
         mAlpha = mBeta = static_cast<ComputeT>(0u);
 
         mRepeats =
@@ -326,6 +392,102 @@ namespace rocwmma
 
         mElapsedTimeMs = mTotalGFlops = mMeasuredTFlopsPerSec = 0.0;
         mEfficiency = mReferenceEfficiency = -1;
+
+        mBenchStats = BenchStats();
+        mBenchSamples.clear();
+        mRoofline = RooflineResult();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    GemmTuningConfig GemmKernelBase<BlockM,
+                     BlockN,
+                     BlockK,
+                     InputT,
+                     OutputT,
+                     ComputeT,
+                     LayoutA,
+                     LayoutB,
+                     LayoutC,
+                     LayoutD>::tuningConfig() const
+    {
+        GemmTuningConfig config;
+        config.blockM   = BlockM;
+        config.blockN   = BlockN;
+        config.blockK   = BlockK;
+        config.tBlockX  = mTBlockX;
+        config.tBlockY  = mTBlockY;
+        config.waveSize = DeviceInfo::instance()->warpSize();
+        return config;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    std::string GemmKernelBase<BlockM,
+                               BlockN,
+                               BlockK,
+                               InputT,
+                               OutputT,
+                               ComputeT,
+                               LayoutA,
+                               LayoutB,
+                               LayoutC,
+                               LayoutD>::inputTag() const
+    {
+        return std::string();
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    std::string GemmKernelBase<BlockM,
+                BlockN,
+                BlockK,
+                InputT,
+                OutputT,
+                ComputeT,
+                LayoutA,
+                LayoutB,
+                LayoutC,
+                LayoutD>::kernelConfigString() const
+    {
+        // Kernel family and its variant fields, then the wave block grid.
+        // Fields that do not apply are left out.
+        auto config = tuningConfig();
+
+        std::stringstream result;
+        for(auto const& field : {config.kernel, config.gemmConfig, config.layoutLds})
+        {
+            if(!field.empty() && field != "n/a")
+            {
+                result << field << "_";
+            }
+        }
+        result << config.blocksX << "x" << config.blocksY;
+        return result.str();
     }
 
     template <uint32_t BlockM,
@@ -376,7 +538,7 @@ namespace rocwmma
 
         return stream << "TBlkX, TBlkY, "
                       << "BlkM, BlkN, BlkK, "
-                      << "MatM, MatN, MatK, "
+                      << "MatM, MatN, MatK, Batch, "
                       << "alpha, lda, ldb, beta, ldc, ldd, "
                       << "LytA_LytB_LytC_LytD, "
                       << "Ti_To_Tc, "
@@ -387,6 +549,10 @@ namespace rocwmma
 #if defined(ROCWMMA_BENCHMARK_WITH_ROCBLAS)
                       << "rocBLAS Efficiency(%), "
 #endif // ROCWMMA_BENCHMARK_WITH_ROCBLAS
+#if defined(ROCWMMA_BENCHMARK_TESTS)
+                      << "minMs, p95Ms, stddevMs, CV(%), Samples, Outliers, SamplesMs, "
+                      << "AI(Flop/B), Roofline TFlops/s, Roofline(%), Bound, "
+#endif // ROCWMMA_BENCHMARK_TESTS
                       << "Result" << std::endl;
     }
 
@@ -412,8 +578,9 @@ namespace rocwmma
                                  LayoutD>::printKernel(std::ostream& stream) const
     {
         stream << mTBlockX << ", " << mTBlockY << ", " << BlockM << ", " << BlockN << ", " << BlockK
-               << ", " << mM << ", " << mN << ", " << mK << ", " << mAlpha << ", " << mLda << ", "
-               << mLdb << ", " << mBeta << ", " << mLdc << ", " << mLdd << ", "
+               << ", " << mM << ", " << mN << ", " << mK << ", " << mBatchCount << ", " << mAlpha
+               << ", " << mLda << ", " << mLdb << ", " << mBeta << ", " << mLdc << ", " << mLdd
+               << ", "
                << dataTypeToString<LayoutA>() << "_" << dataTypeToString<LayoutB>() << "_"
                << dataTypeToString<LayoutC>() << "_" << dataTypeToString<LayoutD>() << ", "
                << dataTypeToString<InputT>() << "_" << dataTypeToString<OutputT>() << "_"
@@ -433,6 +600,10 @@ namespace rocwmma
                    << "n/a"
                    << ", "
 #endif // ROCWMMA_BENCHMARK_WITH_ROCBLAS
+#if defined(ROCWMMA_BENCHMARK_TESTS)
+                   << "n/a, n/a, n/a, n/a, n/a, n/a, n/a, "
+                   << "n/a, n/a, n/a, n/a, "
+#endif // ROCWMMA_BENCHMARK_TESTS
                    << "SKIPPED" << std::endl;
         }
         else
@@ -443,6 +614,14 @@ namespace rocwmma
 #if defined(ROCWMMA_BENCHMARK_WITH_ROCBLAS)
                    << mReferenceEfficiency << ", "
 #endif // ROCWMMA_BENCHMARK_WITH_ROCBLAS
+#if defined(ROCWMMA_BENCHMARK_TESTS)
+                   << mBenchStats.min << ", " << mBenchStats.p95 << ", " << mBenchStats.stddev
+                   << ", " << mBenchStats.cv * 100.0 << ", " << mBenchStats.samples << ", "
+                   << mBenchStats.outliers << ", ";
+            writeSamplesCsv(stream, mBenchSamples)
+                << ", " << mRoofline.arithmeticIntensity << ", " << mRoofline.boundTFlopsPerSec
+                << ", " << mRoofline.achievedPercent << ", " << mRoofline.bound << ", "
+#endif // ROCWMMA_BENCHMARK_TESTS
 
 #if defined(ROCWMMA_VALIDATION_TESTS)
                    << (mValidationResult ? "PASSED" : "FAILED")
@@ -495,10 +674,17 @@ namespace rocwmma
                        (std::is_same<LayoutB, row_major>::value ? mN : mK),
                        (std::is_same<LayoutC, row_major>::value ? mN : mM),
                        (std::is_same<LayoutC, row_major>::value ? mN : mM));
+        mBatchCount = static_cast<uint32_t>(problem.batchCount);
+        std::tie(mStrideA, mStrideB, mStrideC, mStrideD)
+            = std::make_tuple(static_cast<uint64_t>(std::get<0>(problem.batchStrides)),
+                              static_cast<uint64_t>(std::get<1>(problem.batchStrides)),
+                              static_cast<uint64_t>(std::get<2>(problem.batchStrides)),
+                              static_cast<uint64_t>(std::get<3>(problem.batchStrides)));
 
         // Clear the kernel to run
         mRunFlag &= checkDevice();
         mRunFlag &= checkSizes();
+        mRunFlag &= checkBatch();
         mRunFlag &= checkLds();
         mRunFlag &= checkQuirks();
 
@@ -506,32 +692,128 @@ namespace rocwmma
         {
             auto& dataInstance = DataStorage::instance();
 
-            // Initialize matrix storage
-            dataInstance->resizeStorage(problem.problemSize);
+            // Initialize matrix storage, covering every batch member
+            dataInstance->resizeStorage(batchElements());
 
-            // Initialize matrix data on device
-            MatrixUtil<LayoutA>::fillLaunchKernel(dataInstance->deviceA().get(), mM, mK);
-            MatrixUtil<LayoutB>::fillLaunchKernel(dataInstance->deviceB().get(), mK, mN);
-            MatrixUtil<LayoutC>::fillLaunchKernel(dataInstance->deviceC().get(), mM, mN);
-            MatrixUtil<LayoutD>::fillValLaunchKernel(dataInstance->deviceD().get(),
-                                                     mM,
-                                                     mN,
-                                                     std::numeric_limits<OutputT>::signaling_NaN());
+            // Initialize matrix data on device. Batch member b is seeded with
+            // PhiloxDefaultSeed + b, so member 0 matches the single gemm data.
+            for(uint32_t batch = 0u; batch < mBatchCount; ++batch)
+            {
+                auto seed = PhiloxDefaultSeed + batch;
+                auto a    = dataInstance->deviceA().get() + batch * mStrideA;
+                auto b    = dataInstance->deviceB().get() + batch * mStrideB;
+                auto c    = dataInstance->deviceC().get() + batch * mStrideC;
+                auto d    = dataInstance->deviceD().get() + batch * mStrideD;
+
+                MatrixUtil<LayoutA>::fillRandLaunchKernel(a, mM, mK, seed, DataStorage::MatrixA);
+                MatrixUtil<LayoutB>::fillRandLaunchKernel(b, mK, mN, seed, DataStorage::MatrixB);
+                MatrixUtil<LayoutC>::fillRandLaunchKernel(c, mM, mN, seed, DataStorage::MatrixC);
+                MatrixUtil<LayoutD>::fillValLaunchKernel(
+                    d, mM, mN, std::numeric_limits<OutputT>::signaling_NaN());
+            }
+
+            // Generate identical inputs in place on host if performing cpu
+            // validation, rather than copying them back from the device.
+            [[maybe_unused]] auto fillHostInputs = [this, &dataInstance]() {
+                for(uint32_t batch = 0u; batch < mBatchCount; ++batch)
+                {
+                    auto seed = PhiloxDefaultSeed + batch;
+                    auto a    = dataInstance->hostA().get() + batch * mStrideA;
+                    auto b    = dataInstance->hostB().get() + batch * mStrideB;
+                    auto c    = dataInstance->hostC().get() + batch * mStrideC;
+
+                    MatrixUtil<LayoutA>::fillRand(a, mM, mK, seed, DataStorage::MatrixA);
+                    MatrixUtil<LayoutB>::fillRand(b, mK, mN, seed, DataStorage::MatrixB);
+                    MatrixUtil<LayoutC>::fillRand(c, mM, mN, seed, DataStorage::MatrixC);
+                }
+            };
 
-            // Copy to host if performing cpu validation
 #if !defined(ROCWMMA_VALIDATE_WITH_ROCBLAS) && defined(ROCWMMA_VALIDATION_TESTS)
-            dataInstance->copyDeviceToHostAll();
+            fillHostInputs();
 #endif // !defined(ROCWMMA_VALIDATE_WITH_ROCBLAS) && defined(ROCWMMA_VALIDATION_TESTS)
 
 #if defined(ROCWMMA_VALIDATE_WITH_ROCBLAS)
             if(!quirks::rocblas_supported<InputT, OutputT, ComputeT>::value)
             {
-                dataInstance->copyDeviceToHostAll();
+                fillHostInputs();
             }
 #endif // ROCWMMA_VALIDATE_WITH_ROCBLAS
         }
     };
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    auto GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::kernelImpl() const -> KernelFunc
+    {
+        return nullptr;
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void GemmKernelBase<BlockM,
+                        BlockN,
+                        BlockK,
+                        InputT,
+                        OutputT,
+                        ComputeT,
+                        LayoutA,
+                        LayoutB,
+                        LayoutC,
+                        LayoutD>::launchKernel()
+    {
+        auto& dataInstance = DataStorage::instance();
+        hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
+                              (this->gridDim()), // Wg grid size
+                              (this->blockDim()), // Thread block size
+                              (this->ldsUsage()), // sharedMemBytes
+                              0, // stream
+                              nullptr, // Event start
+                              nullptr, // event stop
+                              0, // flags
+                              this->mM, // M
+                              this->mN, // N
+                              this->mK, // K
+                              dataInstance->deviceA().get(), // A*
+                              dataInstance->deviceB().get(), // B*
+                              dataInstance->deviceC().get(), // C*
+                              dataInstance->deviceD().get(), // D*
+                              this->mLda, // lda
+                              this->mLdb, // ldb
+                              this->mLdc, // ldc
+                              this->mLdd, // ldd
+                              this->mStrideA, // strideA
+                              this->mStrideB, // strideB
+                              this->mStrideC, // strideC
+                              this->mStrideD, // strideD
+                              this->mAlpha, // alpha
+                              this->mBeta); // beta
+    }
+
     template <uint32_t BlockM,
               uint32_t BlockN,
               uint32_t BlockK,
@@ -559,61 +841,140 @@ namespace rocwmma
             /// Run ROCWMMA kernel
             ///
 
-            auto rocwmmaKernel = [this]() {
-                auto& dataInstance = DataStorage::instance();
-                hipExtLaunchKernelGGL((this->kernelImpl()), // Kernel to launch
-                                      (this->gridDim()), // Wg grid size
-                                      (this->blockDim()), // Thread block size
-                                      (this->ldsUsage()), // sharedMemBytes
-                                      0, // stream
-                                      nullptr, // Event start
-                                      nullptr, // event stop
-                                      0, // flags
-                                      this->mM, // M
-                                      this->mN, // N
-                                      this->mK, // K
-                                      dataInstance->deviceA().get(), // A*
-                                      dataInstance->deviceB().get(), // B*
-                                      dataInstance->deviceC().get(), // C*
-                                      dataInstance->deviceD().get(), // D*
-                                      this->mLda, // lda
-                                      this->mLdb, // ldb
-                                      this->mLdc, // ldc
-                                      this->mLdd, // ldd
-                                      this->mAlpha, // alpha
-                                      this->mBeta); // beta
-            };
+            auto rocwmmaKernel = [this]() { this->launchKernel(); };
 
             {
-                hipEvent_t startEvent, stopEvent;
-                CHECK_HIP_ERROR(hipEventCreate(&startEvent));
-                CHECK_HIP_ERROR(hipEventCreate(&stopEvent));
+#if defined(ROCWMMA_BENCHMARK_TESTS)
+                auto benchConfig = RocwmmaLogging::instance()->benchConfig();
+#else
+                // Validation runs need a single launch and no statistics
+                auto benchConfig       = BenchConfig();
+                benchConfig.warmup     = 0u;
+                benchConfig.iterations = mRepeats;
+                benchConfig.targetCv   = 0.0;
+#endif // ROCWMMA_BENCHMARK_TESTS
+
+                // Events bracket each launch, so every iteration is timed individually
+                std::vector<hipEvent_t> startEvents, stopEvents;
+                auto timeRound = [&](uint32_t count, std::vector<float64_t>& samples) {
+                    while(startEvents.size() < count)
+                    {
+                        startEvents.emplace_back();
+                        stopEvents.emplace_back();
+                        CHECK_HIP_ERROR(hipEventCreate(&startEvents.back()));
+                        CHECK_HIP_ERROR(hipEventCreate(&stopEvents.back()));
+                    }
 
-                CHECK_HIP_ERROR(hipEventRecord(startEvent));
-                for(uint32_t i = 0; i < mRepeats; ++i)
+                    for(uint32_t i = 0; i < count; ++i)
+                    {
+                        CHECK_HIP_ERROR(hipEventRecord(startEvents[i]));
+                        rocwmmaKernel();
+                        CHECK_HIP_ERROR(hipEventRecord(stopEvents[i]));
+                    }
+                    CHECK_HIP_ERROR(hipEventSynchronize(stopEvents[count - 1u]));
+
+                    for(uint32_t i = 0; i < count; ++i)
+                    {
+                        auto timeMs = 0.0f;
+                        CHECK_HIP_ERROR(
+                            hipEventElapsedTime(&timeMs, startEvents[i], stopEvents[i]));
+                        samples.push_back(float64_t(timeMs));
+                    }
+                };
+
+                mBenchStats = runBenchmark(benchConfig, timeRound, mBenchSamples);
+
+                for(uint32_t i = 0; i < startEvents.size(); ++i)
                 {
-                    rocwmmaKernel();
+                    CHECK_HIP_ERROR(hipEventDestroy(startEvents[i]));
+                    CHECK_HIP_ERROR(hipEventDestroy(stopEvents[i]));
                 }
-                CHECK_HIP_ERROR(hipEventRecord(stopEvent));
-                CHECK_HIP_ERROR(hipEventSynchronize(stopEvent));
 
-                auto timeMs = 0.0f;
-                CHECK_HIP_ERROR(hipEventElapsedTime(&timeMs, startEvent, stopEvent));
-
-                // Calculate efficiency
+                // Calculate efficiency from the median iteration
                 auto& deviceInfo = DeviceInfo::instance();
 
                 auto devicePeakGFlopsPerSec = deviceInfo->peakGFlopsPerSec<InputT>();
 
-                mElapsedTimeMs        = float64_t(timeMs);
-                mTotalGFlops          = calculateGFlops(mM, mN, mK);
+                // One launch covers every batch member
+                mElapsedTimeMs        = mBenchStats.median;
+                mTotalGFlops          = calculateGFlops(mM, mN, mK) * mBatchCount;
                 mMeasuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, mElapsedTimeMs)
-                                        * static_cast<float64_t>(mRepeats);
+                                        * static_cast<float64_t>(mBatchCount);
 
                 mEfficiency = round(mMeasuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
 
-                CHECK_HIP_ERROR(hipEventDestroy(startEvent));
-                CHECK_HIP_ERROR(hipEventDestroy(stopEvent));
+#if defined(ROCWMMA_BENCHMARK_TESTS)
+                // Roofline over the launched tiling: each workgroup covers a
+                // gridDim-derived macro tile with (TBlockX / warpSize) x TBlockY waves.
+                auto gridDims = gridDim();
+                auto traffic  = calculateGemmTraffic(mM,
+                                                    mN,
+                                                    mK,
+                                                    gridDims.x,
+                                                    gridDims.y,
+                                                    mTBlockX / deviceInfo->warpSize(),
+                                                    mTBlockY,
+                                                    sizeof(InputT),
+                                                    sizeof(OutputT),
+                                                    static_cast<float32_t>(mBeta) != 0.0f,
+                                                    ldsUsage() > 0u);
+                traffic.globalReadBytes *= mBatchCount;
+                traffic.globalWriteBytes *= mBatchCount;
+                traffic.ldsBytes *= mBatchCount;
+
+                mRoofline = calculateRoofline(mTotalGFlops,
+                                              traffic,
+                                              mMeasuredTFlopsPerSec,
+                                              devicePeakGFlopsPerSec,
+                                              deviceInfo->peakHbmGBytesPerSec(),
+                                              deviceInfo->peakLdsGBytesPerSec());
+
+                // Offer every benchmarked configuration to the autotuner.
+                // Tuning keys describe single gemms, so batched runs are not recorded.
+                auto& tuner = GemmTuner::instance();
+                if(tuner->enabled() && mBatchCount == 1u)
+                {
+                    std::string arch = deviceInfo->getDeviceProps().gcnArchName;
+
+                    GemmTuningKey key;
+                    key.arch    = arch.substr(0, arch.find(':'));
+                    key.types   = std::string(dataTypeToString<InputT>()) + "_"
+                                + dataTypeToString<OutputT>() + "_" + dataTypeToString<ComputeT>();
+                    key.layouts = std::string(dataTypeToString<LayoutA>()) + "_"
+                                  + dataTypeToString<LayoutB>() + "_" + dataTypeToString<LayoutC>()
+                                  + "_" + dataTypeToString<LayoutD>();
+
+                    GemmTuningEntry entry;
+                    entry.m            = mM;
+                    entry.n            = mN;
+                    entry.k            = mK;
+                    entry.config       = tuningConfig();
+                    entry.tflopsPerSec = mMeasuredTFlopsPerSec;
+                    tuner->record(key, entry);
+                }
+
+                auto& benchJson = RocwmmaLogging::instance()->benchJson();
+                if(benchJson.is_open())
+                {
+                    benchJson << "{\"TBlkX\": " << mTBlockX << ", \"TBlkY\": " << mTBlockY
+                              << ", \"BlkM\": " << BlockM << ", \"BlkN\": " << BlockN
+                              << ", \"BlkK\": " << BlockK << ", \"MatM\": " << mM
+                              << ", \"MatN\": " << mN << ", \"MatK\": " << mK
+                              << ", \"Batch\": " << mBatchCount
+                              << ", \"Layouts\": \"" << dataTypeToString<LayoutA>() << "_"
+                              << dataTypeToString<LayoutB>() << "_" << dataTypeToString<LayoutC>()
+                              << "_" << dataTypeToString<LayoutD>() << "\", \"Types\": \""
+                              << dataTypeToString<InputT>() << "_" << dataTypeToString<OutputT>()
+                              << "_" << dataTypeToString<ComputeT>() << "\", \"Config\": \""
+                              << kernelConfigString()
+                              << "\", \"TFlops/s\": " << mMeasuredTFlopsPerSec
+                              << ", \"AI\": " << mRoofline.arithmeticIntensity
+                              << ", \"RooflineTFlops/s\": " << mRoofline.boundTFlopsPerSec
+                              << ", \"Roofline(%)\": " << mRoofline.achievedPercent
+                              << ", \"Bound\": \"" << mRoofline.bound << "\", ";
+                    writeStatsJson(benchJson, mBenchStats, mBenchSamples) << "}" << std::endl;
+                }
+#endif // ROCWMMA_BENCHMARK_TESTS
             }
 
             ///
@@ -644,61 +1005,71 @@ namespace rocwmma
 #if defined(ROCBLAS_DATA_TYPE_FLOAT8)
                     {
                         rocblas_computetype computeType = rocblas_compute_type_f32;
-                        CHECK_ROCBLAS_ERROR(
-                            rocblas_gemm_ex3(handle,
-                                             rocblas_layout<LayoutA>::operation(), // opA
-                                             rocblas_layout<LayoutB>::operation(), // opB
-                                             this->mM, // M
-                                             this->mN, // N
-                                             this->mK, // K
-                                             &(this->mAlpha), // alpha,
-                                             dataInstance->deviceA().get(), // A*,
-                                             rocblas_types<InputT>::type(), // a_type
-                                             this->mLda, // lda
-                                             dataInstance->deviceB().get(), // B*,
-                                             rocblas_types<InputT>::type(), // b_type
-                                             this->mLdb, // ldb
-                                             &(this->mBeta), // beta
-                                             dataInstance->deviceC().get(), // C*
-                                             rocblas_types<OutputT>::type(), // c_type
-                                             this->mM, // ldc (col major output only)
-                                             dataInstance->deviceD().get(), // D*
-                                             rocblas_types<OutputT>::type(), // d_type
-                                             this->mM, // ldd (col major output only)
-                                             computeType, // compute_type
-                                             rocblas_gemm_algo_standard, // algo
-                                             0, // solution_index
-                                             0)); // flags
+                        CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex3(
+                            handle,
+                            rocblas_layout<LayoutA>::operation(), // opA
+                            rocblas_layout<LayoutB>::operation(), // opB
+                            this->mM, // M
+                            this->mN, // N
+                            this->mK, // K
+                            &(this->mAlpha), // alpha,
+                            dataInstance->deviceA().get(), // A*,
+                            rocblas_types<InputT>::type(), // a_type
+                            this->mLda, // lda
+                            this->mStrideA, // stride_a
+                            dataInstance->deviceB().get(), // B*,
+                            rocblas_types<InputT>::type(), // b_type
+                            this->mLdb, // ldb
+                            this->mStrideB, // stride_b
+                            &(this->mBeta), // beta
+                            dataInstance->deviceC().get(), // C*
+                            rocblas_types<OutputT>::type(), // c_type
+                            this->mM, // ldc (col major output only)
+                            this->mStrideC, // stride_c
+                            dataInstance->deviceD().get(), // D*
+                            rocblas_types<OutputT>::type(), // d_type
+                            this->mM, // ldd (col major output only)
+                            this->mStrideD, // stride_d
+                            this->mBatchCount, // batch_count
+                            computeType, // compute_type
+                            rocblas_gemm_algo_standard, // algo
+                            0, // solution_index
+                            0)); // flags
                     }
 #endif
                 }
                 else
                 {
-                    CHECK_ROCBLAS_ERROR(
-                        rocblas_gemm_ex(handle,
-                                        rocblas_layout<LayoutA>::operation(), // opA
-                                        rocblas_layout<LayoutB>::operation(), // opB
-                                        this->mM, // M
-                                        this->mN, // N
-                                        this->mK, // K
-                                        &(this->mAlpha), // alpha,
-                                        dataInstance->deviceA().get(), // A*,
-                                        rocblas_types<InputT>::type(), // a_type
-                                        this->mLda, // lda
-                                        dataInstance->deviceB().get(), // B*,
-                                        rocblas_types<InputT>::type(), // b_type
-                                        this->mLdb, // ldb
-                                        &(this->mBeta), // beta
-                                        dataInstance->deviceC().get(), // C*
-                                        rocblas_types<OutputT>::type(), // c_type
-                                        this->mM, // ldc (col major output only)
-                                        dataInstance->deviceD().get(), // D*
-                                        rocblas_types<OutputT>::type(), // d_type
-                                        this->mM, // ldd (col major output only)
-                                        rocblas_types<ComputeT>::type(), // compute_type
-                                        rocblas_gemm_algo_standard, // algo
-                                        0, // solution_index
-                                        0)); // flags
+                    CHECK_ROCBLAS_ERROR(rocblas_gemm_strided_batched_ex(
+                        handle,
+                        rocblas_layout<LayoutA>::operation(), // opA
+                        rocblas_layout<LayoutB>::operation(), // opB
+                        this->mM, // M
+                        this->mN, // N
+                        this->mK, // K
+                        &(this->mAlpha), // alpha,
+                        dataInstance->deviceA().get(), // A*,
+                        rocblas_types<InputT>::type(), // a_type
+                        this->mLda, // lda
+                        this->mStrideA, // stride_a
+                        dataInstance->deviceB().get(), // B*,
+                        rocblas_types<InputT>::type(), // b_type
+                        this->mLdb, // ldb
+                        this->mStrideB, // stride_b
+                        &(this->mBeta), // beta
+                        dataInstance->deviceC().get(), // C*
+                        rocblas_types<OutputT>::type(), // c_type
+                        this->mM, // ldc (col major output only)
+                        this->mStrideC, // stride_c
+                        dataInstance->deviceD().get(), // D*
+                        rocblas_types<OutputT>::type(), // d_type
+                        this->mM, // ldd (col major output only)
+                        this->mStrideD, // stride_d
+                        this->mBatchCount, // batch_count
+                        rocblas_types<ComputeT>::type(), // compute_type
+                        rocblas_gemm_algo_standard, // algo
+                        0, // solution_index
+                        0)); // flags
                 }
             };
             if(quirks::rocblas_supported<InputT, OutputT, ComputeT>::value)
@@ -710,45 +1081,103 @@ namespace rocwmma
                 // change C if needed
                 if(!std::is_same<LayoutC, col_major>::value)
                 {
-                    MatrixUtil<col_major>::fillLaunchKernel(dataInstance->deviceC().get(), mM, mN);
+                    for(uint32_t batch = 0u; batch < mBatchCount; ++batch)
+                    {
+                        MatrixUtil<col_major>::fillRandLaunchKernel(
+                            dataInstance->deviceC().get() + batch * mStrideC,
+                            mM,
+                            mN,
+                            PhiloxDefaultSeed + batch,
+                            DataStorage::MatrixC);
+                    }
                 }
 
                 benchRef        = true;
                 referenceKernel = rocBlasKernel;
 
 #if defined(ROCWMMA_VALIDATE_WITH_ROCBLAS)
-                // Cache the ROCWMMA result from device
-                auto rocwmmaResult = dataInstance->template allocHost<OutputT>(mM * mN);
-                dataInstance->copyData(rocwmmaResult, dataInstance->deviceD(), mM * mN);
+                // Cache the ROCWMMA result from device, over all batch members
+                auto sizeD         = std::get<DataStorage::MatrixD>(batchElements());
+                auto rocwmmaResult = dataInstance->template allocHost<OutputT>(sizeD);
+                dataInstance->copyData(rocwmmaResult, dataInstance->deviceD(), sizeD);
 
                 // Reset device D with NaN
                 MatrixUtil<LayoutD>::fillValLaunchKernel(
                     dataInstance->deviceD().get(),
-                    mM,
-                    mN,
+                    sizeD,
+                    1u,
                     std::numeric_limits<OutputT>::signaling_NaN());
 
                 // Move the ROCWMMA result to host for analysis
-                dataInstance->copyData(dataInstance->hostD(), rocwmmaResult, mM * mN);
+                dataInstance->copyData(dataInstance->hostD(), rocwmmaResult, sizeD);
 #endif // ROCWMMA_VALIDATE_WITH_ROCBLAS
             }
 #endif // ROCWMMA_VALIDATE_WITH_ROCBLAS || ROCWMMA_BENCHMARK_WITH_ROCBLAS
 
 #if defined(ROCWMMA_VALIDATION_TESTS)
 
-            // Fallback CPU kernel for validation
+            // Fallback CPU kernel for validation.
+            // Results repeat exactly for the same problem signature, so they are
+            // looked up in the persistent reference cache before computing.
             auto cpuKernel = [this]() {
                 auto& dataInstance = DataStorage::instance();
-                gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
-                    this->mM,
-                    this->mN,
-                    this->mK,
-                    dataInstance->hostA().get(),
-                    dataInstance->hostB().get(),
-                    dataInstance->hostC().get(),
-                    dataInstance->hostD().get(), // Cpu result on host D
-                    this->mAlpha,
-                    this->mBeta);
+                auto& cache        = GemmReferenceCache::instance();
+
+                std::ostringstream signature;
+                signature << "gemm_CPU:" << this->mM << "," << this->mN << "," << this->mK << ":"
+                          << dataTypeToString<InputT>() << "," << dataTypeToString<OutputT>()
+                          << "," << dataTypeToString<ComputeT>() << ":"
+                          << dataTypeToString<LayoutA>() << "," << dataTypeToString<LayoutB>()
+                          << "," << dataTypeToString<LayoutC>() << ","
+                          << dataTypeToString<LayoutD>() << ":" << std::hexfloat
+                          << static_cast<float64_t>(this->mAlpha) << ","
+                          << static_cast<float64_t>(this->mBeta) << ":philox4x32-10:" << std::hex
+                          << PhiloxDefaultSeed;
+
+                // Single gemm signatures are kept unchanged to reuse existing entries
+                if(this->mBatchCount > 1u)
+                {
+                    signature << std::dec << ":batch:" << this->mBatchCount << "," << this->mStrideA
+                              << "," << this->mStrideB << "," << this->mStrideC << ","
+                              << this->mStrideD;
+                }
+
+                // Transformed inputs no longer match the plain gemm entry
+                if(!this->inputTag().empty())
+                {
+                    signature << std::dec << ":" << this->inputTag();
+                }
+
+                auto bytes = static_cast<size_t>(std::get<DataStorage::MatrixD>(batchElements()))
+                             * sizeof(OutputT);
+
+                // Serializes concurrent processes on the same entry
+                auto entryLock = cache->lockEntry(signature.str());
+                if(!cache->load(signature.str(), dataInstance->hostD().get(), bytes))
+                {
+                    gemm_strided_batched_CPU<InputT,
+                                             OutputT,
+                                             ComputeT,
+                                             LayoutA,
+                                             LayoutB,
+                                             LayoutC,
+                                             LayoutD>(
+                        this->mM,
+                        this->mN,
+                        this->mK,
+                        dataInstance->hostA().get(),
+                        dataInstance->hostB().get(),
+                        dataInstance->hostC().get(),
+                        dataInstance->hostD().get(), // Cpu result on host D
+                        this->mAlpha,
+                        this->mBeta,
+                        this->mBatchCount,
+                        this->mStrideA,
+                        this->mStrideB,
+                        this->mStrideC,
+                        this->mStrideD);
+                    cache->store(signature.str(), dataInstance->hostD().get(), bytes);
+                }
             };
 
             if(!referenceKernel)
@@ -784,7 +1213,8 @@ namespace rocwmma
 
                     auto elapsedTimeMs        = float64_t(timeMs);
                     auto measuredTFlopsPerSec = calculateTFlopsPerSec(mM, mN, mK, elapsedTimeMs)
-                                                * static_cast<float64_t>(mRepeats);
+                                                * static_cast<float64_t>(mRepeats)
+                                                * static_cast<float64_t>(mBatchCount);
                     mReferenceEfficiency
                         = round(measuredTFlopsPerSec / devicePeakGFlopsPerSec * 100000.0);
                 }
@@ -833,26 +1263,40 @@ namespace rocwmma
 
             auto& dataInstance = DataStorage::instance();
 
-            // Allocated managed memory for results on host
-            const int64_t sizeD = mM * mN;
+            // Allocated managed memory for results on host, over all batch members
+            const int64_t sizeD = std::get<DataStorage::MatrixD>(batchElements());
 
             // One result on host needs to be transfered to device
             auto reference = dataInstance->template allocDevice<OutputT>(sizeD);
             dataInstance->copyData(reference, dataInstance->hostD(), sizeD);
 
-            // Give more error tolerance to ComputeT = fp16,
-            // due to MFMA output is always fp32. We downcast the MFMA result to fp16, which
-            // will introduce an error compared to native fp16 MAC. The tolerance would be a function
-            // of max / min values and number of operations propagating the error.
+            // Tolerance accounts for accumulation error in narrow compute types.
             // Note that integer values between [-2048, 2048 ] are exactly representable by fp16,
             // and significant rounding errors occur thereafter to the nearest multiple of 2.
             // The input generator for GEMM uses integer values within a certain range, therefore
             // FMA operations will be very prone to significant errors.
-            double errorTolerance = sizeof(ComputeT) < sizeof(float32_t) ? 100.0 : 10.0;
+            double errorTolerance = CompareTolerance<ComputeT>::value;
+
+            // Compare each batch member, accumulating a single report
+            auto compareBatch = [&](uint32_t batch) {
+                return compareEqualStatsLaunchKernel<OutputT, OutputT, DeviceLayoutD, LayoutD>(
+                    dataInstance->deviceD().get() + batch * mStrideD,
+                    reference.get() + batch * mStrideD,
+                    mM,
+                    mN,
+                    std::is_same<DeviceLayoutD, row_major>::value ? mN : mM,
+                    std::is_same<LayoutD, row_major>::value ? mN : mM,
+                    errorTolerance);
+            };
+
+            auto stats = compareBatch(0u);
+            for(uint32_t batch = 1u; batch < mBatchCount; ++batch)
+            {
+                stats.merge(compareBatch(batch));
+            }
 
-            std::tie(mValidationResult, mMaxRelativeError)
-                = compareEqualLaunchKernel<OutputT, OutputT, DeviceLayoutD, LayoutD>(
-                    dataInstance->deviceD().get(), reference.get(), mM, mN, errorTolerance);
+            mValidationResult = stats.passed();
+            mMaxRelativeError = stats.template relativeError<OutputT>();
 
             // auto result = dataInstance->template allocHost<OutputT>(sizeD);
             // dataInstance->copyData(result, dataInstance->deviceD(), sizeD);
@@ -860,7 +1304,7 @@ namespace rocwmma
             // MatrixUtil<DeviceLayoutD>::print(dataInstance->hostD().get(), mM, mN);
             // MatrixUtil<LayoutD>::print(result.get(), mM, mN);
 
-            EXPECT_TRUE(mValidationResult) << "Max relative error: " << mMaxRelativeError;
+            EXPECT_TRUE(mValidationResult) << stats;
         }
 #endif // ROCWMMA_VALIDATION_TESTS
     }
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMM_PIPELINE_HPP
+#define GEMM_PIPELINE_HPP
+
+namespace rocwmma
+{
+    /* Pipeline class:
+    * This class implements the software-pipelined accumulation loop of an LDS
+    * GEMM kernel for the given Global, Lds and GemmDriver classes. K tiles move
+    * through two rings: global reads are prefetched into PrefetchStages
+    * register buffers, then written into LdsStages LDS buffers from which the
+    * mfma fragments are read.
+    *
+    * Iteration t issues, in order: the LDS read of tile t, the global read of
+    * tile t + LdsStages + PrefetchStages - 2, the mfma of tile t, the LDS write
+    * of tile t + LdsStages - 1 and a single workgroup barrier. Global reads are
+    * issued ahead of the mfma and local writes after it, so the vmcnt wait
+    * before each local write leaves the younger prefetches in flight.
+    *
+    * LdsRing<1, 2> is the classic double buffered loop (PGR1 / LB2). Deeper
+    * rings trade LDS and registers for more global latency hiding in large K.
+    *
+    * With AsyncCopy, the global read of a tile is a cooperative async copy into
+    * its LDS stage and the local write is the matching wait. Where LDS-direct
+    * loads are supported, tiles bypass the register stage entirely. The LDS
+    * stages are the only prefetch buffers, so PrefetchStages must be 1.
+    *
+    * LDS usage: LdsStages * sizeLds() elements.
+    * Register usage: PrefetchStages * (GRBuffA + GRBuffB), none for LDS-direct
+    * async copies.
+    */
+
+    namespace CooperativeGemm
+    {
+        namespace Pipeline
+        {
+            template <uint32_t PrefetchCount, uint32_t BufferCount, bool AsyncCopy = false>
+            struct LdsRing
+            {
+                static_assert(PrefetchCount >= 1u, "At least one global prefetch stage required");
+                static_assert(BufferCount >= 2u, "At least two LDS stages required");
+                static_assert(!AsyncCopy || PrefetchCount == 1u,
+                              "Async copies are prefetched through LDS stages only");
+
+                enum : uint32_t
+                {
+                    PrefetchStages = PrefetchCount,
+                    LdsStages      = BufferCount,
+
+                    // Global reads in flight ahead of the first LDS read
+                    PrologueStages = PrefetchStages + LdsStages - 2u,
+
+                    // Upper bound of guarded iterations after the unguarded steady state
+                    DrainStages = LdsStages + 2u * PrefetchStages - 4u
+                };
+
+                template <typename GlobalMapping, typename LdsMapping, typename GemmDriver>
+                struct Mainloop
+                {
+                    using InputT = GetDataType_t<typename GlobalMapping::GRFragA>;
+
+                    using GRBuffA     = typename GlobalMapping::GRBuffA;
+                    using GRBuffB     = typename GlobalMapping::GRBuffB;
+                    using MfmaBuffA   = typename GlobalMapping::MfmaBuffA;
+                    using MfmaBuffB   = typename GlobalMapping::MfmaBuffB;
+                    using MfmaBuffAcc = typename GlobalMapping::MfmaBuffAcc;
+
+                    // Global A / B are the wave's starting read addresses,
+                    // kTiles is the count of BlockK steps to accumulate.
+                    __device__ inline Mainloop(InputT*       ldsPtr,
+                                               InputT const* a,
+                                               uint32_t      lda,
+                                               InputT const* b,
+                                               uint32_t      ldb,
+                                               uint32_t      kTiles);
+
+                    // Fill the rings up to the first LDS read, then synchronize
+                    __device__ inline void prologue();
+
+                    // Accumulate all but the last K tile
+                    __device__ inline void accumulate(MfmaBuffAcc& fragsAcc);
+
+                    // Accumulate the last K tile, already resident in LDS
+                    __device__ inline void tail(MfmaBuffAcc& fragsAcc);
+
+                    // Restart on new global A / B addresses with the same K extent,
+                    // e.g. for the next tile of a persistent workgroup. LDS offsets
+                    // are kept and the ring carries on from the stage after tail().
+                    __device__ inline void retarget(InputT const* a, InputT const* b);
+
+                    // Elements of one LDS stage
+                    __device__ constexpr static inline uint32_t stageSizeLds();
+
+                private:
+                    // Read the next K tile into the given register stage,
+                    // or start its async copy into the next LDS stage
+                    __device__ inline void globalRead(uint32_t stage);
+
+                    // Write the given register stage into the next LDS stage,
+                    // or wait for its async copy
+                    __device__ inline void localWrite(uint32_t stage);
+
+                    // Read the oldest LDS stage into the mfma fragments
+                    __device__ inline void localRead(MfmaBuffA& fragsA, MfmaBuffB& fragsB);
+
+                    // Accumulate A * B
+                    __device__ inline void mfma(MfmaBuffAcc&     fragsAcc,
+                                                MfmaBuffA const& fragsA,
+                                                MfmaBuffB const& fragsB);
+
+                    __device__ inline void advance(InputT*& ldsStagePtr) const;
+
+                    GRBuffA mGRBuffA[PrefetchStages];
+                    GRBuffB mGRBuffB[PrefetchStages];
+
+                    InputT const* mAddrA;
+                    InputT const* mAddrB;
+                    uint32_t      mLda;
+                    uint32_t      mLdb;
+                    uint32_t      mKStepOffsetA;
+                    uint32_t      mKStepOffsetB;
+
+                    InputT*  mLdsBase;
+                    InputT*  mLdsRead;
+                    InputT*  mLdsWrite;
+                    uint32_t mLdlds;
+                    uint32_t mLdsWriteOffsetA;
+                    uint32_t mLdsWriteOffsetB;
+                    uint32_t mLdsReadOffsetA;
+                    uint32_t mLdsReadOffsetB;
+
+                    uint32_t mKTiles;
+                };
+            };
+
+        } // namespace Pipeline
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#include "gemm_pipeline_impl.hpp"
+
+#endif // GEMM_PIPELINE_HPP
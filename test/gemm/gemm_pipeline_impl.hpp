@@ -0,0 +1,305 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GEMM_PIPELINE_IMPL_HPP
+#define GEMM_PIPELINE_IMPL_HPP
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include <rocwmma/rocwmma.hpp>
+#pragma GCC diagnostic pop
+
+namespace rocwmma
+{
+
+    namespace CooperativeGemm
+    {
+
+        namespace Pipeline
+        {
+
+#define LdsRingT uint32_t PrefetchCount, uint32_t BufferCount, bool AsyncCopy
+#define LdsRingT_impl PrefetchCount, BufferCount, AsyncCopy
+
+#define LdsRingMainloopT typename GlobalMapping, typename LdsMapping, typename GemmDriver
+#define LdsRingMainloopT_impl GlobalMapping, LdsMapping, GemmDriver
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::Mainloop(
+                InputT*       ldsPtr,
+                InputT const* a,
+                uint32_t      lda,
+                InputT const* b,
+                uint32_t      ldb,
+                uint32_t      kTiles)
+                : mAddrA(a)
+                , mAddrB(b)
+                , mLda(lda)
+                , mLdb(ldb)
+                , mLdsBase(ldsPtr)
+                , mLdsRead(ldsPtr)
+                , mLdsWrite(ldsPtr)
+                , mLdlds(LdsMapping::ldLds())
+                , mKTiles(kTiles)
+            {
+                using DataMappingA   = GetDataLayout_t<typename GlobalMapping::MfmaFragA>;
+                using DataMappingB   = GetDataLayout_t<typename GlobalMapping::MfmaFragB>;
+                using DataMappingLds = typename LdsMapping::DataLayout;
+
+                mKStepOffsetA = DataMappingA::fromMatrixCoord(GlobalMapping::kStepOffsetA(), lda);
+                mKStepOffsetB = DataMappingB::fromMatrixCoord(GlobalMapping::kStepOffsetB(), ldb);
+
+                auto ldlds = mLdlds;
+                mLdsWriteOffsetA
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordA(), ldlds);
+                mLdsWriteOffsetB
+                    = DataMappingLds::fromMatrixCoord(LdsMapping::writeCoordB(), ldlds);
+                mLdsReadOffsetA = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordA(), ldlds);
+                mLdsReadOffsetB = DataMappingLds::fromMatrixCoord(LdsMapping::readCoordB(), ldlds);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ constexpr inline uint32_t
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::stageSizeLds()
+            {
+                auto sizeLds = LdsMapping::sizeLds();
+                return get<0>(sizeLds) * get<1>(sizeLds);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::globalRead(uint32_t stage)
+            {
+                if constexpr(AsyncCopy)
+                {
+                    // The LDS write stage only advances in localWrite(),
+                    // which waits on this copy.
+                    GemmDriver::copyCoopAsyncA(
+                        mLdsWrite + mLdsWriteOffsetA, mGRBuffA[stage], mAddrA, mLda, mLdlds);
+                    GemmDriver::copyCoopAsyncB(
+                        mLdsWrite + mLdsWriteOffsetB, mGRBuffB[stage], mAddrB, mLdb, mLdlds);
+                }
+                else
+                {
+                    GemmDriver::globalReadCoopA(mGRBuffA[stage], mAddrA, mLda);
+                    GemmDriver::globalReadCoopB(mGRBuffB[stage], mAddrB, mLdb);
+                }
+
+                // Advance to next k step
+                mAddrA += mKStepOffsetA;
+                mAddrB += mKStepOffsetB;
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::localWrite(uint32_t stage)
+            {
+                if constexpr(AsyncCopy)
+                {
+                    GemmDriver::waitCoopAsyncA(
+                        mLdsWrite + mLdsWriteOffsetA, mGRBuffA[stage], mLdlds);
+                    GemmDriver::waitCoopAsyncB(
+                        mLdsWrite + mLdsWriteOffsetB, mGRBuffB[stage], mLdlds);
+                }
+                else
+                {
+                    GemmDriver::localWriteCoopA(
+                        mLdsWrite + mLdsWriteOffsetA, mGRBuffA[stage], mLdlds);
+                    GemmDriver::localWriteCoopB(
+                        mLdsWrite + mLdsWriteOffsetB, mGRBuffB[stage], mLdlds);
+                }
+                advance(mLdsWrite);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::localRead(
+                    MfmaBuffA& fragsA, MfmaBuffB& fragsB)
+            {
+                GemmDriver::localReadA(fragsA, mLdsRead + mLdsReadOffsetA, mLdlds);
+                GemmDriver::localReadB(fragsB, mLdsRead + mLdsReadOffsetB, mLdlds);
+                advance(mLdsRead);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::mfma(
+                MfmaBuffAcc& fragsAcc, MfmaBuffA const& fragsA, MfmaBuffB const& fragsB)
+            {
+                // accum(A * B)
+                GemmDriver::mfma(fragsAcc, fragsA, fragsB, fragsAcc);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::advance(
+                    InputT*& ldsStagePtr) const
+            {
+                // Wrap around the ring. Stage pointers are uniform, so this stays scalar.
+                ldsStagePtr += stageSizeLds();
+                if(ldsStagePtr == mLdsBase + LdsStages * stageSizeLds())
+                {
+                    ldsStagePtr = mLdsBase;
+                }
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::prologue()
+            {
+                // Tile s goes to register stage s % PrefetchStages. A register
+                // stage is written to LDS before its next global read reuses it.
+#pragma unroll
+                for(uint32_t s = 0; s < PrologueStages; s++)
+                {
+                    if(s >= PrefetchStages && s - PrefetchStages < mKTiles)
+                    {
+                        localWrite((s - PrefetchStages) % PrefetchStages);
+                    }
+
+                    if(s < mKTiles)
+                    {
+                        globalRead(s % PrefetchStages);
+                    }
+                }
+
+                // All LDS stages but one are now filled
+                if(LdsStages - 2u < mKTiles)
+                {
+                    localWrite((LdsStages - 2u) % PrefetchStages);
+                }
+
+                ///
+                /// Synchronize waves and memory
+                ///
+                GemmDriver::syncWorkgroup();
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::accumulate(
+                    MfmaBuffAcc& fragsAcc)
+            {
+                // Ring offsets of the global read and local write issued
+                // alongside the LDS read of a tile.
+                constexpr uint32_t ReadAhead  = PrefetchStages + LdsStages - 2u;
+                constexpr uint32_t WriteAhead = LdsStages - 1u;
+
+                // Steady state in steps of PrefetchStages tiles keeps register
+                // stage indices static. Every tile of a step has its global read
+                // and local write in bounds, so no guards are needed.
+                uint32_t currentTile = 0u;
+                for(; currentTile + ReadAhead + PrefetchStages - 1u < mKTiles;
+                    currentTile += PrefetchStages)
+                {
+#pragma unroll
+                    for(uint32_t i = 0; i < PrefetchStages; i++)
+                    {
+                        MfmaBuffA fragsA;
+                        MfmaBuffB fragsB;
+
+                        localRead(fragsA, fragsB);
+                        globalRead((i + ReadAhead) % PrefetchStages);
+                        mfma(fragsAcc, fragsA, fragsB);
+                        localWrite((i + WriteAhead) % PrefetchStages);
+
+                        // Make sure that all waves have finished reading / writing to lds.
+                        GemmDriver::syncWorkgroup();
+                    }
+                }
+
+                // Drain the remaining tiles, except the last one
+#pragma unroll
+                for(uint32_t i = 0; i < DrainStages; i++)
+                {
+                    if(currentTile + i + 1u < mKTiles)
+                    {
+                        auto const readTile  = currentTile + i + ReadAhead;
+                        auto const writeTile = currentTile + i + WriteAhead;
+
+                        MfmaBuffA fragsA;
+                        MfmaBuffB fragsB;
+
+                        localRead(fragsA, fragsB);
+                        if(readTile < mKTiles)
+                        {
+                            globalRead((i + ReadAhead) % PrefetchStages);
+                        }
+                        mfma(fragsAcc, fragsA, fragsB);
+                        if(writeTile < mKTiles)
+                        {
+                            localWrite((i + WriteAhead) % PrefetchStages);
+                        }
+
+                        GemmDriver::syncWorkgroup();
+                    }
+                }
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::tail(MfmaBuffAcc& fragsAcc)
+            {
+                MfmaBuffA fragsA;
+                MfmaBuffB fragsB;
+
+                localRead(fragsA, fragsB);
+                mfma(fragsAcc, fragsA, fragsB);
+            }
+
+            template <LdsRingT>
+            template <LdsRingMainloopT>
+            __device__ inline void
+                LdsRing<LdsRingT_impl>::Mainloop<LdsRingMainloopT_impl>::retarget(InputT const* a,
+                                                                                  InputT const* b)
+            {
+                // Every K tile was written to and read from LDS once,
+                // so the read and write stages are already aligned.
+                mAddrA = a;
+                mAddrB = b;
+            }
+
+#undef LdsRingT
+#undef LdsRingT_impl
+#undef LdsRingMainloopT
+#undef LdsRingMainloopT_impl
+
+        } // namespace Pipeline
+
+    } // namespace CooperativeGemm
+
+} // namespace rocwmma
+
+#endif // GEMM_PIPELINE_IMPL_HPP
@@ -0,0 +1,253 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gemm_reference_cache.hpp"
+#include "rocwmma_logging.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        // Bump when the entry format or the reference numerics change
+        constexpr uint32_t CacheVersion  = 1u;
+        constexpr char     CacheMagic[8] = {'R', 'W', 'M', 'M', 'A', 'R', 'E', 'F'};
+
+        // Payload starts at an aligned offset after the header and signature
+        constexpr size_t PayloadAlign = 64u;
+
+        struct EntryHeader
+        {
+            char     magic[8];
+            uint32_t version;
+            uint32_t signatureBytes;
+            uint64_t signatureHash;
+            uint64_t payloadBytes;
+        };
+
+        // FNV-1a
+        uint64_t hashSignature(std::string const& signature)
+        {
+            uint64_t hash = 0xcbf29ce484222325ull;
+            for(auto c : signature)
+            {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+
+        size_t payloadOffset(size_t signatureBytes)
+        {
+            auto offset = sizeof(EntryHeader) + signatureBytes;
+            return (offset + PayloadAlign - 1u) / PayloadAlign * PayloadAlign;
+        }
+
+        bool writeAll(int fd, void const* data, size_t bytes)
+        {
+            auto ptr = static_cast<char const*>(data);
+            while(bytes > 0u)
+            {
+                auto written = ::write(fd, ptr, bytes);
+                if(written <= 0)
+                {
+                    return false;
+                }
+                ptr += written;
+                bytes -= written;
+            }
+            return true;
+        }
+    }
+
+    GemmReferenceCache::EntryLock::EntryLock(int fd)
+        : mFd(fd)
+    {
+    }
+
+    GemmReferenceCache::EntryLock::EntryLock(EntryLock&& rhs)
+        : mFd(rhs.mFd)
+    {
+        rhs.mFd = -1;
+    }
+
+    GemmReferenceCache::EntryLock::~EntryLock()
+    {
+        if(mFd >= 0)
+        {
+            ::flock(mFd, LOCK_UN);
+            ::close(mFd);
+        }
+    }
+
+    GemmReferenceCache::GemmReferenceCache()
+        : mCacheDir(RocwmmaLogging::instance()->referenceCacheDir())
+    {
+        if(mCacheDir.empty())
+        {
+            if(auto env = std::getenv("ROCWMMA_REFERENCE_CACHE_DIR"))
+            {
+                mCacheDir = env;
+            }
+        }
+
+        if(!mCacheDir.empty())
+        {
+            // Tolerate existing or concurrently created dirs
+            ::mkdir(mCacheDir.c_str(), 0777);
+        }
+    }
+
+    bool GemmReferenceCache::enabled() const
+    {
+        return !mCacheDir.empty();
+    }
+
+    std::string GemmReferenceCache::entryPath(std::string const& signature) const
+    {
+        char name[32];
+        std::snprintf(name,
+                      sizeof(name),
+                      "%016llx.ref",
+                      static_cast<unsigned long long>(hashSignature(signature)));
+        return mCacheDir + "/" + name;
+    }
+
+    GemmReferenceCache::EntryLock GemmReferenceCache::lockEntry(std::string const& signature) const
+    {
+        if(!enabled())
+        {
+            return EntryLock();
+        }
+
+        auto lockPath = entryPath(signature) + ".lock";
+        int  fd       = ::open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        if(fd < 0 || ::flock(fd, LOCK_EX) != 0)
+        {
+            if(fd >= 0)
+            {
+                ::close(fd);
+            }
+            return EntryLock();
+        }
+        return EntryLock(fd);
+    }
+
+    bool GemmReferenceCache::load(std::string const& signature, void* data, size_t bytes) const
+    {
+        if(!enabled())
+        {
+            return false;
+        }
+
+        int fd = ::open(entryPath(signature).c_str(), O_RDONLY | O_CLOEXEC);
+        if(fd < 0)
+        {
+            return false;
+        }
+
+        bool        hit = false;
+        struct stat info;
+        auto        expectedSize = payloadOffset(signature.size()) + bytes;
+        if(::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) == expectedSize)
+        {
+            auto mapped = ::mmap(nullptr, expectedSize, PROT_READ, MAP_SHARED, fd, 0);
+            if(mapped != MAP_FAILED)
+            {
+                auto base   = static_cast<char const*>(mapped);
+                auto header = reinterpret_cast<EntryHeader const*>(base);
+
+                // Full signature check guards against hash collisions
+                hit = std::memcmp(header->magic, CacheMagic, sizeof(CacheMagic)) == 0
+                      && header->version == CacheVersion
+                      && header->signatureBytes == signature.size()
+                      && header->signatureHash == hashSignature(signature)
+                      && header->payloadBytes == bytes
+                      && std::memcmp(base + sizeof(EntryHeader), signature.data(), signature.size())
+                             == 0;
+
+                if(hit)
+                {
+                    std::memcpy(data, base + payloadOffset(signature.size()), bytes);
+                }
+                ::munmap(mapped, expectedSize);
+            }
+        }
+
+        ::close(fd);
+        return hit;
+    }
+
+    void GemmReferenceCache::store(std::string const& signature,
+                                   void const*        data,
+                                   size_t             bytes) const
+    {
+        if(!enabled())
+        {
+            return;
+        }
+
+        auto path    = entryPath(signature);
+        auto tmpPath = path + ".tmp." + std::to_string(::getpid());
+
+        int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+        if(fd < 0)
+        {
+            return;
+        }
+
+        EntryHeader header;
+        std::memcpy(header.magic, CacheMagic, sizeof(CacheMagic));
+        header.version        = CacheVersion;
+        header.signatureBytes = static_cast<uint32_t>(signature.size());
+        header.signatureHash  = hashSignature(signature);
+        header.payloadBytes   = bytes;
+
+        auto padding = std::string(
+            payloadOffset(signature.size()) - sizeof(EntryHeader) - signature.size(), '\0');
+
+        bool ok = writeAll(fd, &header, sizeof(header))
+                  && writeAll(fd, signature.data(), signature.size())
+                  && writeAll(fd, padding.data(), padding.size()) && writeAll(fd, data, bytes);
+        ok &= (::close(fd) == 0);
+
+        // Atomic publish; readers see either nothing or the whole entry
+        if(!ok || ::rename(tmpPath.c_str(), path.c_str()) != 0)
+        {
+            ::unlink(tmpPath.c_str());
+        }
+    }
+
+} // namespace rocwmma
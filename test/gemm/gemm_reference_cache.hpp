@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_REFERENCE_CACHE_HPP
+#define ROCWMMA_GEMM_REFERENCE_CACHE_HPP
+
+#include <string>
+
+#include "singleton.hpp"
+
+// GemmReferenceCache is a persistent, on-disk store of reference GEMM results.
+//
+// Reference results are fully determined by the problem signature (sizes,
+// types, layouts, alpha, beta and the input generator seed), and repeat
+// exactly across test binaries and kernel families. Entries are keyed by a
+// hash of the signature string, one file per entry, and read back via mmap.
+//
+// Concurrent test processes share the store safely:
+// - Entries are published with an atomic rename, so readers never observe
+//   partial files.
+// - An advisory per-entry lock (flock) lets one process compute a missing
+//   entry while the others wait and then hit.
+//
+// The cache is disabled unless a directory is given with
+// --reference_cache <dir> or the ROCWMMA_REFERENCE_CACHE_DIR environment variable.
+
+namespace rocwmma
+{
+    class GemmReferenceCache : public LazySingleton<GemmReferenceCache>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<GemmReferenceCache> std::make_unique<GemmReferenceCache>();
+
+        // Holds the advisory lock on one entry for its lifetime
+        class EntryLock
+        {
+        public:
+            EntryLock() = default;
+            explicit EntryLock(int fd);
+            EntryLock(EntryLock&& rhs);
+            ~EntryLock();
+
+            EntryLock(EntryLock const&)            = delete;
+            EntryLock& operator=(EntryLock const&) = delete;
+            EntryLock& operator=(EntryLock&&)      = delete;
+
+        private:
+            int mFd = -1;
+        };
+
+    private: // No public instantiation except make_unique.
+             // No copy
+        GemmReferenceCache();
+        GemmReferenceCache(GemmReferenceCache const&)            = delete;
+        GemmReferenceCache& operator=(GemmReferenceCache const&) = delete;
+
+    public:
+        ~GemmReferenceCache() = default;
+
+        bool enabled() const;
+
+        // Blocks until exclusive access to the entry is acquired.
+        // Returns an empty lock if the cache is disabled.
+        EntryLock lockEntry(std::string const& signature) const;
+
+        // Copies a cached result into data. Returns false on miss.
+        bool load(std::string const& signature, void* data, size_t bytes) const;
+
+        // Publishes a result. Failures are non-fatal: the cache is best effort.
+        void store(std::string const& signature, void const* data, size_t bytes) const;
+
+    private:
+        std::string entryPath(std::string const& signature) const;
+
+        std::string mCacheDir;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_REFERENCE_CACHE_HPP
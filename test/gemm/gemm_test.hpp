@@ -40,14 +40,16 @@ namespace rocwmma
                                                      typename GemmCommonTestParams::ThreadBlockT,
                                                      typename GemmCommonTestParams::ProblemSizeT,
                                                      typename GemmCommonTestParams::AlphaT,
-                                                     typename GemmCommonTestParams::BetaT>>
+                                                     typename GemmCommonTestParams::BetaT,
+                                                     typename GemmCommonTestParams::BatchCountT>>
     {
         using Base
             = ::testing::TestWithParam<std::tuple<typename GemmCommonTestParams::KernelT,
                                                   typename GemmCommonTestParams::ThreadBlockT,
                                                   typename GemmCommonTestParams::ProblemSizeT,
                                                   typename GemmCommonTestParams::AlphaT,
-                                                  typename GemmCommonTestParams::BetaT>>;
+                                                  typename GemmCommonTestParams::BetaT,
+                                                  typename GemmCommonTestParams::BatchCountT>>;
 
         void SetUp() override
         {
@@ -59,6 +61,7 @@ namespace rocwmma
             auto problemSize = std::get<2>(param);
             auto alpha       = std::get<3>(param);
             auto beta        = std::get<4>(param);
+            auto batchCount  = std::get<5>(param);
 
             // Cleanup previously used resources if the resource context changes.
             // This happens in GEMM when the Input/Output types change for test batches.
@@ -72,6 +75,13 @@ namespace rocwmma
 
             ProblemParams params = {threadBlock, problemSize, alpha, beta};
 
+            // Batch members are packed back to back
+            auto m              = std::get<0>(problemSize);
+            auto n              = std::get<1>(problemSize);
+            auto k              = std::get<2>(problemSize);
+            params.batchCount   = batchCount;
+            params.batchStrides = std::make_tuple(m * k, k * n, m * n, m * n);
+
             // Walk through kernel workflow
             kernel->setup(params);
         }
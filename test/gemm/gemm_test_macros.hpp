@@ -93,12 +93,14 @@
 /// test_params : the class generated by ROCWMMA_GENERATE_GEMM_GTEST_SUITE_PARAMS,
 /// which fulfills the rocwmma::GemmTest interface.
 ///
-#define ROCWMMA_GEMM_GTEST_PARAM_TRIAGE(test_params)                     \
-    ::testing::Combine(::testing::ValuesIn(test_params::kernels()),      \
-                       ::testing::ValuesIn(test_params::threadBlocks()), \
-                       ::testing::ValuesIn(test_params::problemSizes()), \
-                       ::testing::ValuesIn(test_params::alphas()),       \
-                       ::testing::ValuesIn(test_params::betas()))
+#define ROCWMMA_GEMM_GTEST_PARAM_TRIAGE(test_params)                                        \
+    ::testing::Combine(                                                                     \
+        ::testing::ValuesIn(test_params::kernels()),                                        \
+        ::testing::ValuesIn(test_params::threadBlocks()),                                   \
+        ::testing::ValuesIn(test_params::resolveProblemSizes(test_params::problemSizes())), \
+        ::testing::ValuesIn(test_params::alphas()),                                         \
+        ::testing::ValuesIn(test_params::betas()),                                          \
+        ::testing::ValuesIn(test_params::batchCounts()))
 
 ///
 /// Specific to GEMM gtest interface of rocwmma::GemmTest
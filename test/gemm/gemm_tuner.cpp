@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <iostream>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include "gemm_tuner.hpp"
+#include "rocwmma_logging.hpp"
+
+namespace rocwmma
+{
+    GemmTuner::GemmTuner()
+        : mTablePath(RocwmmaLogging::instance()->tuningTable())
+    {
+    }
+
+    GemmTuner::~GemmTuner()
+    {
+        flush();
+    }
+
+    bool GemmTuner::enabled() const
+    {
+        return !mTablePath.empty();
+    }
+
+    void GemmTuner::record(GemmTuningKey const& key, GemmTuningEntry const& entry)
+    {
+        if(enabled())
+        {
+            mResults.record(key, entry);
+        }
+    }
+
+    bool GemmTuner::flush()
+    {
+        if(!enabled() || mResults.size() == 0u)
+        {
+            return true;
+        }
+
+        // Serialize read-merge-write with other tuning processes
+        auto lockPath = mTablePath + ".lock";
+        int  fd       = ::open(lockPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        if(fd >= 0)
+        {
+            ::flock(fd, LOCK_EX);
+        }
+
+        std::string     error;
+        GemmTuningTable table;
+        bool            ok = table.load(mTablePath, error);
+        if(ok)
+        {
+            table.merge(mResults);
+
+            auto tmpPath = mTablePath + ".tmp." + std::to_string(::getpid());
+            {
+                std::ofstream file(tmpPath);
+                ok = file.is_open() && table.write(file).good();
+            }
+
+            // Atomic publish; readers see either the old or the new table
+            if(!ok || std::rename(tmpPath.c_str(), mTablePath.c_str()) != 0)
+            {
+                std::remove(tmpPath.c_str());
+                error = mTablePath + ": unable to write tuning table";
+                ok    = false;
+            }
+        }
+
+        if(fd >= 0)
+        {
+            ::flock(fd, LOCK_UN);
+            ::close(fd);
+        }
+
+        if(ok)
+        {
+            std::cout << "Tuning table " << mTablePath << ": merged " << mResults.size()
+                      << " results, " << table.size() << " entries" << std::endl;
+            mResults = GemmTuningTable();
+        }
+        else
+        {
+            std::cerr << error << std::endl;
+        }
+        return ok;
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TUNER_HPP
+#define ROCWMMA_GEMM_TUNER_HPP
+
+#include <string>
+
+#include "gemm_tuning_table.hpp"
+#include "singleton.hpp"
+
+// GemmTuner collects the fastest kernel configurations seen by a benchmark
+// run into a GemmTuningTable. Every benchmarked kernel is recorded; the
+// table keeps the winner per key and shape bucket.
+//
+// Results are merged into the table file on exit, under an advisory lock,
+// so several benchmark binaries (one per kernel family) can tune into the
+// same table, concurrently or one after the other.
+//
+// The tuner is disabled unless a table is given with --tuning_table <file>.
+// Sweep specific shapes with --problem_sizes.
+
+namespace rocwmma
+{
+    class GemmTuner : public LazySingleton<GemmTuner>
+    {
+    public:
+        // For static initialization
+        friend std::unique_ptr<GemmTuner> std::make_unique<GemmTuner>();
+
+    private: // No public instantiation except make_unique.
+             // No copy
+        GemmTuner();
+        GemmTuner(GemmTuner const&)            = delete;
+        GemmTuner& operator=(GemmTuner const&) = delete;
+
+    public:
+        ~GemmTuner();
+
+        bool enabled() const;
+
+        void record(GemmTuningKey const& key, GemmTuningEntry const& entry);
+
+        // Merges recorded results into the table file.
+        // Failures are reported but non-fatal.
+        bool flush();
+
+    private:
+        std::string     mTablePath;
+        GemmTuningTable mResults;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TUNER_HPP
@@ -0,0 +1,432 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_GEMM_TUNING_TABLE_HPP
+#define ROCWMMA_GEMM_TUNING_TABLE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <rocwmma/internal/types.hpp>
+
+// Tuning table of the fastest GEMM kernel configurations.
+//
+// Winners are recorded per key (arch, types, layouts) and shape bucket, the
+// nearest power of two of each of M, N and K. Lookups for arbitrary
+// (M, N, K) prefer the exact bucket, then the nearest tuned shape of the same
+// shape class, then the nearest tuned shape of any class, in log2 space.
+// Only configurations whose macro tile fits the problem are returned.
+//
+// The table is host-only and stored as versioned CSV text, so it can be
+// reviewed, diffed and tested without a device.
+
+namespace rocwmma
+{
+    struct GemmTuningKey
+    {
+        std::string arch; // E.g. gfx90a
+        std::string types; // Ti_To_Tc
+        std::string layouts; // LytA_LytB_LytC_LytD
+
+        bool operator<(GemmTuningKey const& rhs) const
+        {
+            return std::tie(arch, types, layouts) < std::tie(rhs.arch, rhs.types, rhs.layouts);
+        }
+    };
+
+    struct GemmTuningConfig
+    {
+        std::string kernel; // Kernel family, e.g. PGR1_LB2_MP0_MB_CP
+        std::string gemmConfig = "n/a"; // Cooperative GemmConfig or K partition, if any
+        std::string layoutLds  = "n/a";
+        uint32_t    blockM = 0u, blockN = 0u, blockK = 0u;
+        uint32_t    blocksX = 1u, blocksY = 1u;
+        uint32_t    tBlockX = 0u, tBlockY = 0u;
+        uint32_t    waveSize = 64u;
+
+        // Output coverage of one workgroup
+        uint32_t macroTileM() const
+        {
+            return blockM * blocksX * (waveSize > 0u ? tBlockX / waveSize : 0u);
+        }
+
+        uint32_t macroTileN() const
+        {
+            return blockN * blocksY * tBlockY;
+        }
+
+        bool fits(uint32_t m, uint32_t n, uint32_t k) const
+        {
+            return macroTileM() > 0u && macroTileM() <= m && macroTileN() > 0u
+                   && macroTileN() <= n && blockK <= k;
+        }
+
+        bool operator==(GemmTuningConfig const& rhs) const
+        {
+            return std::tie(kernel,
+                            gemmConfig,
+                            layoutLds,
+                            blockM,
+                            blockN,
+                            blockK,
+                            blocksX,
+                            blocksY,
+                            tBlockX,
+                            tBlockY,
+                            waveSize)
+                   == std::tie(rhs.kernel,
+                               rhs.gemmConfig,
+                               rhs.layoutLds,
+                               rhs.blockM,
+                               rhs.blockN,
+                               rhs.blockK,
+                               rhs.blocksX,
+                               rhs.blocksY,
+                               rhs.tBlockX,
+                               rhs.tBlockY,
+                               rhs.waveSize);
+        }
+    };
+
+    struct GemmTuningEntry
+    {
+        uint32_t         m = 0u, n = 0u, k = 0u; // Tuned problem size
+        GemmTuningConfig config;
+        float64_t        tflopsPerSec = 0.0;
+    };
+
+    // Shape classes partition problems by the M : N aspect and by the depth
+    // of K relative to the output, at a 4:1 ratio.
+    struct GemmShapeClass
+    {
+        enum : int32_t
+        {
+            Wide    = -1, // N >= 4M
+            Square  = 0,
+            Tall    = 1, // M >= 4N
+            Shallow = -1, // 4K <= min(M, N)
+            Deep    = 1 // K >= 4 max(M, N)
+        };
+
+        int32_t aspect = Square;
+        int32_t depth  = Square;
+
+        static GemmShapeClass classify(uint32_t m, uint32_t n, uint32_t k)
+        {
+            GemmShapeClass result;
+            auto           fm = static_cast<float64_t>(m);
+            auto           fn = static_cast<float64_t>(n);
+            auto           fk = static_cast<float64_t>(k);
+
+            result.aspect = (fm >= 4.0 * fn) ? Tall : (fn >= 4.0 * fm) ? Wide : Square;
+            result.depth  = (4.0 * fk <= std::min(fm, fn))   ? Shallow
+                            : (fk >= 4.0 * std::max(fm, fn)) ? Deep
+                                                             : Square;
+            return result;
+        }
+
+        bool operator==(GemmShapeClass const& rhs) const
+        {
+            return aspect == rhs.aspect && depth == rhs.depth;
+        }
+    };
+
+    class GemmTuningTable
+    {
+    public:
+        // Bump when columns or lookup semantics change
+        static constexpr uint32_t Version = 1u;
+
+        using Bucket = std::tuple<int32_t, int32_t, int32_t>;
+
+        static Bucket shapeBucket(uint32_t m, uint32_t n, uint32_t k)
+        {
+            auto log2Round = [](uint32_t x) {
+                return static_cast<int32_t>(std::lround(std::log2(std::max(x, 1u))));
+            };
+            return Bucket(log2Round(m), log2Round(n), log2Round(k));
+        }
+
+        // Keeps the fastest entry per key and bucket.
+        // Returns true if entry is the new winner.
+        bool record(GemmTuningKey const& key, GemmTuningEntry const& entry)
+        {
+            auto& buckets = mEntries[key];
+            auto  bucket  = shapeBucket(entry.m, entry.n, entry.k);
+            auto  it      = buckets.find(bucket);
+            if(it == buckets.end() || it->second.tflopsPerSec < entry.tflopsPerSec)
+            {
+                buckets[bucket] = entry;
+                return true;
+            }
+            return false;
+        }
+
+        void merge(GemmTuningTable const& other)
+        {
+            for(auto& key : other.mEntries)
+            {
+                for(auto& bucket : key.second)
+                {
+                    record(key.first, bucket.second);
+                }
+            }
+        }
+
+        size_t size() const
+        {
+            size_t count = 0u;
+            for(auto& key : mEntries)
+            {
+                count += key.second.size();
+            }
+            return count;
+        }
+
+        // Best known configuration for an arbitrary problem, or nullptr if no
+        // tuned configuration of this key fits.
+        GemmTuningEntry const* lookup(GemmTuningKey const& key,
+                                      uint32_t             m,
+                                      uint32_t             n,
+                                      uint32_t             k) const
+        {
+            auto keyIt = mEntries.find(key);
+            if(keyIt == mEntries.end())
+            {
+                return nullptr;
+            }
+
+            auto const& buckets = keyIt->second;
+            auto        exact   = buckets.find(shapeBucket(m, n, k));
+            if(exact != buckets.end() && exact->second.config.fits(m, n, k))
+            {
+                return &exact->second;
+            }
+
+            auto shapeClass = GemmShapeClass::classify(m, n, k);
+            auto logM       = std::log2(std::max(m, 1u));
+            auto logN       = std::log2(std::max(n, 1u));
+            auto logK       = std::log2(std::max(k, 1u));
+
+            GemmTuningEntry const* best = nullptr;
+            auto                   bestScore
+                = std::make_tuple(true, std::numeric_limits<float64_t>::max(), 0.0);
+
+            for(auto& bucket : buckets)
+            {
+                auto& entry = bucket.second;
+                if(!entry.config.fits(m, n, k))
+                {
+                    continue;
+                }
+
+                auto dm = std::log2(std::max(entry.m, 1u)) - logM;
+                auto dn = std::log2(std::max(entry.n, 1u)) - logN;
+                auto dk = std::log2(std::max(entry.k, 1u)) - logK;
+
+                // Same class first, then distance, then throughput
+                auto score = std::make_tuple(
+                    !(GemmShapeClass::classify(entry.m, entry.n, entry.k) == shapeClass),
+                    dm * dm + dn * dn + dk * dk,
+                    -entry.tflopsPerSec);
+
+                if(best == nullptr || score < bestScore)
+                {
+                    best      = &entry;
+                    bestScore = score;
+                }
+            }
+
+            return best;
+        }
+
+        std::ostream& write(std::ostream& stream) const
+        {
+            stream << "# rocWMMA gemm tuning table\n"
+                   << "version, " << Version << "\n"
+                   << "Arch, Types, Layouts, MatM, MatN, MatK, Kernel, GemmConfig, LytLds, "
+                      "BlkM, BlkN, BlkK, BlocksX, BlocksY, TBlkX, TBlkY, WaveSize, TFlops/s\n";
+
+            for(auto& key : mEntries)
+            {
+                for(auto& bucket : key.second)
+                {
+                    auto& e = bucket.second;
+                    auto& c = e.config;
+                    stream << key.first.arch << ", " << key.first.types << ", "
+                           << key.first.layouts << ", " << e.m << ", " << e.n << ", " << e.k
+                           << ", " << c.kernel << ", " << c.gemmConfig << ", " << c.layoutLds
+                           << ", " << c.blockM << ", " << c.blockN << ", " << c.blockK << ", "
+                           << c.blocksX << ", " << c.blocksY << ", " << c.tBlockX << ", "
+                           << c.tBlockY << ", " << c.waveSize << ", " << e.tflopsPerSec << "\n";
+                }
+            }
+            return stream;
+        }
+
+        // Replaces the contents. Rejects other versions rather than guessing.
+        bool read(std::istream& stream, std::string& error)
+        {
+            mEntries.clear();
+
+            std::string line;
+            uint32_t    lineNum = 0u;
+            bool        header  = false;
+            bool        columns = false;
+
+            while(std::getline(stream, line))
+            {
+                lineNum++;
+                if(line.empty() || line[0] == '#')
+                {
+                    continue;
+                }
+
+                auto fields = split(line);
+                if(!header)
+                {
+                    if(fields.size() != 2u || fields[0] != "version")
+                    {
+                        error = "missing tuning table version";
+                        return false;
+                    }
+                    if(fields[1] != std::to_string(Version))
+                    {
+                        error = "unsupported tuning table version " + fields[1];
+                        return false;
+                    }
+                    header = true;
+                    continue;
+                }
+
+                if(!columns)
+                {
+                    // Column names
+                    columns = true;
+                    continue;
+                }
+
+                GemmTuningKey   key;
+                GemmTuningEntry e;
+                auto&           c = e.config;
+                if(fields.size() != 18u)
+                {
+                    error = "malformed tuning table line " + std::to_string(lineNum);
+                    mEntries.clear();
+                    return false;
+                }
+
+                key.arch     = fields[0];
+                key.types    = fields[1];
+                key.layouts  = fields[2];
+                c.kernel     = fields[6];
+                c.gemmConfig = fields[7];
+                c.layoutLds  = fields[8];
+
+                try
+                {
+                    e.m            = std::stoul(fields[3]);
+                    e.n            = std::stoul(fields[4]);
+                    e.k            = std::stoul(fields[5]);
+                    c.blockM       = std::stoul(fields[9]);
+                    c.blockN       = std::stoul(fields[10]);
+                    c.blockK       = std::stoul(fields[11]);
+                    c.blocksX      = std::stoul(fields[12]);
+                    c.blocksY      = std::stoul(fields[13]);
+                    c.tBlockX      = std::stoul(fields[14]);
+                    c.tBlockY      = std::stoul(fields[15]);
+                    c.waveSize     = std::stoul(fields[16]);
+                    e.tflopsPerSec = std::stod(fields[17]);
+                }
+                catch(std::exception const&)
+                {
+                    error = "malformed tuning table line " + std::to_string(lineNum);
+                    mEntries.clear();
+                    return false;
+                }
+
+                record(key, e);
+            }
+
+            if(!header)
+            {
+                error = "missing tuning table version";
+                return false;
+            }
+            return true;
+        }
+
+        // A missing file is an empty table
+        bool load(std::string const& path, std::string& error)
+        {
+            std::ifstream file(path);
+            if(!file.is_open())
+            {
+                mEntries.clear();
+                return true;
+            }
+
+            if(!read(file, error))
+            {
+                error = path + ": " + error;
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        static std::vector<std::string> split(std::string const& line)
+        {
+            std::vector<std::string> fields;
+            std::stringstream        ss(line);
+            std::string              field;
+            while(std::getline(ss, field, ','))
+            {
+                auto first = field.find_first_not_of(" \t\r");
+                auto last  = field.find_last_not_of(" \t\r");
+                fields.push_back(first == std::string::npos
+                                     ? std::string()
+                                     : field.substr(first, last - first + 1u));
+            }
+            return fields;
+        }
+
+        std::map<GemmTuningKey, std::map<Bucket, GemmTuningEntry>> mEntries;
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_GEMM_TUNING_TABLE_HPP
@@ -182,6 +182,36 @@ namespace rocwmma
         return mCurFreqMhz;
     }
 
+    double HipDevice::peakHbmGBytesPerSec() const
+    {
+        switch(mGcnArch)
+        {
+        case hipGcnArch_t::GFX908:
+            return MemoryPerfTraits<ArchGfx908>::HbmGBytesPerSec;
+
+        case hipGcnArch_t::GFX90A:
+            return MemoryPerfTraits<ArchGfx90a>::HbmGBytesPerSec;
+
+        default:
+            return calculatePeakHbmGBytesPerSec(mProps.memoryClockRate, mProps.memoryBusWidth);
+        }
+    }
+
+    double HipDevice::peakLdsGBytesPerSec() const
+    {
+        switch(mGcnArch)
+        {
+        case hipGcnArch_t::GFX908:
+            return calculatePeakLdsGBytesPerSec<ArchGfx908>(mCurFreqMhz, mCuCount);
+
+        case hipGcnArch_t::GFX90A:
+            return calculatePeakLdsGBytesPerSec<ArchGfx90a>(mCurFreqMhz, mCuCount);
+
+        default:
+            return calculatePeakLdsGBytesPerSec(mCurFreqMhz, mCuCount);
+        }
+    }
+
     HipDevice::~HipDevice()
     {
 #ifdef ROCWMMA_BENCHMARK_TESTS
@@ -190,8 +220,10 @@ namespace rocwmma
 #endif
     }
 
+#if !ROCWMMA_TESTS_NO_DEVICE
     // Need to check the host device target support statically before hip modules attempt
     // to load any kernels. Not safe to proceed if the host device is unsupported.
+    // Tests that run entirely on the host backend opt out with ROCWMMA_TESTS_NO_DEVICE.
     struct HipStaticDeviceGuard
     {
         static bool testSupportedDevice()
@@ -211,5 +243,6 @@ namespace rocwmma
     };
 
     bool HipStaticDeviceGuard::sResult = HipStaticDeviceGuard::testSupportedDevice();
+#endif // !ROCWMMA_TESTS_NO_DEVICE
 
 } // namespace rocwmma
@@ -82,6 +82,10 @@ namespace rocwmma
         template <typename InputT>
         double peakGFlopsPerSec() const;
 
+        // Memory system peaks for roofline bounds
+        double peakHbmGBytesPerSec() const;
+        double peakLdsGBytesPerSec() const;
+
         ~HipDevice();
 
     private:
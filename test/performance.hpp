@@ -367,6 +367,42 @@ namespace rocwmma
     };
 #endif // !ROCWMMA_TESTS_NO_HALF
 
+    // Memory system peaks for roofline bounds.
+    // HBM bandwidth is per visible device (one GCD on multi-die parts).
+    // LDS bandwidth is per CU per clock. DefaultArch HBM bandwidth is
+    // derived from device properties instead.
+    template <typename GfxArch>
+    struct MemoryPerfTraits
+    {
+        enum : uint32_t
+        {
+            HbmGBytesPerSec = 0,
+            LdsBytesPerClk  = 128
+        };
+    };
+
+    // MI-100
+    template <>
+    struct MemoryPerfTraits<ArchGfx908>
+    {
+        enum : uint32_t
+        {
+            HbmGBytesPerSec = 1229,
+            LdsBytesPerClk  = 128
+        };
+    };
+
+    // MI-200 (per GCD)
+    template <>
+    struct MemoryPerfTraits<ArchGfx90a>
+    {
+        enum : uint32_t
+        {
+            HbmGBytesPerSec = 1638,
+            LdsBytesPerClk  = 128
+        };
+    };
+
     inline double calculateGFlops(uint32_t m, uint32_t n, uint32_t k)
     {
         return 2.0 * static_cast<double>(m) * static_cast<double>(n) * static_cast<double>(k)
@@ -387,6 +423,20 @@ namespace rocwmma
                * static_cast<double>(cuCount) * static_cast<double>(freqMHz) * 1.0e-3;
     }
 
+    template <typename GfxArch = DefaultArch>
+    inline double calculatePeakLdsGBytesPerSec(uint32_t freqMHz, uint32_t cuCount)
+    {
+        return static_cast<double>(MemoryPerfTraits<GfxArch>::LdsBytesPerClk)
+               * static_cast<double>(cuCount) * static_cast<double>(freqMHz) * 1.0e-3;
+    }
+
+    // DDR: two transfers per memory clock
+    inline double calculatePeakHbmGBytesPerSec(uint32_t memFreqKHz, uint32_t busWidthBits)
+    {
+        return 2.0 * static_cast<double>(memFreqKHz) * 1.0e-6
+               * static_cast<double>(busWidthBits / 8u);
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_PERFORMANCE_HPP
@@ -51,6 +51,30 @@ namespace rocwmma
                   ComputeT       alpha,
                   ComputeT       beta);
 
+    // gemm_CPU over batchCount problems, member i of each matrix
+    // starting at i * stride elements.
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_strided_batched_CPU(uint32_t       m,
+                                  uint32_t       n,
+                                  uint32_t       k,
+                                  InputT const*  a,
+                                  InputT const*  b,
+                                  OutputT const* c,
+                                  OutputT*       d,
+                                  ComputeT       alpha,
+                                  ComputeT       beta,
+                                  uint32_t       batchCount,
+                                  uint64_t       strideA,
+                                  uint64_t       strideB,
+                                  uint64_t       strideC,
+                                  uint64_t       strideD);
+
     template <typename DataT>
     void
         dlrm_fwd_CPU(DataT const* input, DataT* output, uint32_t m, uint32_t k, uint32_t batchSize);
@@ -64,6 +88,18 @@ namespace rocwmma
                       uint32_t     k,
                       uint32_t     batchSize);
 
+    // Scaled dot product attention, softmax(Q K^T / sqrt(headDim)) V, over
+    // batchHeads contiguous [seqLen x headDim] row_major heads.
+    template <typename DataT>
+    void attention_fwd_CPU(DataT const* q,
+                           DataT const* k,
+                           DataT const* v,
+                           DataT*       o,
+                           uint32_t     seqLen,
+                           uint32_t     headDim,
+                           uint32_t     batchHeads,
+                           bool         causal);
+
     template <uint32_t ElementIdx,
               uint32_t GroupSize,
               uint32_t RowMask   = 0xF,
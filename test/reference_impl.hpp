@@ -26,6 +26,13 @@
 #ifndef ROCWMMA_REFERENCE_IMPL_HPP
 #define ROCWMMA_REFERENCE_IMPL_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <rocwmma/internal/host_gemm.hpp>
+
 #include "hip_device.hpp"
 #include "reference.hpp"
 
@@ -49,33 +56,60 @@ namespace rocwmma
                   ComputeT       alpha,
                   ComputeT       beta)
     {
-        int lda = std::is_same<LayoutA, row_major>::value ? k : m;
-        int ldb = std::is_same<LayoutB, row_major>::value ? n : k;
-        int ldc = std::is_same<LayoutC, row_major>::value ? n : m;
-        int ldd = std::is_same<LayoutD, row_major>::value ? n : m;
-
-        auto rowMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return row * ld + col; };
-        auto colMjr = [](uint32_t row, uint32_t col, uint32_t ld) { return col * ld + row; };
-
-        auto aIndex = std::is_same<LayoutA, row_major>::value ? rowMjr : colMjr;
-        auto bIndex = std::is_same<LayoutB, row_major>::value ? rowMjr : colMjr;
-        auto cIndex = std::is_same<LayoutC, row_major>::value ? rowMjr : colMjr;
-        auto dIndex = std::is_same<LayoutD, row_major>::value ? rowMjr : colMjr;
+        gemm_blocked_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+            m,
+            n,
+            k,
+            a,
+            b,
+            c,
+            d,
+            std::is_same<LayoutA, row_major>::value ? k : m,
+            std::is_same<LayoutB, row_major>::value ? n : k,
+            std::is_same<LayoutC, row_major>::value ? n : m,
+            std::is_same<LayoutD, row_major>::value ? n : m,
+            alpha,
+            beta);
+    }
 
-#pragma omp parallel for
-        for(int i = 0; i < m; ++i)
+    template <typename InputT,
+              typename OutputT,
+              typename ComputeT,
+              typename LayoutA,
+              typename LayoutB,
+              typename LayoutC,
+              typename LayoutD>
+    void gemm_strided_batched_CPU(uint32_t       m,
+                                  uint32_t       n,
+                                  uint32_t       k,
+                                  InputT const*  a,
+                                  InputT const*  b,
+                                  OutputT const* c,
+                                  OutputT*       d,
+                                  ComputeT       alpha,
+                                  ComputeT       beta,
+                                  uint32_t       batchCount,
+                                  uint64_t       strideA,
+                                  uint64_t       strideB,
+                                  uint64_t       strideC,
+                                  uint64_t       strideD)
+    {
+        // Batched problems are typically small, so threads split the batch and
+        // each gemm_CPU call runs its own (nested, hence serial) parallel region.
+        // A single problem keeps gemm_CPU's internal parallelism.
+#pragma omp parallel for schedule(dynamic) if(batchCount > 1u)
+        for(int64_t i = 0; i < static_cast<int64_t>(batchCount); i++)
         {
-            for(int j = 0; j < n; ++j)
-            {
-                ComputeT accum = static_cast<ComputeT>(0);
-                for(int h = 0; h < k; ++h)
-                {
-                    accum += static_cast<ComputeT>(a[aIndex(i, h, lda)])
-                             * static_cast<ComputeT>(b[bIndex(h, j, ldb)]);
-                }
-                d[dIndex(i, j, ldd)] = static_cast<OutputT>(
-                    alpha * accum + beta * static_cast<ComputeT>(c[cIndex(i, j, ldc)]));
-            }
+            gemm_CPU<InputT, OutputT, ComputeT, LayoutA, LayoutB, LayoutC, LayoutD>(
+                m,
+                n,
+                k,
+                a + i * strideA,
+                b + i * strideB,
+                c + i * strideC,
+                d + i * strideD,
+                alpha,
+                beta);
         }
     }
 
@@ -177,6 +211,66 @@ namespace rocwmma
         delete[] acc;
     }
 
+    template <typename DataT>
+    void attention_fwd_CPU(DataT const* q,
+                           DataT const* k,
+                           DataT const* v,
+                           DataT*       o,
+                           uint32_t     seqLen,
+                           uint32_t     headDim,
+                           uint32_t     batchHeads,
+                           bool         causal)
+    {
+        auto scale = 1.0f / std::sqrt(static_cast<float>(headDim));
+
+#pragma omp parallel for collapse(2)
+        for(uint32_t bh = 0; bh < batchHeads; bh++)
+        {
+            for(uint32_t i = 0; i < seqLen; i++)
+            {
+                auto headOffset = static_cast<int64_t>(bh) * seqLen * headDim;
+                auto* qRow      = q + headOffset + static_cast<int64_t>(i) * headDim;
+
+                // Keys past the query row are masked out of the causal softmax
+                auto keyCount = causal ? i + 1u : seqLen;
+
+                std::vector<float> scores(keyCount);
+                float              rowMax = -std::numeric_limits<float>::infinity();
+                for(uint32_t j = 0; j < keyCount; j++)
+                {
+                    auto* kRow  = k + headOffset + static_cast<int64_t>(j) * headDim;
+                    float accum = 0.0f;
+                    for(uint32_t h = 0; h < headDim; h++)
+                    {
+                        accum += static_cast<float>(qRow[h]) * static_cast<float>(kRow[h]);
+                    }
+                    scores[j] = accum * scale;
+                    rowMax    = std::max(rowMax, scores[j]);
+                }
+
+                float rowSum = 0.0f;
+                for(uint32_t j = 0; j < keyCount; j++)
+                {
+                    scores[j] = std::exp(scores[j] - rowMax);
+                    rowSum += scores[j];
+                }
+
+                for(uint32_t h = 0; h < headDim; h++)
+                {
+                    float accum = 0.0f;
+                    for(uint32_t j = 0; j < keyCount; j++)
+                    {
+                        accum += scores[j]
+                                 * static_cast<float>(
+                                     v[headOffset + static_cast<int64_t>(j) * headDim + h]);
+                    }
+                    o[headOffset + static_cast<int64_t>(i) * headDim + h]
+                        = static_cast<DataT>(accum / rowSum);
+                }
+            }
+        }
+    }
+
     template <uint32_t ElementIdx,
               uint32_t GroupSize,
               uint32_t RowMask /* = 0xF */,
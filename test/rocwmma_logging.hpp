@@ -27,10 +27,15 @@
 #ifndef ROCWMMA_LOGGING_HPP
 #define ROCWMMA_LOGGING_HPP
 
+#include "bench_stats.hpp"
 #include "rocwmma/rocwmma-version.hpp"
 #include "rocwmma_ostream.hpp"
 #include "singleton.hpp"
+#include <cstdio>
 #include <stdlib.h>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace rocwmma
 {
@@ -101,11 +106,107 @@ namespace rocwmma
                     }
                     setOmits(std::stoi(args[i + 1]));
                 }
+                if(args[i] == "--bench_warmup" || args[i] == "--bench_iters"
+                   || args[i] == "--bench_max_iters" || args[i] == "--bench_target_cv"
+                   || args[i] == "--bench_json")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing value for " << args[i] << "\n";
+                        std::cerr << "Usage: " << args[i] << " *value*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    parseBenchOption(args[i], args[i + 1]);
+                    i++;
+                }
+                if(args[i] == "--reference_cache")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing reference cache directory\n";
+                        std::cerr << "Usage: --reference_cache *dir*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mReferenceCacheDir = args[i + 1];
+                    i++;
+                }
+                if(args[i] == "--tuning_table")
+                {
+                    if(i + 2 >= argc)
+                    {
+                        std::cerr << "Missing tuning table file\n";
+                        std::cerr << "Usage: --tuning_table *file*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    mTuningTable = args[i + 1];
+                    i++;
+                }
+                if(args[i] == "--problem_sizes")
+                {
+                    if(i + 2 >= argc || !parseProblemSizes(args[i + 1]))
+                    {
+                        std::cerr << "Missing or invalid problem sizes\n";
+                        std::cerr << "Usage: --problem_sizes *MxNxK[,MxNxK...]*\n";
+                        exit(EXIT_FAILURE);
+                    }
+                    i++;
+                }
             }
 
             mOstream.initializeStream(fileName);
         }
 
+        void parseBenchOption(std::string const& option, std::string const& value)
+        {
+            if(option == "--bench_warmup")
+            {
+                mBenchConfig.warmup = std::stoi(value);
+            }
+            else if(option == "--bench_iters")
+            {
+                mBenchConfig.iterations = std::stoi(value);
+            }
+            else if(option == "--bench_max_iters")
+            {
+                mBenchConfig.maxIterations = std::stoi(value);
+            }
+            else if(option == "--bench_target_cv")
+            {
+                mBenchConfig.targetCv = std::stod(value);
+            }
+            else if(option == "--bench_json")
+            {
+                mBenchJson.open(value);
+            }
+        }
+
+        // Comma separated list of MxNxK
+        bool parseProblemSizes(std::string const& value)
+        {
+            mProblemSizes.clear();
+
+            size_t begin = 0u;
+            while(begin <= value.size())
+            {
+                auto end = value.find(',', begin);
+                end      = (end == std::string::npos) ? value.size() : end;
+
+                long long m, n, k;
+                char      tail;
+                auto      size = value.substr(begin, end - begin);
+                if(std::sscanf(size.c_str(), "%lldx%lldx%lld%c", &m, &n, &k, &tail) != 3 || m <= 0
+                   || n <= 0 || k <= 0)
+                {
+                    mProblemSizes.clear();
+                    return false;
+                }
+
+                mProblemSizes.emplace_back(m, n, k);
+                begin = end + 1u;
+            }
+            return true;
+        }
+
         rocwmmaOStream& ostream()
         {
             return mOstream;
@@ -131,10 +232,45 @@ namespace rocwmma
             return mOmitCout;
         }
 
+        std::string const& referenceCacheDir() const
+        {
+            return mReferenceCacheDir;
+        }
+
+        std::string const& tuningTable() const
+        {
+            return mTuningTable;
+        }
+
+        // Problem sizes overriding the test defaults, if any
+        std::vector<std::tuple<int64_t, int64_t, int64_t>> const& problemSizes() const
+        {
+            return mProblemSizes;
+        }
+
+        BenchConfig const& benchConfig() const
+        {
+            return mBenchConfig;
+        }
+
+        // Per-kernel timing distributions as JSON lines, if requested
+        std::ofstream& benchJson()
+        {
+            return mBenchJson;
+        }
+
     protected:
         rocwmmaOStream mOstream;
 
         bool mOmitSkipped, mOmitFailed, mOmitPassed, mOmitCout;
+
+        std::string mReferenceCacheDir;
+        std::string mTuningTable;
+
+        std::vector<std::tuple<int64_t, int64_t, int64_t>> mProblemSizes;
+
+        BenchConfig   mBenchConfig;
+        std::ofstream mBenchJson;
     };
 }
 
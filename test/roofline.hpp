@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_TEST_ROOFLINE_HPP
+#define ROCWMMA_TEST_ROOFLINE_HPP
+
+#include <algorithm>
+
+#include <rocwmma/internal/types.hpp>
+
+// Roofline bounds for tiled GEMM kernels.
+// Both global and LDS traffic follow the launched tiling: every macro tile
+// streams its own A / B panels, so the memory roof reflects the reuse the
+// tiling actually achieves rather than the compulsory best case.
+
+namespace rocwmma
+{
+    struct RooflineTraffic
+    {
+        float64_t globalReadBytes  = 0.0;
+        float64_t globalWriteBytes = 0.0;
+        float64_t ldsBytes         = 0.0; // LDS writes + reads
+    };
+
+    struct RooflineResult
+    {
+        float64_t arithmeticIntensity = 0.0; // Flop / global byte
+        float64_t ldsIntensity        = 0.0; // Flop / LDS byte (0 if no LDS)
+        float64_t computeTFlopsPerSec = 0.0;
+        float64_t memoryTFlopsPerSec  = 0.0;
+        float64_t ldsTFlopsPerSec     = 0.0; // 0 if no LDS
+        float64_t boundTFlopsPerSec   = 0.0; // Min of the above
+        float64_t achievedPercent     = 0.0; // Measured / bound
+        char const* bound             = "n/a"; // "compute", "memory" or "lds"
+    };
+
+    // tilesM x tilesN workgroups, each of wavesM x wavesN waves.
+    // Every workgroup reads the A rows and B cols of its macro tile from
+    // global memory, so A is read tilesN times and B tilesM times. C / D are
+    // touched once. With LDS staging, the same panels are written to LDS and
+    // each wave reads back the rows / cols of its own sub tile.
+    inline RooflineTraffic calculateGemmTraffic(uint32_t m,
+                                                uint32_t n,
+                                                uint32_t k,
+                                                uint32_t tilesM,
+                                                uint32_t tilesN,
+                                                uint32_t wavesM,
+                                                uint32_t wavesN,
+                                                uint32_t inputBytes,
+                                                uint32_t outputBytes,
+                                                bool     readC,
+                                                bool     usesLds)
+    {
+        auto M = static_cast<float64_t>(m);
+        auto N = static_cast<float64_t>(n);
+        auto K = static_cast<float64_t>(k);
+
+        RooflineTraffic traffic;
+        traffic.globalReadBytes  = (M * K * tilesN + K * N * tilesM) * inputBytes
+                                   + (readC ? M * N * outputBytes : 0.0);
+        traffic.globalWriteBytes = M * N * outputBytes;
+
+        if(usesLds)
+        {
+            auto ldsWrites   = (M * K * tilesN + K * N * tilesM) * inputBytes;
+            auto ldsReads    = K * (M * wavesN * tilesN + N * wavesM * tilesM) * inputBytes;
+            traffic.ldsBytes = ldsWrites + ldsReads;
+        }
+
+        return traffic;
+    }
+
+    inline RooflineResult calculateRoofline(float64_t              gFlops,
+                                            RooflineTraffic const& traffic,
+                                            float64_t              measuredTFlopsPerSec,
+                                            float64_t              peakGFlopsPerSec,
+                                            float64_t              peakHbmGBytesPerSec,
+                                            float64_t              peakLdsGBytesPerSec)
+    {
+        RooflineResult result;
+
+        auto flops       = gFlops * 1.0e9;
+        auto globalBytes = traffic.globalReadBytes + traffic.globalWriteBytes;
+
+        result.arithmeticIntensity = globalBytes > 0.0 ? flops / globalBytes : 0.0;
+        result.ldsIntensity        = traffic.ldsBytes > 0.0 ? flops / traffic.ldsBytes : 0.0;
+
+        // GB/s * Flop/B = GFlop/s
+        result.computeTFlopsPerSec = peakGFlopsPerSec * 1.0e-3;
+        result.memoryTFlopsPerSec  = result.arithmeticIntensity * peakHbmGBytesPerSec * 1.0e-3;
+        result.ldsTFlopsPerSec     = result.ldsIntensity * peakLdsGBytesPerSec * 1.0e-3;
+
+        result.boundTFlopsPerSec = result.computeTFlopsPerSec;
+        result.bound             = "compute";
+        if(result.memoryTFlopsPerSec > 0.0
+           && result.memoryTFlopsPerSec < result.boundTFlopsPerSec)
+        {
+            result.boundTFlopsPerSec = result.memoryTFlopsPerSec;
+            result.bound             = "memory";
+        }
+        if(result.ldsTFlopsPerSec > 0.0 && result.ldsTFlopsPerSec < result.boundTFlopsPerSec)
+        {
+            result.boundTFlopsPerSec = result.ldsTFlopsPerSec;
+            result.bound             = "lds";
+        }
+
+        result.achievedPercent = result.boundTFlopsPerSec > 0.0
+                                     ? measuredTFlopsPerSec / result.boundTFlopsPerSec * 100.0
+                                     : 0.0;
+        return result;
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_TEST_ROOFLINE_HPP
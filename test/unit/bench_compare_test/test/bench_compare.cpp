@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bench_compare/bench_compare.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        std::string const CsvHeader
+            = "TBlkX, TBlkY, BlkM, BlkN, BlkK, MatM, MatN, MatK, alpha, lda, ldb, beta, ldc, ldd, "
+              "LytA_LytB_LytC_LytD, Ti_To_Tc, elapsedMs, Problem Size(GFlops), TFlops/s, "
+              "Efficiency(%), SamplesMs, Result\n";
+
+        std::string csvRow(uint32_t blkM, std::string const& samples, std::string const& result)
+        {
+            std::stringstream ss;
+            ss << "128, 2, " << blkM << ", " << blkM << ", 16, 256, 256, 256, 2, 256, 256, 2, 256, "
+               << "256, R_C_R_R, f16_f32_f32, 1.0, 0.03, 0.5, 10, " << samples << ", " << result
+               << "\n";
+            return ss.str();
+        }
+
+        BenchRecord makeRecord(std::string const& signature, std::vector<float64_t> samples)
+        {
+            BenchRecord record;
+            record.signature    = signature;
+            record.tflopsPerSec = 1.0;
+            record.samples      = std::move(samples);
+            return record;
+        }
+    } // namespace
+
+    TEST(BenchCompareTest, ParseCsv)
+    {
+        std::stringstream ss;
+        ss << "[ RUN      ] gtest noise\n"
+           << CsvHeader << csvRow(16, "1;2;3", "BENCH") << csvRow(32, "", "PASSED")
+           << "128, 2, 64, 64, 16, 256, 256, 256, 2, 256, 256, 2, 256, 256, R_C_R_R, "
+              "f16_f32_f32, n/a, n/a, n/a, n/a, n/a, SKIPPED\n";
+
+        BenchRun run;
+        EXPECT_EQ(parseBenchOutput(ss, run, "gemm"), 2u);
+        ASSERT_EQ(run.records.size(), 2u);
+
+        auto record = run.find("gemm/f16_f32_f32|R_C_R_R|16x16x16|128x2|256x256x256");
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->samples, (std::vector<float64_t>{1.0, 2.0, 3.0}));
+        EXPECT_DOUBLE_EQ(record->tflopsPerSec, 0.5);
+
+        // No distribution: elapsedMs is the single sample
+        record = run.find("gemm/f16_f32_f32|R_C_R_R|32x32x16|128x2|256x256x256");
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->samples, (std::vector<float64_t>{1.0}));
+    }
+
+    TEST(BenchCompareTest, ParseCsvKernelConfig)
+    {
+        // Kernel specific columns lead the header and key the signature
+        std::stringstream ss;
+        ss << "GemmConfig, LytLds, BlocksX, BlocksY, " << CsvHeader << "Block_LdsNT, C, 2, 2, "
+           << csvRow(16, "1", "BENCH") << "Block_LdsTN, C, 2, 2, " << csvRow(16, "2", "BENCH");
+
+        BenchRun run;
+        EXPECT_EQ(parseBenchOutput(ss, run, ""), 2u);
+        ASSERT_EQ(run.records.size(), 2u);
+        EXPECT_NE(run.find("f16_f32_f32|R_C_R_R|16x16x16|128x2|256x256x256|Block_LdsNT_C_2_2"),
+                  nullptr);
+        EXPECT_NE(run.find("f16_f32_f32|R_C_R_R|16x16x16|128x2|256x256x256|Block_LdsTN_C_2_2"),
+                  nullptr);
+    }
+
+    TEST(BenchCompareTest, ParseJsonLines)
+    {
+        std::stringstream ss;
+        ss << "{\"TBlkX\": 64, \"TBlkY\": 4, \"BlkM\": 32, \"BlkN\": 32, \"BlkK\": 8, "
+              "\"MatM\": 512, \"MatN\": 512, \"MatK\": 128, \"Layouts\": \"C_R_C_C\", "
+              "\"Types\": \"bf16_f32_f32\", \"TFlops/s\": 12.5, \"Bound\": \"lds\", "
+              "\"samples\": 3, \"median\": 2, \"distribution\": [2.5, 2, 1.5]}\n";
+
+        BenchRun run;
+        EXPECT_EQ(parseBenchOutput(ss, run, ""), 1u);
+
+        auto record = run.find("bf16_f32_f32|C_R_C_C|32x32x8|64x4|512x512x128");
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->samples, (std::vector<float64_t>{2.5, 2.0, 1.5}));
+        EXPECT_DOUBLE_EQ(record->tflopsPerSec, 12.5);
+    }
+
+    TEST(BenchCompareTest, ParseBatchedProblems)
+    {
+        // Unit batches keep the single gemm key, larger batches are keyed apart
+        std::stringstream ss;
+        ss << "{\"TBlkX\": 64, \"TBlkY\": 1, \"BlkM\": 16, \"BlkN\": 16, \"BlkK\": 16, "
+              "\"MatM\": 64, \"MatN\": 64, \"MatK\": 64, \"Batch\": 1, \"Layouts\": \"R_C_R_R\", "
+              "\"Types\": \"f16_f32_f32\", \"TFlops/s\": 1.5, \"median\": 2}\n"
+           << "{\"TBlkX\": 64, \"TBlkY\": 1, \"BlkM\": 16, \"BlkN\": 16, \"BlkK\": 16, "
+              "\"MatM\": 64, \"MatN\": 64, \"MatK\": 64, \"Batch\": 1024, \"Layouts\": "
+              "\"R_C_R_R\", \"Types\": \"f16_f32_f32\", \"TFlops/s\": 40.5, \"median\": 1}\n";
+
+        BenchRun run;
+        EXPECT_EQ(parseBenchOutput(ss, run, ""), 2u);
+        ASSERT_EQ(run.records.size(), 2u);
+        EXPECT_NE(run.find("f16_f32_f32|R_C_R_R|16x16x16|64x1|64x64x64"), nullptr);
+
+        auto record = run.find("f16_f32_f32|R_C_R_R|16x16x16|64x1|64x64x64*1024");
+        ASSERT_NE(record, nullptr);
+        EXPECT_DOUBLE_EQ(record->tflopsPerSec, 40.5);
+    }
+
+    TEST(BenchCompareTest, RepeatedKernelsPoolSamples)
+    {
+        std::stringstream ss;
+        ss << CsvHeader << csvRow(16, "1;2", "BENCH") << CsvHeader << csvRow(16, "3", "BENCH");
+
+        BenchRun run;
+        EXPECT_EQ(parseBenchOutput(ss, run, ""), 2u);
+        ASSERT_EQ(run.records.size(), 1u);
+        EXPECT_EQ(run.records[0].samples, (std::vector<float64_t>{1.0, 2.0, 3.0}));
+    }
+
+    TEST(BenchCompareTest, StoreRoundTrip)
+    {
+        BenchRun runA, runB;
+        runA.label = "release";
+        runA.add(makeRecord("b", {1.0, 2.0}));
+        runA.add(makeRecord("a", {3.0}));
+        runB.label = "nightly";
+        runB.add(makeRecord("a", {4.0, 5.0, 6.0}));
+
+        BenchStore store;
+        store.addRun(runA);
+        store.addRun(runB);
+
+        std::string path = ::testing::TempDir() + "bench_compare_test.store";
+        std::string error;
+        ASSERT_TRUE(store.save(path, error)) << error;
+
+        BenchStore loaded;
+        ASSERT_TRUE(loaded.load(path, error)) << error;
+        std::remove(path.c_str());
+
+        ASSERT_EQ(loaded.runs().size(), 2u);
+        auto release = loaded.findRun("release");
+        ASSERT_NE(release, nullptr);
+        ASSERT_EQ(release->records.size(), 2u);
+        EXPECT_EQ(release->find("a")->samples, (std::vector<float64_t>{3.0}));
+        EXPECT_EQ(release->find("b")->samples, (std::vector<float64_t>{1.0, 2.0}));
+        EXPECT_EQ(loaded.findRun("nightly")->find("a")->samples,
+                  (std::vector<float64_t>{4.0, 5.0, 6.0}));
+    }
+
+    TEST(BenchCompareTest, MannWhitney)
+    {
+        std::vector<float64_t> a = {1.0, 1.1, 0.9, 1.05, 0.95, 1.0, 1.02, 0.98};
+        std::vector<float64_t> b = {2.0, 2.1, 1.9, 2.05, 1.95, 2.0, 2.02, 1.98};
+
+        EXPECT_LT(mannWhitneyPValue(a, b), 0.01);
+        EXPECT_GT(mannWhitneyPValue(a, a), 0.5);
+        EXPECT_DOUBLE_EQ(mannWhitneyPValue({1.0, 1.0}, {1.0, 1.0}), 1.0);
+        EXPECT_LT(mannWhitneyPValue({1.0}, b), 0.0);
+    }
+
+    TEST(BenchCompareTest, FlagsSignificantChanges)
+    {
+        std::vector<float64_t> fast, slow, noisy;
+        for(uint32_t i = 0; i < 16u; i++)
+        {
+            fast.push_back(1.0 + 0.001 * i);
+            slow.push_back(1.2 + 0.001 * i);
+            noisy.push_back(i % 2 ? 0.5 : 1.8); // Median shift, no significance
+        }
+
+        BenchRun baseline, candidate;
+        baseline.add(makeRecord("regressed", fast));
+        baseline.add(makeRecord("improved", slow));
+        baseline.add(makeRecord("noisy", fast));
+        baseline.add(makeRecord("removed", fast));
+        candidate.add(makeRecord("regressed", slow));
+        candidate.add(makeRecord("improved", fast));
+        candidate.add(makeRecord("noisy", noisy));
+        candidate.add(makeRecord("added", fast));
+
+        auto diffs = compareRuns(baseline, candidate, BenchCompareConfig());
+        ASSERT_EQ(diffs.size(), 5u);
+
+        auto delta = [&](std::string const& signature) {
+            for(auto& diff : diffs)
+            {
+                if(diff.signature == signature)
+                {
+                    return diff.delta;
+                }
+            }
+            return BenchDelta::Unchanged;
+        };
+
+        EXPECT_EQ(delta("regressed"), BenchDelta::Regression);
+        EXPECT_EQ(delta("improved"), BenchDelta::Improvement);
+        EXPECT_EQ(delta("noisy"), BenchDelta::Unchanged);
+        EXPECT_EQ(delta("removed"), BenchDelta::Removed);
+        EXPECT_EQ(delta("added"), BenchDelta::Added);
+
+        auto summary = summarize(diffs);
+        EXPECT_EQ(summary.compared, 3u);
+        EXPECT_EQ(summary.regressions, 1u);
+        EXPECT_EQ(summary.improvements, 1u);
+        EXPECT_EQ(summary.added, 1u);
+        EXPECT_EQ(summary.removed, 1u);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sstream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "bench_stats.hpp"
+
+namespace rocwmma
+{
+    TEST(BenchStatsTest, BasicStatistics)
+    {
+        auto stats = computeBenchStats({4.0, 1.0, 3.0, 2.0, 5.0}, false);
+
+        EXPECT_EQ(stats.samples, 5u);
+        EXPECT_EQ(stats.outliers, 0u);
+        EXPECT_DOUBLE_EQ(stats.min, 1.0);
+        EXPECT_DOUBLE_EQ(stats.max, 5.0);
+        EXPECT_DOUBLE_EQ(stats.mean, 3.0);
+        EXPECT_DOUBLE_EQ(stats.median, 3.0);
+        EXPECT_DOUBLE_EQ(stats.p95, 4.8);
+        EXPECT_DOUBLE_EQ(stats.stddev, std::sqrt(2.5));
+        EXPECT_DOUBLE_EQ(stats.cv, std::sqrt(2.5) / 3.0);
+    }
+
+    TEST(BenchStatsTest, EmptyAndSingle)
+    {
+        auto empty = computeBenchStats({});
+        EXPECT_EQ(empty.samples, 0u);
+        EXPECT_DOUBLE_EQ(empty.mean, 0.0);
+
+        auto single = computeBenchStats({2.0});
+        EXPECT_EQ(single.samples, 1u);
+        EXPECT_DOUBLE_EQ(single.median, 2.0);
+        EXPECT_DOUBLE_EQ(single.stddev, 0.0);
+        EXPECT_DOUBLE_EQ(single.cv, 0.0);
+    }
+
+    TEST(BenchStatsTest, OutlierRejection)
+    {
+        std::vector<float64_t> samples = {1.0, 1.01, 0.99, 1.02, 0.98, 1.0, 10.0};
+
+        auto kept     = computeBenchStats(samples, false);
+        auto rejected = computeBenchStats(samples, true);
+
+        EXPECT_EQ(rejected.samples, 7u);
+        EXPECT_EQ(rejected.outliers, 1u);
+        EXPECT_DOUBLE_EQ(rejected.max, 1.02);
+        EXPECT_LT(rejected.cv, 0.02);
+        EXPECT_GT(kept.cv, rejected.cv);
+    }
+
+    TEST(BenchStatsTest, RunUntilCvTarget)
+    {
+        // Noisy first round, then stable samples
+        uint32_t calls       = 0u;
+        uint32_t warmupCalls = 0u;
+        auto     timeRound   = [&](uint32_t count, std::vector<float64_t>& samples) {
+            if(calls++ == 0u)
+            {
+                warmupCalls = count;
+                return;
+            }
+            for(uint32_t i = 0u; i < count; i++)
+            {
+                samples.push_back(calls == 2u ? (i % 2u ? 1.0 : 2.0) : 1.5);
+            }
+        };
+
+        BenchConfig config;
+        config.warmup         = 2u;
+        config.iterations     = 10u;
+        config.targetCv       = 0.1;
+        config.maxIterations  = 1000u;
+        config.rejectOutliers = false;
+
+        std::vector<float64_t> samples;
+        auto                   stats = runBenchmark(config, timeRound, samples);
+
+        EXPECT_EQ(warmupCalls, 2u);
+        EXPECT_LE(stats.cv, config.targetCv);
+        EXPECT_GT(samples.size(), 10u);
+        EXPECT_EQ(stats.samples, samples.size());
+        EXPECT_EQ(samples.size() % 10u, 0u);
+    }
+
+    TEST(BenchStatsTest, RunStopsAtMaxIterations)
+    {
+        uint32_t toggle    = 0u;
+        auto     timeRound = [&](uint32_t count, std::vector<float64_t>& samples) {
+            for(uint32_t i = 0u; i < count; i++)
+            {
+                samples.push_back(toggle++ % 2u ? 1.0 : 3.0);
+            }
+        };
+
+        BenchConfig config;
+        config.warmup        = 0u;
+        config.iterations    = 8u;
+        config.targetCv      = 0.01;
+        config.maxIterations = 20u;
+
+        std::vector<float64_t> samples;
+        auto                   stats = runBenchmark(config, timeRound, samples);
+
+        EXPECT_EQ(samples.size(), 20u);
+        EXPECT_GT(stats.cv, config.targetCv);
+    }
+
+    TEST(BenchStatsTest, Serialization)
+    {
+        std::vector<float64_t> samples = {1.5, 2.5};
+        auto                   stats   = computeBenchStats(samples);
+
+        std::ostringstream csv;
+        writeSamplesCsv(csv, samples);
+        EXPECT_EQ(csv.str(), "1.5;2.5");
+
+        std::ostringstream json;
+        writeStatsJson(json, stats, samples);
+        EXPECT_NE(json.str().find("\"median\": 2"), std::string::npos);
+        EXPECT_NE(json.str().find("\"distribution\": [1.5, 2.5]"), std::string::npos);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DETAIL_COPY_MATRIX_COOP_ASYNC_HPP
+#define ROCWMMA_DETAIL_COPY_MATRIX_COOP_ASYNC_HPP
+
+#include "device/copy_matrix_coop_async.hpp"
+#include "load_store_matrix_sync_test/detail/load_store_matrix_sync.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct CopyMatrixCoopAsyncKernelA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        // One block staged in LDS
+        uint32_t ldsUsage() const final
+        {
+            return BlockM * BlockN * sizeof(DataT);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(CopyMatrixCoopAsyncA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct CopyMatrixCoopAsyncKernelB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        // One block staged in LDS
+        uint32_t ldsUsage() const final
+        {
+            return BlockM * BlockN * sizeof(DataT);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(CopyMatrixCoopAsyncB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    using CopyMatrixCoopAsyncGeneratorA = LoadStoreMatrixSyncGenerator<CopyMatrixCoopAsyncKernelA>;
+    using CopyMatrixCoopAsyncGeneratorB = LoadStoreMatrixSyncGenerator<CopyMatrixCoopAsyncKernelB>;
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_COPY_MATRIX_COOP_ASYNC_HPP
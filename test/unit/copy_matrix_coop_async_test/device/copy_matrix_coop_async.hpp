@@ -0,0 +1,212 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DEVICE_COPY_MATRIX_COOP_ASYNC_HPP
+#define ROCWMMA_DEVICE_COPY_MATRIX_COOP_ASYNC_HPP
+
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_coop.hpp>
+
+#include "unit_test_traits.hpp"
+
+namespace rocwmma
+{
+
+    template <uint32_t WaveCount, typename FragT, typename DataT>
+    ROCWMMA_DEVICE inline void copyMatrixCoopAsync(FragT&       frag,
+                                                   DataT*       lds,
+                                                   uint32_t     ldlds,
+                                                   DataT const* data,
+                                                   uint32_t     ldm,
+                                                   uint32_t     waveIndex)
+    {
+        copy_matrix_coop_async<WaveCount>(frag, lds, ldlds, data, ldm, waveIndex);
+        wait_matrix_coop_async<WaveCount>(frag, lds, ldlds, waveIndex);
+    }
+
+    // Copies every block covered by the workgroup: global -> LDS cooperatively
+    // with all waves, then LDS -> global by a single wave per block.
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayout, typename FragT>
+    ROCWMMA_DEVICE inline void
+        copyMatrixCoopAsyncBlocks(FragT& frag, DataT const* in, DataT* out, uint32_t ld)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        HIP_DYNAMIC_SHARED(void*, localMemPtr);
+        auto* lds   = reinterpret_cast<DataT*>(localMemPtr);
+        auto  ldlds = is_same<DataLayout, row_major>::value ? BlockN : BlockM;
+
+        auto workgroupDim      = Mapping::workgroupDim();
+        auto waveCoord         = Mapping::waveCoord();
+        auto currentBlockCoord = Mapping::blockCoord();
+
+        // All waves participate in 'row major' order
+        auto waveIndex = get<0>(waveCoord) * get<1>(workgroupDim) + get<1>(waveCoord);
+        auto waveCount = get<0>(workgroupDim) * get<1>(workgroupDim);
+
+        // Start at the first block in WG coverage
+        auto startBlockCoord = currentBlockCoord - waveCoord;
+
+        for(int i = 0; i < get<0>(workgroupDim); i++)
+        {
+            for(int j = 0; j < get<1>(workgroupDim); j++)
+            {
+                auto  blockCoord = startBlockCoord + make_coord2d(i, j);
+                auto* read       = Mapping::dataCoord(in, Mapping::matrixCoord(blockCoord), ld);
+                auto* write      = Mapping::dataCoord(out, Mapping::matrixCoord(blockCoord), ld);
+
+                switch(waveCount)
+                {
+                case 1:
+                    copyMatrixCoopAsync<1>(frag, lds, ldlds, read, ld, waveIndex);
+                    break;
+                case 2:
+                    copyMatrixCoopAsync<2>(frag, lds, ldlds, read, ld, waveIndex);
+                    break;
+                case 4:
+                    copyMatrixCoopAsync<4>(frag, lds, ldlds, read, ld, waveIndex);
+                    break;
+                case 8:
+                    copyMatrixCoopAsync<8>(frag, lds, ldlds, read, ld, waveIndex);
+                    break;
+                default:;
+                }
+
+                synchronize_workgroup();
+
+                if(waveIndex == (i * get<1>(workgroupDim) + j) % waveCount)
+                {
+                    load_matrix_sync(frag, lds, ldlds);
+                    store_matrix_sync(write, frag, ld);
+                }
+
+                // LDS is reused by the next block
+                synchronize_workgroup();
+            }
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void CopyMatrixCoopAsyncA(uint32_t     m,
+                                         uint32_t     n,
+                                         DataT const* in,
+                                         DataT*       out,
+                                         uint32_t     ld,
+                                         DataT        param1,
+                                         DataT        param2)
+    {
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+        copyMatrixCoopAsyncBlocks<BlockM, BlockN, DataT, DataLayout>(frag, in, out, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void CopyMatrixCoopAsyncA(uint32_t     m,
+                                         uint32_t     n,
+                                         DataT const* in,
+                                         DataT*       out,
+                                         uint32_t     ld,
+                                         DataT        param1,
+                                         DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void CopyMatrixCoopAsyncB(uint32_t     m,
+                                         uint32_t     n,
+                                         DataT const* in,
+                                         DataT*       out,
+                                         uint32_t     ld,
+                                         DataT        param1,
+                                         DataT        param2)
+    {
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        auto frag = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>();
+        copyMatrixCoopAsyncBlocks<BlockM, BlockN, DataT, DataLayout>(frag, in, out, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void CopyMatrixCoopAsyncB(uint32_t     m,
+                                         uint32_t     n,
+                                         DataT const* in,
+                                         DataT*       out,
+                                         uint32_t     ld,
+                                         DataT        param1,
+                                         DataT        param2)
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_COPY_MATRIX_COOP_ASYNC_HPP
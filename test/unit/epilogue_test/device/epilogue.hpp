@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_EPILOGUE_HPP
+#define ROCWMMA_DEVICE_EPILOGUE_HPP
+
+#include "unit_test_traits.hpp"
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
+
+namespace rocwmma
+{
+    // Coordinate-dependent offset in [-2, 2], to validate the (row, col)
+    // passed to epilogue ops against the host reference.
+    struct EpilogueCoordOffset
+    {
+        template <typename DataT>
+        ROCWMMA_HOST_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+        {
+            return value + static_cast<DataT>(static_cast<int32_t>((row * 3u + col) % 5u) - 2);
+        }
+    };
+
+    // relu(param1 * x + offset(row, col))
+    template <typename DataT>
+    ROCWMMA_DEVICE inline auto makeTestEpilogue(DataT param1)
+    {
+        return epilogue::make_chain(
+            epilogue::scale<DataT>(param1), EpilogueCoordOffset(), epilogue::relu());
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void applyEpilogue(uint32_t     m,
+                                  uint32_t     n,
+                                  DataT const* in,
+                                  DataT*       out,
+                                  uint32_t     ld,
+                                  DataT        param1,
+                                  DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Load, transform in registers and store
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+        load_matrix_sync(frag, Mapping::dataCoord(in, ld), ld);
+
+        auto matrixCoord = Mapping::matrixCoord();
+        apply_epilogue(
+            frag, makeTestEpilogue(param1), get<0>(matrixCoord), get<1>(matrixCoord));
+
+        store_matrix_sync(Mapping::dataCoord(out, ld), frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void applyEpilogue(uint32_t     m,
+                                  uint32_t     n,
+                                  DataT const* in,
+                                  DataT*       out,
+                                  uint32_t     ld,
+                                  DataT        param1,
+                                  DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void storeMatrixEpilogueSync(uint32_t     m,
+                                            uint32_t     n,
+                                            DataT const* in,
+                                            DataT*       out,
+                                            uint32_t     ld,
+                                            DataT        param1,
+                                            DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Layout-less accumulator exercises the runtime layout dispatch
+        constexpr auto layout
+            = std::is_same<DataLayout, row_major>::value ? mem_row_major : mem_col_major;
+
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT>();
+        load_matrix_sync(frag, Mapping::dataCoord(in, ld), ld, layout);
+
+        auto matrixCoord = Mapping::matrixCoord();
+        store_matrix_epilogue_sync(Mapping::dataCoord(out, ld),
+                                   frag,
+                                   ld,
+                                   layout,
+                                   makeTestEpilogue(param1),
+                                   get<0>(matrixCoord),
+                                   get<1>(matrixCoord));
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void storeMatrixEpilogueSync(uint32_t     m,
+                                            uint32_t     n,
+                                            DataT const* in,
+                                            DataT*       out,
+                                            uint32_t     ld,
+                                            DataT        param1,
+                                            DataT        param2)
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_EPILOGUE_HPP
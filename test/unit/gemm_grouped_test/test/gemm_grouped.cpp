@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gemm/gemm_grouped.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using namespace GroupedGemm;
+
+        using ProblemT = Problem<float16_t, float32_t>;
+
+        ProblemT makeProblem(uint32_t m, uint32_t n, uint32_t k)
+        {
+            return {m, n, k, nullptr, nullptr, nullptr, nullptr, m, k, m, m};
+        }
+
+        // Every tile maps to the non-empty group whose range contains it
+        void expectTileCover(std::vector<ProblemT> const& problems,
+                             uint32_t                     macroTileM,
+                             uint32_t                     macroTileN)
+        {
+            auto tileTable  = buildTileTable(problems, macroTileM, macroTileN);
+            auto groupCount = static_cast<uint32_t>(problems.size());
+
+            std::vector<uint32_t> tilesPerGroup(groupCount, 0u);
+            for(uint32_t tile = 0u; tile < tileTable.back(); tile++)
+            {
+                auto group = findGroup(tileTable.data(), groupCount, tile);
+                ASSERT_LT(group, groupCount) << tile;
+                EXPECT_LE(tileTable[group], tile) << tile;
+                EXPECT_LT(tile, tileTable[group + 1u]) << tile;
+                tilesPerGroup[group]++;
+            }
+
+            for(uint32_t g = 0u; g < groupCount; g++)
+            {
+                EXPECT_EQ(tilesPerGroup[g],
+                          tileCount(problems[g].m, problems[g].n, macroTileM, macroTileN))
+                    << g;
+            }
+        }
+    } // namespace
+
+    TEST(GemmGroupedTest, TileTable)
+    {
+        std::vector<ProblemT> problems = {makeProblem(128u, 64u, 32u),
+                                          makeProblem(0u, 64u, 32u),
+                                          makeProblem(64u, 256u, 32u),
+                                          makeProblem(100u, 40u, 32u)};
+
+        // 2 x 1, empty, 1 x 4, and 2 x 1 with partial tiles
+        auto tileTable = buildTileTable(problems, 64u, 64u);
+        EXPECT_EQ(tileTable, (std::vector<uint32_t>{0u, 2u, 2u, 6u, 8u}));
+
+        EXPECT_TRUE(buildTileTable(std::vector<ProblemT>{}, 64u, 64u)
+                    == std::vector<uint32_t>{0u});
+    }
+
+    TEST(GemmGroupedTest, FindGroup)
+    {
+        expectTileCover({makeProblem(64u, 64u, 16u)}, 64u, 64u);
+
+        // Empty groups at the front, middle and back
+        expectTileCover({makeProblem(0u, 64u, 16u),
+                         makeProblem(128u, 128u, 16u),
+                         makeProblem(0u, 0u, 16u),
+                         makeProblem(0u, 64u, 16u),
+                         makeProblem(64u, 192u, 16u),
+                         makeProblem(0u, 64u, 16u)},
+                        64u,
+                        32u);
+
+        // Many groups of varying sizes
+        std::vector<ProblemT> problems;
+        for(uint32_t g = 0u; g < 37u; g++)
+        {
+            problems.push_back(makeProblem(((g * 7u) % 5u) * 32u, ((g * 3u) % 4u + 1u) * 16u, 16u));
+        }
+        expectTileCover(problems, 32u, 16u);
+    }
+
+    TEST(GemmGroupedTest, TileDim)
+    {
+        // Partial edge tiles round up, on the host and in the kernel alike
+        EXPECT_EQ(tileDim(0u, 64u), 0u);
+        EXPECT_EQ(tileDim(1u, 64u), 1u);
+        EXPECT_EQ(tileDim(64u, 64u), 1u);
+        EXPECT_EQ(tileDim(65u, 64u), 2u);
+        EXPECT_EQ(tileCount(100u, 40u, 64u, 32u), tileDim(100u, 64u) * tileDim(40u, 32u));
+    }
+
+    TEST(GemmGroupedTest, SplitExtent)
+    {
+        for(uint32_t parts : {1u, 3u, 8u})
+        {
+            for(uint32_t extent : {0u, 1u, 7u, 333u, 1000u, 4096u})
+            {
+                auto sizes = splitExtent(extent, parts);
+
+                ASSERT_EQ(sizes.size(), parts);
+                EXPECT_EQ(std::accumulate(sizes.begin(), sizes.end(), 0u), extent) << extent;
+
+                // The first part is empty, unless it is the only one
+                EXPECT_EQ(sizes.front(), parts > 1u ? 0u : extent) << extent;
+            }
+        }
+
+        // Uneven, and not aligned to power of 2 tiles
+        auto sizes    = splitExtent(1000u, 8u);
+        auto distinct = std::set<uint32_t>(sizes.begin(), sizes.end());
+        EXPECT_GT(distinct.size(), 3u);
+        EXPECT_TRUE(std::any_of(sizes.begin(), sizes.end(), [](auto size) { return size % 16u; }));
+    }
+
+    TEST(GemmGroupedTest, SplitDepths)
+    {
+        for(uint32_t k : {1u, 16u, 100u, 500u, 1024u})
+        {
+            auto depths = splitDepths(k, 8u);
+
+            ASSERT_EQ(depths.size(), 8u);
+            EXPECT_EQ(depths.front(), k);
+            for(auto depth : depths)
+            {
+                EXPECT_LE(depth, k) << k;
+                EXPECT_GE(depth, k - k / 2u) << k;
+            }
+        }
+
+        // Groups of differing K, some not a multiple of BlockK
+        auto depths   = splitDepths(500u, 8u);
+        auto distinct = std::set<uint32_t>(depths.begin(), depths.end());
+        EXPECT_GT(distinct.size(), 3u);
+        EXPECT_TRUE(
+            std::any_of(depths.begin(), depths.end(), [](auto depth) { return depth % 32u; }));
+    }
+
+    TEST(GemmGroupedTest, FullTile)
+    {
+        // 100 x 40 x 48 output in 64 x 32 macro tiles
+        EXPECT_TRUE(isFullTile(100u, 40u, 48u, 0u, 0u, 64u, 32u, 16u));
+        EXPECT_FALSE(isFullTile(100u, 40u, 48u, 64u, 0u, 64u, 32u, 16u));
+        EXPECT_FALSE(isFullTile(100u, 40u, 48u, 0u, 32u, 64u, 32u, 16u));
+
+        // K tails and empty K take the bounds-checked path
+        EXPECT_FALSE(isFullTile(100u, 40u, 48u, 0u, 0u, 64u, 32u, 32u));
+        EXPECT_FALSE(isFullTile(100u, 40u, 0u, 0u, 0u, 64u, 32u, 16u));
+
+        // Groups of differing M, N and K in one tile table
+        std::vector<ProblemT> problems = {makeProblem(333u, 40u, 100u),
+                                          makeProblem(64u, 777u, 64u),
+                                          makeProblem(17u, 3u, 5u)};
+        auto                  tileTable = buildTileTable(problems, 64u, 32u);
+        EXPECT_EQ(tileTable, (std::vector<uint32_t>{0u, 12u, 37u, 38u}));
+        expectTileCover(problems, 64u, 32u);
+    }
+
+} // namespace rocwmma
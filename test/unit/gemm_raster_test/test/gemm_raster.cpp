@@ -0,0 +1,173 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "gemm/gemm_global_mapping.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        using namespace GlobalMapping::Rasterization;
+
+        using TileCoord = std::pair<uint32_t, uint32_t>;
+
+        // Macro tile coordinates in launch order
+        template <typename RasterOrder>
+        std::vector<TileCoord> rasterize(uint32_t tilesX, uint32_t tilesY)
+        {
+            std::vector<TileCoord> result;
+            for(uint32_t tile = 0u; tile < tilesX * tilesY; tile++)
+            {
+                auto coord = RasterOrder::tileCoord(tile, tilesX, tilesY);
+                result.emplace_back(get<0>(coord), get<1>(coord));
+            }
+            return result;
+        }
+
+        // Every macro tile of the grid is visited exactly once
+        template <typename RasterOrder>
+        void expectBijection()
+        {
+            for(uint32_t tilesX = 1u; tilesX <= 19u; tilesX++)
+            {
+                for(uint32_t tilesY = 1u; tilesY <= 19u; tilesY++)
+                {
+                    auto coords = rasterize<RasterOrder>(tilesX, tilesY);
+                    auto unique = std::set<TileCoord>(coords.begin(), coords.end());
+                    EXPECT_EQ(unique.size(), coords.size()) << tilesX << " x " << tilesY;
+                    for(auto const& coord : coords)
+                    {
+                        EXPECT_LT(coord.first, tilesX) << tilesX << " x " << tilesY;
+                        EXPECT_LT(coord.second, tilesY) << tilesX << " x " << tilesY;
+                    }
+                }
+            }
+        }
+    } // namespace
+
+    TEST(GemmRasterTest, Bijection)
+    {
+        expectBijection<ColMajor>();
+        expectBijection<RowMajor>();
+        expectBijection<GroupedM<1u>>();
+        expectBijection<GroupedM<3u>>();
+        expectBijection<GroupedM<8u>>();
+        expectBijection<Morton<1u>>();
+        expectBijection<Morton<4u>>();
+        expectBijection<Morton<8u>>();
+        expectBijection<Hilbert<2u>>();
+        expectBijection<Hilbert<4u>>();
+        expectBijection<Hilbert<8u>>();
+    }
+
+    TEST(GemmRasterTest, LinearOrders)
+    {
+        // Col major is the launch grid: blockIdx.x walks M
+        auto colMajor = rasterize<ColMajor>(3u, 2u);
+        EXPECT_EQ(colMajor,
+                  (std::vector<TileCoord>{{0, 0}, {1, 0}, {2, 0}, {0, 1}, {1, 1}, {2, 1}}));
+
+        auto rowMajor = rasterize<RowMajor>(3u, 2u);
+        EXPECT_EQ(rowMajor,
+                  (std::vector<TileCoord>{{0, 0}, {0, 1}, {1, 0}, {1, 1}, {2, 0}, {2, 1}}));
+
+        EXPECT_EQ(rasterize<GroupedM<1u>>(5u, 7u), rasterize<RowMajor>(5u, 7u));
+    }
+
+    TEST(GemmRasterTest, GroupedM)
+    {
+        // Bands of 2 rows walked col by col, last band has a single row
+        auto grouped = rasterize<GroupedM<2u>>(3u, 2u);
+        EXPECT_EQ(grouped,
+                  (std::vector<TileCoord>{{0, 0}, {1, 0}, {0, 1}, {1, 1}, {2, 0}, {2, 1}}));
+
+        // A band as tall as the grid is col major
+        EXPECT_EQ(rasterize<GroupedM<4u>>(4u, 6u), rasterize<ColMajor>(4u, 6u));
+    }
+
+    TEST(GemmRasterTest, Morton)
+    {
+        auto morton = rasterize<Morton<4u>>(4u, 4u);
+        EXPECT_EQ(morton,
+                  (std::vector<TileCoord>{{0, 0},
+                                          {0, 1},
+                                          {1, 0},
+                                          {1, 1},
+                                          {0, 2},
+                                          {0, 3},
+                                          {1, 2},
+                                          {1, 3},
+                                          {2, 0},
+                                          {2, 1},
+                                          {3, 0},
+                                          {3, 1},
+                                          {2, 2},
+                                          {2, 3},
+                                          {3, 2},
+                                          {3, 3}}));
+    }
+
+    TEST(GemmRasterTest, Hilbert)
+    {
+        // Each step of a full super tile moves to a neighbouring macro tile
+        auto hilbert = rasterize<Hilbert<8u>>(8u, 8u);
+        for(uint32_t i = 1u; i < hilbert.size(); i++)
+        {
+            auto dx = std::abs(int(hilbert[i].first) - int(hilbert[i - 1u].first));
+            auto dy = std::abs(int(hilbert[i].second) - int(hilbert[i - 1u].second));
+            EXPECT_EQ(dx + dy, 1) << "step " << i;
+        }
+        EXPECT_EQ(hilbert.front(), TileCoord(0u, 0u));
+        EXPECT_EQ(hilbert.back(), TileCoord(7u, 0u));
+    }
+
+    TEST(GemmRasterTest, SuperTiles)
+    {
+        // 6 x 6 grid of 4 x 4 super tiles: a full super tile, then the partial
+        // super tiles on the right, bottom and corner edges in row major order
+        auto coords = rasterize<Hilbert<4u>>(6u, 6u);
+        auto first  = rasterize<Hilbert<4u>>(4u, 4u);
+        EXPECT_TRUE(std::equal(first.begin(), first.end(), coords.begin()));
+
+        EXPECT_EQ(coords[16], TileCoord(0u, 4u));
+        EXPECT_EQ(coords[17], TileCoord(0u, 5u));
+        EXPECT_EQ(coords[18], TileCoord(1u, 4u));
+        EXPECT_EQ(coords[24], TileCoord(4u, 0u));
+        EXPECT_EQ(coords[25], TileCoord(4u, 1u));
+        EXPECT_EQ(coords[28], TileCoord(5u, 0u));
+        EXPECT_EQ(coords[32], TileCoord(4u, 4u));
+        EXPECT_EQ(coords[35], TileCoord(5u, 5u));
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,166 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "gemm/gemm_tuning_table.hpp"
+
+namespace rocwmma
+{
+    namespace
+    {
+        GemmTuningKey const Key = {"gfx90a", "f16_f32_f32", "C_R_C_C"};
+
+        // 32 x 32 blocks, 2 x 2 per wave, 2 x 2 waves = 128 x 128 macro tile
+        GemmTuningEntry
+            makeEntry(uint32_t m, uint32_t n, uint32_t k, float64_t tflops, uint32_t blocks = 2u)
+        {
+            GemmTuningEntry entry;
+            entry.m                 = m;
+            entry.n                 = n;
+            entry.k                 = k;
+            entry.tflopsPerSec      = tflops;
+            entry.config.kernel     = "PGR1_LB2_MP0_MB_CP";
+            entry.config.gemmConfig = "Workgroup_LdsNT";
+            entry.config.layoutLds  = "C";
+            entry.config.blockM     = 32u;
+            entry.config.blockN     = 32u;
+            entry.config.blockK     = 16u;
+            entry.config.blocksX    = blocks;
+            entry.config.blocksY    = blocks;
+            entry.config.tBlockX    = 128u;
+            entry.config.tBlockY    = 2u;
+            entry.config.waveSize   = 64u;
+            return entry;
+        }
+    } // namespace
+
+    TEST(GemmTuningTableTest, KeepsFastestPerBucket)
+    {
+        GemmTuningTable table;
+        EXPECT_TRUE(table.record(Key, makeEntry(1024, 1024, 1024, 100.0)));
+        EXPECT_FALSE(table.record(Key, makeEntry(1000, 1000, 1000, 90.0, 1u)));
+        EXPECT_TRUE(table.record(Key, makeEntry(1100, 1100, 1100, 120.0, 1u)));
+        EXPECT_EQ(table.size(), 1u);
+
+        auto best = table.lookup(Key, 1024, 1024, 1024);
+        ASSERT_NE(best, nullptr);
+        EXPECT_EQ(best->config.blocksX, 1u);
+        EXPECT_DOUBLE_EQ(best->tflopsPerSec, 120.0);
+    }
+
+    TEST(GemmTuningTableTest, LookupByShapeClass)
+    {
+        GemmTuningTable table;
+        table.record(Key, makeEntry(1024, 1024, 1024, 100.0)); // Square
+        table.record(Key, makeEntry(8192, 256, 1024, 80.0, 1u)); // Tall
+        table.record(Key, makeEntry(256, 256, 8192, 40.0, 1u)); // Deep
+
+        // Exact bucket
+        EXPECT_EQ(table.lookup(Key, 1000, 1000, 1100)->m, 1024u);
+
+        // Same class wins over a nearer shape of another class
+        auto tall = table.lookup(Key, 2048, 256, 1024);
+        ASSERT_NE(tall, nullptr);
+        EXPECT_EQ(tall->m, 8192u);
+
+        auto deep = table.lookup(Key, 512, 512, 16384);
+        ASSERT_NE(deep, nullptr);
+        EXPECT_EQ(deep->k, 8192u);
+
+        // Nearest square shape
+        EXPECT_EQ(table.lookup(Key, 4096, 4096, 4096)->m, 1024u);
+
+        // Unknown key
+        EXPECT_EQ(table.lookup({"gfx908", "f16_f32_f32", "C_R_C_C"}, 1024, 1024, 1024), nullptr);
+    }
+
+    TEST(GemmTuningTableTest, LookupOnlyReturnsFittingConfigs)
+    {
+        GemmTuningTable table;
+        table.record(Key, makeEntry(1024, 1024, 1024, 100.0)); // 128 x 128 tile
+        table.record(Key, makeEntry(64, 64, 64, 10.0, 1u)); // 64 x 64 tile
+
+        auto small = table.lookup(Key, 96, 96, 1024);
+        ASSERT_NE(small, nullptr);
+        EXPECT_EQ(small->config.macroTileM(), 64u);
+
+        EXPECT_EQ(table.lookup(Key, 32, 32, 32), nullptr);
+    }
+
+    TEST(GemmTuningTableTest, RoundTrip)
+    {
+        GemmTuningTable table;
+        table.record(Key, makeEntry(1024, 1024, 1024, 100.5));
+        table.record({"gfx942", "bf16_f32_f32", "R_C_R_R"}, makeEntry(64, 2048, 1024, 12.25, 1u));
+
+        std::stringstream ss;
+        table.write(ss);
+
+        GemmTuningTable loaded;
+        std::string     error;
+        ASSERT_TRUE(loaded.read(ss, error)) << error;
+        EXPECT_EQ(loaded.size(), 2u);
+
+        auto entry = loaded.lookup({"gfx942", "bf16_f32_f32", "R_C_R_R"}, 64, 2048, 1024);
+        ASSERT_NE(entry, nullptr);
+        EXPECT_TRUE(entry->config == makeEntry(64, 2048, 1024, 0.0, 1u).config);
+        EXPECT_DOUBLE_EQ(entry->tflopsPerSec, 12.25);
+    }
+
+    TEST(GemmTuningTableTest, RejectsBadInput)
+    {
+        GemmTuningTable table;
+        std::string     error;
+
+        std::stringstream noVersion("Arch, Types\n");
+        EXPECT_FALSE(table.read(noVersion, error));
+
+        std::stringstream newer("version, 999\n");
+        EXPECT_FALSE(table.read(newer, error));
+        EXPECT_NE(error.find("999"), std::string::npos);
+
+        std::stringstream malformed("version, 1\ncolumns\ngfx90a, f16_f32_f32, C_R_C_C, x\n");
+        EXPECT_FALSE(table.read(malformed, error));
+        EXPECT_EQ(table.size(), 0u);
+    }
+
+    TEST(GemmTuningTableTest, Merge)
+    {
+        GemmTuningTable lhs, rhs;
+        lhs.record(Key, makeEntry(1024, 1024, 1024, 100.0));
+        rhs.record(Key, makeEntry(1024, 1024, 1024, 150.0, 1u));
+        rhs.record(Key, makeEntry(4096, 4096, 4096, 200.0));
+
+        lhs.merge(rhs);
+        EXPECT_EQ(lhs.size(), 2u);
+        EXPECT_DOUBLE_EQ(lhs.lookup(Key, 1024, 1024, 1024)->tflopsPerSec, 150.0);
+    }
+
+} // namespace rocwmma
@@ -0,0 +1,250 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_HOST_BACKEND_HPP
+#define ROCWMMA_DETAIL_HOST_BACKEND_HPP
+
+#include <vector>
+
+#include <rocwmma/rocwmma_host.hpp>
+
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+    // Runs a small GEMM D = A x B + C through the host backend and compares
+    // against a naive reference. Input values in {-1, 0, 1} keep all partial
+    // sums exact in every DataT, so results must match exactly.
+    // Launch geometry comes from the test params alone; no device is queried.
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              typename DataT,
+              typename DataLayoutT>
+    struct HostBackendKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base    = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+        using HostMma = host::detail::HostMma<DataT, DataT, BlockM, BlockN, BlockK>;
+
+        static constexpr uint32_t K = 64u;
+
+        // Set by exec() against the naive reference
+        bool mPassed = false;
+
+        static inline uint32_t index(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return std::is_same_v<DataLayoutT, row_major> ? row * ld + col : col * ld + row;
+        }
+
+        static inline DataT value(uint32_t row, uint32_t col, uint32_t seed)
+        {
+            return static_cast<DataT>(static_cast<float32_t>((row * 3u + col * 5u + seed) % 3u)
+                                      - 1.0f);
+        }
+
+    public:
+        HostBackendKernel()        = default;
+        ~HostBackendKernel() final = default;
+
+        // Host waves are simulated at the configured width
+        uint32_t waveSize() const final
+        {
+            return ROCWMMA_HOST_WAVE_SIZE;
+        }
+
+        // Host MMA emulates only the instructions that exist on device
+        bool checkDevice() const final
+        {
+            return HostMma::Supported;
+        }
+
+        // Shared memory is allocated on the host heap
+        bool checkLds() const final
+        {
+            return true;
+        }
+
+        bool checkSizes() const final
+        {
+            return (Base::mTBlockX % waveSize() == 0) && Base::checkSizes();
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            mPassed = false;
+        }
+
+        void exec() final
+        {
+            if constexpr(HostMma::Supported)
+            {
+                if(Base::mRunFlag)
+                {
+                    execImpl();
+                }
+            }
+        }
+
+        // Runs the host kernel and checks D against the naive reference
+        void execImpl()
+        {
+            auto const M      = Base::mM;
+            auto const N      = Base::mN;
+            auto const wavesX = Base::mTBlockX / waveSize();
+            auto const wavesY = Base::mTBlockY;
+
+            constexpr bool IsRowMajor = std::is_same_v<DataLayoutT, row_major>;
+            auto const     lda        = IsRowMajor ? K : M;
+            auto const     ldb        = IsRowMajor ? N : K;
+            auto const     ldc        = IsRowMajor ? N : M;
+
+            std::vector<DataT> a(M * K), b(K * N), c(M * N), d(M * N);
+            for(uint32_t i = 0; i < M; i++)
+            {
+                for(uint32_t k = 0; k < K; k++)
+                {
+                    a[index(i, k, lda)] = value(i, k, 0u);
+                }
+            }
+            for(uint32_t k = 0; k < K; k++)
+            {
+                for(uint32_t j = 0; j < N; j++)
+                {
+                    b[index(k, j, ldb)] = value(k, j, 1u);
+                }
+            }
+            for(uint32_t i = 0; i < M; i++)
+            {
+                for(uint32_t j = 0; j < N; j++)
+                {
+                    c[index(i, j, ldc)] = value(i, j, 2u);
+                }
+            }
+
+            // Waves in the same workgroup row stage their shared A block in LDS
+            // with cooperative IO, then each wave reads it back in full.
+            auto kernel = [&](host::WaveContext const& context) {
+                auto waveRow = get<0>(context.waveCoord());
+                auto waveCol = get<1>(context.waveCoord());
+                auto row     = get<0>(context.globalWaveCoord()) * BlockM;
+                auto col     = get<1>(context.globalWaveCoord()) * BlockN;
+
+                auto ldsLd = IsRowMajor ? BlockK : BlockM;
+                auto ldsA  = context.sharedMemory<DataT>() + waveRow * BlockM * BlockK;
+
+                host::fragment<matrix_a, BlockM, BlockN, BlockK, DataT, DataLayoutT> fragA;
+                host::fragment<matrix_b, BlockM, BlockN, BlockK, DataT, DataLayoutT> fragB;
+                host::fragment<accumulator, BlockM, BlockN, BlockK, DataT, DataLayoutT> fragAcc;
+
+                host::load_matrix_sync(fragAcc, c.data() + index(row, col, ldc), ldc);
+
+                for(uint32_t k = 0; k < K; k += BlockK)
+                {
+                    host::load_matrix_coop_sync(
+                        fragA, a.data() + index(row, k, lda), lda, waveCol, wavesY);
+                    host::store_matrix_coop_sync(ldsA, fragA, ldsLd, waveCol, wavesY);
+                    host::synchronize_workgroup(context);
+
+                    host::load_matrix_sync(fragA, ldsA, ldsLd);
+                    host::load_matrix_sync(fragB, b.data() + index(k, col, ldb), ldb);
+                    host::mma_sync(fragAcc, fragA, fragB, fragAcc);
+                    host::synchronize_workgroup(context);
+                }
+
+                host::store_matrix_sync(d.data() + index(row, col, ldc), fragAcc, ldc);
+            };
+
+            auto const grid = Base::gridDim();
+            host::launch_kernel(make_coord2d(grid.x, grid.y),
+                                make_coord2d(wavesX, wavesY),
+                                kernel,
+                                wavesX * BlockM * BlockK * sizeof(DataT));
+
+            // Naive reference
+            bool err = false;
+            for(uint32_t i = 0; i < M && !err; i++)
+            {
+                for(uint32_t j = 0; j < N && !err; j++)
+                {
+                    auto accum = static_cast<float64_t>(c[index(i, j, ldc)]);
+                    for(uint32_t k = 0; k < K; k++)
+                    {
+                        accum += static_cast<float64_t>(a[index(i, k, lda)])
+                                 * static_cast<float64_t>(b[index(k, j, ldb)]);
+                    }
+                    err |= (static_cast<float64_t>(d[index(i, j, ldc)]) != accum);
+                }
+            }
+
+            mPassed = !err;
+        }
+
+        void validateResultsImpl() final
+        {
+            Base::mValidationResult = mPassed;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct HostBackendGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            BlockMN     = 0,
+            BlockK      = 1,
+            DataT       = 2,
+            DataLayoutT = 3,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = HostBackendKernel<std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                                    std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                                    std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                    std::tuple_element_t<DataT, TestParamsT>, // DataT
+                                    std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                                    >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_HOST_BACKEND_HPP
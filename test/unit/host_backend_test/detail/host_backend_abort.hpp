@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_HOST_BACKEND_ABORT_HPP
+#define ROCWMMA_DETAIL_HOST_BACKEND_ABORT_HPP
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include <rocwmma/rocwmma_host.hpp>
+
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+    // One wave of a workgroup throws before the first synchronize_workgroup.
+    // launch_kernel must return the original error rather than hang, and the
+    // remaining waves of that workgroup must not be released past the barrier
+    // by the failing wave's retirement.
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename DataLayoutT>
+    struct HostBackendAbortKernel final : public UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, DataT, DataLayoutT>;
+
+        // Set by exec() from the launch outcome
+        bool mPassed = false;
+
+    public:
+        HostBackendAbortKernel()        = default;
+        ~HostBackendAbortKernel() final = default;
+
+        uint32_t waveSize() const final
+        {
+            return ROCWMMA_HOST_WAVE_SIZE;
+        }
+
+        bool checkDevice() const final
+        {
+            return true;
+        }
+
+        bool checkLds() const final
+        {
+            return true;
+        }
+
+        bool checkSizes() const final
+        {
+            return (Base::mTBlockX % waveSize() == 0) && Base::checkSizes();
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            mPassed = false;
+        }
+
+        void exec() final
+        {
+            if(Base::mRunFlag)
+            {
+                auto const wavesX = Base::mTBlockX / waveSize();
+                auto const wavesY = Base::mTBlockY;
+                auto const grid   = Base::gridDim();
+
+                // Fail in the middle of the grid, from the last wave of the workgroup
+                auto const failingX    = grid.x / 2u;
+                auto const failingY    = grid.y / 2u;
+                auto const failingWave = wavesX * wavesY - 1u;
+                auto const message     = std::string("host backend abort test");
+
+                std::atomic<uint32_t> escaped(0u);
+
+                auto kernel = [&](host::WaveContext const& context) {
+                    auto workgroup = context.workgroupCoord();
+                    bool failing
+                        = (get<0>(workgroup) == failingX) && (get<1>(workgroup) == failingY);
+                    if(failing && context.waveIndex() == failingWave)
+                    {
+                        throw std::runtime_error(message);
+                    }
+
+                    host::synchronize_workgroup(context);
+
+                    // No wave of the failing workgroup may get here
+                    if(failing)
+                    {
+                        escaped++;
+                    }
+
+                    host::synchronize_workgroup(context);
+                };
+
+                bool caught = false;
+                try
+                {
+                    host::launch_kernel(
+                        make_coord2d(grid.x, grid.y), make_coord2d(wavesX, wavesY), kernel);
+                }
+                catch(std::runtime_error const& e)
+                {
+                    caught = (message == e.what());
+                }
+
+                mPassed = caught && (escaped.load() == 0u);
+            }
+        }
+
+        void validateResultsImpl() final
+        {
+            Base::mValidationResult = mPassed;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(nullptr);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct HostBackendAbortGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            BlockMN     = 0,
+            DataT       = 1,
+            DataLayoutT = 2,
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT     = HostBackendAbortKernel<
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                std::tuple_element_t<DataT, TestParamsT>, // DataT
+                std::tuple_element_t<DataLayoutT, TestParamsT> // DataLayoutT
+                >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_HOST_BACKEND_ABORT_HPP
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/rocwmma_int4.hpp>
+
+namespace rocwmma
+{
+    namespace
+    {
+        template <typename DataLayout>
+        uint64_t offset(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return std::is_same<DataLayout, row_major>::value ? uint64_t(row) * ld + col
+                                                              : uint64_t(col) * ld + row;
+        }
+
+        // Padded M x N matrix covering the full range of the packed type
+        template <typename DataT, typename DataLayout>
+        std::vector<int8_t> makeValues(uint32_t m, uint32_t n, uint32_t ld)
+        {
+            auto rowMajor = std::is_same<DataLayout, row_major>::value;
+            auto bias     = std::is_same<DataT, int4_t>::value ? 8 : 0;
+
+            std::vector<int8_t> values(uint64_t(ld) * (rowMajor ? m : n), -99);
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < n; col++)
+                {
+                    values[offset<DataLayout>(row, col, ld)]
+                        = static_cast<int8_t>(int32_t((row * 7u + col * 5u) % 16u) - bias);
+                }
+            }
+            return values;
+        }
+
+        template <typename DataT, typename MatrixT, typename DataLayout>
+        void testRoundTrip(uint32_t m, uint32_t n)
+        {
+            auto rowMajor = std::is_same<DataLayout, row_major>::value;
+            auto matrixA  = std::is_same<MatrixT, matrix_a>::value;
+            auto ld       = (rowMajor ? n : m) + 3u;
+
+            // Packed along K: columns of matrix_a, rows of matrix_b
+            auto pm  = matrixA ? m : m / 2u;
+            auto pn  = matrixA ? n / 2u : n;
+            auto ldp = (rowMajor ? pn : pm) + 1u;
+
+            auto                 values = makeValues<DataT, DataLayout>(m, n, ld);
+            std::vector<uint8_t> packed(uint64_t(ldp) * (rowMajor ? pm : pn), 0xAAu);
+            pack_int4<MatrixT, DataLayout>(packed.data(), values.data(), m, n, ld, ldp);
+
+            // Padding is untouched
+            for(uint32_t i = 0u; i < packed.size(); i++)
+            {
+                if(i % ldp >= (rowMajor ? pn : pm))
+                {
+                    EXPECT_EQ(packed[i], 0xAAu) << "byte " << i;
+                }
+            }
+
+            std::vector<int8_t> unpacked(values.size(), -99);
+            unpack_int4<DataT, MatrixT, DataLayout>(
+                unpacked.data(), packed.data(), m, n, ld, ldp);
+            EXPECT_EQ(unpacked, values);
+
+            std::vector<float32_t> dequantized(values.size(), -99.0f);
+            dequantize_int4<DataT, MatrixT, DataLayout>(
+                dequantized.data(), packed.data(), m, n, ld, ldp, 3, 0.5f);
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < n; col++)
+                {
+                    auto index = offset<DataLayout>(row, col, ld);
+                    EXPECT_EQ(dequantized[index], (values[index] - 3) * 0.5f)
+                        << "(" << row << ", " << col << ")";
+                }
+            }
+        }
+    } // namespace
+
+    TEST(Int4Test, NibbleOrder)
+    {
+        // Even K in the low nibble
+        int8_t  values[4] = {1, -2, 7, -8};
+        uint8_t packed[2] = {};
+        pack_int4<matrix_a, row_major>(packed, values, 1u, 4u, 4u, 2u);
+        EXPECT_EQ(packed[0], 0xE1u);
+        EXPECT_EQ(packed[1], 0x87u);
+
+        pack_int4<matrix_b, col_major>(packed, values, 4u, 1u, 4u, 2u);
+        EXPECT_EQ(packed[0], 0xE1u);
+        EXPECT_EQ(packed[1], 0x87u);
+    }
+
+    TEST(Int4Test, Range)
+    {
+        for(uint32_t nibble = 0u; nibble < 16u; nibble++)
+        {
+            auto value = static_cast<int32_t>(nibble);
+            EXPECT_EQ(PackedUnpack<int4_t>::value(nibble), nibble < 8u ? value : value - 16);
+            EXPECT_EQ(PackedUnpack<uint4_t>::value(nibble), value);
+        }
+    }
+
+    TEST(Int4Test, RoundTripMatrixA)
+    {
+        testRoundTrip<int4_t, matrix_a, row_major>(24u, 64u);
+        testRoundTrip<int4_t, matrix_a, col_major>(24u, 64u);
+        testRoundTrip<uint4_t, matrix_a, row_major>(16u, 32u);
+        testRoundTrip<uint4_t, matrix_a, col_major>(16u, 32u);
+    }
+
+    TEST(Int4Test, RoundTripMatrixB)
+    {
+        testRoundTrip<int4_t, matrix_b, row_major>(64u, 24u);
+        testRoundTrip<int4_t, matrix_b, col_major>(64u, 24u);
+        testRoundTrip<uint4_t, matrix_b, row_major>(32u, 16u);
+        testRoundTrip<uint4_t, matrix_b, col_major>(32u, 16u);
+    }
+
+} // namespace rocwmma
@@ -48,7 +48,7 @@ namespace rocwmma
         LoadStoreMatrixSyncKernel()          = default;
         virtual ~LoadStoreMatrixSyncKernel() = default;
 
-        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) override
         {
             auto& dataInstance = Base::DataStorage::instance();
 
@@ -65,7 +65,7 @@ namespace rocwmma
                                                     std::numeric_limits<DataT>::signaling_NaN());
         }
 
-        void validateResultsImpl() final
+        void validateResultsImpl() override
         {
             auto& dataInstance = Base::DataStorage::instance();
 
@@ -167,6 +167,235 @@ namespace rocwmma
         }
     };
 
+    // Bounds-checked variant: uneven problem sizes leave partial edge tiles
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncPartialKernelA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncPartialA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Bounds-checked variant: uneven problem sizes leave partial edge tiles
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncPartialKernelB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncPartialB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Bounds-checked variant: uneven problem sizes leave partial edge tiles
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncPartialKernelAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncPartialAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Partial load followed by a full, unmasked store: elements outside the
+    // valid extent must have been zero-filled by the load.
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncZeroFillKernelA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+        // Storage covers whole tiles so that the unmasked store stays in bounds
+        int64_t paddedM() const
+        {
+            return ceilDiv(Base::mM, BlockM) * BlockM;
+        }
+
+        int64_t paddedN() const
+        {
+            return ceilDiv(Base::mN, BlockN) * BlockN;
+        }
+
+        int64_t index(int64_t row, int64_t col) const
+        {
+            return std::is_same<Layout, row_major>::value ? row * Base::mLd + col
+                                                          : col * Base::mLd + row;
+        }
+
+        bool inBounds(int64_t row, int64_t col) const
+        {
+            return row < Base::mM && col < Base::mN;
+        }
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto const sizeD = paddedM() * paddedN();
+            Base::mLd        = std::is_same<Layout, row_major>::value ? paddedN() : paddedM();
+            dataInstance->resizeStorage(std::make_tuple(paddedM(), paddedN()));
+
+            // The padding holds a non-zero sentinel that a correct load never reads
+            auto& hostIn = dataInstance->hostIn();
+            for(int64_t row = 0; row < paddedM(); row++)
+            {
+                for(int64_t col = 0; col < paddedN(); col++)
+                {
+                    auto value = inBounds(row, col) ? static_cast<float32_t>((row + col) % 3u)
+                                                    : 7.0f;
+                    hostIn.get()[index(row, col)] = static_cast<DataT>(value);
+                }
+            }
+            dataInstance->copyData(dataInstance->deviceIn(), hostIn, sizeD);
+
+            MatrixUtil<Layout>::fillValLaunchKernel(dataInstance->deviceOut().get(),
+                                                    paddedM(),
+                                                    paddedN(),
+                                                    std::numeric_limits<DataT>::signaling_NaN());
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Expect the input within bounds and zero everywhere else
+            auto const sizeD   = paddedM() * paddedN();
+            auto&      hostIn  = dataInstance->hostIn();
+            auto&      hostRef = dataInstance->hostOut();
+            for(int64_t row = 0; row < paddedM(); row++)
+            {
+                for(int64_t col = 0; col < paddedN(); col++)
+                {
+                    auto idx           = index(row, col);
+                    hostRef.get()[idx] = inBounds(row, col) ? hostIn.get()[idx]
+                                                            : static_cast<DataT>(0.0f);
+                }
+            }
+
+            auto reference = dataInstance->template allocDevice<DataT>(sizeD);
+            dataInstance->copyData(reference, hostRef, sizeD);
+
+            double errorTolerance = 10.0;
+
+            std::tie(Base::mValidationResult, Base::mMaxRelativeError)
+                = compareEqualLaunchKernel<DataT, DataT, Layout, Layout>(
+                    reference.get(),
+                    dataInstance->deviceOut().get(),
+                    paddedM(),
+                    paddedN(),
+                    errorTolerance);
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncZeroFillA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Buffer resource variant: same partial edge tiles, addressed by element offset
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncBufferKernelA final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferA<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Buffer resource variant: same partial edge tiles, addressed by element offset
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncBufferKernelB final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferB<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
+    // Buffer resource variant: same partial edge tiles, addressed by element offset
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    struct LoadStoreMatrixSyncBufferKernelAcc final
+        : public LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>
+    {
+    private:
+        using Base = LoadStoreMatrixSyncKernel<BlockM, BlockN, DataT, Layout>;
+
+    protected:
+        bool checkSizes() const final
+        {
+            return true;
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                LoadStoreMatrixSyncBufferAcc<BlockM, BlockN, DataT, Layout>);
+        }
+    };
+
     template <template <uint32_t, uint32_t, typename, typename> class KernelClass>
     struct LoadStoreMatrixSyncGenerator
     {
@@ -200,6 +429,20 @@ namespace rocwmma
     using LoadStoreMatrixSyncGeneratorB = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelB>;
     using LoadStoreMatrixSyncGeneratorAcc
         = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncKernelAcc>;
+    using LoadStoreMatrixSyncPartialGeneratorA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncPartialKernelA>;
+    using LoadStoreMatrixSyncPartialGeneratorB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncPartialKernelB>;
+    using LoadStoreMatrixSyncPartialGeneratorAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncPartialKernelAcc>;
+    using LoadStoreMatrixSyncZeroFillGeneratorA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncZeroFillKernelA>;
+    using LoadStoreMatrixSyncBufferGeneratorA
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncBufferKernelA>;
+    using LoadStoreMatrixSyncBufferGeneratorB
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncBufferKernelB>;
+    using LoadStoreMatrixSyncBufferGeneratorAcc
+        = LoadStoreMatrixSyncGenerator<LoadStoreMatrixSyncBufferKernelAcc>;
 
 } // namespace rocwmma
 
@@ -203,6 +203,481 @@ namespace rocwmma
     {
     }
 
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialA(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Map, load and store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld, validRows, validCols);
+        store_matrix_sync(write, frag, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialA(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialB(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        auto frag = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Map, load and store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld, validRows, validCols);
+        store_matrix_sync(write, frag, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialB(uint32_t     m,
+                                                uint32_t     n,
+                                                DataT const* in,
+                                                DataT*       out,
+                                                uint32_t     ld,
+                                                DataT        param1,
+                                                DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialAcc(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Map, load and store.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld, validRows, validCols);
+        store_matrix_sync(write, frag, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncPartialAcc(uint32_t     m,
+                                                  uint32_t     n,
+                                                  DataT const* in,
+                                                  DataT*       out,
+                                                  uint32_t     ld,
+                                                  DataT        param1,
+                                                  DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncZeroFillA(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Bounds-checked load, then an unmasked store of the whole tile.
+        // Storage is padded to whole tiles, so the store stays in bounds and
+        // exposes whatever the load left in the out-of-bounds elements.
+        auto* read  = Mapping::dataCoord(in, ld);
+        auto* write = Mapping::dataCoord(out, ld);
+        load_matrix_sync(frag, read, ld, validRows, validCols);
+        store_matrix_sync(write, frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncZeroFillA(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferA(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix A (ColNT)
+        // BlockM -> BlockM
+        // <Dummy> -> BlockN
+        // BlockN -> BlockK
+        auto frag = fragment<matrix_a, BlockM, 1, BlockN, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Buffers span the whole matrix; tiles are addressed by element offset
+        auto elementCount = Mapping::dataOffset(make_coord2d(m - 1u, n - 1u), ld) + 1u;
+        auto readBuffer   = buffer_resource<DataT>(in, elementCount);
+        auto writeBuffer  = buffer_resource<DataT>(out, elementCount);
+
+        // Map, load and store.
+        auto offset = Mapping::dataOffset(matrixCoord, ld);
+        load_matrix_sync(frag, readBuffer, offset, ld, validRows, validCols);
+        store_matrix_sync(writeBuffer, frag, offset, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferA(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferB(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix B (RowNT)
+        // <Dummy> -> BlockM
+        // BlockN -> BlockN
+        // BlockM -> BlockK
+        auto frag = fragment<matrix_b, 1, BlockN, BlockM, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Buffers span the whole matrix; tiles are addressed by element offset
+        auto elementCount = Mapping::dataOffset(make_coord2d(m - 1u, n - 1u), ld) + 1u;
+        auto readBuffer   = buffer_resource<DataT>(in, elementCount);
+        auto writeBuffer  = buffer_resource<DataT>(out, elementCount);
+
+        // Map, load and store.
+        auto offset = Mapping::dataOffset(matrixCoord, ld);
+        load_matrix_sync(frag, readBuffer, offset, ld, validRows, validCols);
+        store_matrix_sync(writeBuffer, frag, offset, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferB(uint32_t     m,
+                                               uint32_t     n,
+                                               DataT const* in,
+                                               DataT*       out,
+                                               uint32_t     ld,
+                                               DataT        param1,
+                                               DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferAcc(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Mapping:
+        // Incoming -> Matrix C (Row4T)
+        // BlockM -> BlockM
+        // BlockN -> BlockN
+        // <Dummy> -> BlockK
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+
+        // Edge tiles only cover the remaining rows / cols of the matrix
+        auto matrixCoord = Mapping::matrixCoord();
+        if(get<0>(matrixCoord) >= m || get<1>(matrixCoord) >= n)
+        {
+            return;
+        }
+
+        auto validRows = m - get<0>(matrixCoord);
+        auto validCols = n - get<1>(matrixCoord);
+
+        // Buffers span the whole matrix; tiles are addressed by element offset
+        auto elementCount = Mapping::dataOffset(make_coord2d(m - 1u, n - 1u), ld) + 1u;
+        auto readBuffer   = buffer_resource<DataT>(in, elementCount);
+        auto writeBuffer  = buffer_resource<DataT>(out, elementCount);
+
+        // Map, load and store.
+        auto offset = Mapping::dataOffset(matrixCoord, ld);
+        load_matrix_sync(frag, readBuffer, offset, ld, validRows, validCols);
+        store_matrix_sync(writeBuffer, frag, offset, ld, validRows, validCols);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void LoadStoreMatrixSyncBufferAcc(uint32_t     m,
+                                                 uint32_t     n,
+                                                 DataT const* in,
+                                                 DataT*       out,
+                                                 uint32_t     ld,
+                                                 DataT        param1,
+                                                 DataT        param2)
+    {
+    }
+
 } // namespace rocwmma
 
 #endif // ROCWMMA_DEVICE_LOAD_STORE_MATRIX_SYNC_HPP
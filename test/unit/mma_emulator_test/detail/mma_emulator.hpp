@@ -0,0 +1,335 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DETAIL_MMA_EMULATOR_TEST_HPP
+#define ROCWMMA_DETAIL_MMA_EMULATOR_TEST_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "device/mma_emulator.hpp"
+#include "unit_kernel_base.hpp"
+
+namespace rocwmma
+{
+
+    // Runs a single block MMA on the device and on the host emulator of the
+    // device arch with the same register files.
+    // Integer results must match exactly. Float results must agree within the
+    // rounding error bound of the block: the emulator models the dot product
+    // grouping of the instructions, which is not guaranteed to be bit-identical.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename InputT, typename ComputeT>
+    struct MmaEmulatorKernel final : public UnitKernelBase<BlockM, BlockN, ComputeT, col_major>
+    {
+    private:
+        using Base = UnitKernelBase<BlockM, BlockN, ComputeT, col_major>;
+
+        // Matrix core accumulation type
+        using AccumT
+            = std::conditional_t<std::is_same_v<ComputeT, float64_t>, float64_t, float32_t>;
+
+        constexpr static bool IsInteger = std::numeric_limits<ComputeT>::is_integer;
+
+        template <uint32_t ArchId>
+        constexpr static bool supported()
+        {
+            return mmaEmulatorTestSupported<InputT, ComputeT, BlockM, BlockN, BlockK, ArchId>();
+        }
+
+        uint32_t waveSize() const
+        {
+            return Base::DeviceInfo::instance()->warpSize();
+        }
+
+        uint32_t aRegCount() const
+        {
+            return BlockM * BlockK / waveSize();
+        }
+
+        uint32_t bRegCount() const
+        {
+            return BlockN * BlockK / waveSize();
+        }
+
+        uint32_t cRegCount() const
+        {
+            return BlockM * BlockN / waveSize();
+        }
+
+        static float64_t toDouble(ComputeT const& val)
+        {
+            if constexpr(std::is_same_v<ComputeT, float64_t>)
+            {
+                return val;
+            }
+            else
+            {
+                return static_cast<float64_t>(static_cast<float32_t>(val));
+            }
+        }
+
+        static ComputeT fromDouble(float64_t val)
+        {
+            if constexpr(std::is_same_v<ComputeT, float64_t>)
+            {
+                return val;
+            }
+            else
+            {
+                return static_cast<ComputeT>(static_cast<float32_t>(val));
+            }
+        }
+
+        // Runs the host emulator of the given arch on the register files in 'in'.
+        // Returns false if the arch has no instruction for this block.
+        template <uint32_t ArchId>
+        bool emulate(ComputeT const* in, ComputeT* out) const
+        {
+#if ROCWMMA_ARCH_HOST
+            if constexpr(supported<ArchId>())
+            {
+                auto aCount = waveSize() * aRegCount();
+                auto bCount = waveSize() * bRegCount();
+
+                // A / B values are exactly representable in InputT
+                auto regsA = std::vector<InputT>(aCount);
+                auto regsB = std::vector<InputT>(bCount);
+                for(uint32_t i = 0; i < aCount; i++)
+                {
+                    regsA[i] = static_cast<InputT>(in[i]);
+                }
+                for(uint32_t i = 0; i < bCount; i++)
+                {
+                    regsB[i] = static_cast<InputT>(in[aCount + i]);
+                }
+
+                auto regsC = in + aCount + bCount;
+
+                if constexpr(ArchId == Constants::AMDGCN_ARCH_ID_GFX1100
+                             || ArchId == Constants::AMDGCN_ARCH_ID_GFX1101
+                             || ArchId == Constants::AMDGCN_ARCH_ID_GFX1102)
+                {
+                    WmmaEmulator<InputT, ComputeT, BlockM, BlockN, BlockK>::exec(
+                        regsA.data(), regsB.data(), regsC, out);
+                }
+                else
+                {
+                    MfmaEmulator<InputT, ComputeT, BlockM, BlockN, BlockK, ArchId>::exec(
+                        regsA.data(), regsB.data(), regsC, out);
+                }
+                return true;
+            }
+#endif // ROCWMMA_ARCH_HOST
+            return false;
+        }
+
+        // Dispatches the emulator of the device arch
+        bool emulateDevice(ComputeT const* in, ComputeT* out) const
+        {
+            switch(Base::DeviceInfo::instance()->getGcnArch())
+            {
+            case Base::DeviceInfo::GFX908:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX908>(in, out);
+            case Base::DeviceInfo::GFX90A:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX90A>(in, out);
+            case Base::DeviceInfo::GFX940:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX940>(in, out);
+            case Base::DeviceInfo::GFX941:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX941>(in, out);
+            case Base::DeviceInfo::GFX942:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX942>(in, out);
+            case Base::DeviceInfo::GFX1100:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX1100>(in, out);
+            case Base::DeviceInfo::GFX1101:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX1101>(in, out);
+            case Base::DeviceInfo::GFX1102:
+                return emulate<Constants::AMDGCN_ARCH_ID_GFX1102>(in, out);
+            default:
+                return false;
+            }
+        }
+
+    public:
+        MmaEmulatorKernel()        = default;
+        ~MmaEmulatorKernel() final = default;
+
+        bool checkDevice() const final
+        {
+            switch(Base::DeviceInfo::instance()->getGcnArch())
+            {
+            case Base::DeviceInfo::GFX908:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX908>();
+            case Base::DeviceInfo::GFX90A:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX90A>();
+            case Base::DeviceInfo::GFX940:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX940>();
+            case Base::DeviceInfo::GFX941:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX941>();
+            case Base::DeviceInfo::GFX942:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX942>();
+            case Base::DeviceInfo::GFX1100:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX1100>();
+            case Base::DeviceInfo::GFX1101:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX1101>();
+            case Base::DeviceInfo::GFX1102:
+                return supported<Constants::AMDGCN_ARCH_ID_GFX1102>();
+            default:
+                return false;
+            }
+        }
+
+        void setupImpl(typename Base::DataStorage::ProblemSize const& probsize) final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            // Register files of A, B and C for a single wave
+            auto abElements = waveSize() * (aRegCount() + bRegCount());
+            auto inElements = abElements + waveSize() * cRegCount();
+            dataInstance->resizeStorage({inElements, 1});
+
+            // Random values exercise rounding and accumulation order.
+            // A / B are rounded to InputT, then stored exactly as ComputeT.
+            std::mt19937 gen(BlockM * BlockN * BlockK);
+
+            auto hostIn = dataInstance->hostIn().get();
+            if constexpr(IsInteger)
+            {
+                std::uniform_int_distribution<int32_t> distAB(-128, 127);
+                std::uniform_int_distribution<int32_t> distC(-(1 << 20), 1 << 20);
+                for(uint32_t i = 0; i < inElements; i++)
+                {
+                    hostIn[i] = static_cast<ComputeT>(i < abElements ? distAB(gen) : distC(gen));
+                }
+            }
+            else
+            {
+                std::uniform_real_distribution<float32_t> dist(-1.0f, 1.0f);
+                for(uint32_t i = 0; i < inElements; i++)
+                {
+                    hostIn[i] = i < abElements
+                                    ? static_cast<ComputeT>(static_cast<InputT>(dist(gen)))
+                                    : static_cast<ComputeT>(dist(gen));
+                }
+            }
+
+            dataInstance->copyData(dataInstance->deviceIn(), dataInstance->hostIn(), inElements);
+        }
+
+        void validateResultsImpl() final
+        {
+            auto& dataInstance = Base::DataStorage::instance();
+
+            auto inElements  = waveSize() * (aRegCount() + bRegCount() + cRegCount());
+            auto outElements = waveSize() * cRegCount();
+            dataInstance->copyData(dataInstance->hostOut(), dataInstance->deviceOut(), outElements);
+
+            auto hostIn    = dataInstance->hostIn().get();
+            auto hostOut   = dataInstance->hostOut().get();
+            auto reference = std::vector<ComputeT>(outElements);
+
+            if(!emulateDevice(hostIn, reference.data()))
+            {
+                Base::mValidationResult = false;
+                return;
+            }
+
+            if constexpr(IsInteger)
+            {
+                Base::mValidationResult = std::equal(
+                    reference.begin(), reference.end(), hostOut, hostOut + outElements);
+            }
+            else
+            {
+                // Sum of |a * b| + |c| per output, from the emulator on magnitudes
+                auto magnitudeIn = std::vector<ComputeT>(inElements);
+                auto magnitude   = std::vector<ComputeT>(outElements);
+                for(uint32_t i = 0; i < inElements; i++)
+                {
+                    magnitudeIn[i] = fromDouble(std::abs(toDouble(hostIn[i])));
+                }
+                emulateDevice(magnitudeIn.data(), magnitude.data());
+
+                // Each of the BlockK accumulation steps rounds at most once in AccumT,
+                // and once in ComputeT at the instruction boundary.
+                auto const eps
+                    = toDouble(std::numeric_limits<ComputeT>::epsilon())
+                      + static_cast<float64_t>(std::numeric_limits<AccumT>::epsilon());
+                auto const bound = static_cast<float64_t>(BlockK) * eps;
+
+                uint32_t mismatches = 0u;
+                for(uint32_t i = 0; i < outElements; i++)
+                {
+                    auto error = std::abs(toDouble(reference[i]) - toDouble(hostOut[i]));
+                    mismatches += (error > bound * toDouble(magnitude[i])) ? 1u : 0u;
+                }
+                Base::mValidationResult = (mismatches == 0u);
+            }
+        }
+
+        typename Base::KernelFunc kernelImpl() const final
+        {
+            return typename Base::KernelFunc(
+                mmaEmulatorTest<BlockM, BlockN, BlockK, InputT, ComputeT>);
+        }
+    };
+
+    // This is the GeneratorImpl class
+    struct MmaEmulatorGenerator
+    {
+        // Indices to test parameters
+        enum : uint32_t
+        {
+            InputT   = 0,
+            ComputeT = 1,
+            BlockMN  = 2,
+            BlockK   = 3
+        };
+
+        using ResultT = std::shared_ptr<KernelI>;
+
+        template <typename... Ts>
+        static ResultT generate(std::tuple<Ts...> testParams)
+        {
+            // Map GTest params to Kernel params
+            using TestParamsT = std::tuple<Ts...>;
+            using KernelT
+                = MmaEmulatorKernel<std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockM
+                                    std::tuple_element_t<BlockMN, TestParamsT>::value, // BlockN
+                                    std::tuple_element_t<BlockK, TestParamsT>::value, // BlockK
+                                    std::tuple_element_t<InputT, TestParamsT>, // InputT
+                                    std::tuple_element_t<ComputeT, TestParamsT> // ComputeT
+                                    >;
+
+            return std::make_shared<KernelT>();
+        }
+    };
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DETAIL_MMA_EMULATOR_TEST_HPP
@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef ROCWMMA_DEVICE_MMA_EMULATOR_TEST_HPP
+#define ROCWMMA_DEVICE_MMA_EMULATOR_TEST_HPP
+
+#include <rocwmma/internal/mfma.hpp>
+#include <rocwmma/internal/pack_util.hpp>
+#include <rocwmma/internal/wmma.hpp>
+#include <rocwmma/rocwmma.hpp>
+
+namespace rocwmma
+{
+    // Block MMA instructions available for InputT / ComputeT on the given target.
+    // The tested (InputT, ComputeT) pairs are all valid instruction pairs.
+    template <typename InputT,
+              typename ComputeT,
+              uint32_t BlockM,
+              uint32_t BlockN,
+              uint32_t BlockK,
+              uint32_t ArchId>
+    ROCWMMA_HOST_DEVICE constexpr inline bool mmaEmulatorTestSupported()
+    {
+        constexpr bool IsGfx9 = (ArchId == Constants::AMDGCN_ARCH_ID_GFX908)
+                                || (ArchId == Constants::AMDGCN_ARCH_ID_GFX90A)
+                                || (ArchId == Constants::AMDGCN_ARCH_ID_GFX940)
+                                || (ArchId == Constants::AMDGCN_ARCH_ID_GFX941)
+                                || (ArchId == Constants::AMDGCN_ARCH_ID_GFX942);
+
+        constexpr bool IsGfx11 = (ArchId == Constants::AMDGCN_ARCH_ID_GFX1100)
+                                 || (ArchId == Constants::AMDGCN_ARCH_ID_GFX1101)
+                                 || (ArchId == Constants::AMDGCN_ARCH_ID_GFX1102);
+
+        if constexpr(IsGfx9)
+        {
+            constexpr uint32_t KPerMfma
+                = detail::amdgcn_mfma_emulator_k<InputT, BlockM, ArchId>::KPerMfma;
+            return (BlockM == BlockN) && (KPerMfma > 0u) && (BlockK % KPerMfma == 0u);
+        }
+        else if constexpr(IsGfx11)
+        {
+            constexpr bool IsHalf =
+#if !ROCWMMA_NO_HALF
+                is_same_v<InputT, hfloat16_t> ||
+#endif // !ROCWMMA_NO_HALF
+                is_same_v<InputT, float16_t> || is_same_v<InputT, bfloat16_t>;
+
+            return (BlockM == 16u) && (BlockN == 16u) && (BlockK % 16u == 0u)
+                   && (IsHalf || is_same_v<InputT, int8_t>);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // Each lane of a single wave reads its unpacked A, B and C registers
+    // from the lane-major register files in 'in', runs the block MMA and
+    // writes its unpacked D registers to 'out'.
+    // in = [A regs | B regs | C regs], out = [D regs]
+    // A / B values are stored as ComputeT, and are exactly representable in InputT.
+    template <uint32_t BlockM, uint32_t BlockN, uint32_t BlockK, typename InputT, typename ComputeT>
+    ROCWMMA_KERNEL void mmaEmulatorTest(uint32_t        m,
+                                        uint32_t        n,
+                                        ComputeT const* in,
+                                        ComputeT*       out,
+                                        uint32_t        ld,
+                                        ComputeT        param1,
+                                        ComputeT        param2)
+    {
+        if constexpr(mmaEmulatorTestSupported<InputT,
+                                              ComputeT,
+                                              BlockM,
+                                              BlockN,
+                                              BlockK,
+                                              Constants::AMDGCN_CURRENT_ARCH_ID>())
+        {
+            using MMA       = conditional_t<(bool)ROCWMMA_ARCH_GFX9,
+                                      Mfma<InputT, ComputeT, BlockM, BlockN, BlockK>,
+                                      Wmma<InputT, ComputeT, BlockM, BlockN, BlockK>>;
+            using PackInput = PackUtil<InputT>;
+            using PackAccum = PackUtil<ComputeT>;
+
+            constexpr uint32_t WaveSize  = Constants::AMDGCN_WAVE_SIZE;
+            constexpr uint32_t ARegCount = BlockM * BlockK / WaveSize;
+            constexpr uint32_t BRegCount = BlockN * BlockK / WaveSize;
+            constexpr uint32_t CRegCount = BlockM * BlockN / WaveSize;
+
+            auto const lane = threadIdx.x % WaveSize;
+            auto const inA  = in;
+            auto const inB  = inA + WaveSize * ARegCount;
+            auto const inC  = inB + WaveSize * BRegCount;
+
+            VecT<InputT, ARegCount>   regsA;
+            VecT<InputT, BRegCount>   regsB;
+            VecT<ComputeT, CRegCount> regsC;
+
+#pragma unroll
+            for(uint32_t i = 0; i < ARegCount; i++)
+            {
+                regsA.data[i] = static_cast<InputT>(inA[lane * ARegCount + i]);
+            }
+#pragma unroll
+            for(uint32_t i = 0; i < BRegCount; i++)
+            {
+                regsB.data[i] = static_cast<InputT>(inB[lane * BRegCount + i]);
+            }
+#pragma unroll
+            for(uint32_t i = 0; i < CRegCount; i++)
+            {
+                regsC.data[i] = inC[lane * CRegCount + i];
+            }
+
+            auto regsD = PackAccum::unpack(
+                MMA::exec(PackInput::pack(regsA), PackInput::pack(regsB), PackAccum::pack(regsC)));
+
+#pragma unroll
+            for(uint32_t i = 0; i < CRegCount; i++)
+            {
+                out[lane * CRegCount + i] = regsD.data[i];
+            }
+        }
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_MMA_EMULATOR_TEST_HPP
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <type_traits>
+
+#include "detail/mma_emulator.hpp"
+#include "kernel_generator.hpp"
+#include "unit_test.hpp"
+
+namespace rocwmma
+{
+
+    struct TestParams : public UnitTestParams
+    {
+        using Base = UnitTestParams;
+
+        // (InputT, ComputeT) pairs with block MMA instructions.
+        // Unsupported pairs for the device arch are skipped in checkDevice().
+        using Types = std::tuple<std::tuple<float16_t, float16_t>,
+                                 std::tuple<float16_t, float32_t>,
+#if !ROCWMMA_TESTS_NO_HALF
+                                 std::tuple<hfloat16_t, hfloat16_t>,
+                                 std::tuple<hfloat16_t, float32_t>,
+#endif // !ROCWMMA_TESTS_NO_HALF
+                                 std::tuple<bfloat16_t, bfloat16_t>,
+                                 std::tuple<bfloat16_t, float32_t>,
+                                 std::tuple<float8_t, float32_t>,
+                                 std::tuple<bfloat8_t, float32_t>,
+                                 std::tuple<xfloat32_t, float32_t>,
+                                 std::tuple<int8_t, int32_t>,
+                                 std::tuple<float32_t, float32_t>,
+                                 std::tuple<float64_t, float64_t>>;
+
+        using BlockMNs = std::tuple<I<16>, I<32>>;
+        using BlockKs  = std::tuple<I<16>, I<32>, I<64>>;
+
+        using KernelParams = typename CombineLists<Types, BlockMNs, BlockKs>::Result;
+
+        // Assemble the kernel generator
+        using GeneratorImpl   = MmaEmulatorGenerator;
+        using KernelGenerator = KernelGenerator<KernelParams, GeneratorImpl>;
+
+        // Sanity check for kernel generator
+        static_assert(std::is_same<typename GeneratorImpl::ResultT, typename Base::KernelT>::value,
+                      "Kernels from this generator do not match testing interface");
+
+        static inline typename KernelGenerator::ResultT kernels()
+        {
+            return KernelGenerator::generate();
+        }
+
+        static inline std::vector<ThreadBlockT> threadBlocks()
+        {
+            auto warpSize = HipDevice::instance()->warpSize();
+            // clang-format off
+            return { {warpSize, 1} };
+            // clang-format on
+        }
+
+        static inline std::vector<ProblemSizeT> problemSizes()
+        {
+            // clang-format off
+            return { {16, 16}, {32, 32} };
+            // clang-format on
+        }
+    };
+
+} // namespace rocwmma
+
+// Test suite for unique parameterization
+class MmaEmulatorTest : public rocwmma::UnitTest
+{
+};
+
+TEST_P(MmaEmulatorTest, RunKernel)
+{
+    this->RunKernel();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    KernelTests,
+    MmaEmulatorTest,
+    ::testing::Combine(::testing::ValuesIn(rocwmma::TestParams::kernels()),
+                       ::testing::ValuesIn(rocwmma::TestParams::threadBlocks()),
+                       ::testing::ValuesIn(rocwmma::TestParams::problemSizes()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param1s()),
+                       ::testing::ValuesIn(rocwmma::TestParams::param2s())));
@@ -0,0 +1,238 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef ROCWMMA_DEVICE_REDUCE_HPP
+#define ROCWMMA_DEVICE_REDUCE_HPP
+
+#include "unit_test_traits.hpp"
+#include <rocwmma/internal/mapping_util.hpp>
+#include <rocwmma/rocwmma.hpp>
+#include <rocwmma/rocwmma_epilogue.hpp>
+#include <rocwmma/rocwmma_reduce.hpp>
+
+namespace rocwmma
+{
+    // Test reductions selected by param1
+    enum struct ReduceTestOp : uint32_t
+    {
+        Sum    = 0u,
+        Max    = 1u,
+        Min    = 2u,
+        ArgMax = 3u
+    };
+
+    // Test result forms selected by param2. ArgMax results are always vectors.
+    enum struct ReduceTestForm : uint32_t
+    {
+        Broadcast = 0u,
+        Vector    = 1u
+    };
+
+    template <typename DataT>
+    ROCWMMA_HOST_DEVICE inline uint32_t reduceTestParam(DataT param)
+    {
+        return static_cast<uint32_t>(static_cast<float32_t>(param));
+    }
+
+    // Writes a vector of row (or col) results to every element of the row (or col)
+    template <typename VectorT, bool IsRowVector>
+    struct VectorBroadcast
+    {
+        VectorT mVec;
+
+        template <typename DataT>
+        ROCWMMA_DEVICE inline DataT operator()(DataT value, uint32_t row, uint32_t col) const
+        {
+            return static_cast<DataT>(mVec.data[IsRowVector ? row : col]);
+        }
+    };
+
+    template <bool IsRowVector, typename VectorT>
+    ROCWMMA_DEVICE inline auto makeVectorBroadcast(VectorT const& vec)
+    {
+        return VectorBroadcast<VectorT, IsRowVector>{vec};
+    }
+
+    template <typename FragT, typename ReduceOp>
+    ROCWMMA_DEVICE inline void reduceRowsTest(FragT& frag, ReduceOp const& op, uint32_t form)
+    {
+        if(form == static_cast<uint32_t>(ReduceTestForm::Vector))
+        {
+            apply_epilogue(frag, makeVectorBroadcast<true>(reduce_rows_vector(frag, op)), 0u, 0u);
+        }
+        else
+        {
+            reduce_rows(frag, op);
+        }
+    }
+
+    template <typename FragT, typename ReduceOp>
+    ROCWMMA_DEVICE inline void reduceColsTest(FragT& frag, ReduceOp const& op, uint32_t form)
+    {
+        if(form == static_cast<uint32_t>(ReduceTestForm::Vector))
+        {
+            apply_epilogue(frag, makeVectorBroadcast<false>(reduce_cols_vector(frag, op)), 0u, 0u);
+        }
+        else
+        {
+            reduce_cols(frag, op);
+        }
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void reduceRows(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Load, reduce in registers and store
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+        load_matrix_sync(frag, Mapping::dataCoord(in, ld), ld);
+
+        auto form = reduceTestParam(param2);
+        switch(static_cast<ReduceTestOp>(reduceTestParam(param1)))
+        {
+        case ReduceTestOp::Sum:
+            reduceRowsTest(frag, reduction::sum(), form);
+            break;
+        case ReduceTestOp::Max:
+            reduceRowsTest(frag, reduction::max(), form);
+            break;
+        case ReduceTestOp::Min:
+            reduceRowsTest(frag, reduction::min(), form);
+            break;
+        case ReduceTestOp::ArgMax:
+            apply_epilogue(frag, makeVectorBroadcast<true>(argmax_rows(frag)), 0u, 0u);
+            break;
+        }
+
+        store_matrix_sync(Mapping::dataCoord(out, ld), frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void reduceRows(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  FragSize_guard<BlockM,
+                                 BlockN,
+                                 DataT,
+                                 DataLayout,
+                                 Constants::AMDGCN_WAVE_SIZE,
+                                 Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void reduceCols(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+        using Mapping = MappingUtil<BlockM, BlockN, DataT, DataLayout>;
+
+        // Load, reduce in registers and store
+        auto frag = fragment<accumulator, BlockM, BlockN, 1, DataT, DataLayout>();
+        load_matrix_sync(frag, Mapping::dataCoord(in, ld), ld);
+
+        auto form = reduceTestParam(param2);
+        switch(static_cast<ReduceTestOp>(reduceTestParam(param1)))
+        {
+        case ReduceTestOp::Sum:
+            reduceColsTest(frag, reduction::sum(), form);
+            break;
+        case ReduceTestOp::Max:
+            reduceColsTest(frag, reduction::max(), form);
+            break;
+        case ReduceTestOp::Min:
+            reduceColsTest(frag, reduction::min(), form);
+            break;
+        case ReduceTestOp::ArgMax:
+            apply_epilogue(frag, makeVectorBroadcast<false>(argmax_cols(frag)), 0u, 0u);
+            break;
+        }
+
+        store_matrix_sync(Mapping::dataCoord(out, ld), frag, ld);
+    }
+
+    template <uint32_t BlockM,
+              uint32_t BlockN,
+              typename DataT,
+              typename DataLayout,
+              typename std::enable_if_t<
+                  !FragSize_guard<BlockM,
+                                  BlockN,
+                                  DataT,
+                                  DataLayout,
+                                  Constants::AMDGCN_WAVE_SIZE,
+                                  Constants::AMDGCN_CURRENT_ARCH_ID>::enable()>* = nullptr>
+    __global__ void reduceCols(uint32_t     m,
+                               uint32_t     n,
+                               DataT const* in,
+                               DataT*       out,
+                               uint32_t     ld,
+                               DataT        param1,
+                               DataT        param2)
+    {
+    }
+
+} // namespace rocwmma
+
+#endif // ROCWMMA_DEVICE_REDUCE_HPP
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (C) 2021-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rocwmma/rocwmma_sparse.hpp>
+
+namespace rocwmma
+{
+    namespace
+    {
+        template <typename DataLayout>
+        uint64_t offset(uint32_t row, uint32_t col, uint32_t ld)
+        {
+            return std::is_same<DataLayout, row_major>::value ? uint64_t(row) * ld + col
+                                                              : uint64_t(col) * ld + row;
+        }
+
+        // Padded M x K matrix with every group holding mixed signs and magnitudes
+        template <typename DataLayout>
+        std::vector<float32_t> makeDense(uint32_t m, uint32_t k, uint32_t ld)
+        {
+            auto rowMajor = std::is_same<DataLayout, row_major>::value;
+
+            std::vector<float32_t> dense(uint64_t(ld) * (rowMajor ? m : k), -99.0f);
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < k; col++)
+                {
+                    dense[offset<DataLayout>(row, col, ld)]
+                        = static_cast<float32_t>(int32_t((row * 7u + col * 13u) % 17u) - 8);
+                }
+            }
+            return dense;
+        }
+
+        template <typename DataLayout>
+        void testRoundTrip(uint32_t m, uint32_t k)
+        {
+            auto rowMajor = std::is_same<DataLayout, row_major>::value;
+            auto ld       = (rowMajor ? k : m) + 3u;
+            auto ldv      = (rowMajor ? k / 2u : m) + 1u;
+            auto ldmeta   = k / 8u + 2u;
+
+            auto dense  = makeDense<DataLayout>(m, k, ld);
+            auto pruned = dense;
+            prune_2to4<DataLayout>(pruned.data(), m, k, ld);
+
+            // At most 2 non-zeros per group, and kept elements are unchanged
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < k; col += 4u)
+                {
+                    uint32_t nnz = 0u;
+                    for(uint32_t i = 0u; i < 4u; i++)
+                    {
+                        auto value = pruned[offset<DataLayout>(row, col + i, ld)];
+                        nnz += (value != 0.0f);
+                        EXPECT_TRUE(value == 0.0f
+                                    || value == dense[offset<DataLayout>(row, col + i, ld)]);
+                    }
+                    EXPECT_LE(nnz, 2u) << row << ", " << col;
+                }
+            }
+
+            // Compressing the dense or the pruned matrix is equivalent
+            auto valuesSize = uint64_t(ldv) * (rowMajor ? m : k / 2u);
+            std::vector<float32_t> values(valuesSize), prunedValues(valuesSize);
+            std::vector<uint8_t>   meta(uint64_t(ldmeta) * m), prunedMeta(uint64_t(ldmeta) * m);
+            compress_2to4<DataLayout>(
+                values.data(), meta.data(), dense.data(), m, k, ld, ldv, ldmeta);
+            compress_2to4<DataLayout>(
+                prunedValues.data(), prunedMeta.data(), pruned.data(), m, k, ld, ldv, ldmeta);
+
+            for(uint32_t row = 0u; row < m; row++)
+            {
+                for(uint32_t col = 0u; col < k / 2u; col++)
+                {
+                    EXPECT_EQ(values[offset<DataLayout>(row, col, ldv)],
+                              prunedValues[offset<DataLayout>(row, col, ldv)]);
+                }
+                for(uint32_t byte = 0u; byte < k / 8u; byte++)
+                {
+                    EXPECT_EQ(meta[row * ldmeta + byte], prunedMeta[row * ldmeta + byte]);
+                }
+            }
+
+            // Decompression restores the pruned matrix, leaving the padding untouched
+            auto result = makeDense<DataLayout>(m, k, ld);
+            decompress_2to4<DataLayout>(
+                result.data(), values.data(), meta.data(), m, k, ld, ldv, ldmeta);
+            EXPECT_EQ(result, pruned);
+        }
+    } // namespace
+
+    TEST(SparseTest, PruneKeepsLargestMagnitudes)
+    {
+        // Ties keep the first elements of the group
+        std::vector<float32_t> data = {1.0f, -4.0f, 3.0f, 2.0f, 0.0f, 0.0f, 5.0f, 0.0f,
+                                       2.0f, 2.0f, 2.0f, 2.0f, -1.0f, 1.0f, -1.0f, 1.0f};
+        prune_2to4<row_major>(data.data(), 2u, 8u, 8u);
+
+        EXPECT_EQ(data,
+                  (std::vector<float32_t>{0.0f, -4.0f, 3.0f, 0.0f, 0.0f, 0.0f, 5.0f, 0.0f,
+                                          2.0f, 2.0f, 0.0f, 0.0f, -1.0f, 1.0f, 0.0f, 0.0f}));
+    }
+
+    TEST(SparseTest, CompressFormat)
+    {
+        std::vector<float32_t> dense = {1.0f, -4.0f, 3.0f, 2.0f, 0.0f, 0.0f, 5.0f, 0.0f,
+                                        2.0f, 2.0f, 2.0f, 2.0f, -1.0f, 1.0f, -1.0f, 1.0f};
+        std::vector<float32_t> values(8u);
+        std::vector<uint8_t>   meta(2u);
+        compress_2to4<row_major>(values.data(), meta.data(), dense.data(), 2u, 8u, 8u, 4u, 1u);
+
+        EXPECT_EQ(values,
+                  (std::vector<float32_t>{-4.0f, 3.0f, 0.0f, 5.0f, 2.0f, 2.0f, -1.0f, 1.0f}));
+
+        // Positions (1, 2) and (0, 2), then (0, 1) twice. First group in the low nibble.
+        EXPECT_EQ(meta[0], 0x89u);
+        EXPECT_EQ(meta[1], 0x44u);
+    }
+
+    TEST(SparseTest, RoundTripRowMajor)
+    {
+        testRoundTrip<row_major>(16u, 64u);
+        testRoundTrip<row_major>(33u, 40u);
+    }
+
+    TEST(SparseTest, RoundTripColMajor)
+    {
+        testRoundTrip<col_major>(16u, 64u);
+        testRoundTrip<col_major>(33u, 40u);
+    }
+
+} // namespace rocwmma
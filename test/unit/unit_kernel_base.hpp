@@ -120,6 +120,9 @@ namespace rocwmma
         virtual dim3     gridDim() const;
         virtual dim3     blockDim() const;
 
+        // Lanes per wave of the execution backend
+        virtual uint32_t waveSize() const;
+
         // Kernel run checks.
         // True = run test
         // False = skip test
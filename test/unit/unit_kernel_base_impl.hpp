@@ -63,8 +63,7 @@ namespace rocwmma
     template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
     dim3 UnitKernelBase<BlockM, BlockN, DataT, Layout>::gridDim() const
     {
-        return dim3(ceilDiv(mM, BlockM * mTBlockX / DeviceInfo::instance()->warpSize()),
-                    ceilDiv(mN, BlockN * mTBlockY));
+        return dim3(ceilDiv(mM, BlockM * mTBlockX / waveSize()), ceilDiv(mN, BlockN * mTBlockY));
     }
 
     template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
@@ -73,6 +72,12 @@ namespace rocwmma
         return dim3(mTBlockX, mTBlockY);
     }
 
+    template <uint32_t BlockM, uint32_t BlockN, typename DataT, typename Layout>
+    uint32_t UnitKernelBase<BlockM, BlockN, DataT, Layout>::waveSize() const
+    {
+        return DeviceInfo::instance()->warpSize();
+    }
+
     // Kernel run checks. Virtual as different Test kernels have different requirements
     // True = run test
     // False = skip test
@@ -96,8 +101,7 @@ namespace rocwmma
         // gridDim() takes the upper bound of block coverage.
         // In case of uneven division, this might put us out of bounds.
         // Forfeit the run because there is no tail for cleanup of remainders.
-        auto tileSize = std::make_pair(BlockM * mTBlockX / DeviceInfo::instance()->warpSize(),
-                                       BlockN * mTBlockY);
+        auto tileSize = std::make_pair(BlockM * mTBlockX / waveSize(), BlockN * mTBlockY);
         auto gridDims = gridDim();
         return (gridDims.x * std::get<0>(tileSize) == mM)
                && (gridDims.y * std::get<1>(tileSize) == mN);
@@ -151,9 +155,9 @@ namespace rocwmma
     std::ostream& UnitKernelBase<BlockM, BlockN, DataT, Layout>::printKernel(
         std::ostream& stream /* = std::cout */) const
     {
-        stream << "w" << DeviceInfo::instance()->warpSize() << ", " << mTBlockX << ", " << mTBlockY
-               << ", " << BlockM << ", " << BlockN << ", " << mM << ", " << mN << ", " << mLd
-               << ", " << mParam1 << ", " << mParam2 << ", " << dataTypeToString<Layout>() << ", "
+        stream << "w" << waveSize() << ", " << mTBlockX << ", " << mTBlockY << ", " << BlockM
+               << ", " << BlockN << ", " << mM << ", " << mN << ", " << mLd << ", " << mParam1
+               << ", " << mParam2 << ", " << dataTypeToString<Layout>() << ", "
                << dataTypeToString<DataT>() << ", ";
 
         if(!mRunFlag)